@@ -2479,7 +2479,18 @@ outOfMemory:
 		decompilationRecord->reason = reason;
 		freeDecompilationRecord(currentThread, currentThread, decompilationRecord, FALSE);
 	} else {
+#if defined(J9VM_OPT_JFR)
+		J9OSRFrame *osrFrame = (J9OSRFrame*)(&decompilationRecord->osrBuffer + 1);
+		J9Method *osrMethod = osrFrame->method;
+		U_32 osrBytecodeIndex = (U_32)osrFrame->bytecodePCOffset;
+#endif /* defined(J9VM_OPT_JFR) */
 		fixStackForNewDecompilation(currentThread, &walkState, decompilationRecord, reason, &currentThread->decompilationStack);
+#if defined(J9VM_OPT_JFR)
+		/* Recording the event may release VM access, which is not safe while holding the global OSR buffer lock */
+		if (J9_ARE_NO_BITS_SET(reason, JITDECOMP_OSR_GLOBAL_BUFFER_USED)) {
+			vm->internalVMFunctions->jfrDeoptimization(currentThread, osrMethod, osrBytecodeIndex, metaData->jfrCompileID);
+		}
+#endif /* defined(J9VM_OPT_JFR) */
 	}
 }
 
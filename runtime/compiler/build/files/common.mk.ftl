@@ -371,6 +371,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/runtime/HWProfiler.cpp \
     compiler/runtime/HookHelpers.cpp \
     compiler/runtime/IProfiler.cpp \
+    compiler/runtime/IProfilerSnapshot.cpp \
     compiler/runtime/J9CodeCache.cpp \
     compiler/runtime/J9CodeCacheManager.cpp \
     compiler/runtime/J9CodeCacheMemorySegment.cpp \
@@ -420,6 +421,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/net/MessageBuffer.cpp \
     compiler/net/Message.cpp \
     compiler/net/MessageTypes.cpp \
+    compiler/net/ServerList.cpp \
     compiler/net/ServerStream.cpp \
     compiler/runtime/CompileService.cpp \
     compiler/runtime/JITClientSession.cpp \
@@ -427,6 +429,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/runtime/JITServerAOTDeserializer.cpp \
     compiler/runtime/JITServerIProfiler.cpp \
     compiler/runtime/JITServerProfileCache.cpp \
+    compiler/runtime/JITServerReadMostlyMonitor.cpp \
     compiler/runtime/JITServerROMClassHash.cpp \
     compiler/runtime/JITServerSharedROMClassCache.cpp \
     compiler/runtime/JITServerStatisticsThread.cpp \
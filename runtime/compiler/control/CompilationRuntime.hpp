@@ -133,6 +133,7 @@ public:
     void enqueueCompReqToLPQ(TR_MethodToBeCompiled *compReq);
     bool createLowPriorityCompReqAndQueueIt(TR::IlGeneratorMethodDetails &details, void *startPC, uint8_t reason);
     bool addFirstTimeCompReqToLPQ(J9Method *j9method, uint8_t reason);
+    bool addEagerAOTLoadReqToLPQ(J9Method *j9method);
     bool addUpgradeReqToLPQ(TR_MethodToBeCompiled *, uint8_t reason = TR_MethodToBeCompiled::REASON_UPGRADE);
     bool addUpgradeReqToLPQ(J9Method *j9method, void *startPC, uint8_t reason);
 
@@ -205,12 +206,14 @@ private:
     uint32_t _STAT_LPQcompFromIprofiler; // first time compilations coming from LPQ
     uint32_t _STAT_LPQcompFromInterpreter;
     uint32_t _STAT_LPQcompUpgrade;
+    uint32_t _STAT_LPQcompEagerAOTLoad;
 #if defined(J9VM_OPT_JITSERVER)
     uint32_t _STAT_compReqQueuedByJITServer;
     uint32_t _STAT_LPQcompServerUnavailable;
 #endif /* defined(J9VM_OPT_JITSERVER) */
     // stats written by application threads
     uint32_t _STAT_compReqQueuedByInterpreter;
+    uint32_t _STAT_compReqQueuedForEagerAOTLoad;
     uint32_t _STAT_numFailedToEnqueueInLPQ;
 }; // TR_LowPriorityCompQueue
 
@@ -800,6 +803,14 @@ public:
 
     TR_MethodToBeCompiled *getMethodQueue() { return _methodQueue; }
 
+    // Detach an entry from the main compilation queue; prev is its predecessor or NULL
+    void unlinkQueueEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry);
+    // Find the first ordinary, in-process request for method in the main compilation queue
+    TR_MethodToBeCompiled *findQueuedMethod(J9Method *method);
+    // Find the entry preceding entry in the main compilation queue (NULL if entry is the head)
+    // and optionally its position in the queue; this walks the queue
+    TR_MethodToBeCompiled *findQueuePredecessor(TR_MethodToBeCompiled *entry, int32_t *position = NULL);
+
     int32_t getOverallCompCpuUtilization() const
     {
         return _overallCompCpuUtilization;
@@ -1402,6 +1413,10 @@ public:
 
     void setLastCriticalSeqNo(uint32_t seqNo) { _lastCriticalCompReqSeqNo = seqNo; }
 
+    uint32_t getLastInvalidatingSeqNo() const { return _lastInvalidatingCompReqSeqNo; }
+
+    void setLastInvalidatingSeqNo(uint32_t seqNo) { _lastInvalidatingCompReqSeqNo = seqNo; }
+
     void markCHTableUpdateDone(int32_t threadId) { _chTableUpdateFlags |= (1 << threadId); }
 
     void resetCHTableUpdateDone(int32_t threadId) { _chTableUpdateFlags &= ~(1 << threadId); }
@@ -1539,6 +1554,14 @@ private:
      */
     TR_MethodToBeCompiled *getCompilationQueueEntry();
 
+    void updateQueueWaitStats(TR_MethodToBeCompiled *entry);
+
+    // Maintain _queuedMethodIndex as entries are linked into and out of _methodQueue
+    static bool isIndexedQueueEntry(TR_MethodToBeCompiled *entry);
+    void indexQueueEntry(TR_MethodToBeCompiled *entry);
+    void unindexQueueEntry(TR_MethodToBeCompiled *entry);
+    void printQueueWaitHistogram(const char *title, const uint32_t *histogram);
+
     J9Method *getRamMethod(TR_FrontEnd *vm, char *className, char *methodName, char *signature);
     // char *buildMethodString(TR_ResolvedMethod *method);
 
@@ -1553,6 +1576,15 @@ private:
     TR::CompilationInfoPerThread **_arrayOfCompilationInfoPerThread; // First NULL entry means end of the array
     TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
     TR_MethodToBeCompiled *_methodQueue;
+    TR_MethodToBeCompiled *_methodQueueTail; // last entry in _methodQueue; requests that go to the end
+                                             // of the queue are added without walking it
+#if !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED)
+    // Ordinary, in-process requests in _methodQueue keyed by J9Method, so that duplicate
+    // detection and promotions do not walk the queue. NULL if the index could not be
+    // allocated or was abandoned after an allocation failure; lookups then walk the queue
+    PersistentUnorderedMap<J9Method *, TR_MethodToBeCompiled *> *_queuedMethodIndex;
+    int32_t _numUnindexedQueuedMethods; // queued duplicates of an indexed method; lookups walk the queue while > 0
+#endif /* !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED) */
     TR_MethodToBeCompiled *_methodPool;
     int32_t _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -1625,6 +1657,11 @@ private:
     uint32_t _statNumDowngradeInterpretedMethod;
     uint32_t _statNumUpgradeJittedMethod;
     uint32_t _statNumQueuePromotions;
+    // log2 histograms of the time (ms) spent by requests in the main queue
+    // Only populated with -Xjit:verbose={compilePerformance}
+    static const int32_t QUEUE_WAIT_HISTOGRAM_SIZE = 16;
+    uint32_t _statQueueWaitHistogram[QUEUE_WAIT_HISTOGRAM_SIZE];
+    uint32_t _statSyncQueueWaitHistogram[QUEUE_WAIT_HISTOGRAM_SIZE];
     uint32_t _statNumGCRInducedCompilations;
     uint32_t _statNumSamplingJProfilingBodies;
     uint32_t _statNumJProfilingBodies;
@@ -1726,6 +1763,8 @@ private:
     uint32_t _compReqSeqNo; // seqNo for outgoing messages at the client
     uint32_t _lastCriticalCompReqSeqNo; // seqNo for last request that carried information that needs to be processed in
                                         // order
+    uint32_t _lastInvalidatingCompReqSeqNo; // seqNo for last request that carried information that invalidates data
+                                            // cached at the server (unloaded classes, CHTable removals, etc.)
     PersistentUnorderedMap<TR_OpaqueClassBlock *, uint8_t>
         *_newlyExtendedClasses; // JITServer table of newly extended classes
     uint8_t _chTableUpdateFlags;
@@ -110,6 +110,7 @@
 #include "net/ClientStream.hpp"
 #include "net/ServerStream.hpp"
 #include "net/CommunicationStream.hpp"
+#include "runtime/MetricsServer.hpp"
 #include "omrformatconsts.h"
 #endif /* defined(J9VM_OPT_JITSERVER) */
 #if defined(J9VM_OPT_CRIU_SUPPORT)
@@ -1177,6 +1178,13 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig)
     // Initialize the compilation monitor
     //
     _compilationMonitor = TR::Monitor::create("JIT-CompilationQueueMonitor");
+#if !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED)
+    // Without the index the queue is searched linearly, so a failure here is not fatal
+    _queuedMethodIndex = new (PERSISTENT_NEW) PersistentUnorderedMap<J9Method *, TR_MethodToBeCompiled *>(
+        PersistentUnorderedMap<J9Method *, TR_MethodToBeCompiled *>::allocator_type(
+            TR::Compiler->persistentAllocator()));
+    _numUnindexedQueuedMethods = 0;
+#endif /* !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED) */
     _schedulingMonitor = TR::Monitor::create("JIT-SchedulingMonitor");
 #if defined(J9VM_JIT_DYNAMIC_LOOP_TRANSFER)
     _dltMonitor = TR::Monitor::create("JIT-DLTmonitor");
@@ -1242,6 +1250,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig)
     _sequencingMonitor = TR::Monitor::create("JIT-SequencingMonitor");
     _classesCachedAtServerMonitor = TR::Monitor::create("JIT-ClassesCachedAtServerMonitor");
     _compReqSeqNo = 0;
+    _lastInvalidatingCompReqSeqNo = 0;
     _chTableUpdateFlags = 0;
     _localGCCounter = 0;
     _activationPolicy = JITServer::CompThreadActivationPolicy::AGGRESSIVE;
@@ -1550,7 +1559,7 @@ uint32_t TR::CompilationInfo::getMethodBytecodeSize(J9Method *method)
     if (auto stream = TR::CompilationInfo::getStream()) {
         {
             ClientSessionData *clientSessionData = TR::compInfoPT->getClientData();
-            OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+            JITServerReadSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
             auto it = clientSessionData->getJ9MethodMap().find(method);
             if (it != clientSessionData->getJ9MethodMap().end()) {
                 return getMethodBytecodeSize(it->second._romMethod);
@@ -1574,7 +1583,7 @@ bool TR::CompilationInfo::isJSR292(J9Method *j9method)
     if (auto stream = TR::CompilationInfo::getStream()) {
         {
             ClientSessionData *clientSessionData = TR::compInfoPT->getClientData();
-            OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+            JITServerReadSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
             auto it = clientSessionData->getJ9MethodMap().find(j9method);
             if (it != clientSessionData->getJ9MethodMap().end()) {
                 return isJSR292(it->second._romMethod);
@@ -1740,6 +1749,21 @@ bool TR_LowPriorityCompQueue::addFirstTimeCompReqToLPQ(J9Method *j9method, uint8
     return createLowPriorityCompReqAndQueueIt(details, NULL, reason);
 }
 
+//------------------------ addEagerAOTLoadReqToLPQ ---------------------
+// Queue the relocation of an AOT body ahead of the invocation count of its
+// method expiring. The caller has checked that the body exists in the SCC.
+// Needs compilation monitor in hand
+//-----------------------------------------------------------------------
+bool TR_LowPriorityCompQueue::addEagerAOTLoadReqToLPQ(J9Method *j9method)
+{
+    if (!addFirstTimeCompReqToLPQ(j9method, TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD))
+        return false;
+    // The request was just appended to the queue. Marking it as present in the SCC
+    // is what lets preCompilationTasks() turn it into an AOT load.
+    _lastLPQentry->_methodIsInSharedCache = TR_yes;
+    return true;
+}
+
 //------------------------ addUpgradeReqToLPQ ----------------------
 // This method is used when the JIT performs a low optimized compilation
 // and then schedules a low priority upgrade compilation for the same method
@@ -1990,10 +2014,7 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class *clazz, J9V
             }
 
             // detach from queue
-            if (prev)
-                prev->_next = cur->_next;
-            else
-                _methodQueue = cur->_next;
+            unlinkQueueEntry(prev, cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
@@ -2090,10 +2111,7 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
                     }
                 }
                 // detach from queue
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                unlinkQueueEntry(prev, cur);
                 updateCompQueueAccountingOnDequeue(cur);
                 // decrease the queue weight
                 decreaseQueueWeightBy(cur->_weight);
@@ -2427,7 +2445,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
 
     while (_methodQueue) {
         TR_MethodToBeCompiled *cur = _methodQueue;
-        _methodQueue = cur->_next;
+        unlinkQueueEntry(NULL, cur);
         updateCompQueueAccountingOnDequeue(cur);
         // decrease the queue weight
         decreaseQueueWeightBy(cur->_weight);
@@ -3203,6 +3221,11 @@ void TR::CompilationInfo::stopCompilationThreads()
 #endif
     } // if (printCompStats)
 
+    if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance)) {
+        printQueueWaitHistogram("Compilation queue wait time", _statQueueWaitHistogram);
+        printQueueWaitHistogram("Compilation queue wait time of sync requests", _statSyncQueueWaitHistogram);
+    }
+
     if (TR::Options::getAOTCmdLineOptions()->getOption(TR_EnableAOTRelocationTiming)) {
         fprintf(stderr, "Time spent relocating all AOT methods: %u ms\n", this->getAotRelocationTime() / 1000);
     }
@@ -4659,17 +4682,15 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         skipSearchingForDuplicates = true;
     }
 
-    if (skipSearchingForDuplicates) {
-        // In this case we only have to scan the synchronous requests in the queue
-        for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
-            // Stop the search when we finished with sync entries
-            if (cur->_priority < CP_SYNC_MIN) {
-                cur = NULL; // signal that we din't find the entry
-                break;
-            }
-            if (cur->getMethodDetails().sameAs(details, fe))
-                break;
-        }
+    // Ordinary methods are looked up in the queue index; the predecessor is only
+    // needed, and only searched for, if the request must be re-positioned
+    bool useQueueIndex = details.isOrdinaryMethod();
+    if (useQueueIndex) {
+        prev = NULL;
+        cur = findQueuedMethod(method);
+        // In this case only the synchronous requests in the queue are of interest
+        if (cur && skipSearchingForDuplicates && cur->_priority < CP_SYNC_MIN)
+            cur = NULL;
     } else // Scan the entire queue
     {
         for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
@@ -4700,6 +4721,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
 
         // If the priority has increased, use the new priority
         //
+        uint16_t oldPriority = cur->_priority;
         if (cur->_priority < priority)
             cur->_priority = priority;
         // If the optimization level is higher, just upgrade
@@ -4717,19 +4739,21 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         }
         // If the position in the queue is still correct, just return
         //
+        if (useQueueIndex && cur->_priority > oldPriority)
+            prev = findQueuePredecessor(cur);
         if (!prev || prev->_priority >= cur->_priority)
             return cur;
 
         // Must re-position in the queue
         //
-        prev->_next = cur->_next; // take it out of the queue
+        unlinkQueueEntry(prev, cur); // take it out of the queue
     }
 
     // If method is not yet in the queue prepare the queue entry
     //
     else {
-        // If we skipped searching, we cannot do the validation checks
-        if (!skipSearchingForDuplicates) {
+        // If we did not walk the queue, we cannot do the validation checks
+        if (!useQueueIndex) {
             if (queueWeight != _queueWeight) // QW
             {
                 if (TR::Options::isAnyVerboseOptionSet())
@@ -4944,21 +4968,195 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
     TR_ASSERT_FATAL(entry->_freeTag & ENTRY_INITIALIZED, "queuing an entry which is not initialized\n");
 
     entry->_freeTag |= ENTRY_QUEUED;
+    indexQueueEntry(entry);
 
     if (!_methodQueue || _methodQueue->_priority < entry->_priority) {
         entry->_next = _methodQueue;
         _methodQueue = entry;
+        if (!entry->_next)
+            _methodQueueTail = entry;
+    } else if (_methodQueueTail->_priority >= entry->_priority) {
+        // Common case during startup: a flood of requests with the same priority.
+        // The request goes at the end of the queue, so there is no need to walk it.
+        entry->_next = NULL;
+        _methodQueueTail->_next = entry;
+        _methodQueueTail = entry;
     } else {
         for (TR_MethodToBeCompiled *prev = _methodQueue;; prev = prev->_next) {
             if (!prev->_next || prev->_next->_priority < entry->_priority) {
                 entry->_next = prev->_next;
                 prev->_next = entry;
+                if (!entry->_next)
+                    _methodQueueTail = entry;
                 break;
             }
         }
     }
 }
 
+//--------------------------- unlinkQueueEntry ---------------------------
+// Detach the given entry from the compilation queue. 'prev' must be the
+// entry preceding it in the queue, or NULL if entry is the head of the
+// queue. Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::unlinkQueueEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry)
+{
+    TR_ASSERT(prev ? prev->_next == entry : _methodQueue == entry, "prev must be the predecessor of entry");
+    if (prev)
+        prev->_next = entry->_next;
+    else
+        _methodQueue = entry->_next;
+    if (_methodQueueTail == entry)
+        _methodQueueTail = prev;
+    unindexQueueEntry(entry);
+}
+
+//--------------------------- isIndexedQueueEntry ------------------------
+// Only ordinary methods compiled for this JVM are kept in the index; DLT,
+// JitDump and thunk requests, as well as JITServer requests that carry
+// client J9Method pointers, are always found by walking the queue
+//------------------------------------------------------------------------
+bool TR::CompilationInfo::isIndexedQueueEntry(TR_MethodToBeCompiled *entry)
+{
+    return entry->getMethodDetails().isOrdinaryMethod() && !entry->isOutOfProcessCompReq()
+        && entry->getMethodDetails().getMethod();
+}
+
+//--------------------------- indexQueueEntry ----------------------------
+// Record an entry being linked into the main compilation queue.
+// Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::indexQueueEntry(TR_MethodToBeCompiled *entry)
+{
+#if !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED)
+    if (!_queuedMethodIndex || !isIndexedQueueEntry(entry))
+        return;
+    try {
+        auto result = _queuedMethodIndex->insert({ entry->getMethodDetails().getMethod(), entry });
+        if (!result.second && result.first->second != entry)
+            _numUnindexedQueuedMethods++;
+    } catch (const std::bad_alloc &) {
+        // The index can no longer be trusted to be complete; fall back to walking the queue
+        _queuedMethodIndex->~PersistentUnorderedMap<J9Method *, TR_MethodToBeCompiled *>();
+        jitPersistentFree(_queuedMethodIndex);
+        _queuedMethodIndex = NULL;
+    }
+#endif /* !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED) */
+}
+
+//--------------------------- unindexQueueEntry --------------------------
+// Record an entry being unlinked from the main compilation queue. If the
+// index pointed to it and the queue holds another request for the same
+// method, the index is repointed to the first such request.
+// Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::unindexQueueEntry(TR_MethodToBeCompiled *entry)
+{
+#if !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED)
+    if (!_queuedMethodIndex || !isIndexedQueueEntry(entry))
+        return;
+    J9Method *method = entry->getMethodDetails().getMethod();
+    auto it = _queuedMethodIndex->find(method);
+    TR_ASSERT(it != _queuedMethodIndex->end(), "queued entry %p missing from the index", entry);
+    if (it == _queuedMethodIndex->end())
+        return;
+    if (it->second != entry) {
+        // entry was a duplicate that the index did not point to
+        _numUnindexedQueuedMethods--;
+        return;
+    }
+    if (_numUnindexedQueuedMethods > 0) {
+        for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next) {
+            if (cur != entry && isIndexedQueueEntry(cur) && cur->getMethodDetails().getMethod() == method) {
+                it->second = cur;
+                _numUnindexedQueuedMethods--;
+                return;
+            }
+        }
+    }
+    _queuedMethodIndex->erase(it);
+#endif /* !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED) */
+}
+
+//--------------------------- findQueuedMethod ---------------------------
+// Return the first ordinary, in-process request for the given method in
+// the main compilation queue, or NULL if there is none.
+// Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+TR_MethodToBeCompiled *TR::CompilationInfo::findQueuedMethod(J9Method *method)
+{
+#if !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED)
+    // With duplicates in the queue the index may not point to the first one
+    if (_queuedMethodIndex && _numUnindexedQueuedMethods == 0) {
+        auto it = _queuedMethodIndex->find(method);
+        return it != _queuedMethodIndex->end() ? it->second : NULL;
+    }
+#endif /* !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED) */
+    for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next) {
+        if (isIndexedQueueEntry(cur) && cur->getMethodDetails().getMethod() == method)
+            return cur;
+    }
+    return NULL;
+}
+
+//--------------------------- findQueuePredecessor -----------------------
+// Walk the main compilation queue to find the entry preceding the given
+// one. Only needed when a queued entry must be moved, which is rare
+// compared to lookups. Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+TR_MethodToBeCompiled *TR::CompilationInfo::findQueuePredecessor(TR_MethodToBeCompiled *entry, int32_t *position)
+{
+    int32_t i = 0;
+    TR_MethodToBeCompiled *prev = NULL;
+    for (TR_MethodToBeCompiled *cur = _methodQueue; cur && cur != entry; prev = cur, cur = cur->_next)
+        i++;
+    if (position)
+        *position = i;
+    return prev;
+}
+
+//------------------------ updateQueueWaitStats --------------------------
+// Record in a log2 histogram how long the entry waited in the queue
+// before a compilation thread picked it up. The entry time is only
+// recorded with -Xjit:verbose={compilePerformance}
+//------------------------------------------------------------------------
+void TR::CompilationInfo::updateQueueWaitStats(TR_MethodToBeCompiled *entry)
+{
+    if (!entry->_entryTime)
+        return;
+    PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+    uint64_t waitTimeMs = (j9time_usec_clock() - entry->_entryTime) / 1000;
+    int32_t bucket = 0;
+    while (waitTimeMs && bucket < QUEUE_WAIT_HISTOGRAM_SIZE - 1) {
+        waitTimeMs >>= 1;
+        bucket++;
+    }
+    _statQueueWaitHistogram[bucket]++;
+    if (entry->_priority >= CP_SYNC_MIN)
+        _statSyncQueueWaitHistogram[bucket]++;
+}
+
+void TR::CompilationInfo::printQueueWaitHistogram(const char *title, const uint32_t *histogram)
+{
+    uint32_t total = 0;
+    for (int32_t i = 0; i < QUEUE_WAIT_HISTOGRAM_SIZE; i++)
+        total += histogram[i];
+    if (!total)
+        return;
+    TR_VerboseLog::CriticalSection vlogLock;
+    TR_VerboseLog::writeLine(TR_Vlog_PERF, "%s (%u requests):", title, total);
+    for (int32_t i = 0; i < QUEUE_WAIT_HISTOGRAM_SIZE; i++) {
+        if (!histogram[i])
+            continue;
+        if (0 == i)
+            TR_VerboseLog::writeLine(TR_Vlog_PERF, "\t      < 1 ms: %8u", histogram[i]);
+        else if (i < QUEUE_WAIT_HISTOGRAM_SIZE - 1)
+            TR_VerboseLog::writeLine(TR_Vlog_PERF, "\t%5u-%5u ms: %8u", 1u << (i - 1), (1u << i) - 1, histogram[i]);
+        else
+            TR_VerboseLog::writeLine(TR_Vlog_PERF, "\t   >= %5u ms: %8u", 1u << (i - 1), histogram[i]);
+    }
+}
+
 //--------------------------------- requeue ----------------------------------
 // Put the request that is currently being compiled, back into the queue
 // and increment the number of queued methods
@@ -4995,10 +5193,14 @@ TR_MethodToBeCompiled *TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
     }
 
     // Search the queue for my method
-    TR_MethodToBeCompiled *cur, *prev;
-    for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
-        if (cur->getMethodDetails().sameAs(details, fe))
-            break;
+    TR_MethodToBeCompiled *cur, *prev = NULL;
+    if (details.isOrdinaryMethod()) {
+        cur = findQueuedMethod(details.getMethod());
+    } else {
+        for (cur = _methodQueue; cur; cur = cur->_next) {
+            if (cur->getMethodDetails().sameAs(details, fe))
+                break;
+        }
     }
     if (cur) {
         // here define the list of exclusions
@@ -5014,10 +5216,8 @@ TR_MethodToBeCompiled *TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
 
             if (cur->_priority < priority) {
                 // take the method out
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                prev = findQueuePredecessor(cur);
+                unlinkQueueEntry(prev, cur);
                 // put it back at its proper place
                 cur->_priority = priority;
                 queueEntry(cur);
@@ -5044,15 +5244,14 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method *method, void *p
         }
     }
 
-    int i = 0;
-    TR_MethodToBeCompiled *cur, *prev;
-    for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
-        if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-            break;
-        i++;
-    }
-
-    if (!cur || !prev || cur->_priority >= CP_ASYNC_MAX || prev->_priority >= CP_ASYNC_MAX)
+    // The position in the queue is only known if the queue had to be walked to find
+    // the predecessor; a request that is not queued or needs no promotion returns -1
+    TR_MethodToBeCompiled *cur = findQueuedMethod(method);
+    if (!cur || cur->_priority >= CP_ASYNC_MAX)
+        return -1;
+    int32_t i = 0;
+    TR_MethodToBeCompiled *prev = findQueuePredecessor(cur, &i);
+    if (!prev || prev->_priority >= CP_ASYNC_MAX)
         return -i;
     changeCompThreadPriority(J9THREAD_PRIORITY_MAX, 9);
     _statNumQueuePromotions++;
@@ -5061,22 +5260,10 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method *method, void *p
 #endif
     cur->_priority = CP_ASYNC_MAX;
 
-    // take the method out
-    prev->_next = cur->_next;
-    // find insertion point
-    if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-    {
-        cur->_next = _methodQueue;
-        _methodQueue = cur;
-        // FIXME: how about the compilation lag
-    } else {
-        for (prev = _methodQueue; prev->_next; prev = prev->_next)
-            if (prev->_next->_priority < CP_ASYNC_MAX) {
-                cur->_next = prev->_next;
-                prev->_next = cur;
-                break;
-            }
-    }
+    // take the method out and put it back at its proper place
+    // FIXME: how about the compilation lag
+    unlinkQueueEntry(prev, cur);
+    queueEntry(cur);
     return i;
 }
 
@@ -5100,17 +5287,16 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method *method)
         }
     }
     if (!cur) {
-        for (cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-            if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-                break;
+        cur = findQueuedMethod(method);
         // Check if this is an asynchronous request
         //
         if (cur && cur->_priority <= CP_ASYNC_MAX) {
             // Take the method out, increase its priority and insert it at the proper place
             //
             cur->_priority = CP_SYNC_NORMAL;
+            prev = findQueuePredecessor(cur);
             if (prev) {
-                prev->_next = cur->_next;
+                unlinkQueueEntry(prev, cur);
                 queueEntry(cur);
             } else // method already at the top of the queue
             {
@@ -5150,6 +5336,8 @@ TR_MethodToBeCompiled *TR::CompilationInfo::requestExistsInCompilationQueue(TR::
             return curCompThreadInfoPT->getMethodBeingCompiled();
     }
 
+    if (details.isOrdinaryMethod())
+        return findQueuedMethod(details.getMethod());
     for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next)
         if (cur->getMethodDetails().sameAs(details, fe))
             return cur;
@@ -5199,7 +5387,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
 
         if (_methodQueue) {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            unlinkQueueEntry(NULL, nextMethodToBeCompiled);
 
             // See explanation at the start of this function of why it is important to ensure this
             TR_ASSERT_FATAL(nextMethodToBeCompiled->getMethodDetails().isJitDumpMethod(),
@@ -5222,7 +5410,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
 #endif
             ) {
                 nextMethodToBeCompiled = _methodQueue;
-                _methodQueue = _methodQueue->_next;
+                unlinkQueueEntry(NULL, nextMethodToBeCompiled);
             }
             // Check if we need to throttle
             else if (exceedsCompCpuEntitlement() == TR_yes && !compThreadCameOutOfSleep
@@ -5241,7 +5429,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
                 _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
             {
                 nextMethodToBeCompiled = _methodQueue;
-                _methodQueue = _methodQueue->_next;
+                unlinkQueueEntry(NULL, nextMethodToBeCompiled);
             } else // scan for a cold/warm method
             {
                 TR_MethodToBeCompiled *prev = _methodQueue;
@@ -5251,7 +5439,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
                         nextMethodToBeCompiled->_priority >= CP_SYNC_MIN || // sync comp
                         nextMethodToBeCompiled->_methodIsInSharedCache == TR_yes) // very cheap relocation
                     {
-                        prev->_next = nextMethodToBeCompiled->_next;
+                        unlinkQueueEntry(prev, nextMethodToBeCompiled);
                         break;
                     }
                 }
@@ -5311,6 +5499,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
             if (nextMethodToBeCompiled) // A request has been dequeued
             {
                 updateCompQueueAccountingOnDequeue(nextMethodToBeCompiled);
+                updateQueueWaitStats(nextMethodToBeCompiled);
             }
         }
         // When no request is in the main queue we can look in the low priority queue
@@ -6085,7 +6274,7 @@ void *TR::CompilationInfo::compileOnSeparateThread(J9VMThread *vmThread, TR::IlG
             if (reqMe && reqMe->_priority < CP_ASYNC_ABOVE_NORMAL) {
                 reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
                 if (prevReq && prevReq->_priority < CP_ASYNC_ABOVE_NORMAL) {
-                    prevReq->_next = reqMe->_next;
+                    unlinkQueueEntry(prevReq, reqMe);
                     queueEntry(reqMe);
                 }
             }
@@ -6464,8 +6653,14 @@ TR_MethodMetaData *TR::CompilationInfoPerThreadBase::installAotCachedMethod(J9VM
         }
 
         ++_compInfo._statNumMethodsFromSharedCache;
+#if defined(J9VM_OPT_JITSERVER)
+        MetricsDatabase::recordAOTLoad(true);
+#endif /* defined(J9VM_OPT_JITSERVER) */
     } else // relocation failed
     {
+#if defined(J9VM_OPT_JITSERVER)
+        MetricsDatabase::recordAOTLoad(false);
+#endif /* defined(J9VM_OPT_JITSERVER) */
         if (entry) {
             entry->_compErrCode = returnCode;
             entry->setAotCodeToBeRelocated(NULL); // reset if relocation failed
@@ -8904,6 +9099,16 @@ TR_MethodMetaData *TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrar
                 }
             }
         }
+
+        // Remember the AOT bodies that had to be loaded during startup so that subsequent
+        // runs can relocate them eagerly, as soon as their class is initialized.
+        // Bodies that were themselves loaded eagerly are not recorded again.
+        if (metaData && that->_methodBeingCompiled->isAotLoad() && sc && TR::Options::_eagerAOTLoadsAtStartup
+            && that->_methodBeingCompiled->_reqFromSecondaryQueue != TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD
+            && TR::Compiler->vm.isVMInStartupPhase(jitConfig)) {
+            sc->addHint(that->_methodBeingCompiled->getMethodDetails().getMethod(),
+                TR_HintMethodCompiledDuringStartup);
+        }
     }
 #if defined(J9VM_OPT_JITSERVER)
     catch (const JITServer::StreamFailure &e) {
@@ -10162,6 +10367,9 @@ void TR::CompilationInfoPerThreadBase::logCompilationSuccess(J9VMThread *vmThrea
             TR::CompilationInfoPerThread *cipt = (TR::CompilationInfoPerThread *)this;
             cipt->setLastCompilationDuration(translationTime / 1000);
         }
+#if defined(J9VM_OPT_JITSERVER)
+        MetricsDatabase::recordCompilationTime(translationTime);
+#endif /* defined(J9VM_OPT_JITSERVER) */
 
         uintptr_t gcDataBytes = _jitConfig->lastGCDataAllocSize;
         uintptr_t atlasBytes = _jitConfig->lastExceptionTableAllocSize;
@@ -10491,6 +10699,10 @@ void TR::CompilationInfoPerThreadBase::logCompilationSuccess(J9VMThread *vmThrea
 #endif // ifdef TR_HOST_S390
         }
     }
+
+#if defined(J9VM_OPT_JFR)
+    emitJFRCompilationEvents(vmThread, compiler, method, metaData, NULL);
+#endif /* defined(J9VM_OPT_JFR) */
 }
 
 static void printCompFailureInfo(TR::Compilation *comp, const char *reason)
@@ -10820,8 +11032,69 @@ void TR::CompilationInfoPerThreadBase::processExceptionCommonTasks(J9VMThread *v
     } else {
         Trc_JIT_compilationFailed(vmThread, compiler->signature(), -1);
     }
+
+#if defined(J9VM_OPT_JFR)
+    emitJFRCompilationEvents(vmThread, compiler, entry->getMethodDetails().getMethod(), NULL,
+        (_methodBeingCompiled->_compErrCode == compilationFailure)
+            ? exceptionName
+            : compilationErrorNames[_methodBeingCompiled->_compErrCode]);
+#endif /* defined(J9VM_OPT_JFR) */
 }
 
+#if defined(J9VM_OPT_JFR)
+/**
+ * Report the end of a compilation to an active JFR recording as a jdk.Compilation event,
+ * followed by a jdk.CompilationFailure event when failureMessage is not NULL. Any pending
+ * code cache full event is written first.
+ */
+void TR::CompilationInfoPerThreadBase::emitJFRCompilationEvents(J9VMThread *vmThread, TR::Compilation *compiler,
+    J9Method *method, TR_MethodMetaData *metaData, const char *failureMessage)
+{
+    static volatile uintptr_t jfrCompileID = 0;
+    J9JavaVM *javaVM = _jitConfig->javaVM;
+    J9InternalVMFunctions *vmFuncs = javaVM->internalVMFunctions;
+
+    if (!vmFuncs->isJFRRecordingStarted(javaVM) || (NULL == method))
+        return;
+
+    TR::CodeCacheManager::instance()->reportCodeCacheFullToJFR(vmThread);
+
+#if defined(J9VM_OPT_JITSERVER)
+    // On a JITServer server the method belongs to the client; the client records its own event
+    if (_methodBeingCompiled->isOutOfProcessCompReq())
+        return;
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
+    PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+    const I_64 duration = (I_64)(j9time_usec_clock() - getTimeWhenCompStarted()) * 1000;
+    const U_32 compileID = (U_32)VM_AtomicSupport::add(&jfrCompileID, 1);
+    const bool succeeded = (NULL == failureMessage);
+    const bool isAOTLoad = _methodBeingCompiled->isAotLoad();
+    bool isRemote = false;
+#if defined(J9VM_OPT_JITSERVER)
+    isRemote = _methodBeingCompiled->isRemoteCompReq();
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
+    U_32 codeSize = 0;
+    U_32 inlinedBytes = 0;
+    if (succeeded && (NULL != metaData)) {
+        // Lets jdk.Deoptimization events refer back to this compilation
+        metaData->jfrCompileID = compileID;
+        codeSize = (U_32)(metaData->endPC - metaData->startPC);
+        if (!isAOTLoad) {
+            inlinedBytes = computeTotalBytecodeSize(compiler) - compiler->getMethodBeingCompiled()->maxBytecodeIndex();
+        }
+    }
+
+    vmFuncs->jfrCompilation(vmThread, method, compileID, (U_32)compiler->getMethodHotness(), duration,
+        succeeded ? TRUE : FALSE, compiler->isDLT() ? TRUE : FALSE, codeSize, inlinedBytes, isRemote ? TRUE : FALSE,
+        isAOTLoad ? TRUE : FALSE);
+
+    if (!succeeded)
+        vmFuncs->jfrCompilationFailure(vmThread, compileID, failureMessage);
+}
+#endif /* defined(J9VM_OPT_JFR) */
+
 uint32_t TR::CompilationInfoPerThreadBase::computeTotalBytecodeSize(TR::Compilation *compiler)
 {
     TR_ResolvedMethod *method = compiler->getMethodBeingCompiled();
@@ -11318,6 +11591,7 @@ TR_LowPriorityCompQueue::TR_LowPriorityCompQueue()
     , _STAT_LPQcompFromIprofiler(0)
     , _STAT_LPQcompFromInterpreter(0)
     , _STAT_LPQcompUpgrade(0)
+    , _STAT_LPQcompEagerAOTLoad(0)
     ,
 #if defined(J9VM_OPT_JITSERVER)
     _STAT_compReqQueuedByJITServer(0)
@@ -11325,6 +11599,7 @@ TR_LowPriorityCompQueue::TR_LowPriorityCompQueue()
     ,
 #endif /* defined(J9VM_OPT_JITSERVER) */
     _STAT_compReqQueuedByInterpreter(0)
+    , _STAT_compReqQueuedForEagerAOTLoad(0)
     , _STAT_numFailedToEnqueueInLPQ(0)
 {}
 
@@ -11561,6 +11836,9 @@ void TR_LowPriorityCompQueue::incStatsCompFromLPQ(uint8_t reason)
         case TR_MethodToBeCompiled::REASON_UPGRADE:
             _STAT_LPQcompUpgrade++;
             break;
+        case TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD:
+            _STAT_LPQcompEagerAOTLoad++;
+            break;
 #if defined(J9VM_OPT_JITSERVER)
         case TR_MethodToBeCompiled::REASON_SERVER_UNAVAILABLE:
             _STAT_LPQcompServerUnavailable++;
@@ -11583,6 +11861,9 @@ void TR_LowPriorityCompQueue::incStatsReqQueuedToLPQ(uint8_t reason)
         case TR_MethodToBeCompiled::REASON_UPGRADE:
             _STAT_compReqQueuedByJIT++;
             break;
+        case TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD:
+            _STAT_compReqQueuedForEagerAOTLoad++;
+            break;
 #if defined(J9VM_OPT_JITSERVER)
         case TR_MethodToBeCompiled::REASON_SERVER_UNAVAILABLE:
             _STAT_compReqQueuedByJITServer++;
@@ -11614,6 +11895,8 @@ void TR_LowPriorityCompQueue::printStats() const
         _STAT_LPQcompFromIprofiler + _STAT_LPQcompFromInterpreter + _STAT_LPQcompUpgrade, _STAT_LPQcompFromIprofiler,
         _STAT_LPQcompFromInterpreter, _STAT_LPQcompUpgrade);
 #endif /* defined(J9VM_OPT_JITSERVER) */
+    fprintf(stderr, "   Eager AOT loads  = %4u (queued=%u)\n", _STAT_LPQcompEagerAOTLoad,
+        _STAT_compReqQueuedForEagerAOTLoad);
     fprintf(stderr, "   Conflicts        = %4u (tried to cache j9method that didn't have space)\n", _STAT_conflict);
     fprintf(stderr, "   Stale entries    = %4u\n", _STAT_staleScrubbed); // we want very few of these, hopefully 0
     fprintf(stderr, "   Bypass ocurrences= %4u (normal comp req hapened before the fast LPQ comp req)\n", _STAT_bypass);
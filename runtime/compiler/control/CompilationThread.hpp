@@ -460,6 +460,11 @@ private:
 
     uint32_t computeTotalBytecodeSize(TR::Compilation *compiler);
 
+#if defined(J9VM_OPT_JFR)
+    void emitJFRCompilationEvents(J9VMThread *vmThread, TR::Compilation *compiler, J9Method *method,
+        TR_MethodMetaData *metaData, const char *failureMessage);
+#endif /* defined(J9VM_OPT_JFR) */
+
 #if defined(TR_HOST_S390)
     void outputVerboseMMapEntry(TR_ResolvedMethod *compilee, const struct ::tm &date, const struct timeval &time,
         void *startPC, void *endPC, const char *fmt, const char *profiledString, const char *compileString);
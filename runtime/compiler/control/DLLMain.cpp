@@ -695,11 +695,11 @@ _abort:
                             if (listener) {
                                 listener->stop();
                             }
-                            MetricsServer *metricsServer
-                                = ((TR_JitPrivateConfig *)(vm->jitConfig->privateConfig))->metricsServer;
-                            if (metricsServer) {
-                                metricsServer->stop();
-                            }
+                        }
+                        MetricsServer *metricsServer
+                            = ((TR_JitPrivateConfig *)(vm->jitConfig->privateConfig))->metricsServer;
+                        if (metricsServer) {
+                            metricsServer->stop();
                         }
 
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -1556,6 +1556,12 @@ static void jitHookGlobalGCStart(J9HookInterface **hookInterface, UDATA eventNum
 
     if (jitConfig && jitConfig->runtimeFlags & J9JIT_GC_NOTIFY)
         printf("\n{GGC");
+#if defined(J9VM_OPT_JITSERVER)
+    if (MetricsDatabase::get()) {
+        PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+        MetricsDatabase::recordGCStart(vmThread->javaVM, j9time_usec_clock());
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
     jitReclaimMarkedAssumptions(false);
 }
 
@@ -1579,6 +1585,12 @@ static void jitHookLocalGCStart(J9HookInterface **hookInterface, UDATA eventNum,
         printf("\n<jit: enabling stack tracing at gc %" OMR_PRIuPTR ">", jitConfig->gcCount);
         TR::Options::getCmdLineOptions()->setVerboseOption(TR_VerboseGc);
     }
+#if defined(J9VM_OPT_JITSERVER)
+    if (MetricsDatabase::get()) {
+        PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+        MetricsDatabase::recordGCStart(vmThread->javaVM, j9time_usec_clock());
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
     jitReclaimMarkedAssumptions(false);
 }
 
@@ -1599,6 +1611,12 @@ static void jitHookGlobalGCEnd(J9HookInterface **hookInterface, UDATA eventNum,
     getOutOfIdleStatesUnlocked(TR::CompilationInfo::SAMPLER_DEEPIDLE, compInfo, "GC");
 
     TR::CodeCacheManager::instance()->synchronizeTrampolines();
+#if defined(J9VM_OPT_JITSERVER)
+    if (MetricsDatabase::get()) {
+        PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+        MetricsDatabase::recordGCEnd(j9time_usec_clock());
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
     if (jitConfig->runtimeFlags & J9JIT_GC_NOTIFY)
         printf("}");
 }
@@ -1615,6 +1633,12 @@ static void jitHookLocalGCEnd(J9HookInterface **hookInterface, UDATA eventNum, v
     if (jitConfig == 0)
         return; // if a hook gets called after freeJitConfig then not much else we can do
 
+#if defined(J9VM_OPT_JITSERVER)
+    if (MetricsDatabase::get()) {
+        PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+        MetricsDatabase::recordGCEnd(j9time_usec_clock());
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
     if (jitConfig->runtimeFlags & J9JIT_GC_NOTIFY)
         printf("}");
 }
@@ -3866,6 +3890,72 @@ static void jitHookClassPreinitialize(J9HookInterface **hookInterface, UDATA eve
     jitHookClassPreinitializeHelper(vmThread, jitConfig, cl, &(classPreinitializeEvent->failed));
 }
 
+/// With -Xjit:eagerAOTLoadsAtStartup, queue low priority AOT loads for the methods of a class
+/// that was just initialized, if their AOT bodies had to be loaded during startup in previous runs
+/// (these methods carry the TR_HintMethodCompiledDuringStartup hint). The compilation threads
+/// relocate such bodies when there is nothing else to compile, instead of waiting for the
+/// invocation counts of the methods to expire and competing with regular compilations.
+///
+static void queueEagerAOTLoads(J9VMThread *vmThread, J9JITConfig *jitConfig, TR::CompilationInfo *compInfo,
+    J9Class *cl)
+{
+#if defined(J9VM_INTERP_AOT_RUNTIME_SUPPORT) && defined(J9VM_OPT_SHARED_CLASSES)                        \
+    && (defined(TR_HOST_X86) || defined(TR_HOST_POWER) || defined(TR_HOST_S390) || defined(TR_HOST_ARM) \
+        || defined(TR_HOST_ARM64))
+    if (jitConfig->javaVM->phase == J9VM_PHASE_NOT_STARTUP || !TR::Options::sharedClassCache()
+        || TR::Options::getAOTCmdLineOptions()->getOption(TR_NoLoadAOT)
+        || !(TR_HintMethodCompiledDuringStartup & TR::Options::getAOTCmdLineOptions()->getEnableSCHintFlags()))
+        return;
+
+    // The AOT dependency table already lowers the counts of methods to 0 as soon as
+    // the dependencies of their AOT bodies are satisfied
+    if (compInfo->getPersistentInfo()->getAOTDependencyTable())
+        return;
+
+    TR_J9VMBase *fej9 = TR_J9VMBase::get(jitConfig, vmThread, TR_J9VMBase::AOT_VM);
+    TR_J9SharedCache *sc = fej9 ? fej9->sharedCache() : NULL;
+    if (!sc || !sc->isClassInSharedCache(cl))
+        return;
+
+    uint32_t numQueued = 0;
+    uint32_t numMethods = cl->romClass->romMethodCount;
+    for (uint32_t i = 0; i < numMethods; i++) {
+        J9Method *method = cl->ramMethods + i;
+        J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+        if (romMethod->modifiers & (J9AccNative | J9AccAbstract))
+            continue;
+
+        // A count of 0 means that a compilation request will be issued anyway
+        if (TR::CompilationInfo::getInvocationCount(method) <= 0)
+            continue;
+
+        if (!sc->isHint(method, TR_HintMethodCompiledDuringStartup)
+            || !jitConfig->javaVM->sharedClassConfig->existsCachedCodeForROMMethod(vmThread, romMethod))
+            continue;
+
+        compInfo->acquireCompMonitor(vmThread);
+        if (compInfo->getLowPriorityCompQueue().addEagerAOTLoadReqToLPQ(method))
+            numQueued++;
+        else
+            compInfo->getLowPriorityCompQueue().incNumFailuresToEnqueue();
+        compInfo->releaseCompMonitor(vmThread);
+    }
+
+    if (numQueued > 0) {
+        if (TR::Options::getVerboseOption(TR_VerboseHooks))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_HK, "Queued %u eager AOT loads for methods of class=%p", numQueued,
+                cl);
+
+        // Wake up a sleeping compilation thread if the LPQ can be served now;
+        // suspended compilation threads are not activated for these requests
+        compInfo->acquireCompMonitor(vmThread);
+        if (compInfo->getNumCompThreadsJobless() > 0 && compInfo->canProcessLowPriorityRequest())
+            compInfo->getCompilationMonitor()->notifyAll();
+        compInfo->releaseCompMonitor(vmThread);
+    }
+#endif
+}
+
 static void jitHookClassInitialize(J9HookInterface **hookInterface, UDATA eventNum, void *eventData, void *userData)
 {
     J9VMClassInitializeEvent *classInitializeEvent = (J9VMClassInitializeEvent *)eventData;
@@ -3880,6 +3970,9 @@ static void jitHookClassInitialize(J9HookInterface **hookInterface, UDATA eventN
     if (auto dependencyTable = compInfo->getPersistentInfo()->getAOTDependencyTable())
         dependencyTable->classLoadEvent((TR_OpaqueClassBlock *)cl, false, true);
 
+    if (TR::Options::_eagerAOTLoadsAtStartup)
+        queueEagerAOTLoads(vmThread, jitConfig, compInfo, cl);
+
     loadingClasses = false;
 }
 
@@ -4142,13 +4235,19 @@ void JitShutdown(J9JITConfig *jitConfig)
                 iProfiler->dumpAllBytecodeProfilingData(vmThread);
         }
 
-        printIprofilerStats(options, jitConfig, iProfiler, "Shutdown");
         // Prevent the interpreter to accumulate more info
         // stopInterpreterProfiling is stronger than turnOff... because it prevents the reactivation
         // by setting TR_DisableInterpreterProfiling option to false
         stopInterpreterProfiling(jitConfig);
         if (!options->getOption(TR_DisableIProfilerThread))
             iProfiler->stopIProfilerThread();
+#if defined(J9VM_OPT_JITSERVER)
+        if (compInfo->getPersistentInfo()->getRemoteCompilationMode() != JITServer::SERVER)
+#endif
+        {
+            iProfiler->writeSnapshot(vmThread);
+        }
+        printIprofilerStats(options, jitConfig, iProfiler, "Shutdown");
 #ifdef DEBUG
         uint32_t unexpectedLockedEntries = 0;
         iProfiler->releaseAllEntries(unexpectedLockedEntries);
@@ -7766,6 +7865,11 @@ void printIprofilerStats(TR::Options *options, J9JITConfig *jitConfig, TR_IProfi
             j9tty_printf(PORTLIB, "Total records read: %d\n", TR_IProfiler::_STATS_IPEntryRead);
             j9tty_printf(PORTLIB, "Total records choose persistent: %d\n",
                 TR_IProfiler::_STATS_IPEntryChoosePersistent);
+            j9tty_printf(PORTLIB, "Snapshot methods loaded:        %d\n", TR_IProfiler::_STATS_snapshotMethodsLoaded);
+            j9tty_printf(PORTLIB, "Snapshot records loaded:        %d\n", TR_IProfiler::_STATS_snapshotEntriesLoaded);
+            j9tty_printf(PORTLIB, "Snapshot methods stale:         %d\n", TR_IProfiler::_STATS_snapshotMethodsStale);
+            j9tty_printf(PORTLIB, "Snapshot methods written:       %d\n", TR_IProfiler::_STATS_snapshotMethodsWritten);
+            j9tty_printf(PORTLIB, "Snapshot records written:       %d\n", TR_IProfiler::_STATS_snapshotEntriesWritten);
         }
         if (TR_IProfiler::_STATS_abortedPersistence > 0) {
             TR_ASSERT(TR_IProfiler::_STATS_methodPersisted / TR_IProfiler::_STATS_abortedPersistence > 20
@@ -151,6 +151,8 @@ int32_t J9::Options::_veryHighActiveThreadThreshold = -1;
 int32_t J9::Options::_aotCachePersistenceMinDeltaMethods = 200;
 int32_t J9::Options::_aotCachePersistenceMinPeriodMs = 10000; // ms
 int32_t J9::Options::_jitserverMallocTrimInterval = 1000 * 30; // 30000ms = 30s
+int32_t J9::Options::_jitserverMessageCompressionThreshold = 0; // bytes; 0 disables message compression at the client
+int32_t J9::Options::_jitserverServerSwitchInterval = 10000; // ms
 int32_t J9::Options::_lowCompDensityModeEnterThreshold
     = 4; // Maximum number of compilations per 10 min of CPU required to enter low compilation density mode. Use 0 to
          // disable feature
@@ -196,9 +198,9 @@ int32_t J9::Options::_iProfilerMemoryConsumptionLimit = 32 * 1024 * 1024;
 #else
 int32_t J9::Options::_iProfilerMemoryConsumptionLimit = 18 * 1024 * 1024;
 #endif
-int32_t J9::Options::_iProfilerBcHashTableSize
-    = 131049; // prime number; Note: 131049 * 8 fits in 1 segment of persistent memory
-int32_t J9::Options::_iProfilerMethodHashTableSize = 32707; // 32707 could be another good value for larger apps
+// Initial sizes of the IProfiler hashtables; they are rounded up to a power of 2 and grow as needed
+int32_t J9::Options::_iProfilerBcHashTableSize = 131072;
+int32_t J9::Options::_iProfilerMethodHashTableSize = 32768;
 
 int32_t J9::Options::_IprofilerOffSubtractionFactor = 500;
 int32_t J9::Options::_IprofilerOffDivisionFactor = 16;
@@ -338,6 +340,8 @@ bool J9::Options::_aggressiveLockReservation = false;
 
 bool J9::Options::_xrsSync = false;
 
+bool J9::Options::_eagerAOTLoadsAtStartup = false;
+
 int32_t J9::Options::_jvmStarvationThreshold = 40; // 40% CPU utilization. Use 10 (or lower) to disable the feature
 int32_t J9::Options::_cpuStatsPrintInterval = 1000; // Write CPU stats to JIT verbose log every second
 
@@ -995,6 +999,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
      (intptr_t)&TR::Options::_disableIProfilerClassUnloadThreshold, 0, "F%d", NOT_IN_SUBSET },
     { "dltPostponeThreshold=", "M<nnn>\tNumber of dlt attempts inv. count for a method is seen not advancing",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_dltPostponeThreshold, 0, "F%d", NOT_IN_SUBSET },
+    { "eagerAOTLoadsAtStartup",
+     "M\tduring startup, queue low priority relocations for the AOT bodies loaded during startup in previous runs "
+        "as soon as their class is initialized",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_eagerAOTLoadsAtStartup, 1, "F%d", NOT_IN_SUBSET },
     { "exclude=", "D<xxx>\tdo not compile methods beginning with xxx", TR::Options::limitOption, 1, 0, "P%s" },
     { "excludeAndDontInline=", "D<xxx>\tdo not compile or inline methods beginning with xxx",
      TR::Options::excludeAndDontInlineOption, 1, 0, "P%s" },
@@ -1094,7 +1102,7 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "invocationThresholdToTriggerLowPriComp=",
      "M<nnn>\tNumber of times a loopy method must be invoked to be eligible for LPQ", TR::Options::setStaticNumeric,
      (intptr_t)&TR::Options::_invocationThresholdToTriggerLowPriComp, 0, "F%d", NOT_IN_SUBSET },
-    { "iprofilerBcHashTableSize=", "M<nnn>\tSize of the backbone for the IProfiler bytecode hash table",
+    { "iprofilerBcHashTableSize=", "M<nnn>\tInitial size of the IProfiler bytecode hash table",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerBcHashTableSize, 0, "F%d", NOT_IN_SUBSET },
     { "iprofilerBufferInterarrivalTimeToExitDeepIdle=",
      "M<nnn>\tIn ms. If 4 IP buffers arrive back-to-back more frequently than this value, JIT exits DEEP_IDLE", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle, 0, "F%d",
@@ -1122,7 +1130,7 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "iprofilerMemoryConsumptionLimit=", "O<nnn>\tlimit on memory consumption for interpreter profiling data",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerMemoryConsumptionLimit, 0, "P%d",
      NOT_IN_SUBSET },
-    { "iprofilerMethodHashTableSize=", "M<nnn>\tSize of the backbone for the IProfiler method (fanin) hash table",
+    { "iprofilerMethodHashTableSize=", "M<nnn>\tInitial size of the IProfiler method (fanin) hash table",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerMethodHashTableSize, 0, "F%d", NOT_IN_SUBSET },
     { "iprofilerNumOutstandingBuffers=",
      "O<nnn>\tnumber of outstanding interpreter profiling buffers "
@@ -1141,6 +1149,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         "needs to be taken after the profiling starts going off to completely turn it off. "
         "Specify a very large value to disable this optimization", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerSamplesBeforeTurningOff, 0, "P%d",
      NOT_IN_SUBSET },
+    { "iprofilerSnapshotFile=",
+     "I<filename>\tload interpreter profiling data from filename and write it back at shutdown and checkpoint",
+     TR::Options::setStringForPrivateBase, offsetof(TR_JitPrivateConfig, iprofilerSnapshotFileName), 0, "F%s" },
     { "itFileNamePrefix=", "L<filename>\tprefix for itrace filename", TR::Options::setStringForPrivateBase,
      offsetof(TR_JitPrivateConfig, itraceFileNamePrefix), 0, "P%s" },
 #if defined(J9VM_OPT_JITSERVER)
@@ -1150,6 +1161,12 @@ TR::OptionTable OMR::Options::_feOptions[] = {
      TR::Options::JITServerAOTCacheStoreLimitOption, 1, 0, "P%s" },
     { "jitserverMallocTrimInterval=",
      "M<nnn>\tmiminum time between two consecutive JITServer client malloc_trim invocations (ms)", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMallocTrimInterval, 0, "F%d", NOT_IN_SUBSET },
+    { "jitserverMessageCompressionThreshold=",
+     "M<nnn>\tcompress JITServer messages of at least this size (bytes). At the client, a non-zero value "
+        "also asks the server to compress its replies. Use 0 to disable compression", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMessageCompressionThreshold, 0, "F%d", NOT_IN_SUBSET },
+    { "jitserverServerSwitchInterval=",
+     "M<nnn>\tminimum time between two consecutive moves of the client to a less loaded server, "
+        "when several servers are given to -XX:JITServerAddress (ms)", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverServerSwitchInterval, 0, "F%d", NOT_IN_SUBSET },
 #endif  /* defined(J9VM_OPT_JITSERVER) */
     { "jProfilingEnablementSampleThreshold=",
      "M<nnn>\tNumber of global samples to allow generation of JProfiling bodies", TR::Options::setStaticNumeric,
@@ -2376,50 +2393,6 @@ bool J9::Options::preProcessJitServer(J9JavaVM *vm, J9JITConfig *jitConfig)
                 compInfo->getPersistentInfo()->setJITServerUseHealthPort(false);
             }
 
-            // Check if we should open the port for the MetricsServer
-            int32_t xxEnableMetricsServerArgIndex
-                = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXplusMetricsServer);
-            int32_t xxDisableMetricsServerArgIndex
-                = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXminusMetricsServer);
-            if (xxEnableMetricsServerArgIndex > xxDisableMetricsServerArgIndex) {
-                // Default port is already set at 38500; see if the user wants to change that
-                int32_t xxJITServerMetricsPortArgIndex
-                    = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXJITServerMetricsPortOption);
-                if (xxJITServerMetricsPortArgIndex >= 0) {
-                    UDATA port = 0;
-                    const char *xxJITServerMetricsPortOption
-                        = J9::Options::getExternalOptionString(J9::ExternalOptions::XXJITServerMetricsPortOption);
-                    IDATA ret = GET_INTEGER_VALUE(xxJITServerMetricsPortArgIndex, xxJITServerMetricsPortOption, port);
-                    if (ret == OPTION_OK)
-                        compInfo->getPersistentInfo()->setJITServerMetricsPort(port);
-                }
-
-                // For optional metrics server encryption. Key and cert have to be set as a pair.
-                int32_t xxJITServerMetricsSSLKeyArgIndex
-                    = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXJITServerMetricsSSLKeyOption);
-                int32_t xxJITServerMetricsSSLCertArgIndex
-                    = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXJITServerMetricsSSLCertOption);
-
-                if ((xxJITServerMetricsSSLKeyArgIndex >= 0) && (xxJITServerMetricsSSLCertArgIndex >= 0)) {
-                    char *keyFileName = NULL;
-                    char *certFileName = NULL;
-                    GET_OPTION_VALUE(xxJITServerMetricsSSLKeyArgIndex, '=', &keyFileName);
-                    GET_OPTION_VALUE(xxJITServerMetricsSSLCertArgIndex, '=', &certFileName);
-                    std::string key = readFileToString(keyFileName);
-                    std::string cert = readFileToString(certFileName);
-
-                    if (!key.empty() && !cert.empty()) {
-                        compInfo->addJITServerMetricsSslKey(key);
-                        compInfo->addJITServerMetricsSslCert(cert);
-                    } else {
-                        j9tty_printf(PORTLIB, "Fatal Error: The metrics server SSL key and cert cannot be empty\n");
-                        return false;
-                    }
-                }
-            } else {
-                compInfo->getPersistentInfo()->setJITServerMetricsPort(0); // This means don't use MetricsServer
-            }
-
             // Check if cached ROM classes should be shared between clients
             int32_t xxJITServerShareROMClassesArgIndex
                 = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXplusJITServerShareROMClassesOption);
@@ -2542,6 +2515,55 @@ bool J9::Options::preProcessJitServer(J9JavaVM *vm, J9JITConfig *jitConfig)
 #endif // #if defined(J9VM_OPT_CRIU_SUPPORT)
         }
 
+        // Check if we should open the port for the MetricsServer. This is supported in all modes:
+        // a JITServer publishes server metrics, a client or a regular JVM publishes JIT and GC metrics
+        int32_t xxEnableMetricsServerArgIndex
+            = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXplusMetricsServer);
+        int32_t xxDisableMetricsServerArgIndex
+            = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXminusMetricsServer);
+        if (xxEnableMetricsServerArgIndex > xxDisableMetricsServerArgIndex) {
+            // Default port is already set at 38500; see if the user wants to change that
+            int32_t xxJITServerMetricsPortArgIndex
+                = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXJITServerMetricsPortOption);
+            if (xxJITServerMetricsPortArgIndex >= 0) {
+                UDATA port = 0;
+                const char *xxJITServerMetricsPortOption
+                    = J9::Options::getExternalOptionString(J9::ExternalOptions::XXJITServerMetricsPortOption);
+                IDATA ret = GET_INTEGER_VALUE(xxJITServerMetricsPortArgIndex, xxJITServerMetricsPortOption, port);
+                if (ret == OPTION_OK)
+                    compInfo->getPersistentInfo()->setJITServerMetricsPort(port);
+            }
+
+            // For optional metrics server encryption. Key and cert have to be set as a pair.
+            int32_t xxJITServerMetricsSSLKeyArgIndex
+                = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXJITServerMetricsSSLKeyOption);
+            int32_t xxJITServerMetricsSSLCertArgIndex
+                = J9::Options::getExternalOptionIndex(J9::ExternalOptions::XXJITServerMetricsSSLCertOption);
+
+            if (((xxJITServerMetricsSSLKeyArgIndex >= 0) || (xxJITServerMetricsSSLCertArgIndex >= 0))
+                && (compInfo->getPersistentInfo()->getRemoteCompilationMode() != JITServer::SERVER)) {
+                // The SSL libraries are not necessarily loaded outside of server mode
+                j9tty_printf(PORTLIB, "Warning: The metrics server SSL key and cert are ignored outside of JITServer\n");
+            } else if ((xxJITServerMetricsSSLKeyArgIndex >= 0) && (xxJITServerMetricsSSLCertArgIndex >= 0)) {
+                char *keyFileName = NULL;
+                char *certFileName = NULL;
+                GET_OPTION_VALUE(xxJITServerMetricsSSLKeyArgIndex, '=', &keyFileName);
+                GET_OPTION_VALUE(xxJITServerMetricsSSLCertArgIndex, '=', &certFileName);
+                std::string key = readFileToString(keyFileName);
+                std::string cert = readFileToString(certFileName);
+
+                if (!key.empty() && !cert.empty()) {
+                    compInfo->addJITServerMetricsSslKey(key);
+                    compInfo->addJITServerMetricsSslCert(cert);
+                } else {
+                    j9tty_printf(PORTLIB, "Fatal Error: The metrics server SSL key and cert cannot be empty\n");
+                    return false;
+                }
+            }
+        } else {
+            compInfo->getPersistentInfo()->setJITServerMetricsPort(0); // This means don't use MetricsServer
+        }
+
         if (!JITServerParseCommonOptions(vm->vmArgsArray, vm, compInfo)) {
             // Could not parse JITServer options successfully
             return false;
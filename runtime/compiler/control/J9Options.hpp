@@ -461,6 +461,8 @@ public:
     static int32_t _aotCachePersistenceMinDeltaMethods;
     static int32_t _aotCachePersistenceMinPeriodMs;
     static int32_t _jitserverMallocTrimInterval;
+    static int32_t _jitserverMessageCompressionThreshold;
+    static int32_t _jitserverServerSwitchInterval;
     static int32_t _lowCompDensityModeEnterThreshold;
     static int32_t _lowCompDensityModeExitThreshold;
     static int32_t _lowCompDensityModeExitLPQSize;
@@ -538,6 +540,8 @@ public:
 
     static bool _xrsSync;
 
+    static bool _eagerAOTLoadsAtStartup; // relocate AOT bodies loaded during startup in previous runs ahead of time
+
     static int32_t _jvmStarvationThreshold;
 
     static char *_logFileNameSuffix;
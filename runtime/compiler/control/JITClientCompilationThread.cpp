@@ -44,6 +44,7 @@
 #include "env/VMAccessCriticalSection.hpp"
 #include "env/VMJ9.h"
 #include "net/ClientStream.hpp"
+#include "net/ServerList.hpp"
 #include "optimizer/TransformUtil.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
@@ -118,6 +119,15 @@ static UDATA jitFindField(TR::Compilation *comp, J9VMThread *vmStruct, J9Constan
     return result;
 }
 
+// Tells the server whether the profile of a method should be stored in persistent or heap memory.
+// Note that if the method is queued for compilation, new interpreter samples will not be collected.
+static bool canCacheProfilePersistently(TR_OpaqueMethodBlock *method, bool isCompiled, TR::Compilation *comp)
+{
+    bool isQueued = TR::CompilationInfo::getJ9MethodVMExtra((J9Method *)method) == J9_JIT_QUEUED_FOR_COMPILATION;
+    bool isInProgress = comp->getMethodBeingCompiled()->getPersistentIdentifier() == method;
+    return isCompiled || isInProgress || isQueued;
+}
+
 static void handler_IProfiler_profilingSample(JITServer::ClientStream *client, TR_J9VM *fe, TR::Compilation *comp)
 {
     auto recv = client->getRecvData<TR_OpaqueMethodBlock *, uint32_t, bool, bool>();
@@ -129,12 +139,8 @@ static void handler_IProfiler_profilingSample(JITServer::ClientStream *client, T
     JITClientIProfiler *iProfiler = (JITClientIProfiler *)fe->getIProfiler();
 
     bool isCompiled = TR::CompilationInfo::isCompiled((J9Method *)method);
-    bool isQueued = TR::CompilationInfo::getJ9MethodVMExtra((J9Method *)method) == J9_JIT_QUEUED_FOR_COMPILATION;
-    bool isInProgress = comp->getMethodBeingCompiled()->getPersistentIdentifier() == method;
+    bool usePersistentCache = canCacheProfilePersistently(method, isCompiled, comp);
     bool abort = false;
-    // Used to tell the server if a profiled entry should be stored in persistent or heap memory.
-    // Note that if the method is queued for compilation, new interpreter samples will not be collected.
-    bool usePersistentCache = isCompiled || isInProgress || isQueued;
 
     if (wholeMethodInfo) {
         // Serialize all the information related to this method
@@ -183,6 +189,41 @@ static void handler_IProfiler_profilingSample(JITServer::ClientStream *client, T
     }
 }
 
+// Serialize the profiles of all the requested methods and send them in a single reply
+static void handler_IProfiler_profilingSampleBatch(JITServer::ClientStream *client, TR_J9VM *fe,
+    TR::Compilation *comp)
+{
+    auto recv = client->getRecvData<std::vector<TR_OpaqueMethodBlock *>, bool>();
+    auto &methods = std::get<0>(recv);
+    auto sharedProfile = std::get<1>(recv);
+
+    JITClientIProfiler *iProfiler = (JITClientIProfiler *)fe->getIProfiler();
+
+    size_t numMethods = methods.size();
+    std::vector<std::string> ipdata(numMethods);
+    std::vector<uint64_t> totalSamples(numMethods, 0);
+    std::vector<uint64_t> numProfiledBytecodes(numMethods, 0);
+    std::vector<uint8_t> flags(numMethods, 0);
+    std::vector<J9Class *> uncachedClasses;
+    std::vector<JITServerHelpers::ClassInfoTuple> classInfoTuples;
+    for (size_t i = 0; i < numMethods; ++i) {
+        TR_OpaqueMethodBlock *method = methods[i];
+        bool isCompiled = TR::CompilationInfo::isCompiled((J9Method *)method);
+        if (isCompiled)
+            flags[i] |= IPBATCH_IS_COMPILED;
+        if (canCacheProfilePersistently(method, isCompiled, comp))
+            flags[i] |= IPBATCH_USE_PERSISTENT_CACHE;
+
+        uint32_t numEntries = 0;
+        if (iProfiler->serializeIProfileInfoForMethod(method, comp, sharedProfile, ipdata[i], totalSamples[i],
+                numEntries, uncachedClasses, classInfoTuples))
+            flags[i] |= IPBATCH_ABORTED;
+        numProfiledBytecodes[i] = numEntries;
+    }
+    client->write(JITServer::MessageType::IProfiler_profilingSampleBatch, ipdata, totalSamples, numProfiledBytecodes,
+        flags, uncachedClasses, classInfoTuples);
+}
+
 static bool handleResponse(JITServer::MessageType response, JITServer::ClientStream *client,
     TR::CompilationInfoPerThread *compInfoPT, TR::Compilation *comp, TR_J9VM *fe, J9VMThread *vmThread)
 {
@@ -2340,6 +2381,9 @@ static bool handleResponse(JITServer::MessageType response, JITServer::ClientStr
         case MessageType::IProfiler_profilingSample: {
             handler_IProfiler_profilingSample(client, fe, comp);
         } break;
+        case MessageType::IProfiler_profilingSampleBatch: {
+            handler_IProfiler_profilingSampleBatch(client, fe, comp);
+        } break;
         case MessageType::Recompilation_getJittedBodyInfoFromPC: {
             void *startPC = std::get<0>(client->getRecvData<void *>());
             auto bodyInfo = J9::Recompilation::getJittedBodyInfoFromPC(startPC);
@@ -3052,6 +3096,13 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
     // For JitDump recompilations need to use the same stream as for the original compile
     JITServer::ClientStream *client
         = (enableJITServerPerCompConn && !details.isJitDumpMethod()) ? NULL : compInfoPT->getClientStream();
+    // The client may have moved to a different server since this connection was opened
+    if (client && !details.isJitDumpMethod() && !client->isConnectedToCurrentServer()) {
+        client->~ClientStream();
+        TR_Memory::jitPersistentFree(client);
+        compInfoPT->setClientStream(NULL);
+        client = NULL;
+    }
     if (!client) {
         try {
             if (JITServerHelpers::isServerAvailable()) {
@@ -3176,11 +3227,17 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
     std::pair<std::string, std::string> chtableUpdates("", "");
     uint32_t seqNo = 0;
     uint32_t lastCriticalSeqNo = 0;
+    uint32_t lastInvalidatingSeqNo = 0;
 
     // sequencing monitor critical section scope
     {
         OMR::CriticalSection sequencingLock(compInfo->getSequencingMonitor());
 
+        // The updates collected below must reach the server that all future requests go to.
+        // Server switches happen with the sequencing monitor in hand, so this check is reliable.
+        if (!details.isJitDumpMethod() && !client->isConnectedToCurrentServer())
+            compiler->failCompilation<JITServer::StreamFailure>("Client switched to a different server");
+
         // Collect the list of unloaded classes
         {
             auto src = compInfo->getUnloadedClassesTempList();
@@ -3203,12 +3260,20 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
         // Update the sequence number for these updates
         seqNo = compInfo->incCompReqSeqNo();
         lastCriticalSeqNo = !details.isJitDumpMethod() ? compInfo->getLastCriticalSeqNo() : 0;
+        lastInvalidatingSeqNo = !details.isJitDumpMethod() ? compInfo->getLastInvalidatingSeqNo() : 0;
 
         // If needed, update the seqNo of the last request that carried information that needed to be processed in order
         if (!chtableUpdates.first.empty() || !chtableUpdates.second.empty() || !illegalModificationList.empty()
             || !unloadedClasses.empty() || details.isJitDumpMethod()) {
             compInfo->setLastCriticalSeqNo(seqNo);
         }
+        // Requests that only carry CHTable modifications do not make data cached at the server stale:
+        // CHTable assumptions are validated again here when the compiled body is committed.
+        // Requests without updates of their own only need to wait for the ones that do.
+        if (!chtableUpdates.first.empty() || !illegalModificationList.empty() || !unloadedClasses.empty()
+            || details.isJitDumpMethod()) {
+            compInfo->setLastInvalidatingSeqNo(seqNo);
+        }
     }
 
     // Determine the loaders to consider permanent for this compilation. From
@@ -3243,6 +3308,8 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
     TR_OptimizationPlan modifiedOptPlan;
     std::vector<SerializedRuntimeAssumption> serializedRuntimeAssumptions;
     std::vector<TR_OpaqueMethodBlock *> methodsRequiringTrampolines;
+    JITServer::ServerMemoryState serverMemoryState = JITServer::ServerMemoryState::NORMAL;
+    JITServer::ServerActiveThreadsState serverActiveThreadsState = JITServer::ServerActiveThreadsState::NORMAL_THREAD;
 
 #if defined(J9VM_OPT_OPENJDK_METHODHANDLE)
     std::vector<TR::CodeGenerator::ConstRefInfo> constRefInfo;
@@ -3263,12 +3330,15 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
 
         Trc_JITServerRemoteCompileRequest(vmThread, seqNo, compiler->signature(), compiler->getHotnessName());
 
+        PORT_ACCESS_FROM_JITCONFIG(compInfoPT->getJitConfig());
+        uint64_t requestStartTime = j9time_usec_clock();
+
         client->buildCompileRequest(persistentInfo->getClientUID(), seqNo, lastCriticalSeqNo, method, clazz,
             *entry->_optimizationPlan, detailsStr, details.getType(), unloadedClasses, illegalModificationList,
             classInfoTuple, optionsStr, recompMethodInfoStr, chtableUpdates.first, chtableUpdates.second,
             useAotCompilation, TR::Compiler->vm.isVMInStartupPhase(compInfoPT->getJitConfig()), aotCacheStore,
             aotCacheLoad, methodIndex, classChainOffset, ramClassChain, uncachedRAMClasses, uncachedClassInfos,
-            newKnownIds, numPermanentLoaders);
+            newKnownIds, numPermanentLoaders, lastInvalidatingSeqNo);
 
         JITServer::MessageType response;
         while (!handleServerMessage(client, compiler->fej9vm(), response))
@@ -3298,15 +3368,15 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
             resolvedMirrorMethodsPersistIPInfo = std::get<5>(recv);
             modifiedOptPlan = std::get<6>(recv);
             serializedRuntimeAssumptions = std::get<7>(recv);
-            JITServer::ServerMemoryState nextMemoryState = std::get<8>(recv);
-            JITServer::ServerActiveThreadsState nextActiveThreadState = std::get<9>(recv);
+            serverMemoryState = std::get<8>(recv);
+            serverActiveThreadsState = std::get<9>(recv);
             methodsRequiringTrampolines = std::get<10>(recv);
 
 #if defined(J9VM_OPT_OPENJDK_METHODHANDLE)
             constRefInfo = std::get<11>(recv);
 #endif
 
-            updateCompThreadActivationPolicy(compInfoPT, nextMemoryState, nextActiveThreadState);
+            updateCompThreadActivationPolicy(compInfoPT, serverMemoryState, serverActiveThreadsState);
 
             if (aotCacheLoad)
                 deserializer->incNumCacheMisses();
@@ -3323,11 +3393,11 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
             resolvedMirrorMethodsPersistIPInfo = std::get<5>(recv);
             modifiedOptPlan = std::get<6>(recv);
             serializedRuntimeAssumptions = std::get<7>(recv);
-            JITServer::ServerMemoryState nextMemoryState = std::get<8>(recv);
-            JITServer::ServerActiveThreadsState nextActiveThreadState = std::get<9>(recv);
+            serverMemoryState = std::get<8>(recv);
+            serverActiveThreadsState = std::get<9>(recv);
             methodsRequiringTrampolines = std::get<10>(recv);
 
-            updateCompThreadActivationPolicy(compInfoPT, nextMemoryState, nextActiveThreadState);
+            updateCompThreadActivationPolicy(compInfoPT, serverMemoryState, serverActiveThreadsState);
 
             if (aotCacheLoad)
                 deserializer->incNumCacheMisses();
@@ -3357,10 +3427,10 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
             auto &methodStr = std::get<0>(recv);
             auto &records = std::get<1>(recv);
             modifiedOptPlan = std::get<2>(recv);
-            JITServer::ServerMemoryState nextMemoryState = std::get<3>(recv);
-            JITServer::ServerActiveThreadsState nextActiveThreadState = std::get<4>(recv);
+            serverMemoryState = std::get<3>(recv);
+            serverActiveThreadsState = std::get<4>(recv);
 
-            updateCompThreadActivationPolicy(compInfoPT, nextMemoryState, nextActiveThreadState);
+            updateCompThreadActivationPolicy(compInfoPT, serverMemoryState, serverActiveThreadsState);
 
             auto method = SerializedAOTMethod::get(methodStr);
             bool usesSVM = false;
@@ -3499,6 +3569,10 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
         else if (statusCode == compilationStreamMessageTypeMismatch)
             throw JITServer::StreamMessageTypeMismatch();
         client->setVersionCheckStatus();
+
+        if ((statusCode == compilationOK) && JITServer::ServerList::get())
+            JITServer::ServerList::get()->compilationDone(compInfo, client->getServerGeneration(),
+                j9time_usec_clock() - requestStartTime, serverMemoryState, serverActiveThreadsState);
     } catch (const JITServer::StreamFailure &e) {
         if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
             TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "JITServer::StreamFailure: %s for %s @ %s", e.what(),
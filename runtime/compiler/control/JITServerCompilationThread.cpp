@@ -396,17 +396,18 @@ void TR::CompilationInfoPerThreadRemote::waitForMyTurn(ClientSessionData *client
                 // The entry cannot be in the list
                 TR_MethodToBeCompiled *headEntry = clientSession->getOOSequenceEntryList();
                 if (headEntry) {
-                    uint32_t headSeqNo = ((TR::CompilationInfoPerThreadRemote *)(headEntry->_compInfoPT))->getSeqNo();
-                    TR_ASSERT_FATAL(seqNo < headSeqNo,
-                        "Next in line method cannot be in the waiting list: seqNo=%u >= headSeqNo=%u entry=%p "
-                        "headEntry=%p",
-                        seqNo, headSeqNo, &entry, headEntry);
+                    uint32_t headExpectedSeqNo
+                        = ((TR::CompilationInfoPerThreadRemote *)(headEntry->_compInfoPT))->getExpectedSeqNo();
+                    TR_ASSERT_FATAL(criticalSeqNo < headExpectedSeqNo,
+                        "Next in line method cannot be in the waiting list: expectedSeqNo=%u >= headExpectedSeqNo=%u "
+                        "entry=%p headEntry=%p",
+                        criticalSeqNo, headExpectedSeqNo, &entry, headEntry);
                 }
                 break; // It's my turn, so proceed
             }
 
             if (clientSession->getNumActiveThreads() <= 0 && // Wait for active threads to quiesce
-                &entry == clientSession->getOOSequenceEntryList() && // Allow only the smallest seqNo which is the head
+                &entry == clientSession->getOOSequenceEntryList() && // Allow only the head of the list
                 !getWaitToBeNotified()) // Avoid a cohort of threads clearing the caches
             {
                 clientSession->clearCaches();
@@ -492,7 +493,7 @@ bool TR::CompilationInfoPerThreadRemote::serveCachedAOTMethod(TR_MethodToBeCompi
         auto &classRecord = serializedMethod->definingClassRecord()->data();
         const J9ROMMethod *romMethod;
         {
-            OMR::CriticalSection cs(clientData->getROMMapMonitor());
+            JITServerReadSection cs(clientData->getROMMapMonitor());
             auto it = clientData->getJ9MethodMap().find(method);
             TR_ASSERT(it != clientData->getJ9MethodMap().end(), "Method %p must be cached", method);
             romMethod = it->second._romMethod;
@@ -575,6 +576,8 @@ void TR::CompilationInfoPerThreadRemote::processCompilationRequest(CompilationRe
     auto &uncachedClassInfos = std::get<23>(req);
     auto &newKnownIds = std::get<24>(req);
     size_t numPermanentLoaders = std::get<25>(req);
+    // Sequence number of the last request that invalidated data cached at the server
+    uint32_t invalidatingSeqNo = std::get<26>(req);
 
     TR_ASSERT_FATAL(TR::Compiler->persistentMemory() == compInfo->persistentMemory(),
         "per-client persistent memory must not be set at this point");
@@ -609,7 +612,12 @@ void TR::CompilationInfoPerThreadRemote::processCompilationRequest(CompilationRe
 
     stream->setClientId(clientId);
     setSeqNo(seqNo); // Memorize the sequence number of this request
-    setExpectedSeqNo(criticalSeqNo); // Memorize the message I have to wait for
+    // Critical requests must be applied in the order they were generated at the client, so they wait for
+    // the previous critical request. Other requests only need the server caches to reflect every class
+    // unloading and redefinition the client saw before sending them; CHTable additions may lag because
+    // the client validates all CH assumptions again when the compiled method is committed.
+    uint32_t expectedSeqNo = isCriticalRequest ? criticalSeqNo : std::min(invalidatingSeqNo, criticalSeqNo);
+    setExpectedSeqNo(expectedSeqNo); // Memorize the message I have to wait for
 
     bool sessionDataWasEmpty = false;
     {
@@ -636,12 +644,12 @@ void TR::CompilationInfoPerThreadRemote::processCompilationRequest(CompilationRe
     if (TR::Options::getVerboseOption(TR_VerboseJITServer))
         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
             "compThreadID=%d %s clientSessionData=%p for clientUID=%llu seqNo=%u (isCritical=%d) (criticalSeqNo=%u "
-            "lastProcessedCriticalReq=%u)",
+            "expectedSeqNo=%u lastProcessedCriticalReq=%u)",
             getCompThreadId(), sessionDataWasEmpty ? "created" : "found", clientSession, (unsigned long long)clientId,
-            seqNo, isCriticalRequest, criticalSeqNo, clientSession->getLastProcessedCriticalSeqNo());
+            seqNo, isCriticalRequest, criticalSeqNo, expectedSeqNo, clientSession->getLastProcessedCriticalSeqNo());
 
     Trc_JITServerClientSessionData1(compThread, getCompThreadId(), sessionDataWasEmpty ? "created" : "found",
-        clientSession, (unsigned long long)clientId, seqNo, isCriticalRequest, criticalSeqNo,
+        clientSession, (unsigned long long)clientId, seqNo, isCriticalRequest, expectedSeqNo,
         clientSession->getLastProcessedCriticalSeqNo());
 
     if (!newKnownIds.empty()) {
@@ -655,27 +663,27 @@ void TR::CompilationInfoPerThreadRemote::processCompilationRequest(CompilationRe
     clientSession->getSequencingMonitor()->enter();
     clientSession->updateMaxReceivedSeqNo(seqNo); // TODO: why do I need this?
 
-    // This request can go through as long as criticalSeqNo has been processed
-    if (criticalSeqNo > clientSession->getLastProcessedCriticalSeqNo()) {
-        // Park this request until `criticalSeqNo` arrives and is processed
+    // This request can go through as long as expectedSeqNo has been processed
+    if (expectedSeqNo > clientSession->getLastProcessedCriticalSeqNo()) {
+        // Park this request until `expectedSeqNo` arrives and is processed
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
-                "compThreadID=%d out-of-sequence msg=%u detected for clientUID=%llu criticalSeqNo=%u > "
+                "compThreadID=%d out-of-sequence msg=%u detected for clientUID=%llu expectedSeqNo=%u > "
                 "lastCriticalSeqNo=%u. Parking this thread (entry=%p)",
-                getCompThreadId(), seqNo, (unsigned long long)clientId, criticalSeqNo,
+                getCompThreadId(), seqNo, (unsigned long long)clientId, expectedSeqNo,
                 clientSession->getLastProcessedCriticalSeqNo(), &entry);
 
         Trc_JITServerOutOfSequenceMsg1(compThread, getCompThreadId(), clientSession, (unsigned long long)clientId,
-            &entry, seqNo, clientSession->getLastProcessedCriticalSeqNo(), clientSession->getNumActiveThreads(),
+            &entry, seqNo, expectedSeqNo, clientSession->getNumActiveThreads(),
             clientSession->getLastProcessedCriticalSeqNo());
 
         waitForMyTurn(clientSession, entry);
     }
 
-    TR_ASSERT_FATAL(criticalSeqNo <= clientSession->getLastProcessedCriticalSeqNo(),
-        "Critical requests must be processed in order: compThreadID=%d seqNo=%u criticalSeqNo=%u > "
+    TR_ASSERT_FATAL(expectedSeqNo <= clientSession->getLastProcessedCriticalSeqNo(),
+        "Critical requests must be processed in order: compThreadID=%d seqNo=%u expectedSeqNo=%u > "
         "lastProcessedCriticalSeqNo=%u clientUID=%llu",
-        getCompThreadId(), seqNo, criticalSeqNo, clientSession->getLastProcessedCriticalSeqNo(),
+        getCompThreadId(), seqNo, expectedSeqNo, clientSession->getLastProcessedCriticalSeqNo(),
         (unsigned long long)clientId);
 
     if (criticalSeqNo < clientSession->getLastProcessedCriticalSeqNo()) {
@@ -739,12 +739,21 @@ J9ROMClass *JITServerHelpers::packROMClass(const J9ROMClass *romClass, TR_Memory
 // insertIntoOOSequenceEntryList needs to be executed with sequencingMonitor in hand.
 // This method belongs to ClientSessionData, but is temporarily moved here to be able
 // to push the ClientSessionData related code as a standalone piece.
+// The list is sorted by the seqNo each entry waits for (and then by its own seqNo), so that
+// waking up waiting requests can stop at the first entry that still cannot proceed.
 void JITServerHelpers::insertIntoOOSequenceEntryList(ClientSessionData *clientData, TR_MethodToBeCompiled *entry)
 {
-    uint32_t seqNo = ((TR::CompilationInfoPerThreadRemote *)(entry->_compInfoPT))->getSeqNo();
+    auto compInfoPT = (TR::CompilationInfoPerThreadRemote *)(entry->_compInfoPT);
+    uint32_t seqNo = compInfoPT->getSeqNo();
+    uint32_t expectedSeqNo = compInfoPT->getExpectedSeqNo();
     TR_MethodToBeCompiled *crtEntry = clientData->getOOSequenceEntryList();
     TR_MethodToBeCompiled *prevEntry = NULL;
-    while (crtEntry && (seqNo > ((TR::CompilationInfoPerThreadRemote *)(crtEntry->_compInfoPT))->getSeqNo())) {
+    while (crtEntry) {
+        auto crtCompInfoPT = (TR::CompilationInfoPerThreadRemote *)(crtEntry->_compInfoPT);
+        uint32_t crtExpectedSeqNo = crtCompInfoPT->getExpectedSeqNo();
+        if ((expectedSeqNo < crtExpectedSeqNo)
+            || ((expectedSeqNo == crtExpectedSeqNo) && (seqNo < crtCompInfoPT->getSeqNo())))
+            break;
         prevEntry = crtEntry;
         crtEntry = crtEntry->_next;
     }
@@ -785,6 +794,18 @@ void JITServerHelpers::printJITServerMsgStats(J9JITConfig *jitConfig, TR::Compil
     j9tty_printf(PORTLIB, "Total number of messages: %llu\n", (unsigned long long)totalMsgCount);
     j9tty_printf(PORTLIB, "Total amount of data received: %llu bytes\n",
         (unsigned long long)JITServer::CommunicationStream::_totalMsgSize);
+    if (JITServer::CommunicationStream::_numCompressedMsgsSent) {
+        uint64_t bytesBefore = JITServer::CommunicationStream::_totalBytesBeforeCompression;
+        uint64_t bytesAfter = JITServer::CommunicationStream::_totalBytesAfterCompression;
+        j9tty_printf(PORTLIB, "Compressed messages sent: %u. Bytes before compression: %llu. After compression: %llu. "
+                              "Compression ratio: %f\n",
+            JITServer::CommunicationStream::_numCompressedMsgsSent, (unsigned long long)bytesBefore,
+            (unsigned long long)bytesAfter, bytesBefore / float(bytesAfter));
+    }
+    if (JITServer::CommunicationStream::_numCompressedMsgsReceived)
+        j9tty_printf(PORTLIB, "Compressed messages received: %u. Compressed bytes received: %llu\n",
+            JITServer::CommunicationStream::_numCompressedMsgsReceived,
+            (unsigned long long)JITServer::CommunicationStream::_totalCompressedBytesReceived);
 
     uint32_t numCompilations = 0;
     uint32_t numDeserializedMethods = 0;
@@ -876,7 +897,7 @@ void JITServerHelpers::freeRemoteROMClass(J9ROMClass *romClass, TR_PersistentMem
 J9ROMClass *JITServerHelpers::cacheRemoteROMClassOrFreeIt(ClientSessionData *clientSessionData, J9Class *clazz,
     J9ROMClass *romClass, const ClassInfoTuple &classInfoTuple)
 {
-    OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+    JITServerWriteSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
     auto it = clientSessionData->getROMClassMap().find(clazz);
     if (it == clientSessionData->getROMClassMap().end()) {
         JITServerHelpers::cacheRemoteROMClass(clientSessionData, clazz, romClass, classInfoTuple);
@@ -944,7 +965,7 @@ ClientSessionData::ClassInfo &JITServerHelpers::cacheRemoteROMClass(ClientSessio
 
 J9ROMClass *JITServerHelpers::getRemoteROMClassIfCached(ClientSessionData *clientSessionData, J9Class *clazz)
 {
-    OMR::CriticalSection getRemoteROMClassIfCached(clientSessionData->getROMMapMonitor());
+    JITServerReadSection getRemoteROMClassIfCached(clientSessionData->getROMMapMonitor());
     auto it = clientSessionData->getROMClassMap().find(clazz);
     return (it == clientSessionData->getROMClassMap().end()) ? NULL : it->second._romClass;
 }
@@ -1065,7 +1086,7 @@ bool JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData
         return false;
 
     {
-        OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
         auto it = clientSessionData->getROMClassMap().find(clazz);
         if (it != clientSessionData->getROMClassMap().end()) {
             JITServerHelpers::getROMClassData(it->second, dataType, data);
@@ -1077,7 +1098,7 @@ bool JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData
     auto recv = stream->read<ClassInfoTuple>();
     auto &classInfoTuple = std::get<0>(recv);
 
-    OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+    JITServerWriteSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
     auto it = clientSessionData->getROMClassMap().find(clazz);
     if (it == clientSessionData->getROMClassMap().end()) {
         auto romClass = romClassFromString(std::get<0>(classInfoTuple), std::get<24>(classInfoTuple),
@@ -1099,7 +1120,7 @@ bool JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData
         return false;
 
     {
-        OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
         auto it = clientSessionData->getROMClassMap().find(clazz);
         if (it != clientSessionData->getROMClassMap().end()) {
             JITServerHelpers::getROMClassData(it->second, dataType1, data1);
@@ -1112,7 +1133,7 @@ bool JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData
     auto recv = stream->read<ClassInfoTuple>();
     auto &classInfoTuple = std::get<0>(recv);
 
-    OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+    JITServerWriteSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
     auto it = clientSessionData->getROMClassMap().find(clazz);
     if (it == clientSessionData->getROMClassMap().end()) {
         auto romClass = romClassFromString(std::get<0>(classInfoTuple), std::get<24>(classInfoTuple),
@@ -1228,7 +1249,7 @@ J9ROMMethod *JITServerHelpers::romMethodOfRamMethod(J9Method *method)
 
     // Check if the method is already cached.
     {
-        OMR::CriticalSection romCache(clientData->getROMMapMonitor());
+        JITServerReadSection romCache(clientData->getROMMapMonitor());
         auto &map = clientData->getJ9MethodMap();
         auto it = map.find((J9Method *)method);
         if (it != map.end())
@@ -1242,7 +1263,7 @@ J9ROMMethod *JITServerHelpers::romMethodOfRamMethod(J9Method *method)
         J9Class *clazz = (J9Class *)std::get<0>(stream->read<TR_OpaqueClassBlock *>());
         TR::compInfoPT->getAndCacheRemoteROMClass(clazz);
         {
-            OMR::CriticalSection romCache(clientData->getROMMapMonitor());
+            JITServerReadSection romCache(clientData->getROMMapMonitor());
             auto &map = clientData->getJ9MethodMap();
             auto it = map.find((J9Method *)method);
             if (it != map.end())
@@ -1347,7 +1368,7 @@ uintptr_t JITServerHelpers::getRemoteClassDepthAndFlagsWhenROMClassNotCached(J9C
     auto recv = stream->read<JITServerHelpers::ClassInfoTuple>();
     auto &classInfoTuple = std::get<0>(recv);
 
-    OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+    JITServerWriteSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
     auto it = clientSessionData->getROMClassMap().find(clazz);
     if (it == clientSessionData->getROMClassMap().end()) {
         auto romClass = JITServerHelpers::romClassFromString(std::get<0>(classInfoTuple), std::get<24>(classInfoTuple),
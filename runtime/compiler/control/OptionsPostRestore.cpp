@@ -318,6 +318,11 @@ void J9::OptionsPostRestore::processJitServerOptions()
         _compInfo->getPersistentInfo()->setServerUID(0);
         _compInfo->getCRRuntime()->setCanPerformRemoteCompilationInCRIUMode(true);
 
+        // Connect to the servers given at restore time; connections opened before the checkpoint become stale
+        bool validServerList = JITServer::ServerList::init(_compInfo->getPersistentInfo(),
+            OMRPORT_FROM_J9PORT(_jitConfig->javaVM->portLibrary));
+        TR_ASSERT_FATAL(validServerList, "Terminating the JVM because the JITServer address list cannot be parsed");
+
         // If encryption is desired, load and initialize the SSL
         if (_compInfo->useSSL()) {
             bool loaded = JITServer::loadLibsslAndFindSymbols();
@@ -120,6 +120,7 @@
 #include "net/CommunicationStream.hpp"
 #include "net/ClientStream.hpp"
 #include "net/LoadSSLLibs.hpp"
+#include "net/ServerList.hpp"
 #include "runtime/JITClientSession.hpp"
 #include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerAOTDeserializer.hpp"
@@ -597,10 +598,10 @@ extern "C" void jitExclusiveVMShutdownPending(J9VMThread *vmThread)
         if (listener) {
             listener->stop();
         }
-        MetricsServer *metricsServer = ((TR_JitPrivateConfig *)(javaVM->jitConfig->privateConfig))->metricsServer;
-        if (metricsServer) {
-            metricsServer->stop();
-        }
+    }
+    MetricsServer *metricsServer = ((TR_JitPrivateConfig *)(javaVM->jitConfig->privateConfig))->metricsServer;
+    if (metricsServer) {
+        metricsServer->stop();
     }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
@@ -1654,6 +1655,18 @@ extern "C" jint onLoadInternal(J9JavaVM *javaVM, J9JITConfig *jitConfig, char *x
     if (compInfo->getPersistentInfo()->getRemoteCompilationMode() != JITServer::NONE)
         JITServer::MessageBuffer::initTotalBuffersMonitor();
 
+    // If we are allowed to use a metrics port, allocate the MetricsServer now. The metrics
+    // database is allocated too, so that the JIT and GC hooks can start recording right away
+    if (compInfo->getPersistentInfo()->getJITServerMetricsPort() != 0) {
+        ((TR_JitPrivateConfig *)(jitConfig->privateConfig))->metricsServer = MetricsServer::allocate();
+        if (!((TR_JitPrivateConfig *)(jitConfig->privateConfig))->metricsServer
+            || !MetricsDatabase::allocate(compInfo)) {
+            // warn that MetricsServer was not allocated
+            j9tty_printf(PORTLIB, "JITServer MetricsServer not allocated, abort.\n");
+            return -1;
+        }
+    }
+
     if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER) {
         JITServer::CommunicationStream::initConfigurationFlags();
 
@@ -1667,16 +1680,6 @@ extern "C" jint onLoadInternal(J9JavaVM *javaVM, J9JITConfig *jitConfig, char *x
             return -1;
         }
 
-        // If we are allowed to use a metrics port, allocate the MetricsServer now
-        if (compInfo->getPersistentInfo()->getJITServerMetricsPort() != 0) {
-            ((TR_JitPrivateConfig *)(jitConfig->privateConfig))->metricsServer = MetricsServer::allocate();
-            if (!((TR_JitPrivateConfig *)(jitConfig->privateConfig))->metricsServer) {
-                // warn that MetricsServer was not allocated
-                j9tty_printf(PORTLIB, "JITServer MetricsServer not allocated, abort.\n");
-                return -1;
-            }
-        }
-
         if (jitConfig->samplingFrequency != 0) {
             ((TR_JitPrivateConfig *)(jitConfig->privateConfig))->statisticsThreadObject
                 = JITServerStatisticsThread::allocate();
@@ -1720,6 +1723,10 @@ extern "C" jint onLoadInternal(J9JavaVM *javaVM, J9JITConfig *jitConfig, char *x
         if (JITServer::ClientStream::static_init(compInfo) != 0)
             return -1;
 
+        if (!JITServer::ServerList::init(compInfo->getPersistentInfo(),
+                OMRPORT_FROM_J9PORT(jitConfig->javaVM->portLibrary)))
+            return -1;
+
         JITServer::CommunicationStream::initConfigurationFlags();
     }
 #endif // J9VM_OPT_JITSERVER
@@ -2100,6 +2107,13 @@ extern "C" int32_t aboutToBootstrap(J9JavaVM *javaVM, J9JITConfig *jitConfig)
             }
         }
     }
+
+    // The server starts its metrics thread together with the listener, see startJITServer()
+    if (compInfo->getPersistentInfo()->getRemoteCompilationMode() != JITServer::SERVER) {
+        MetricsServer *metricsServer = ((TR_JitPrivateConfig *)(jitConfig->privateConfig))->metricsServer;
+        if (metricsServer)
+            metricsServer->startMetricsThread(javaVM);
+    }
 #endif // J9VM_OPT_JITSERVER
 
     return 0;
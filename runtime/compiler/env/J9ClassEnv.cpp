@@ -360,7 +360,7 @@ void J9::ClassEnv::setClassHasIllegalStaticFinalFieldModification(TR_OpaqueClass
 
         // Update the cache
         ClientSessionData *clientSessionData = TR::compInfoPT->getClientData();
-        OMR::CriticalSection romMapCS(clientSessionData->getROMMapMonitor());
+        JITServerWriteSection romMapCS(clientSessionData->getROMMapMonitor());
         auto it = clientSessionData->getROMClassMap().find(j9c);
         if (it != clientSessionData->getROMClassMap().end())
             it->second._classFlags |= J9ClassHasIllegalFinalFieldModifications;
@@ -1679,7 +1679,7 @@ uintptr_t TR_J9JITServerSharedCache::getClassChainOffsetIdentifyingLoader(TR_Opa
 
         // If we got a valid value back, cache that
         if (TR_SharedCache::INVALID_CLASS_CHAIN_OFFSET != classChainOffset) {
-            OMR::CriticalSection getRemoteROMClass(clientData->getROMMapMonitor());
+            JITServerWriteSection getRemoteROMClass(clientData->getROMMapMonitor());
             auto it = clientData->getROMClassMap().find((J9Class *)clazz);
             if (it != clientData->getROMClassMap().end()) {
                 it->second._classChainOffsetIdentifyingLoader = classChainOffset;
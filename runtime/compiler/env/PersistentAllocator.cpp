@@ -20,8 +20,10 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "AtomicSupport.hpp"
 #include "OMR/Bytes.hpp"
 #include "control/CompilationRuntime.hpp"
+#include "control/CompilationThread.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "env/PersistentAllocator.hpp"
@@ -57,11 +59,16 @@ PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationK
     ,
 #if defined(J9VM_OPT_JITSERVER)
     _isJITServer(creationKit.javaVM.internalVMFunctions->isJITServerEnabled(&creationKit.javaVM))
+    , _threadCaches(NULL)
+    , _threadCachesMemory(NULL)
+    , _numThreadCaches(0)
     ,
 #endif
     _segments(SegmentContainerAllocator(RawAllocator(&creationKit.javaVM)))
     , _numSegments(0)
     , _javaVM(creationKit.javaVM)
+    , _bucketLockStats()
+    , _segmentLockStats()
 {
     _disclaimEnabled =
 #if defined(J9VM_OPT_JITSERVER)
@@ -88,6 +95,23 @@ PersistentAllocator::~PersistentAllocator() throw()
     _largeBlockMonitor = NULL;
     j9thread_monitor_destroy(_segmentMonitor);
     _segmentMonitor = NULL;
+#if defined(J9VM_OPT_JITSERVER)
+    if (_threadCachesMemory) {
+        PORT_ACCESS_FROM_JAVAVM(&_javaVM);
+        j9mem_free_memory(_threadCachesMemory);
+        _threadCachesMemory = NULL;
+        _threadCaches = NULL;
+    }
+#endif
+}
+
+void PersistentAllocator::enterMonitor(J9ThreadMonitor *monitor, LockStats &stats)
+{
+    if (j9thread_monitor_try_enter(monitor) != 0) {
+        j9thread_monitor_enter(monitor);
+        stats._contended++;
+    }
+    stats._acquisitions++;
 }
 
 void *PersistentAllocator::allocate(size_t size, const std::nothrow_t tag, void *hint) throw()
@@ -215,25 +239,34 @@ void *PersistentAllocator::allocateInternal(size_t requestedSize)
     size_t const index = freeBlocksIndex(allocSize);
     if (index != LARGE_BLOCK_LIST_INDEX) // fixed-size-block chain
     {
-        j9thread_monitor_enter(_smallBlockMonitor);
-        Block *block = _freeBlocks[index];
+        Block *block = NULL;
+#if defined(J9VM_OPT_JITSERVER)
+        ThreadCache *cache = getThreadCache();
+        if (cache) {
+            block = allocateFromThreadCache(cache, index);
+        } else
+#endif
+        {
+            enterMonitor(_smallBlockMonitor, _bucketLockStats[index]);
+            block = _freeBlocks[index];
+            if (block)
+                _freeBlocks[index] = block->next();
+            j9thread_monitor_exit(_smallBlockMonitor);
+        }
+
         if (block) {
-            _freeBlocks[index] = block->next();
             block->setNext(NULL);
-            j9thread_monitor_exit(_smallBlockMonitor);
             allocation = block + 1; // Return pointer after the header
         } else // Couldn't find suitable free block; need to allocate from segment
         {
-            j9thread_monitor_exit(_smallBlockMonitor);
-
             // Find the first persistent segment with enough free space
-            j9thread_monitor_enter(_segmentMonitor);
+            enterMonitor(_segmentMonitor, _segmentLockStats);
             allocation = allocateFromSegmentLocked(allocSize);
             j9thread_monitor_exit(_segmentMonitor);
         }
     } else // Variable size block allocation
     {
-        j9thread_monitor_enter(_largeBlockMonitor);
+        enterMonitor(_largeBlockMonitor, _bucketLockStats[LARGE_BLOCK_LIST_INDEX]);
         Block *block =
 #if defined(J9VM_OPT_JITSERVER)
             _isJITServer ? allocateFromIndexedListLocked(allocSize) :
@@ -250,7 +283,7 @@ void *PersistentAllocator::allocateInternal(size_t requestedSize)
                     // Exit the variable size list monitor and grab the fixed size list monitor
                     j9thread_monitor_exit(_largeBlockMonitor);
 
-                    j9thread_monitor_enter(_smallBlockMonitor);
+                    enterMonitor(_smallBlockMonitor, _bucketLockStats[excessIndex]);
                     freeFixedSizeBlock(new (pointer_cast<uint8_t *>(block) + allocSize) Block(excess));
                     j9thread_monitor_exit(_smallBlockMonitor);
                 } else {
@@ -272,7 +305,7 @@ void *PersistentAllocator::allocateInternal(size_t requestedSize)
             // Exit the variable size list monitor and grab the segment monitor
             j9thread_monitor_exit(_largeBlockMonitor);
 
-            j9thread_monitor_enter(_segmentMonitor);
+            enterMonitor(_segmentMonitor, _segmentLockStats);
             allocation = allocateFromSegmentLocked(allocSize);
             j9thread_monitor_exit(_segmentMonitor);
         }
@@ -390,6 +423,104 @@ void PersistentAllocator::freeVariableSizeBlock(Block *block)
 }
 
 #if defined(J9VM_OPT_JITSERVER)
+PersistentAllocator::ThreadCache *PersistentAllocator::getThreadCache()
+{
+    if (!_isJITServer)
+        return NULL;
+    TR::CompilationInfoPerThread *compInfoPT = TR::compInfoPT;
+    if (!compInfoPT)
+        return NULL;
+
+    if (!_threadCaches) {
+        allocateThreadCaches();
+        if (!_threadCaches)
+            return NULL;
+    }
+    // _numThreadCaches is set before _threadCaches is published; a stale value of 0 only sends us to the shared lists
+    int32_t compThreadId = compInfoPT->getCompThreadId();
+    if ((compThreadId < 0) || (compThreadId >= _numThreadCaches))
+        return NULL;
+    return reinterpret_cast<ThreadCache *>(_threadCaches + compThreadId * THREAD_CACHE_SLOT_SIZE);
+}
+
+void PersistentAllocator::allocateThreadCaches()
+{
+    // Compilation threads may race to create the caches; the loser sees them under the monitor
+    j9thread_monitor_enter(_smallBlockMonitor);
+    if (!_threadCaches) {
+        int32_t numThreadCaches = TR::CompilationInfo::get()->getNumTotalAllocatedCompilationThreads();
+        size_t size = numThreadCaches * THREAD_CACHE_SLOT_SIZE + CACHE_LINE_SIZE;
+        PORT_ACCESS_FROM_JAVAVM(&_javaVM);
+        void *mem = j9mem_allocate_memory(size, J9MEM_CATEGORY_JIT);
+        if (mem) {
+            memset(mem, 0, size);
+            _threadCachesMemory = mem;
+            _numThreadCaches = numThreadCaches;
+            // The caches must be initialized before other threads can see them
+            VM_AtomicSupport::writeBarrier();
+            _threadCaches = reinterpret_cast<uint8_t *>(
+                ((uintptr_t)mem + CACHE_LINE_SIZE - 1) & ~(uintptr_t)(CACHE_LINE_SIZE - 1));
+        }
+    }
+    j9thread_monitor_exit(_smallBlockMonitor);
+}
+
+PersistentAllocator::Block *PersistentAllocator::allocateFromThreadCache(ThreadCache *cache, size_t index)
+{
+    if (!cache->_freeBlocks[index]) {
+        // Move a batch of blocks from the shared list into the cache
+        enterMonitor(_smallBlockMonitor, _bucketLockStats[index]);
+        Block *first = _freeBlocks[index];
+        Block *last = first;
+        uint32_t numBlocks = 0;
+        if (first) {
+            numBlocks = 1;
+            while (last->next() && (numBlocks < THREAD_CACHE_BATCH_SIZE)) {
+                last = last->next();
+                numBlocks++;
+            }
+            _freeBlocks[index] = last->next();
+            last->setNext(NULL);
+        }
+        j9thread_monitor_exit(_smallBlockMonitor);
+
+        if (!first)
+            return NULL;
+        cache->_freeBlocks[index] = first;
+        cache->_numFreeBlocks[index] = numBlocks;
+    }
+
+    Block *block = cache->_freeBlocks[index];
+    cache->_freeBlocks[index] = block->next();
+    cache->_numFreeBlocks[index]--;
+    return block;
+}
+
+void PersistentAllocator::freeToThreadCache(ThreadCache *cache, size_t index, Block *block)
+{
+    block->setNext(cache->_freeBlocks[index]);
+    cache->_freeBlocks[index] = block;
+    if (++cache->_numFreeBlocks[index] <= THREAD_CACHE_MAX_BLOCKS)
+        return;
+
+    // Keep the most recently freed blocks and give the rest back to the shared list
+    Block *lastKept = block;
+    for (size_t i = 1; i < THREAD_CACHE_BATCH_SIZE; i++)
+        lastKept = lastKept->next();
+    Block *first = lastKept->next();
+    lastKept->setNext(NULL);
+    cache->_numFreeBlocks[index] = THREAD_CACHE_BATCH_SIZE;
+
+    Block *last = first;
+    while (last->next())
+        last = last->next();
+
+    enterMonitor(_smallBlockMonitor, _bucketLockStats[index]);
+    last->setNext(_freeBlocks[index]);
+    _freeBlocks[index] = first;
+    j9thread_monitor_exit(_smallBlockMonitor);
+}
+
 size_t PersistentAllocator::getInterval(size_t blockSize)
 {
     // Find the power-of-two interval that this block size belongs to
@@ -590,11 +721,18 @@ void PersistentAllocator::freeBlock(Block *block)
     //
     size_t const index = freeBlocksIndex(block->size());
     if (index > LARGE_BLOCK_LIST_INDEX) {
-        j9thread_monitor_enter(_smallBlockMonitor);
+#if defined(J9VM_OPT_JITSERVER)
+        ThreadCache *cache = getThreadCache();
+        if (cache) {
+            freeToThreadCache(cache, index, block);
+            return;
+        }
+#endif
+        enterMonitor(_smallBlockMonitor, _bucketLockStats[index]);
         freeFixedSizeBlock(block);
         j9thread_monitor_exit(_smallBlockMonitor);
     } else {
-        j9thread_monitor_enter(_largeBlockMonitor);
+        enterMonitor(_largeBlockMonitor, _bucketLockStats[LARGE_BLOCK_LIST_INDEX]);
 #if defined(J9VM_OPT_JITSERVER)
         if (_isJITServer)
             freeBlockToIndexedList(block);
@@ -623,6 +761,25 @@ void PersistentAllocator::deallocate(void *mem, size_t) throw()
     freeBlock(block);
 }
 
+void PersistentAllocator::printStats()
+{
+    // The counters are read without synchronization; the values are approximate
+    PORT_ACCESS_FROM_JAVAVM(&_javaVM);
+    for (size_t i = 0; i < PERSISTENT_BLOCK_SIZE_BUCKETS; i++) {
+        const LockStats &stats = _bucketLockStats[i];
+        if (stats._acquisitions == 0)
+            continue;
+        if (i == LARGE_BLOCK_LIST_INDEX)
+            j9tty_printf(PORTLIB, "\t\tlarge blocks: lock acquisitions: %llu (contended: %llu)\n", stats._acquisitions,
+                stats._contended);
+        else
+            j9tty_printf(PORTLIB, "\t\t%zu byte blocks: lock acquisitions: %llu (contended: %llu)\n",
+                i * sizeof(void *), stats._acquisitions, stats._contended);
+    }
+    j9tty_printf(PORTLIB, "\t\tsegments: lock acquisitions: %llu (contended: %llu)\n", _segmentLockStats._acquisitions,
+        _segmentLockStats._contended);
+}
+
 // Note: this method has high overhead. Use it only for debugging
 extern "C" {
 #ifdef LINUX
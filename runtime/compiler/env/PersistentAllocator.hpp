@@ -89,6 +89,10 @@ public:
     // be sure that these segments are not actually in use in that case.
     void adviseDontNeedSegments();
 
+    // Print how often the monitors protecting the free lists and the segments were acquired,
+    // and how many of those acquisitions were contended
+    void printStats();
+
 private:
     // Persistent block header
     //
@@ -129,6 +133,15 @@ private:
         return candidateBucket < PERSISTENT_BLOCK_SIZE_BUCKETS ? candidateBucket : LARGE_BLOCK_LIST_INDEX;
     }
 
+    // Acquisitions of a monitor, and how many of them found it held by another thread.
+    // Updated with the corresponding monitor in hand.
+    struct LockStats {
+        uint64_t _acquisitions;
+        uint64_t _contended;
+    };
+
+    void enterMonitor(J9ThreadMonitor *monitor, LockStats &stats);
+
     void *allocateInternal(size_t);
     Block *allocateFromVariableSizeListLocked(size_t allocSize);
     void *allocateFromSegmentLocked(size_t allocSize);
@@ -150,6 +163,9 @@ private:
     int _numSegments;
     bool _disclaimEnabled;
     const J9JavaVM &_javaVM;
+    // Large blocks are protected by _largeBlockMonitor, the other buckets by _smallBlockMonitor
+    LockStats _bucketLockStats[PERSISTENT_BLOCK_SIZE_BUCKETS];
+    LockStats _segmentLockStats;
 
 #if defined(J9VM_OPT_JITSERVER)
     // For JITServer, large freed blocks are put in a doubly linked list ordered by size.
@@ -193,7 +209,31 @@ private:
     void freeBlockToIndexedList(Block *);
     void checkIntegrity(const char msg[]); // for debugging purposes
 
+    // On JITServer, each compilation thread keeps a cache of free fixed-size blocks so that most
+    // small allocations and frees do not need _smallBlockMonitor. An empty bucket is refilled with up
+    // to THREAD_CACHE_BATCH_SIZE blocks from the shared list in a single critical section, and a bucket
+    // that grows past THREAD_CACHE_MAX_BLOCKS returns its least recently freed blocks the same way.
+    // A cache is only accessed by its own compilation thread, so it needs no synchronization.
+    struct ThreadCache {
+        Block *_freeBlocks[PERSISTENT_BLOCK_SIZE_BUCKETS];
+        uint32_t _numFreeBlocks[PERSISTENT_BLOCK_SIZE_BUCKETS];
+    };
+
+    static const size_t THREAD_CACHE_BATCH_SIZE = 16;
+    static const size_t THREAD_CACHE_MAX_BLOCKS = 2 * THREAD_CACHE_BATCH_SIZE;
+    static const size_t CACHE_LINE_SIZE = 64;
+    static const size_t THREAD_CACHE_SLOT_SIZE = (sizeof(ThreadCache) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+
+    ThreadCache *getThreadCache();
+    void allocateThreadCaches();
+    Block *allocateFromThreadCache(ThreadCache *cache, size_t index);
+    void freeToThreadCache(ThreadCache *cache, size_t index, Block *block);
+
     const bool _isJITServer;
+    // One cache line aligned slot per compilation thread, allocated when a compilation thread first uses the allocator
+    uint8_t *volatile _threadCaches;
+    void *_threadCachesMemory;
+    int32_t _numThreadCaches;
     // Since the list of variable-size blocks (the large ones) can become very big,
     // it may generate a lot of overhead during allocation and deallocation because
     // we need to find the right place in this list which is ordered by block size.
@@ -245,7 +245,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getSystemClassFromClassName(const char *name
         = _compInfoPT->getClientData()->getClassBySignatureMap();
 
     {
-        OMR::CriticalSection getSystemClassCS(_compInfoPT->getClientData()->getClassMapMonitor());
+        JITServerReadSection getSystemClassCS(_compInfoPT->getClientData()->getClassMapMonitor());
         auto it = classBySignatureMap.find(key);
         if (it != classBySignatureMap.end())
             return it->second;
@@ -255,7 +255,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getSystemClassFromClassName(const char *name
     stream->write(JITServer::MessageType::VM_getSystemClassFromClassName, className, isVettedForAOT);
     TR_OpaqueClassBlock *clazz = std::get<0>(stream->read<TR_OpaqueClassBlock *>());
     if (clazz) {
-        OMR::CriticalSection getSystemClassCS(_compInfoPT->getClientData()->getClassMapMonitor());
+        JITServerWriteSection getSystemClassCS(_compInfoPT->getClientData()->getClassMapMonitor());
         classBySignatureMap[key] = clazz;
     } else {
         // Class with given name does not exist yet, but it could be
@@ -274,7 +274,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getByteArrayClass()
 bool TR_J9ServerVM::isMethodTracingEnabled(TR_OpaqueMethodBlock *method)
 {
     {
-        OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
         auto it = _compInfoPT->getClientData()->getJ9MethodMap().find((J9Method *)method);
         if (it != _compInfoPT->getClientData()->getJ9MethodMap().end()) {
             return it->second._isMethodTracingEnabled;
@@ -373,7 +373,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getClassFromSignature(const char *sig, int32
     PersistentUnorderedMap<ClassLoaderStringPair, TR_OpaqueClassBlock *> &classBySignatureMap
         = _compInfoPT->getClientData()->getClassBySignatureMap();
     {
-        OMR::CriticalSection classFromSigCS(_compInfoPT->getClientData()->getClassMapMonitor());
+        JITServerReadSection classFromSigCS(_compInfoPT->getClientData()->getClassMapMonitor());
         auto it = classBySignatureMap.find(key);
         if (it != classBySignatureMap.end())
             return it->second;
@@ -395,7 +395,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getClassFromSignature(const char *sig, int32
             // make sure that the class is cached
             J9ROMClass *romClass = TR::Compiler->cls.romClassOf((TR_OpaqueClassBlock *)clazz);
             TR_ASSERT_FATAL(romClass, "class %p could not be cached", clazz);
-            OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+            JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
             auto it = _compInfoPT->getClientData()->getROMClassMap().find(reinterpret_cast<J9Class *>(clazz));
             if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
                 // remember that we cached this class by cp class loader
@@ -405,7 +405,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getClassFromSignature(const char *sig, int32
             }
         }
 
-        OMR::CriticalSection classFromSigCS(_compInfoPT->getClientData()->getClassMapMonitor());
+        JITServerWriteSection classFromSigCS(_compInfoPT->getClientData()->getClassMapMonitor());
         classBySignatureMap[key] = clazz;
     } else {
         ((TR::CompilationInfoPerThreadRemote *)_compInfoPT)->addClassToNullClassSignatureCache(key);
@@ -510,7 +510,7 @@ bool TR_J9ServerVM::jitStaticsAreSame(TR_ResolvedMethod *method1, I_32 cpIndex1,
 
 bool TR_J9ServerVM::getCachedField(J9Class *ramClass, int32_t cpIndex, J9Class **declaringClass, UDATA *field)
 {
-    OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+    JITServerReadSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
     auto it = _compInfoPT->getClientData()->getROMClassMap().find(ramClass);
     if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
         auto &jitFieldsCache = it->second._jitFieldsCache;
@@ -529,7 +529,7 @@ void TR_J9ServerVM::cacheField(J9Class *ramClass, int32_t cpIndex, J9Class *decl
     // Do not cache unresolved fields
     if (field == 0)
         return;
-    OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+    JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
     auto it = _compInfoPT->getClientData()->getROMClassMap().find(ramClass);
     if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
         auto &jitFieldsCache = it->second._jitFieldsCache;
@@ -598,7 +598,7 @@ bool TR_J9ServerVM::classHasBeenExtended(TR_OpaqueClassBlock *clazz)
 
     bool cachedAndNotInCHTable = false;
     {
-        OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
         auto it = clientSessionData->getROMClassMap().find((J9Class *)clazz);
         if (it != clientSessionData->getROMClassMap().end()) {
             if ((it->second._classDepthAndFlags & J9AccClassHasBeenOverridden) != 0)
@@ -619,7 +619,7 @@ bool TR_J9ServerVM::classHasBeenExtended(TR_OpaqueClassBlock *clazz)
         stream->write(JITServer::MessageType::VM_classHasBeenExtended, clazz);
         bool result = std::get<0>(stream->read<bool>());
         if (result) {
-            OMR::CriticalSection cs(clientSessionData->getROMMapMonitor());
+            JITServerWriteSection cs(clientSessionData->getROMMapMonitor());
             auto it = clientSessionData->getROMClassMap().find((J9Class *)clazz);
             TR_ASSERT(it != clientSessionData->getROMClassMap().end(), "Class %p must be cached", clazz);
             it->second._classDepthAndFlags |= J9AccClassHasBeenOverridden;
@@ -731,7 +731,7 @@ bool TR_J9ServerVM::isClassInitialized(TR_OpaqueClassBlock *clazz)
         stream->write(JITServer::MessageType::VM_isClassInitialized, clazz);
         isClassInitialized = std::get<0>(stream->read<bool>());
         if (isClassInitialized) {
-            OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+            JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
             auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class *)clazz);
             if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
                 it->second._classInitialized = isClassInitialized;
@@ -746,7 +746,7 @@ TR_J9ServerVM::getOSRFrameSizeInBytes(TR_OpaqueMethodBlock *method)
 {
     {
         ClientSessionData *clientSessionData = _compInfoPT->getClientData();
-        OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
         auto it = clientSessionData->getJ9MethodMap().find((J9Method *)method);
         if (it != clientSessionData->getJ9MethodMap().end()) {
             return osrFrameSizeRomMethod(it->second._romMethod);
@@ -1096,7 +1096,7 @@ bool TR_J9ServerVM::canAllocateInlineClass(TR_OpaqueClassBlock *clazz)
         stream->write(JITServer::MessageType::VM_isClassInitialized, clazz);
         isClassInitialized = std::get<0>(stream->read<bool>());
         if (isClassInitialized) {
-            OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+            JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
             auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class *)clazz);
             if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
                 it->second._classInitialized = isClassInitialized;
@@ -1122,7 +1122,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getArrayClassFromComponentClass(TR_OpaqueCla
         arrayClass = std::get<0>(stream->read<TR_OpaqueClassBlock *>());
         if (arrayClass) {
             // if client initialized arrayClass, cache the new value
-            OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+            JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
             auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class *)componentClass);
             if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
                 it->second._arrayClass = arrayClass;
@@ -1143,7 +1143,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getNullRestrictedArrayClassFromComponentClas
         nullRestrictedArrayClass = std::get<0>(stream->read<TR_OpaqueClassBlock *>());
         if (nullRestrictedArrayClass) {
             // if client initialized nullRestrictedArrayClass, cache the new value
-            OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+            JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
             auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class *)componentClass);
             if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
                 it->second._nullRestrictedArrayClass = nullRestrictedArrayClass;
@@ -1418,7 +1418,7 @@ TR_OpaqueMethodBlock *TR_J9ServerVM::getMethodFromClass(TR_OpaqueClassBlock *met
     // Only methods visible to the callingClass will be returned. The caching mechanism
     // becomes simpler when we only use it when callingClass is (nil).
     if (!callingClass) {
-        OMR::CriticalSection getMethodFromClassCS(_compInfoPT->getClientData()->getMethodMapMonitor());
+        JITServerReadSection getMethodFromClassCS(_compInfoPT->getClientData()->getMethodMapMonitor());
         auto it = methodMap.find(key);
         if (it != methodMap.end())
             return it->second;
@@ -1435,7 +1435,7 @@ TR_OpaqueMethodBlock *TR_J9ServerVM::getMethodFromClass(TR_OpaqueClassBlock *met
         // unloaded
         bool cache = false;
         {
-            OMR::CriticalSection getClassLoader(_compInfoPT->getClientData()->getROMMapMonitor());
+            JITServerWriteSection getClassLoader(_compInfoPT->getClientData()->getROMMapMonitor());
             auto &romClassMap = _compInfoPT->getClientData()->getROMClassMap();
             auto it = romClassMap.find((J9Class *)methodClass);
             if (it != romClassMap.end()) {
@@ -1447,7 +1447,7 @@ TR_OpaqueMethodBlock *TR_J9ServerVM::getMethodFromClass(TR_OpaqueClassBlock *met
             }
         }
         if (cache) {
-            OMR::CriticalSection getMethodFromClassCS(_compInfoPT->getClientData()->getMethodMapMonitor());
+            JITServerWriteSection getMethodFromClassCS(_compInfoPT->getClientData()->getMethodMapMonitor());
             methodMap[key] = method;
         }
     }
@@ -1577,7 +1577,7 @@ int32_t *TR_J9ServerVM::getReferenceSlotsInClass(TR::Compilation *comp, TR_Opaqu
     bool classIsCached = true;
     // First check the cache
     {
-        OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
         auto it = _compInfoPT->getClientData()->getROMClassMap().find(reinterpret_cast<J9Class *>(clazz));
         if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
             // 'clazz' is cached. How about the reference slot info for this class?
@@ -1618,7 +1618,7 @@ int32_t *TR_J9ServerVM::getReferenceSlotsInClass(TR::Compilation *comp, TR_Opaqu
 
     // If the class is cached, we can also cache the information about the reference slots.
     if (classIsCached) {
-        OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
         auto it = _compInfoPT->getClientData()->getROMClassMap().find(reinterpret_cast<J9Class *>(clazz));
         if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
             auto &refSlotsCache = it->second._referenceSlotsInClass;
@@ -1694,7 +1694,7 @@ bool TR_J9ServerVM::isContinuationClass(TR_OpaqueClassBlock *clazz)
 TR_OpaqueClassBlock *TR_J9ServerVM::getClassFromMethodBlock(TR_OpaqueMethodBlock *method)
 {
     {
-        OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
         auto it = _compInfoPT->getClientData()->getJ9MethodMap().find((J9Method *)method);
         if (it != _compInfoPT->getClientData()->getJ9MethodMap().end()) {
             return (TR_OpaqueClassBlock *)it->second.definingClass();
@@ -1900,7 +1900,7 @@ bool TR_J9ServerVM::instanceOfOrCheckCastHelper(J9Class *instanceClass, J9Class
     // When castClass is an ancestor/interface of class instanceClass, can avoid a remote message,
     // since superclasses and interfaces are cached on the server
     {
-        OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
         auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class *)instanceClass);
         if (it != _compInfoPT->getClientData()->getROMClassMap().end()) {
             TR_OpaqueClassBlock *instanceClassOffset = (TR_OpaqueClassBlock *)instanceClass;
@@ -2033,7 +2033,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getClassFromCP(J9ConstantPool *cp)
     auto &constantPoolMap = _compInfoPT->getClientData()->getConstantPoolToClassMap();
     {
         // check if the value is cached
-        OMR::CriticalSection getConstantPoolMonitor(_compInfoPT->getClientData()->getConstantPoolMonitor());
+        JITServerReadSection getConstantPoolMonitor(_compInfoPT->getClientData()->getConstantPoolMonitor());
         auto it = constantPoolMap.find(cp);
         if (it != constantPoolMap.end())
             return it->second;
@@ -2043,7 +2043,7 @@ TR_OpaqueClassBlock *TR_J9ServerVM::getClassFromCP(J9ConstantPool *cp)
     stream->write(JITServer::MessageType::VM_getClassFromCP, cp);
     TR_OpaqueClassBlock *clazz = std::get<0>(stream->read<TR_OpaqueClassBlock *>());
     if (clazz) {
-        OMR::CriticalSection getConstantPoolMonitor(_compInfoPT->getClientData()->getConstantPoolMonitor());
+        JITServerWriteSection getConstantPoolMonitor(_compInfoPT->getClientData()->getConstantPoolMonitor());
         constantPoolMap.insert({ cp, clazz });
     }
     return clazz;
@@ -2097,7 +2097,7 @@ J9ROMMethod *TR_J9ServerVM::getROMMethodFromRAMMethod(J9Method *ramMethod)
 {
     {
         // Check persistent cache first
-        OMR::CriticalSection J9MethodMapMonitor(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection J9MethodMapMonitor(_compInfoPT->getClientData()->getROMMapMonitor());
         auto it = _compInfoPT->getClientData()->getJ9MethodMap().find(ramMethod);
         if (it != _compInfoPT->getClientData()->getJ9MethodMap().end()) {
             return it->second._origROMMethod;
@@ -2493,7 +2493,7 @@ bool TR_J9ServerVM::isStable(J9Class *fieldClass, int32_t cpIndex)
 {
     // See if we cached the presence of the annotation for this class and cpIndex
     {
-        OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
         // The fieldClass is guaranteed to be cached at the server because this
         // method is called from a ResolvedMethod
         auto &cache = JITServerHelpers::getJ9ClassInfo(_compInfoPT, fieldClass)._isStableCache;
@@ -2515,7 +2515,7 @@ bool TR_J9ServerVM::isStable(J9Class *fieldClass, int32_t cpIndex)
 
     // Cache the answer
     {
-        OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
         auto &cache = JITServerHelpers::getJ9ClassInfo(_compInfoPT, fieldClass)._isStableCache;
         cache.insert({ cpIndex, answer });
     }
@@ -130,7 +130,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::definingClassFromCPFieldRef(T
 {
     TR::CompilationInfoPerThread *compInfoPT = _fe->_compInfoPT;
     {
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &cache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDefiningClassCache;
         auto it = cache.find(cpIndex);
         if (it != cache.end()) {
@@ -144,7 +144,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::definingClassFromCPFieldRef(T
     TR_OpaqueClassBlock *resolvedClass = std::get<0>(_stream->read<TR_OpaqueClassBlock *>());
     // Do not cache if the class is unresolved, because it may become resolved later on
     if (resolvedClass) {
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &cache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDefiningClassCache;
         cache.insert({ cpIndex, resolvedClass });
     }
@@ -170,7 +170,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::getClassFromConstantPool(TR::
     {
         // This persistent cache must only be checked when doRuntimeResolve is false,
         // otherwise a non method handle thunk compilation can return cached value, instead of NULL.
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &constantClassPoolCache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._constantClassPoolCache;
         auto it = constantClassPoolCache.find(cpIndex);
         if (it != constantClassPoolCache.end()) {
@@ -185,7 +185,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::getClassFromConstantPool(TR::
     TR_OpaqueClassBlock *resolvedClass = std::get<0>(_stream->read<TR_OpaqueClassBlock *>());
 
     if (resolvedClass) {
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &constantClassPoolCache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._constantClassPoolCache;
         constantClassPoolCache.insert({ cpIndex, resolvedClass });
     }
@@ -197,7 +197,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::getDeclaringClassFromFieldOrS
 {
     TR::CompilationInfoPerThread *compInfoPT = _fe->_compInfoPT;
     {
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &cache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDeclaringClassCache;
         auto it = cache.find(cpIndex);
         if (it != cache.end()) {
@@ -211,7 +211,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::getDeclaringClassFromFieldOrS
     _stream->write(JITServer::MessageType::ResolvedMethod_getDeclaringClassFromFieldOrStatic, _remoteMirror, cpIndex);
     TR_OpaqueClassBlock *declaringClass = std::get<0>(_stream->read<TR_OpaqueClassBlock *>());
     if (declaringClass) {
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &cache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDeclaringClassCache;
         cache.insert({ cpIndex, declaringClass });
     }
@@ -226,7 +226,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::classOfStatic(I_32 cpIndex, b
 
     auto compInfoPT = static_cast<TR::CompilationInfoPerThreadRemote *>(_fe->_compInfoPT);
     {
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &classOfStaticCache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._classOfStaticCache;
         auto it = classOfStaticCache.find(cpIndex);
         if (it != classOfStaticCache.end())
@@ -243,7 +243,7 @@ TR_OpaqueClassBlock *TR_ResolvedJ9JITServerMethod::classOfStatic(I_32 cpIndex, b
         // reacquire monitor and cache, if client returned a valid class
         // if client returned NULL, don't cache, because class might not be fully initialized,
         // so the result may change in the future
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &classOfStaticCache = JITServerHelpers::getJ9ClassInfo(compInfoPT, _ramClass)._classOfStaticCache;
         classOfStaticCache.insert({ cpIndex, classOfStatic });
     } else {
@@ -499,7 +499,7 @@ bool TR_ResolvedJ9JITServerMethod::getCachedFieldAttributes(int32_t cpIndex, TR_
     auto compInfoPT = static_cast<TR::CompilationInfoPerThreadRemote *>(_fe->_compInfoPT);
     {
         // First, search a global cache
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &attributesCache = getAttributesCache(isStatic);
         auto it = attributesCache.find(cpIndex);
         if (it != attributesCache.end()) {
@@ -530,7 +530,7 @@ void TR_ResolvedJ9JITServerMethod::cacheFieldAttributes(int32_t cpIndex, const T
         compInfoPT->cacheFieldOrStaticAttributes((TR_OpaqueClassBlock *)_ramClass, cpIndex, attributes, isStatic);
     } else {
         // field is resolved in CP, can cache globally per RAM class.
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &attributesCache = getAttributesCache(isStatic);
 #if defined(DEBUG) || defined(PROD_WITH_ASSUMES)
         TR_ASSERT(canCacheFieldAttributes(cpIndex, attributes, isStatic),
@@ -1736,7 +1736,7 @@ void TR_ResolvedJ9JITServerMethod::cacheFields()
     auto &declaringClasses = std::get<0>(recv);
     auto &fields = std::get<1>(recv);
     TR_ASSERT(numFields == declaringClasses.size(), "Number of received fields does not match the requested number");
-    OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+    JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
     for (int32_t i = 0; i < numFields; ++i) {
         serverVM->cacheField(ramClass, cpIndices[i], declaringClasses[i], fields[i]);
     }
@@ -2547,7 +2547,7 @@ TR_J9ServerMethod::TR_J9ServerMethod(TR_FrontEnd *fe, TR_Memory *trMemory, J9Cla
     bool cached = false;
     {
         // look up parameters for construction of this method in a cache first
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerReadSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &cache = JITServerHelpers::getJ9ClassInfo(compInfoPT, aClazz)._J9MethodNameCache;
         // search the cache for existing method parameters
         auto it = cache.find(cpIndex);
@@ -2569,7 +2569,7 @@ TR_J9ServerMethod::TR_J9ServerMethod(TR_FrontEnd *fe, TR_Memory *trMemory, J9Cla
         methodNameStr = std::get<1>(recv);
         methodSignatureStr = std::get<2>(recv);
 
-        OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
         auto &cache = JITServerHelpers::getJ9ClassInfo(compInfoPT, aClazz)._J9MethodNameCache;
         cache.insert({
             cpIndex, { classNameStr, methodNameStr, methodSignatureStr }
@@ -268,10 +268,37 @@ static BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
 ClientStream::ClientStream(TR::PersistentInfo *info)
     : CommunicationStream()
     , _versionCheckStatus(NOT_DONE)
+    , _serverGeneration(0)
 {
-    int connfd = openConnection(info->getJITServerAddress(), info->getJITServerPort(), info->getSocketTimeout());
-    BIO *ssl = openSSLConnection(_sslCtx, connfd);
+    std::string address = info->getJITServerAddress();
+    uint32_t port = info->getJITServerPort();
+    ServerList *serverList = ServerList::get();
+    if (serverList)
+        _serverGeneration = serverList->getConnectionTarget(address, port);
+
+    int connfd = -1;
+    BIO *ssl = NULL;
+    try {
+        connfd = openConnection(address, port, info->getSocketTimeout());
+        ssl = openSSLConnection(_sslCtx, connfd);
+    } catch (const StreamFailure &e) {
+        // When several servers are configured, try another one before backing off.
+        // Only this stream knows which generation of the server list the failed server belongs to.
+        if (serverList && !e.retryConnectionImmediately()
+            && serverList->connectionFailed(TR::CompilationInfo::get(), _serverGeneration))
+            throw StreamFailure(e.what(), true);
+        throw;
+    }
     initStream(connfd, ssl);
+    if (serverList)
+        serverList->connectionEstablished(_serverGeneration);
     _numConnectionsOpened++;
 }
+
+void ClientStream::setVersionCheckStatus()
+{
+    _versionCheckStatus = PASSED;
+    if ((TR::Options::_jitserverMessageCompressionThreshold > 0) && !isCompressionEnabled())
+        requestCompression(TR::Options::_jitserverMessageCompressionThreshold);
+}
 }; // namespace JITServer
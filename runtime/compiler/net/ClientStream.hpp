@@ -28,6 +28,7 @@
 #include "ilgen/J9IlGeneratorMethodDetails.hpp"
 #include "net/RawTypeConvert.hpp"
 #include "net/CommunicationStream.hpp"
+#include "net/ServerList.hpp"
 
 namespace JITServer {
 enum VersionCheckStatus {
@@ -139,7 +140,30 @@ public:
 
     VersionCheckStatus getVersionCheckStatus() { return _versionCheckStatus; }
 
-    void setVersionCheckStatus() { _versionCheckStatus = PASSED; }
+    /**
+       @brief Record that the server accepted the version of this client
+
+       Message compression, if enabled, is requested from this point on. The first exchange
+       on a connection is never compressed: a server with a different protocol version would
+       read the compression flags as part of the frame size and never reach its version check.
+    */
+    void setVersionCheckStatus();
+
+    /**
+       @brief Generation of the server list this stream was opened for
+    */
+    uint32_t getServerGeneration() const { return _serverGeneration; }
+
+    /**
+       @brief Answers whether this stream is connected to the server that new requests must go to
+
+       Always true when a single server is configured.
+    */
+    bool isConnectedToCurrentServer() const
+    {
+        ServerList *serverList = ServerList::get();
+        return !serverList || (serverList->getGeneration() == _serverGeneration);
+    }
 
     /**
        @brief Function called when JITServer was discovered to be incompatible with the client
@@ -185,6 +209,7 @@ private:
     static int _numConnectionsOpened;
     static int _numConnectionsClosed;
     VersionCheckStatus _versionCheckStatus; // indicates whether a version checking has been performed
+    uint32_t _serverGeneration; // ServerList generation at the time the connection was opened
     static int _incompatibilityCount;
     static uint64_t _incompatibleStartTime; // Time when version incomptibility has been detected
     static const uint64_t
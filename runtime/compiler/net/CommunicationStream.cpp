@@ -24,6 +24,7 @@
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
 #include "net/CommunicationStream.hpp"
+#include "zlib.h"
 
 namespace JITServer {
 
@@ -36,6 +37,11 @@ uint32_t CommunicationStream::_numConsecutiveReadErrorsOfSameType = 0;
 #if defined(MESSAGE_SIZE_STATS)
 TR_Stats CommunicationStream::_msgSizeStats[];
 #endif /* defined(MESSAGE_SIZE_STATS) */
+uint32_t CommunicationStream::_numCompressedMsgsSent = 0;
+uint64_t CommunicationStream::_totalBytesBeforeCompression = 0;
+uint64_t CommunicationStream::_totalBytesAfterCompression = 0;
+uint32_t CommunicationStream::_numCompressedMsgsReceived = 0;
+uint64_t CommunicationStream::_totalCompressedBytesReceived = 0;
 
 void CommunicationStream::initConfigurationFlags()
 {
@@ -74,6 +80,71 @@ void CommunicationStream::initSSL()
     // It's redundant and doesn't need to be called
 }
 
+MessageBuffer *CommunicationStream::getCompressionBuffer(uint32_t requiredSize)
+{
+    if (!_compressionBuffer)
+        _compressionBuffer = new (TR::Compiler->persistentGlobalAllocator()) MessageBuffer();
+    // Nothing needs to be preserved across uses of the scratch buffer
+    _compressionBuffer->clear();
+    _compressionBuffer->expandIfNeeded(requiredSize);
+    return _compressionBuffer;
+}
+
+// Compress the serialized message into the scratch buffer and prepend the frame header.
+// Return the size of the compressed frame, or 0 if the message could not be made smaller.
+uint32_t CommunicationStream::compressMessage(const char *serialMsg, uint32_t serialSize)
+{
+    if (serialSize <= COMPRESSED_FRAME_HEADER_SIZE)
+        return 0;
+
+    MessageBuffer *buffer = getCompressionBuffer(serialSize);
+    uint32_t *frame = reinterpret_cast<uint32_t *>(buffer->getBufferStart());
+
+    // Only accept outputs that save at least the space taken by the extra frame header
+    uLongf compressedSize = serialSize - COMPRESSED_FRAME_HEADER_SIZE;
+    int rc = compress2(reinterpret_cast<Bytef *>(frame) + COMPRESSED_FRAME_HEADER_SIZE, &compressedSize,
+        reinterpret_cast<const Bytef *>(serialMsg), serialSize, Z_BEST_SPEED);
+    if (Z_OK != rc)
+        return 0; // Z_BUF_ERROR: incompressible data; send the message as is
+
+    uint32_t frameSize = COMPRESSED_FRAME_HEADER_SIZE + (uint32_t)compressedSize;
+    frame[0] = frameSize | MESSAGE_COMPRESSED_FLAG | (_requestCompression ? MESSAGE_REQUEST_COMPRESSION_FLAG : 0);
+    frame[1] = serialSize;
+
+    _numCompressedMsgsSent++;
+    _totalBytesBeforeCompression += serialSize;
+    _totalBytesAfterCompression += frameSize;
+    return frameSize;
+}
+
+// The compressed frame has been read into the message buffer. Inflate it in place
+// so that the message buffer ends up holding the original serialized message.
+void CommunicationStream::decompressMessage(Message &msg, uint32_t frameSize)
+{
+    if (frameSize < COMPRESSED_FRAME_HEADER_SIZE)
+        throw JITServer::StreamFailure("JITServer I/O error: compressed frame too small");
+
+    uint32_t compressedSize = frameSize - COMPRESSED_FRAME_HEADER_SIZE;
+    uint32_t serializedSize = ((uint32_t *)msg.getBufferStartForRead())[1];
+    if ((serializedSize > MESSAGE_SIZE_MASK) || (serializedSize < sizeof(uint32_t)))
+        throw JITServer::StreamFailure("JITServer I/O error: invalid uncompressed message size");
+
+    // Move the compressed stream out of the way, since the message buffer is the inflate destination
+    MessageBuffer *buffer = getCompressionBuffer(compressedSize);
+    memcpy(buffer->getBufferStart(), msg.getBufferStartForRead() + COMPRESSED_FRAME_HEADER_SIZE, compressedSize);
+
+    msg.expandBufferIfNeeded(serializedSize);
+    uLongf decompressedSize = serializedSize;
+    int rc = uncompress(reinterpret_cast<Bytef *>(msg.getBufferStartForRead()), &decompressedSize,
+        reinterpret_cast<const Bytef *>(buffer->getBufferStart()), compressedSize);
+    if ((Z_OK != rc) || (decompressedSize != serializedSize)
+        || (((uint32_t *)msg.getBufferStartForRead())[0] != serializedSize))
+        throw JITServer::StreamFailure("JITServer I/O error: failed to decompress message");
+
+    _numCompressedMsgsReceived++;
+    _totalCompressedBytesReceived += frameSize;
+}
+
 void CommunicationStream::readMessage(Message &msg)
 {
     msg.clearForRead();
@@ -92,7 +163,8 @@ void CommunicationStream::readMessage(Message &msg)
     }
 
     // bytesRead >= sizeof(uint32_t)
-    uint32_t serializedSize = ((uint32_t *)buffer)[0];
+    uint32_t frameHeader = ((uint32_t *)buffer)[0];
+    uint32_t serializedSize = frameHeader & MESSAGE_SIZE_MASK;
     if (bytesRead > serializedSize) {
         throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
     }
@@ -112,6 +184,18 @@ void CommunicationStream::readMessage(Message &msg)
         readBlocking(buffer + bytesRead, bytesLeftToRead);
     }
 
+    // The peer asks for compressed messages; start compressing on this connection
+    if ((frameHeader & MESSAGE_REQUEST_COMPRESSION_FLAG) && !isCompressionEnabled()) {
+        _compressionThreshold = (TR::Options::_jitserverMessageCompressionThreshold > 0)
+            ? TR::Options::_jitserverMessageCompressionThreshold
+            : DEFAULT_COMPRESSION_THRESHOLD;
+    }
+
+    if (frameHeader & MESSAGE_COMPRESSED_FLAG) {
+        decompressMessage(msg, serializedSize);
+        serializedSize = ((uint32_t *)msg.getBufferStartForRead())[0];
+    }
+
     msg.setSerializedSize(serializedSize);
 
     // rebuild the message
@@ -128,8 +212,20 @@ void CommunicationStream::readMessage(Message &msg)
 void CommunicationStream::writeMessage(Message &msg)
 {
     char *serialMsg = msg.serialize();
-    // write serialized message to the socket
-    writeBlocking(serialMsg, msg.serializedSize());
+    uint32_t serialSize = msg.serializedSize();
+    TR_ASSERT_FATAL(serialSize <= MESSAGE_SIZE_MASK, "Message size %u is too large", serialSize);
+    uint32_t frameSize = 0;
+    if (isCompressionEnabled() && (serialSize >= _compressionThreshold))
+        frameSize = compressMessage(serialMsg, serialSize);
+
+    if (frameSize) {
+        writeBlocking(_compressionBuffer->getBufferStart(), frameSize);
+    } else {
+        if (_requestCompression)
+            *(uint32_t *)serialMsg |= MESSAGE_REQUEST_COMPRESSION_FLAG;
+        // write serialized message to the socket
+        writeBlocking(serialMsg, serialSize);
+    }
     msg.clearForWrite();
 }
 
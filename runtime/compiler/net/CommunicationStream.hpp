@@ -66,6 +66,12 @@ public:
 #if defined(MESSAGE_SIZE_STATS)
     static TR_Stats _msgSizeStats[MessageType::MessageType_MAXTYPE];
 #endif /* defined(MESSAGE_SIZE_STATS) */
+    // Message compression statistics; sizes are in bytes
+    static uint32_t _numCompressedMsgsSent;
+    static uint64_t _totalBytesBeforeCompression; // Sum of original sizes of the compressed messages sent
+    static uint64_t _totalBytesAfterCompression; // Sum of sizes of the compressed frames sent
+    static uint32_t _numCompressedMsgsReceived;
+    static uint64_t _totalCompressedBytesReceived; // Sum of sizes of the compressed frames received
 
     static void initConfigurationFlags();
 
@@ -97,14 +103,29 @@ public:
 
     static bool shouldReadRetry() { return (_numConsecutiveReadErrorsOfSameType < MAX_READ_RETRY); }
 
+    /**
+       @brief Whether messages of at least getCompressionThreshold() bytes are compressed
+       before being sent on this connection.
+    */
+    bool isCompressionEnabled() const { return _compressionThreshold != 0; }
+
+    uint32_t getCompressionThreshold() const { return _compressionThreshold; }
+
 protected:
     CommunicationStream()
         : _ssl(NULL)
         , _connfd(-1)
+        , _compressionThreshold(0)
+        , _requestCompression(false)
+        , _compressionBuffer(NULL)
     {}
 
     virtual ~CommunicationStream()
     {
+        if (_compressionBuffer) {
+            _compressionBuffer->~MessageBuffer();
+            TR::Compiler->persistentGlobalAllocator().deallocate(_compressionBuffer);
+        }
         if (_ssl)
             (*OBIO_free_all)(_ssl);
         if (_connfd != -1)
@@ -124,10 +145,39 @@ protected:
 
     int getConnFD() const { return _connfd; }
 
+    /**
+       @brief Ask the peer to compress the messages it sends on this connection,
+       and compress outgoing messages of at least threshold bytes.
+
+       Used by the client when compression is enabled with -Xjit:jitserverMessageCompressionThreshold=<nnn>,
+       once the server has accepted the client version (see ClientStream::setVersionCheckStatus()).
+       The server turns on compression for a connection when it receives the first frame
+       carrying MESSAGE_REQUEST_COMPRESSION_FLAG.
+    */
+    void requestCompression(uint32_t threshold)
+    {
+        _compressionThreshold = threshold;
+        _requestCompression = true;
+    }
+
+    // The most significant bits of the size word of a frame are used as flags.
+    // Compressed frames have the following layout:
+    //   [uint32_t frameSize | flags][uint32_t uncompressed message size][zlib stream of the whole message]
+    static const uint32_t MESSAGE_COMPRESSED_FLAG = 0x80000000;
+    static const uint32_t MESSAGE_REQUEST_COMPRESSION_FLAG = 0x40000000;
+    static const uint32_t MESSAGE_SIZE_MASK = 0x3FFFFFFF;
+    static const uint32_t COMPRESSED_FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+    // Threshold used by the server for connections on which the client requested compression,
+    // unless a different value is specified with -Xjit:jitserverMessageCompressionThreshold=<nnn>
+    static const uint32_t DEFAULT_COMPRESSION_THRESHOLD = 4096;
+
     BIO *_ssl; // SSL connection, null if not using SSL
     int _connfd;
     ServerMessage _sMsg;
     ClientMessage _cMsg;
+    uint32_t _compressionThreshold; // 0 if outgoing messages are never compressed on this connection
+    bool _requestCompression; // Whether outgoing frames ask the peer to compress its messages
+    MessageBuffer *_compressionBuffer; // Scratch space for (de)compression, allocated lazily
 
     // When increasing a version number here (especially MINOR_NUMBER), please
     // also change the ID comment to a unique value, preferably one that has
@@ -140,11 +190,15 @@ protected:
     // likely to lose an increment when merging/rebasing/etc.
     //
     static const uint8_t MAJOR_NUMBER = 1;
-    static const uint16_t MINOR_NUMBER = 105; // ID: etwSOwaRRyEiXWkBxSiP
+    static const uint16_t MINOR_NUMBER = 108; // ID: kQ7v0Zr3XbN1sYd2mLe8
     static const uint8_t PATCH_NUMBER = 0;
     static uint32_t CONFIGURATION_FLAGS;
 
 private:
+    MessageBuffer *getCompressionBuffer(uint32_t requiredSize);
+    uint32_t compressMessage(const char *serialMsg, uint32_t serialSize);
+    void decompressMessage(Message &msg, uint32_t frameSize);
+
     void readBlocking(char *data, size_t size)
     {
         size_t totalBytesRead = 0;
@@ -248,6 +248,7 @@ const char *messageNames[] = {
     "CHTable_clearReservable",
     "IProfiler_profilingSample",
     "IProfiler_searchForMethodSample",
+    "IProfiler_profilingSampleBatch",
     "Recompilation_getJittedBodyInfoFromPC",
     "KnownObjectTable_getOrCreateIndexAt",
     "KnownObjectTable_getExistingIndexAt",
@@ -272,6 +272,7 @@ enum MessageType : uint16_t {
     // for JITServerIProfiler
     IProfiler_profilingSample,
     IProfiler_searchForMethodSample,
+    IProfiler_profilingSampleBatch,
 
     Recompilation_getJittedBodyInfoFromPC,
 
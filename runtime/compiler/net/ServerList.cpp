@@ -0,0 +1,308 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "net/ServerList.hpp"
+#include "control/CompilationRuntime.hpp"
+#include "control/JITServerHelpers.hpp"
+#include "control/Options.hpp"
+#include "env/PersistentInfo.hpp"
+#include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include <stdlib.h>
+
+namespace JITServer {
+ServerList *ServerList::_instance = NULL;
+
+ServerList::ServerList(OMRPortLibrary *portLibrary, TR::Monitor *monitor)
+    : _portLibrary(portLibrary)
+    , _monitor(monitor)
+    , _current(0)
+    , _generation(0)
+    , _lastSwitchTime(0)
+{}
+
+static bool parsePort(const std::string &str, uint32_t &port)
+{
+    if (str.empty() || (str.find_first_not_of("0123456789") != std::string::npos))
+        return false;
+    unsigned long value = strtoul(str.c_str(), NULL, 10);
+    if ((value == 0) || (value > 65535))
+        return false;
+    port = (uint32_t)value;
+    return true;
+}
+
+bool ServerList::parse(const std::string &option, uint32_t defaultPort, std::vector<Server> &servers)
+{
+    size_t start = 0;
+    while (start <= option.size()) {
+        size_t end = option.find(',', start);
+        if (end == std::string::npos)
+            end = option.size();
+        std::string entry = option.substr(start, end - start);
+        start = end + 1;
+
+        std::string address = entry;
+        uint32_t port = defaultPort;
+        if (!entry.empty() && (entry[0] == '[')) {
+            // [IPv6 address] or [IPv6 address]:port
+            size_t close = entry.find(']');
+            if (close == std::string::npos)
+                return false;
+            address = entry.substr(1, close - 1);
+            if (close + 1 < entry.size()) {
+                if ((entry[close + 1] != ':') || !parsePort(entry.substr(close + 2), port))
+                    return false;
+            }
+        } else if (entry.find(':') == entry.rfind(':') && (entry.find(':') != std::string::npos)) {
+            // host:port; an address with more than one ':' is an IPv6 address without a port
+            size_t colon = entry.find(':');
+            address = entry.substr(0, colon);
+            if (!parsePort(entry.substr(colon + 1), port))
+                return false;
+        }
+        if (address.empty())
+            return false;
+        servers.push_back(Server(address, port));
+    }
+    return !servers.empty();
+}
+
+bool ServerList::init(TR::PersistentInfo *info, OMRPortLibrary *portLibrary)
+{
+    std::vector<Server> servers;
+    if (!parse(info->getJITServerAddress(), info->getJITServerPort(), servers)) {
+        OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+        omrtty_printf("JITServer: cannot parse the server list '%s' given to -XX:JITServerAddress\n",
+            info->getJITServerAddress().c_str());
+        return false;
+    }
+
+    if (!_instance) {
+        TR::Monitor *monitor = TR::Monitor::create("JITServerListMonitor");
+        if (!monitor)
+            return false;
+        _instance = new (PERSISTENT_NEW) ServerList(portLibrary, monitor);
+        if (!_instance)
+            return false;
+    }
+
+    OMR::CriticalSection cs(_instance->_monitor);
+    _instance->_servers.swap(servers);
+    // Spread clients across servers: different clients start with different servers
+    _instance->_current = (size_t)(info->getClientUID() % _instance->_servers.size());
+    _instance->_generation++;
+    _instance->_lastSwitchTime = 0;
+
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer) && (_instance->_servers.size() > 1)) {
+        for (size_t i = 0; i < _instance->_servers.size(); ++i)
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Server #%d: %s port: %u%s", (int)i,
+                _instance->_servers[i]._address.c_str(), _instance->_servers[i]._port,
+                (i == _instance->_current) ? " (initial)" : "");
+    }
+    return true;
+}
+
+uint32_t ServerList::getConnectionTarget(std::string &address, uint32_t &port)
+{
+    OMR::CriticalSection cs(_monitor);
+    const Server &server = _servers[_current];
+    address = server._address;
+    port = server._port;
+    return _generation;
+}
+
+void ServerList::connectionEstablished(uint32_t generation)
+{
+    if (_servers.size() < 2)
+        return;
+    OMR::CriticalSection cs(_monitor);
+    if (generation == _generation) {
+        _servers[_current]._waitTimeMs = 0;
+        _servers[_current]._nextRetryTime = 0;
+    }
+}
+
+bool ServerList::connectionFailed(TR::CompilationInfo *compInfo, uint32_t generation)
+{
+    if (_servers.size() < 2)
+        return false;
+
+    OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+    uint64_t now = omrtime_current_time_millis();
+    size_t current;
+    size_t target;
+    bool reachable = false;
+    {
+        OMR::CriticalSection cs(_monitor);
+        // The server that failed is no longer the current one; the current one may be tried right away
+        if (generation != _generation)
+            return isReachable(_servers[_current], now);
+
+        Server &failed = _servers[_current];
+        failed._waitTimeMs = failed._waitTimeMs ? failed._waitTimeMs * 2 : TR::Options::_reconnectWaitTimeMs;
+        failed._nextRetryTime = now + failed._waitTimeMs;
+
+        // Prefer the next server that is not backing off; otherwise the one that can be retried first
+        current = _current;
+        target = _current;
+        for (size_t i = 1; i < _servers.size(); ++i) {
+            size_t index = (_current + i) % _servers.size();
+            if (isReachable(_servers[index], now)) {
+                target = index;
+                reachable = true;
+                break;
+            }
+            if (_servers[index]._nextRetryTime < _servers[target]._nextRetryTime)
+                target = index;
+        }
+    }
+
+    if (target == current)
+        return false;
+    return switchServer(compInfo, generation, target, "connection failure") && reachable;
+}
+
+void ServerList::compilationDone(TR::CompilationInfo *compInfo, uint32_t generation, uint64_t latencyUs,
+    ServerMemoryState memoryState, ServerActiveThreadsState activeThreadsState)
+{
+    if (_servers.size() < 2)
+        return;
+
+    OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+    uint64_t now = omrtime_current_time_millis();
+    size_t current;
+    size_t target;
+    const char *reason = NULL;
+    {
+        OMR::CriticalSection cs(_monitor);
+        if (generation != _generation) // Result from a server this client has already moved away from
+            return;
+
+        Server &server = _servers[_current];
+        server._avgLatencyUs
+            = server._numCompilations ? (server._avgLatencyUs * 7 + latencyUs) / 8 : latencyUs; // EWMA, alpha = 1/8
+        server._numCompilations++;
+        server._memoryState = memoryState;
+        server._activeThreadsState = activeThreadsState;
+        server._lastUpdateTime = now;
+
+        if (now - _lastSwitchTime < (uint64_t)TR::Options::_jitserverServerSwitchInterval)
+            return;
+        current = _current;
+        target = findRebalanceTarget(now, reason);
+    }
+
+    if (target != current)
+        switchServer(compInfo, generation, target, reason);
+}
+
+bool ServerList::isOverloaded(const Server &server, uint64_t now) const
+{
+    if (now - server._lastUpdateTime > SERVER_STATE_EXPIRATION_MS)
+        return false;
+    return (server._memoryState != ServerMemoryState::NORMAL)
+        || (server._activeThreadsState != ServerActiveThreadsState::NORMAL_THREAD);
+}
+
+// Must be called with _monitor in hand. Returns _current if the client should stay where it is.
+size_t ServerList::findRebalanceTarget(uint64_t now, const char *&reason) const
+{
+    const Server &current = _servers[_current];
+    size_t target = _current;
+    if (isOverloaded(current, now)) {
+        // Go to the fastest known server that is not overloaded, or to a server never used so far
+        for (size_t i = 1; i < _servers.size(); ++i) {
+            size_t index = (_current + i) % _servers.size();
+            const Server &server = _servers[index];
+            if (!isReachable(server, now) || isOverloaded(server, now))
+                continue;
+            const Server &best = _servers[target];
+            if ((target == _current) || (server._numCompilations == 0)
+                || ((best._numCompilations != 0) && (server._avgLatencyUs < best._avgLatencyUs)))
+                target = index;
+        }
+        reason = "server overloaded";
+    } else if (current._numCompilations >= MIN_LATENCY_SAMPLES) {
+        uint64_t bestLatencyUs = current._avgLatencyUs / LATENCY_SWITCH_FACTOR;
+        for (size_t i = 1; i < _servers.size(); ++i) {
+            size_t index = (_current + i) % _servers.size();
+            const Server &server = _servers[index];
+            if (!isReachable(server, now) || isOverloaded(server, now)
+                || (server._numCompilations < MIN_LATENCY_SAMPLES))
+                continue;
+            if (server._avgLatencyUs < bestLatencyUs) {
+                bestLatencyUs = server._avgLatencyUs;
+                target = index;
+            }
+        }
+        reason = "lower latency";
+    }
+    return target;
+}
+
+// Switching must not interleave with a compilation request collecting the updates
+// (unloaded classes, CHTable changes) the server needs, so it is done with the
+// sequencing monitor in hand: requests for the old server that did not collect their
+// updates yet will notice the new generation and retry with a new connection.
+bool ServerList::switchServer(TR::CompilationInfo *compInfo, uint32_t fromGeneration, size_t index,
+    const char *reason)
+{
+    OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+    TR::PersistentInfo *persistentInfo = compInfo->getPersistentInfo();
+    {
+        OMR::CriticalSection sequencingLock(compInfo->getSequencingMonitor());
+        OMR::CriticalSection cs(_monitor);
+        if (fromGeneration != _generation) // Another thread switched first
+            return false;
+
+        if (TR::Options::getVerboseOption(TR_VerboseJITServerConns))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "t=%6u Switching from server %s:%u to server %s:%u (%s)", (uint32_t)persistentInfo->getElapsedTime(),
+                _servers[_current]._address.c_str(), _servers[_current]._port, _servers[index]._address.c_str(),
+                _servers[index]._port, reason);
+
+        _current = index;
+        _generation++;
+        _lastSwitchTime = omrtime_current_time_millis();
+
+        // Use a new identity so that the new server starts a fresh session for this client
+        uint64_t oldClientUID = persistentInfo->getClientUID();
+        uint64_t clientUID = JITServerHelpers::generateUID();
+        while (clientUID == oldClientUID)
+            clientUID = JITServerHelpers::generateUID();
+        persistentInfo->setClientUID(clientUID);
+        compInfo->getJITConfig()->clientUID = clientUID;
+        persistentInfo->setServerUID(0);
+    }
+
+    {
+        OMR::CriticalSection romClassCache(compInfo->getclassesCachedAtServerMonitor());
+        compInfo->getclassesCachedAtServer().clear();
+    }
+    // The activation policy reflects the load of the previous server
+    compInfo->setCompThreadActivationPolicy(JITServer::CompThreadActivationPolicy::AGGRESSIVE);
+    return true;
+}
+
+} // namespace JITServer
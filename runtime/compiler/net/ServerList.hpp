@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SERVER_LIST_H
+#define SERVER_LIST_H
+
+#include <string>
+#include <vector>
+#include "env/J9PersistentInfo.hpp"
+
+struct OMRPortLibrary;
+
+namespace TR {
+class CompilationInfo;
+class Monitor;
+class PersistentInfo;
+} // namespace TR
+
+namespace JITServer {
+/**
+   @class ServerList
+   @brief The set of JITServer instances a client can send its compilation requests to
+
+   The list is built from -XX:JITServerAddress, which accepts a comma separated list of
+   host[:port] entries (IPv6 addresses with a port are written as [address]:port).
+   Entries without a port use -XX:JITServerPort.
+
+   All compilation threads of a client talk to one "current" server at a time. The client
+   tracks the CHTable updates, unloaded classes and classes cached at the server for a single
+   server only, and staying with one server also keeps its per-client caches warm.
+   Load is spread across servers by picking the initial server based on the client UID and
+   by moving a client away from a server that is overloaded or much slower than another one.
+   The current server changes when:
+   (1) a connection to it cannot be established and another server is not in its
+       reconnect backoff period (failover), or
+   (2) it reports low memory or a high number of active compilation threads, or its
+       average compilation latency is much higher than that of another server (rebalance).
+       Rebalancing happens at most once every TR::Options::_jitserverServerSwitchInterval ms.
+
+   Every change of the current server increments a generation number. Connections opened for
+   an older generation are closed before their next compilation request. A switch also gives
+   the client a new UID, so that the new server starts a fresh session and asks for the full
+   CHTable and unloaded class ranges, even if it still holds an older session for this client.
+
+   With a single server in the list the class behaves exactly like the original one-server client.
+*/
+class ServerList {
+public:
+    struct Server {
+        Server(const std::string &address, uint32_t port)
+            : _address(address)
+            , _port(port)
+            , _nextRetryTime(0)
+            , _waitTimeMs(0)
+            , _avgLatencyUs(0)
+            , _numCompilations(0)
+            , _lastUpdateTime(0)
+            , _memoryState(ServerMemoryState::NORMAL)
+            , _activeThreadsState(ServerActiveThreadsState::NORMAL_THREAD)
+        {}
+
+        std::string _address;
+        uint32_t _port;
+        uint64_t _nextRetryTime; // (ms) Do not try to connect before this time after a connection failure
+        uint64_t _waitTimeMs; // Current reconnect backoff interval; 0 if the last connection attempt succeeded
+        uint64_t _avgLatencyUs; // Moving average of the end-to-end latency of remote compilations
+        uint32_t _numCompilations; // Number of compilations that contributed to _avgLatencyUs
+        uint64_t _lastUpdateTime; // (ms) When the fields below were last reported by the server
+        ServerMemoryState _memoryState;
+        ServerActiveThreadsState _activeThreadsState;
+    };
+
+    /**
+       @brief Build (or rebuild, post-restore) the server list from the -XX:JITServerAddress and -XX:JITServerPort values
+
+       @return false if the address list cannot be parsed
+    */
+    static bool init(TR::PersistentInfo *info, OMRPortLibrary *portLibrary);
+
+    /**
+       @brief Return the server list, or NULL if this JVM is not a JITServer client
+    */
+    static ServerList *get() { return _instance; }
+
+    size_t getNumServers() const { return _servers.size(); }
+
+    uint32_t getGeneration() const { return _generation; }
+
+    /**
+       @brief Get the address and port a new connection should be opened to
+
+       @return The generation of the server list the connection belongs to
+    */
+    uint32_t getConnectionTarget(std::string &address, uint32_t &port);
+
+    /**
+       @brief Called when a connection for the given generation was established
+    */
+    void connectionEstablished(uint32_t generation);
+
+    /**
+       @brief Called when a connection for the given generation could not be established
+
+       Failures of connections opened for an older generation are not held against the
+       current server: the client already moved away from the server that failed.
+
+       @return true if the client switched to another server that can be tried right away
+    */
+    bool connectionFailed(TR::CompilationInfo *compInfo, uint32_t generation);
+
+    /**
+       @brief Called after a remote compilation succeeded
+
+       Updates the statistics of the server that performed the compilation and, if needed,
+       moves the client to a different server.
+    */
+    void compilationDone(TR::CompilationInfo *compInfo, uint32_t generation, uint64_t latencyUs,
+        ServerMemoryState memoryState, ServerActiveThreadsState activeThreadsState);
+
+private:
+    ServerList(OMRPortLibrary *portLibrary, TR::Monitor *monitor);
+
+    static bool parse(const std::string &option, uint32_t defaultPort, std::vector<Server> &servers);
+
+    bool isOverloaded(const Server &server, uint64_t now) const;
+    bool isReachable(const Server &server, uint64_t now) const { return now >= server._nextRetryTime; }
+    size_t findRebalanceTarget(uint64_t now, const char *&reason) const;
+    bool switchServer(TR::CompilationInfo *compInfo, uint32_t fromGeneration, size_t index, const char *reason);
+
+    static ServerList *_instance;
+
+    OMRPortLibrary *_portLibrary;
+    TR::Monitor *_monitor; // Protects all the fields below
+    std::vector<Server> _servers;
+    size_t _current; // Index of the server new connections are opened to
+    volatile uint32_t _generation; // Incremented every time _current changes
+    uint64_t _lastSwitchTime; // (ms)
+
+    static const uint32_t MIN_LATENCY_SAMPLES = 16; // Samples needed before a server's latency is trusted
+    static const uint32_t LATENCY_SWITCH_FACTOR = 2; // Switch if another server is this many times faster
+    static const uint64_t SERVER_STATE_EXPIRATION_MS = 60000; // Load reports older than this are ignored
+};
+
+} // namespace JITServer
+
+#endif // SERVER_LIST_H
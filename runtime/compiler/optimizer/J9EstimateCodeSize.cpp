@@ -28,6 +28,8 @@
 #include "compile/TRResolvedMethod.hpp"
 #if defined(J9VM_OPT_JITSERVER)
 #include "env/j9methodServer.hpp"
+#include "infra/vector.hpp"
+#include "runtime/JITServerIProfiler.hpp"
 #endif /* defined(J9VM_OPT_JITSERVER) */
 #include "env/VMJ9.h"
 #include "il/Node.hpp"
@@ -1674,6 +1676,24 @@ bool TR_J9EstimateCodeSize::realEstimateCodeSize(TR_CallTarget *calltarget, TR_C
     }
 
     /****************** Phase 4: Deal with Inlineable Calls **************************/
+#if defined(J9VM_OPT_JITSERVER)
+    if (comp()->isOutOfProcessCompilation() && bci._inlineableCallExists) {
+        // JITServer optimization:
+        // the targets below are about to be estimated, and estimating a target needs its
+        // bytecode profile. Fetch the profiles of all the targets from the client in a single query
+        // instead of one query per target.
+        TR::vector<TR_OpaqueMethodBlock *, TR::Region &> callees(comp()->trMemory()->currentStackRegion());
+        for (int32_t i = 0; i < maxIndex; ++i) {
+            if (callSites[i]) {
+                for (int32_t j = 0; j < callSites[i]->numTargets(); j++)
+                    callees.push_back(callSites[i]->getTarget(j)->_calleeMethod->getPersistentIdentifier());
+            }
+        }
+        JITServerIProfiler *iProfiler = (JITServerIProfiler *)comp()->fej9()->getIProfiler();
+        if (iProfiler && !callees.empty())
+            iProfiler->prefetchProfilingData(comp(), callees.data(), callees.size());
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
     TR::Block *currentBlock = NULL;
     for (TR_J9ByteCode bc = bci.first(); bc != J9BCunknown && bci._inlineableCallExists; bc = bci.next()) {
         int32_t i = bci.bcIndex();
@@ -708,6 +708,16 @@ void TR::CRRuntime::prepareForCheckpoint()
             TR_J9VMBase::get(_jitConfig, NULL)->getIProfiler(), "Checkpoint");
     }
 
+    // Save the profile snapshot now; this also unmaps it so that the checkpoint does not depend on the file.
+    // Compilation threads are suspended, so nobody can be reading the snapshot. It is mapped again after restore.
+    TR_IProfiler *iProfiler = TR_J9VMBase::get(_jitConfig, NULL)->getIProfiler();
+    if (iProfiler
+#if defined(J9VM_OPT_JITSERVER)
+        && (getCompInfo()->getPersistentInfo()->getRemoteCompilationMode() != JITServer::SERVER)
+#endif
+    )
+        iProfiler->writeSnapshot(vmThread, true);
+
     if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCheckpointRestore))
         TR_VerboseLog::writeLineLocked(TR_Vlog_CHECKPOINT_RESTORE, "Ready for checkpoint");
 
@@ -1266,7 +1266,7 @@ bool J9::PersistentInfo::isUnloadedClass(void *v, bool yesIReallyDontCareAboutHC
 #if defined(J9VM_OPT_JITSERVER)
     if (getRemoteCompilationMode() == JITServer::SERVER) {
         auto clientData = TR::compInfoPT->getClientData();
-        OMR::CriticalSection isUnloadedClass(clientData->getROMMapMonitor());
+        JITServerReadSection isUnloadedClass(clientData->getROMMapMonitor());
         return clientData->getUnloadedClassAddresses().mayContain((uintptr_t)v);
     }
 #endif
@@ -38,6 +38,7 @@
 #include "rommeth.h"
 #include "vmaccess.h"
 #include "VMHelpers.hpp"
+#include "AtomicSupport.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "compile/Compilation.hpp"
@@ -77,6 +78,7 @@
 #include "ilgen/J9ByteCode.hpp"
 #include "ilgen/J9ByteCodeIterator.hpp"
 #include "runtime/IProfiler.hpp"
+#include "runtime/IProfilerSnapshot.hpp"
 #include "runtime/J9Profiler.hpp"
 #include "omrformatconsts.h"
 #if defined(J9VM_OPT_CRIU_SUPPORT)
@@ -176,6 +178,12 @@ int32_t TR_IProfiler::_STATS_currentIPReadHadBadData = 0;
 int32_t TR_IProfiler::_STATS_IPEntryRead = 0;
 int32_t TR_IProfiler::_STATS_IPEntryChoosePersistent = 0;
 
+int32_t TR_IProfiler::_STATS_snapshotMethodsLoaded = 0;
+int32_t TR_IProfiler::_STATS_snapshotEntriesLoaded = 0;
+int32_t TR_IProfiler::_STATS_snapshotMethodsStale = 0;
+int32_t TR_IProfiler::_STATS_snapshotMethodsWritten = 0;
+int32_t TR_IProfiler::_STATS_snapshotEntriesWritten = 0;
+
 bool TR_ReadSampleRequestsHistory::init(int32_t historyBufferSize)
 {
     _crtIndex = 0;
@@ -548,6 +556,8 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
     , _iprofilerNumRecords(0)
     , _numMethodHashEntries(0)
     , _iprofilerThreadLifetimeState(TR_IprofilerThreadLifetimeStates::IPROF_THR_NOT_CREATED)
+    , _snapshot(NULL)
+    , _snapshotState(SNAPSHOT_NOT_OPENED)
 {
     PORT_ACCESS_FROM_JITCONFIG(jitConfig);
 
@@ -564,37 +574,24 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
 
 #if defined(J9VM_OPT_JITSERVER)
     if (_compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER) {
+        // The hashtables are left uninitialized
         _hashTableMonitor = NULL;
-        _bcHashTable = NULL;
-#if defined(EXPERIMENTAL_IPROFILER)
-        _allocHashTable = NULL;
-#endif
-        _methodHashTable = NULL;
         _readSampleRequestsHistory = NULL;
     } else
 #endif
     {
         // initialize the monitors
         _hashTableMonitor = TR::Monitor::create("JIT-InterpreterProfilingMonitor");
-        // bytecode hashtable
-        _bcHashTable = (TR_IPBytecodeHashTableEntry **)_allocator->allocate(
-            TR::Options::_iProfilerBcHashTableSize * sizeof(TR_IPBytecodeHashTableEntry *), std::nothrow);
-        if (_bcHashTable != NULL)
-            memset(_bcHashTable, 0, TR::Options::_iProfilerBcHashTableSize * sizeof(TR_IPBytecodeHashTableEntry *));
-        else
+        // The hashtables start at the configured sizes and grow as needed
+        if (!_bcHashTable.init(_allocator, TR::Options::_iProfilerBcHashTableSize))
             _isIProfilingEnabled = false;
 
 #if defined(EXPERIMENTAL_IPROFILER)
-        _allocHashTable = (TR_IPBCDataAllocation **)_allocator->allocate(
-            ALLOC_HASH_TABLE_SIZE * sizeof(TR_IPBCDataAllocation *), std::nothrow);
-        if (_allocHashTable != NULL)
-            memset(_allocHashTable, 0, ALLOC_HASH_TABLE_SIZE * sizeof(TR_IPBCDataAllocation *));
+        _allocHashTable.init(_allocator, ALLOC_HASH_TABLE_SIZE);
 #endif
-        _methodHashTable = (TR_IPMethodHashTableEntry **)_allocator->allocate(
-            TR::Options::_iProfilerMethodHashTableSize * sizeof(TR_IPMethodHashTableEntry *), std::nothrow);
-        if (_methodHashTable != NULL)
-            memset(_methodHashTable, 0,
-                TR::Options::_iProfilerMethodHashTableSize * sizeof(TR_IPMethodHashTableEntry *));
+        _methodHashTable.init(_allocator, TR::Options::_iProfilerMethodHashTableSize);
+        if (getSnapshotFileName())
+            _snapshotLookups.init(_allocator, TR::Options::_iProfilerMethodHashTableSize);
         _readSampleRequestsHistory
             = (TR_ReadSampleRequestsHistory *)_allocator->allocate(sizeof(TR_ReadSampleRequestsHistory), std::nothrow);
         if (!_readSampleRequestsHistory || !_readSampleRequestsHistory->init(TR::Options::_iprofilerFailHistorySize)) {
@@ -629,18 +626,6 @@ bool TR_IProfiler::isCallGraphProfilingEnabled()
     return _enableCGProfiling && !_compInfo->getPersistentInfo()->isClassLoadingPhase();
 }
 
-inline int32_t TR_IProfiler::bcHash(uintptr_t pc)
-{
-    return (int32_t)((pc & 0x7FFFFFFF) % TR::Options::_iProfilerBcHashTableSize);
-}
-
-inline int32_t TR_IProfiler::allocHash(uintptr_t pc) { return (int32_t)((pc & 0x7FFFFFFF) % ALLOC_HASH_TABLE_SIZE); }
-
-inline int32_t TR_IProfiler::methodHash(uintptr_t data)
-{
-    return (int32_t)((data & 0x7FFFFFFF) % TR::Options::_iProfilerMethodHashTableSize);
-}
-
 bool TR_IProfiler::isCompact(U_8 byteCode)
 {
     switch (byteCode) {
@@ -934,38 +919,23 @@ bool TR_IProfiler::addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t d
     return false;
 }
 
-TR_IPBytecodeHashTableEntry *TR_IProfiler::searchForSample(uintptr_t pc, int32_t bucket)
-{
-    TR_IPBytecodeHashTableEntry *entry;
-
-    for (entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
-        if (pc == entry->getPC())
-            return entry;
-    }
+TR_IPBytecodeHashTableEntry *TR_IProfiler::searchForSample(uintptr_t pc) { return _bcHashTable.find(pc); }
 
-    return NULL;
-}
-
-TR_IPBCDataAllocation *TR_IProfiler::searchForAllocSample(uintptr_t pc, int32_t bucket)
+TR_IPBCDataAllocation *TR_IProfiler::searchForAllocSample(uintptr_t pc)
 {
 #if defined(EXPERIMENTAL_IPROFILER)
     TR_ASSERT(0, "This isn't currently supported, and the information is not persisted");
-    TR_IPBCDataAllocation *entry;
-
-    for (entry = _allocHashTable[bucket]; entry; entry = (TR_IPBCDataAllocation *)entry->next) {
-        if (pc == entry->pc)
-            return entry;
-    }
-#endif
-
+    return _allocHashTable.find(pc);
+#else
     return NULL;
+#endif
 }
 
-TR_IPBytecodeHashTableEntry *TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
+TR_IPBytecodeHashTableEntry *TR_IProfiler::findOrCreateEntry(uintptr_t pc, bool addIt)
 {
     TR_IPBytecodeHashTableEntry *entry = NULL;
 
-    entry = searchForSample(pc, bucket);
+    entry = searchForSample(pc);
     // if we are just searching and we didn't find profile data for the
     // method just go back
     if (!addIt)
@@ -990,29 +960,21 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::findOrCreateEntry(int32_t bucket, uin
     if (!entry)
         return NULL;
 
-    // While the entry is being allocated, another thread could have added an entry with the same PC.
-    // If that happened, it's likely that the duplicate entry is at the head of this list.
-    // Check to see if that's the case. This technique does not eliminate the race completely
-    // but catches most of duplicate situations.
-    TR_IPBytecodeHashTableEntry *headEntry = _bcHashTable[bucket];
-    if (headEntry && headEntry->getPC() == pc) {
-        delete entry; // Newly allocated entry is not needed
-        return headEntry;
-    }
-
-    entry->setNext(_bcHashTable[bucket]);
-    FLUSH_MEMORY(TR::Compiler->target.isSMP());
-    _bcHashTable[bucket] = entry;
+    // While the entry was being allocated, another thread could have added an entry with the same PC.
+    // The hashtable only publishes one entry per PC and hands back the one that won.
+    TR_IPBytecodeHashTableEntry *tableEntry = _bcHashTable.insert(entry);
+    if (tableEntry != entry)
+        delete entry; // Newly allocated entry is not needed, or the table is full
 
-    return entry;
+    return tableEntry;
 }
 
-TR_IPBCDataAllocation *TR_IProfiler::findOrCreateAllocEntry(int32_t bucket, uintptr_t pc, bool addIt)
+TR_IPBCDataAllocation *TR_IProfiler::findOrCreateAllocEntry(uintptr_t pc, bool addIt)
 {
 #if defined(EXPERIMENTAL_IPROFILER)
     TR_IPBCDataAllocation *entry = NULL;
 
-    entry = searchForAllocSample(pc, bucket);
+    entry = searchForAllocSample(pc);
     // if we are just searching and we didn't find profile data for the
     // method just go back
     if (!addIt)
@@ -1023,18 +985,16 @@ TR_IPBCDataAllocation *TR_IProfiler::findOrCreateAllocEntry(int32_t bucket, uint
 
     // Create a new hash table entry
     //
-    entry = new TR_IPBCDataAllocation();
+    entry = new TR_IPBCDataAllocation(pc);
 
     if (!entry)
         return NULL;
 
-    entry->next = _allocHashTable[bucket];
-    entry->pc = pc;
-    entry->_lastSeenClassUnloadID = -1; //_compInfo->getPersistentInfo()->getGlobalClassUnloadID();
-    FLUSH_MEMORY(TR::Compiler->target.isSMP());
-    _allocHashTable[bucket] = entry;
+    TR_IPBCDataAllocation *tableEntry = _allocHashTable.insert(entry);
+    if (tableEntry != entry)
+        delete entry;
 
-    return entry;
+    return tableEntry;
 #else
     return NULL;
 #endif
@@ -1045,12 +1005,11 @@ TR_IPMethodHashTableEntry *TR_IProfiler::findOrCreateMethodEntry(J9Method *calle
 {
     TR_IPMethodHashTableEntry *entry = NULL;
 
-    if (!_methodHashTable)
+    if (!_methodHashTable.isInitialized())
         return NULL;
 
     // Search the hashtable
-    int32_t bucket = methodHash((uintptr_t)calleeMethod);
-    entry = searchForMethodSample((TR_OpaqueMethodBlock *)calleeMethod, bucket);
+    entry = searchForMethodSample((TR_OpaqueMethodBlock *)calleeMethod);
 
     if (!addIt)
         return entry;
@@ -1064,16 +1023,22 @@ TR_IPMethodHashTableEntry *TR_IProfiler::findOrCreateMethodEntry(J9Method *calle
         entry = (TR_IPMethodHashTableEntry *)_allocator->allocate(sizeof(TR_IPMethodHashTableEntry), std::nothrow);
         if (entry) {
             memset(entry, 0, sizeof(TR_IPMethodHashTableEntry));
-            entry->_next = _methodHashTable[bucket];
             entry->_method = (TR_OpaqueMethodBlock *)calleeMethod;
             // Set-up the first caller which is embedded in the entry
             entry->_caller.setMethod((TR_OpaqueMethodBlock *)callerMethod);
             entry->_caller.setPCIndex(pcIndex);
             entry->_caller.incWeight();
 
-            FLUSH_MEMORY(TR::Compiler->target.isSMP());
-            _methodHashTable[bucket] = entry; // chain it
-            _numMethodHashEntries++;
+            TR_IPMethodHashTableEntry *tableEntry = _methodHashTable.insert(entry);
+            if (tableEntry == entry) {
+                _numMethodHashEntries++;
+            } else {
+                // Another thread added the callee first (or the table is full)
+                _allocator->deallocate(entry);
+                entry = tableEntry;
+                if (entry)
+                    entry->add((TR_OpaqueMethodBlock *)callerMethod, (TR_OpaqueMethodBlock *)calleeMethod, pcIndex);
+            }
         }
     }
     return entry;
@@ -1211,7 +1176,7 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::persistentProfilingSample(TR_OpaqueMe
         } else {
             if (store) {
                 // Create a new IProfiler hashtable entry and copy the data from the SCC
-                TR_IPBytecodeHashTableEntry *newEntry = findOrCreateEntry(bcHash(pc), pc, true);
+                TR_IPBytecodeHashTableEntry *newEntry = findOrCreateEntry(pc, true);
                 newEntry->loadFromPersistentCopy(store, comp);
                 return newEntry;
             }
@@ -1264,14 +1229,9 @@ TR_IPBCDataStorageHeader *TR_IProfiler::getJ9SharedDataDescriptorForMethod(J9Sha
     return store;
 }
 
-TR_IPMethodHashTableEntry *TR_IProfiler::searchForMethodSample(TR_OpaqueMethodBlock *omb, int32_t bucket)
+TR_IPMethodHashTableEntry *TR_IProfiler::searchForMethodSample(TR_OpaqueMethodBlock *omb)
 {
-    TR_IPMethodHashTableEntry *entry;
-    for (entry = _methodHashTable[bucket]; entry; entry = entry->_next) {
-        if (omb == entry->_method)
-            return entry;
-    }
-    return NULL;
+    return _methodHashTable.find((uintptr_t)omb);
 }
 
 // This method is used at compile time to search both the
@@ -1283,7 +1243,7 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::profilingSample(TR_OpaqueMethodBlock
     uintptr_t pc = getSearchPC(method, byteCodeIndex, comp);
 
     // When we just search in the hashtable we don't need to lock,
-    // It should work even if someone else is modifying the hashtable bucket entry
+    // It should work even if someone else is adding entries or growing the hashtable
     //
     if (!addIt) // read request
     {
@@ -1291,7 +1251,11 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::profilingSample(TR_OpaqueMethodBlock
 
         U_8 bytecode = *(U_8 *)pc;
         // Find the pc in the IProfiler/bytecode hashtable
-        TR_IPBytecodeHashTableEntry *currentEntry = findOrCreateEntry(bcHash(pc), pc, false);
+        TR_IPBytecodeHashTableEntry *currentEntry = findOrCreateEntry(pc, false);
+        // The first time a method without profile is looked up, bring in its profile from the snapshot
+        if ((!currentEntry || !currentEntry->hasData()) && !comp->getOption(TR_DoNotUsePersistentIprofiler)
+            && loadProfileFromSnapshot(method, comp))
+            currentEntry = findOrCreateEntry(pc, false);
         TR_IPBytecodeHashTableEntry *persistentEntry = NULL;
         TR_IPBytecodeHashTableEntry *entry = currentEntry;
         TR_IPBCDataStorageHeader *persistentEntryStore = NULL;
@@ -1402,7 +1366,7 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::profilingSample(TR_OpaqueMethodBlock
             if (!currentEntry || !currentEntry->hasData()) {
                 if (persistentEntry && persistentEntry->hasData()) {
                     _STATS_IPEntryChoosePersistent++;
-                    currentEntry = findOrCreateEntry(bcHash(pc), pc, true);
+                    currentEntry = findOrCreateEntry(pc, true);
                     currentEntry->copyFromEntry(persistentEntry);
                     // Remember that we already looked into the SCC for this PC
                     currentEntry->setPersistentEntryRead();
@@ -1464,7 +1428,7 @@ int32_t TR_IPBCDataEightWords::getSumSwitchCount() const
 TR_IPBytecodeHashTableEntry *TR_IProfiler::profilingSample(uintptr_t pc, uintptr_t data, bool addIt, bool isRIData,
     uint32_t freq)
 {
-    TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(bcHash(pc), pc, addIt);
+    TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(pc, addIt);
 
     if (entry && addIt) {
         if (invalidateEntryIfInconsistent(entry))
@@ -1485,12 +1449,10 @@ TR_IPBCDataAllocation *TR_IProfiler::profilingAllocSample(uintptr_t pc, uintptr_
 #if defined(EXPERIMENTAL_IPROFILER)
     TR_IPBCDataAllocation *entry = NULL;
 
-    if (!_allocHashTable)
+    if (!_allocHashTable.isInitialized())
         return NULL;
 
-    int32_t bucket = allocHash(pc);
-
-    entry = findOrCreateAllocEntry(bucket, pc, addIt);
+    entry = findOrCreateAllocEntry(pc, addIt);
 
     return entry;
 #else
@@ -2286,6 +2248,15 @@ bool TR_IProfiler::acquireHashTableWriteLock(bool forceFullLock) { return true;
 
 void TR_IProfiler::releaseHashTableWriteLock() { return; }
 
+template <class Stats> static void printHashTableStats(const char *name, const Stats &stats)
+{
+    fprintf(stderr,
+        "IProfiler: %s hashtable: capacity=%" OMR_PRIuSIZE " occupancy=%" OMR_PRIuSIZE " (%.1f%%) resizes=%u"
+        " avgProbeLength=%.2f maxProbeLength=%u\n",
+        name, stats._capacity, stats._occupancy, stats._capacity ? 100.0 * stats._occupancy / stats._capacity : 0.0,
+        stats._numResizes, stats._avgProbeLength, stats._maxProbeLength);
+}
+
 void TR_IProfiler::outputStats()
 {
     TR::Options *options = TR::Options::getCmdLineOptions();
@@ -2301,6 +2272,17 @@ void TR_IProfiler::outputStats()
     fprintf(stderr, "IProfiler: Number of records processed=%" OMR_PRIu64 "\n", _iprofilerNumRecords);
     fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
     fprintf(stderr, "IProfiler: Number of methodHash entries=%u\n", _numMethodHashEntries);
+    TR_IPBytecodeHashTable::Stats bcStats;
+    _bcHashTable.getStats(bcStats);
+    printHashTableStats("bytecode", bcStats);
+    TR_IPMethodHashTable::Stats methodStats;
+    _methodHashTable.getStats(methodStats);
+    printHashTableStats("method", methodStats);
+#if defined(EXPERIMENTAL_IPROFILER)
+    TR_IPAllocHashTable::Stats allocStats;
+    _allocHashTable.getStats(allocStats);
+    printHashTableStats("allocation", allocStats);
+#endif
     checkMethodHashTable();
 }
 
@@ -3058,53 +3040,49 @@ void TR_IProfiler::printAllocationReport()
     if (!_globalAllocationCount)
         return;
 
-    for (int32_t bucket = 0; bucket < ALLOC_HASH_TABLE_SIZE; bucket++) {
 #if defined(EXPERIMENTAL_IPROFILER)
-        for (TR_IPBCDataAllocation *entry = _allocHashTable[bucket]; entry;
-             entry = (TR_IPBCDataAllocation *)entry->next) {
-            if (entry->asIPBCDataAllocation()) {
-                J9Class *clazz = (J9Class *)((TR_IPBCDataAllocation *)entry)->getClass();
-                J9Method *method = (J9Method *)((TR_IPBCDataAllocation *)entry)->getMethod();
-
-                if (method && clazz && !_compInfo->getPersistentInfo()->isUnloadedClass((void *)clazz, true)
-                    && entry->getData() > 0) {
-                    J9UTF8 *clazzUTRF8 = J9ROMCLASS_CLASSNAME(clazz->romClass);
-                    J9UTF8 *nameUTF8;
-                    J9UTF8 *signatureUTF8;
-                    J9UTF8 *methodClazzUTRF8;
-                    getClassNameSignatureFromMethod(method, methodClazzUTRF8, nameUTF8, signatureUTF8);
-
-                    printf("%d\t%5.2lf\t%.*s\t%.*s.%.*s%.*s\n", entry->getData(),
-                        (double)((double)(entry->getData()) / ((double)_globalAllocationCount)) * 100.0,
-                        J9UTF8_LENGTH(clazzUTRF8), J9UTF8_DATA(clazzUTRF8), J9UTF8_LENGTH(methodClazzUTRF8),
-                        J9UTF8_DATA(methodClazzUTRF8), J9UTF8_LENGTH(nameUTF8), J9UTF8_DATA(nameUTF8),
-                        J9UTF8_LENGTH(signatureUTF8), J9UTF8_DATA(signatureUTF8));
-                } else if (entry->getData() > 0) {
-                    printf("%d\t%5.2lf\tUnknown\tUnknown\n", entry->getData(),
-                        (double)((double)(entry->getData()) / ((double)_globalAllocationCount)) * 100.0);
-                }
+    TR_IPAllocHashTable::Iterator iter(_allocHashTable);
+    for (TR_IPBCDataAllocation *entry = iter.getFirst(); entry; entry = iter.getNext()) {
+        if (entry->asIPBCDataAllocation()) {
+            J9Class *clazz = (J9Class *)((TR_IPBCDataAllocation *)entry)->getClass();
+            J9Method *method = (J9Method *)((TR_IPBCDataAllocation *)entry)->getMethod();
+
+            if (method && clazz && !_compInfo->getPersistentInfo()->isUnloadedClass((void *)clazz, true)
+                && entry->getData() > 0) {
+                J9UTF8 *clazzUTRF8 = J9ROMCLASS_CLASSNAME(clazz->romClass);
+                J9UTF8 *nameUTF8;
+                J9UTF8 *signatureUTF8;
+                J9UTF8 *methodClazzUTRF8;
+                getClassNameSignatureFromMethod(method, methodClazzUTRF8, nameUTF8, signatureUTF8);
+
+                printf("%d\t%5.2lf\t%.*s\t%.*s.%.*s%.*s\n", entry->getData(),
+                    (double)((double)(entry->getData()) / ((double)_globalAllocationCount)) * 100.0,
+                    J9UTF8_LENGTH(clazzUTRF8), J9UTF8_DATA(clazzUTRF8), J9UTF8_LENGTH(methodClazzUTRF8),
+                    J9UTF8_DATA(methodClazzUTRF8), J9UTF8_LENGTH(nameUTF8), J9UTF8_DATA(nameUTF8),
+                    J9UTF8_LENGTH(signatureUTF8), J9UTF8_DATA(signatureUTF8));
+            } else if (entry->getData() > 0) {
+                printf("%d\t%5.2lf\tUnknown\tUnknown\n", entry->getData(),
+                    (double)((double)(entry->getData()) / ((double)_globalAllocationCount)) * 100.0);
             }
         }
-#endif
     }
+#endif
 }
 
 uint32_t TR_IProfiler::releaseAllEntries(uint32_t &unexpectedLockedEntries)
 {
     uint32_t count = 0;
-    for (int32_t bucket = 0; bucket < TR::Options::_iProfilerBcHashTableSize; bucket++) {
-        for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
-            if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked()) {
-                // Because there is a known race in findOrCreateEntry(), there is a
-                // chance that this entry is still locked because another entry for
-                // the same PC was added after it. These should not contribute to
-                // the number of unexpectedly locked entries.
-                auto otherEntry = profilingSample(entry->getPC(), 0, false);
-                if (entry == otherEntry)
-                    unexpectedLockedEntries++;
-                count++;
-                entry->asIPBCDataCallGraph()->releaseEntry();
-            }
+    TR_IPBytecodeHashTable::Iterator iter(_bcHashTable);
+    for (TR_IPBytecodeHashTableEntry *entry = iter.getFirst(); entry; entry = iter.getNext()) {
+        if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked()) {
+            // An entry that lost an insertion race during a resize of the hashtable
+            // is not the entry found for its PC. These should not contribute to
+            // the number of unexpectedly locked entries.
+            auto otherEntry = profilingSample(entry->getPC(), 0, false);
+            if (entry == otherEntry)
+                unexpectedLockedEntries++;
+            count++;
+            entry->asIPBCDataCallGraph()->releaseEntry();
         }
     }
     return count;
@@ -3113,9 +3091,9 @@ uint32_t TR_IProfiler::releaseAllEntries(uint32_t &unexpectedLockedEntries)
 uint32_t TR_IProfiler::countEntries()
 {
     uint32_t count = 0;
-    for (int32_t bucket = 0; bucket < TR::Options::_iProfilerBcHashTableSize; bucket++)
-        for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
-            count++;
+    TR_IPBytecodeHashTable::Iterator iter(_bcHashTable);
+    for (TR_IPBytecodeHashTableEntry *entry = iter.getFirst(); entry; entry = iter.getNext())
+        count++;
     return count;
 }
 
@@ -3141,56 +3119,55 @@ void TR_IProfiler::checkMethodHashTable()
 
     fprintf(fout, "Printing method hash table\n");
     fflush(fout);
-    for (int32_t bucket = 0; bucket < TR::Options::_iProfilerMethodHashTableSize; bucket++) {
-        for (TR_IPMethodHashTableEntry *entry = _methodHashTable[bucket]; entry; entry = entry->_next) {
-            J9Method *method = (J9Method *)entry->_method;
-            fprintf(fout, "Callee method %p", method);
-            if (methodNames) {
-                J9UTF8 *nameUTF8;
-                J9UTF8 *signatureUTF8;
-                J9UTF8 *methodClazzUTRF8;
-                getClassNameSignatureFromMethod(method, methodClazzUTRF8, nameUTF8, signatureUTF8);
-                fprintf(fout, "\t%.*s.%.*s%.*s", J9UTF8_LENGTH(methodClazzUTRF8), J9UTF8_DATA(methodClazzUTRF8),
-                    J9UTF8_LENGTH(nameUTF8), J9UTF8_DATA(nameUTF8), J9UTF8_LENGTH(signatureUTF8),
-                    J9UTF8_DATA(signatureUTF8));
-                fprintf(fout, "\t is %" OMR_PRIdPTR " bytecode long",
-                    J9_BYTECODE_SIZE_FROM_ROM_METHOD(getOriginalROMMethod(method)));
-            }
-            fprintf(fout, "\n");
-            fflush(fout);
-            int32_t count = 0;
-            uint32_t i = 0;
-
-            for (TR_IPMethodData *it = &entry->_caller; it; it = it->next) {
-                count++;
-                TR_OpaqueMethodBlock *caller = it->getMethod();
-                if (caller) {
-                    fprintf(fout, "\t%8p pcIndex %3" OMR_PRIu32 " weight %3" OMR_PRIu32 "\t", caller, it->getPCIndex(),
-                        it->getWeight());
-                    if (methodNames) {
-                        J9UTF8 *caller_nameUTF8;
-                        J9UTF8 *caller_signatureUTF8;
-                        J9UTF8 *caller_methodClazzUTF8;
-                        getClassNameSignatureFromMethod((J9Method *)caller, caller_methodClazzUTF8, caller_nameUTF8,
-                            caller_signatureUTF8);
-
-                        fprintf(fout, "%.*s.%.*s%.*s", J9UTF8_LENGTH(caller_methodClazzUTF8),
-                            J9UTF8_DATA(caller_methodClazzUTF8), J9UTF8_LENGTH(caller_nameUTF8),
-                            J9UTF8_DATA(caller_nameUTF8), J9UTF8_LENGTH(caller_signatureUTF8),
-                            J9UTF8_DATA(caller_signatureUTF8));
-                    }
-                    fprintf(fout, "\n");
-                    fflush(fout);
-                } else {
-                    fprintf(fout, "caller method is null\n");
+    TR_IPMethodHashTable::Iterator iter(_methodHashTable);
+    for (TR_IPMethodHashTableEntry *entry = iter.getFirst(); entry; entry = iter.getNext()) {
+        J9Method *method = (J9Method *)entry->_method;
+        fprintf(fout, "Callee method %p", method);
+        if (methodNames) {
+            J9UTF8 *nameUTF8;
+            J9UTF8 *signatureUTF8;
+            J9UTF8 *methodClazzUTRF8;
+            getClassNameSignatureFromMethod(method, methodClazzUTRF8, nameUTF8, signatureUTF8);
+            fprintf(fout, "\t%.*s.%.*s%.*s", J9UTF8_LENGTH(methodClazzUTRF8), J9UTF8_DATA(methodClazzUTRF8),
+                J9UTF8_LENGTH(nameUTF8), J9UTF8_DATA(nameUTF8), J9UTF8_LENGTH(signatureUTF8),
+                J9UTF8_DATA(signatureUTF8));
+            fprintf(fout, "\t is %" OMR_PRIdPTR " bytecode long",
+                J9_BYTECODE_SIZE_FROM_ROM_METHOD(getOriginalROMMethod(method)));
+        }
+        fprintf(fout, "\n");
+        fflush(fout);
+        int32_t count = 0;
+        uint32_t i = 0;
+
+        for (TR_IPMethodData *it = &entry->_caller; it; it = it->next) {
+            count++;
+            TR_OpaqueMethodBlock *caller = it->getMethod();
+            if (caller) {
+                fprintf(fout, "\t%8p pcIndex %3" OMR_PRIu32 " weight %3" OMR_PRIu32 "\t", caller, it->getPCIndex(),
+                    it->getWeight());
+                if (methodNames) {
+                    J9UTF8 *caller_nameUTF8;
+                    J9UTF8 *caller_signatureUTF8;
+                    J9UTF8 *caller_methodClazzUTF8;
+                    getClassNameSignatureFromMethod((J9Method *)caller, caller_methodClazzUTF8, caller_nameUTF8,
+                        caller_signatureUTF8);
+
+                    fprintf(fout, "%.*s.%.*s%.*s", J9UTF8_LENGTH(caller_methodClazzUTF8),
+                        J9UTF8_DATA(caller_methodClazzUTF8), J9UTF8_LENGTH(caller_nameUTF8),
+                        J9UTF8_DATA(caller_nameUTF8), J9UTF8_LENGTH(caller_signatureUTF8),
+                        J9UTF8_DATA(caller_signatureUTF8));
                 }
+                fprintf(fout, "\n");
+                fflush(fout);
+            } else {
+                fprintf(fout, "caller method is null\n");
             }
-            // Print the other bucket
-            fprintf(fout, "\tother bucket: weight %d\n", entry->_otherBucket.getWeight());
-            fprintf(fout, "Caller list length = %d\n", count);
-            fflush(fout);
-            faninHisto.update(count);
         }
+        // Print the other bucket
+        fprintf(fout, "\tother bucket: weight %d\n", entry->_otherBucket.getWeight());
+        fprintf(fout, "Caller list length = %d\n", count);
+        fflush(fout);
+        faninHisto.update(count);
     }
     faninHisto.report(fout);
     fflush(fout);
@@ -3204,8 +3181,7 @@ void TR_IProfiler::getFaninInfo(TR_OpaqueMethodBlock *calleeMethod, uint32_t *co
     uint32_t other = 0;
 
     // Search for the callee in the hashtable
-    int32_t bucket = methodHash((uintptr_t)calleeMethod);
-    TR_IPMethodHashTableEntry *entry = searchForMethodSample((TR_OpaqueMethodBlock *)calleeMethod, bucket);
+    TR_IPMethodHashTableEntry *entry = searchForMethodSample((TR_OpaqueMethodBlock *)calleeMethod);
     if (entry) {
         other = entry->_otherBucket.getWeight();
         w = other;
@@ -3232,18 +3208,14 @@ void TR_IProfiler::getFaninInfo(TR_OpaqueMethodBlock *calleeMethod, uint32_t *co
 bool TR_IProfiler::getCallerWeight(TR_OpaqueMethodBlock *calleeMethod, TR_OpaqueMethodBlock *callerMethod,
     uint32_t *weight, uint32_t pcIndex, TR::Compilation *comp)
 {
-    // First: hash the method
-
     bool useTuples = (pcIndex != ~0);
 
-    int32_t bucket = methodHash((uintptr_t)calleeMethod);
-
     // adjust pcIndex for interface calls (see getSearchPCFromMethodAndBCIndex)
     // otherwise we won't be able to locate a caller-callee-bcIndex triplet
     // even if it is in a TR_IPMethodHashTableEntry
     uintptr_t pcAddress = getSearchPCFromMethodAndBCIndex(callerMethod, pcIndex, comp);
 
-    TR_IPMethodHashTableEntry *entry = searchForMethodSample((TR_OpaqueMethodBlock *)calleeMethod, bucket);
+    TR_IPMethodHashTableEntry *entry = searchForMethodSample((TR_OpaqueMethodBlock *)calleeMethod);
 
     if (!entry) // if there are no entries, we have no callers!
     {
@@ -4301,26 +4273,25 @@ void TR_IProfiler::traverseIProfilerTableAndCollectEntries(TR_AggregationHT *agg
 
     TR::VMAccessCriticalSection dumpCallGraph(fe); // prevent class unloading
 
-    for (int32_t bucket = 0; bucket < TR::Options::_iProfilerBcHashTableSize; bucket++) {
-        for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
-            // Skip invalid entries
-            if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
-                continue;
-            // Skip non-callgraph entries, if so desired
-            if (collectOnlyCallGraphEntries && !entry->asIPBCDataCallGraph())
-                continue;
+    TR_IPBytecodeHashTable::Iterator iter(_bcHashTable);
+    for (TR_IPBytecodeHashTableEntry *entry = iter.getFirst(); entry; entry = iter.getNext()) {
+        // Skip invalid entries
+        if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
+            continue;
+        // Skip non-callgraph entries, if so desired
+        if (collectOnlyCallGraphEntries && !entry->asIPBCDataCallGraph())
+            continue;
 
-            // Get the pc and find the method this pc belongs to
-            J9ROMClass *romClass = NULL;
-            J9ROMMethod *desiredMethod = findROMMethodFromPC(vmThread, entry->getPC(), romClass);
-            if (desiredMethod) {
-                // Add the information to the aggregationTable
-                aggregationHT->add(desiredMethod, romClass, entry);
-            } else {
-                fprintf(stderr, "Cannot find RomMethod that contains pc=%p \n", (uint8_t *)entry->getPC());
-            }
+        // Get the pc and find the method this pc belongs to
+        J9ROMClass *romClass = NULL;
+        J9ROMMethod *desiredMethod = findROMMethodFromPC(vmThread, entry->getPC(), romClass);
+        if (desiredMethod) {
+            // Add the information to the aggregationTable
+            aggregationHT->add(desiredMethod, romClass, entry);
+        } else {
+            fprintf(stderr, "Cannot find RomMethod that contains pc=%p \n", (uint8_t *)entry->getPC());
         }
-    } // for each bucket
+    }
 }
 
 // This method can be used to print to stderr in readable format all the IPBCDataCallGraph
@@ -4565,6 +4536,373 @@ void TR_IProfiler::persistAllEntries()
     }
 }
 
+const char *TR_IProfiler::getSnapshotFileName() const
+{
+    return ((TR_JitPrivateConfig *)_compInfo->getJITConfig()->privateConfig)->iprofilerSnapshotFileName;
+}
+
+TR_IProfilerSnapshot *TR_IProfiler::getSnapshot()
+{
+    if (_snapshotState == SNAPSHOT_OPEN)
+        return _snapshot;
+    if (_snapshotState != SNAPSHOT_NOT_OPENED)
+        return NULL;
+    // Only one thread maps the file; others go without the snapshot until it is ready
+    if (SNAPSHOT_NOT_OPENED
+        != VM_AtomicSupport::lockCompareExchangeU32((uint32_t *)&_snapshotState, SNAPSHOT_NOT_OPENED,
+            SNAPSHOT_OPENING))
+        return NULL;
+
+    const char *fileName = getSnapshotFileName();
+    TR_IProfilerSnapshot *snapshot = fileName ? TR_IProfilerSnapshot::open(_portLib, fileName) : NULL;
+    if (fileName && TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseIProfilerPersistence)) {
+        if (snapshot)
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "IProfiler: mapped snapshot %s with %u methods", fileName,
+                snapshot->getNumMethods());
+        else
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "IProfiler: no usable snapshot in %s", fileName);
+    }
+    _snapshot = snapshot;
+    VM_AtomicSupport::writeBarrier();
+    _snapshotState = snapshot ? SNAPSHOT_OPEN : SNAPSHOT_UNAVAILABLE;
+    return snapshot;
+}
+
+void TR_IProfiler::closeSnapshot(bool reopen)
+{
+    TR_IProfilerSnapshot *snapshot = _snapshot;
+    _snapshotState = reopen ? SNAPSHOT_NOT_OPENED : SNAPSHOT_UNAVAILABLE;
+    VM_AtomicSupport::readWriteBarrier();
+    _snapshot = NULL;
+    if (snapshot)
+        snapshot->close();
+}
+
+bool TR_IProfiler::loadProfileFromSnapshot(TR_OpaqueMethodBlock *method, TR::Compilation *comp)
+{
+    // Every profiling miss for a method ends up here; only the first one needs to search the snapshot
+    if (!_snapshotLookups.isInitialized() || _snapshotLookups.find((uintptr_t)method))
+        return false;
+    TR_IProfilerSnapshot *snapshot = getSnapshot();
+    if (!snapshot)
+        return false;
+
+    // If the method cannot be recorded, the snapshot is simply searched again next time.
+    // The entry is not removed when the class is unloaded; a method allocated later at the same
+    // address would then go without its snapshot profile, which only costs some warm-up.
+    TR_IPSnapshotLookupEntry *lookup
+        = (TR_IPSnapshotLookupEntry *)_allocator->allocate(sizeof(TR_IPSnapshotLookupEntry), std::nothrow);
+    if (lookup) {
+        lookup->_method = method;
+        if (_snapshotLookups.insert(lookup) != lookup) {
+            // Another thread is consulting the snapshot for this method (or the table is full)
+            _allocator->deallocate(lookup);
+            return false;
+        }
+    }
+
+    J9Method *j9method = (J9Method *)method;
+    J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(j9method);
+    bool isStale = false;
+    const TR_IPSnapshotMethod *storedMethod
+        = snapshot->claimMethod(J9_CLASS_FROM_METHOD(j9method)->romClass, romMethod, isStale);
+    if (!storedMethod) {
+        if (isStale)
+            _STATS_snapshotMethodsStale++;
+        return false;
+    }
+
+    // Use the regular JIT frontend: class lookups must not be recorded as AOT validations
+    TR_J9VMBase *fej9 = TR_J9VMBase::get(_compInfo->getJITConfig(), comp->j9VMThread());
+    uintptr_t bytecodeStart = (uintptr_t)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
+    const TR_IPSnapshotEntry *storedEntries = snapshot->getEntries(storedMethod);
+    uint32_t numLoaded = 0;
+    for (uint32_t i = 0; i < storedMethod->_numEntries; i++) {
+        const TR_IPSnapshotEntry *stored = storedEntries + i;
+        if (stored->_bytecodeIndex >= storedMethod->_bytecodeSize)
+            continue;
+
+        uintptr_t pc = bytecodeStart + stored->_bytecodeIndex;
+        TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(pc, true);
+        // Data collected in this run takes precedence over the snapshot
+        if (!entry || entry->hasData())
+            continue;
+
+        switch (stored->_ID) {
+            case TR_IPBCD_FOUR_BYTES:
+                if (entry->asIPBCDataFourBytes()) {
+                    entry->setData(stored->_branchData);
+                    numLoaded++;
+                }
+                break;
+            case TR_IPBCD_EIGHT_WORDS:
+                if (entry->asIPBCDataEightWords()) {
+                    uint64_t *data = entry->asIPBCDataEightWords()->getDataPointer();
+                    for (int32_t j = 0; j < SWITCH_DATA_COUNT; j++)
+                        data[j] = stored->_switchData[j];
+                    numLoaded++;
+                }
+                break;
+            case TR_IPBCD_CALL_GRAPH:
+                if (entry->asIPBCDataCallGraph()) {
+                    // Classes are resolved by name in the loader of the profiled method. Classes that are
+                    // not loaded or not yet initialized cannot be used, so their weight goes to the residue.
+                    CallSiteProfileInfo *csInfo = entry->asIPBCDataCallGraph()->getCGData();
+                    uint32_t residueWeight = stored->_residueWeight;
+                    int32_t slot = 0;
+                    for (int32_t j = 0; j < NUM_CS_SLOTS; j++) {
+                        const J9UTF8 *className = snapshot->getString(stored->_callGraph._classNameOffset[j]);
+                        TR_OpaqueClassBlock *clazz = NULL;
+                        if (className)
+                            clazz = fej9->getClassFromSignature((const char *)J9UTF8_DATA(className),
+                                J9UTF8_LENGTH(className), method);
+                        if (clazz && fej9->isClassInitialized(clazz)) {
+                            csInfo->setClazz(slot, (uintptr_t)clazz);
+                            csInfo->_weight[slot] = stored->_callGraph._weight[j];
+                            slot++;
+                        } else {
+                            residueWeight += stored->_callGraph._weight[j];
+                        }
+                    }
+                    csInfo->_residueWeight = (residueWeight > 0x7FFF) ? 0x7FFF : residueWeight;
+                    csInfo->_tooBigToBeInlined = stored->_tooBigToBeInlined ? 1 : 0;
+                    numLoaded++;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    _STATS_snapshotMethodsLoaded++;
+    _STATS_snapshotEntriesLoaded += numLoaded;
+    return numLoaded > 0;
+}
+
+bool TR_IProfiler::fillSnapshotEntry(TR_IPBytecodeHashTableEntry *entry, uintptr_t bytecodeStart,
+    TR_IPSnapshotEntry *stored, TR_IProfilerSnapshotStringTable &strings)
+{
+    memset(stored, 0, sizeof(*stored));
+    stored->_bytecodeIndex = (uint32_t)(entry->getPC() - bytecodeStart);
+
+    if (entry->asIPBCDataFourBytes()) {
+        if (!entry->hasData())
+            return false;
+        stored->_ID = TR_IPBCD_FOUR_BYTES;
+        stored->_branchData = (uint32_t)entry->getData();
+    } else if (entry->asIPBCDataEightWords()) {
+        if (!entry->hasData())
+            return false;
+        stored->_ID = TR_IPBCD_EIGHT_WORDS;
+        const uint64_t *data = entry->asIPBCDataEightWords()->getDataPointer();
+        for (int32_t i = 0; i < SWITCH_DATA_COUNT; i++)
+            stored->_switchData[i] = data[i];
+    } else if (entry->asIPBCDataCallGraph()) {
+        CallSiteProfileInfo *csInfo = entry->asIPBCDataCallGraph()->getCGData();
+        uint32_t residueWeight = csInfo->_residueWeight;
+        int32_t slot = 0;
+        for (int32_t i = 0; i < NUM_CS_SLOTS; i++) {
+            J9Class *clazz = (J9Class *)csInfo->getClazz(i);
+            uint16_t weight = csInfo->_weight[i];
+            if (!clazz)
+                continue;
+            uint32_t offset = 0;
+            if (!_compInfo->getPersistentInfo()->isUnloadedClass(clazz, true))
+                offset = strings.add(J9ROMCLASS_CLASSNAME(clazz->romClass));
+            if (offset) {
+                stored->_callGraph._classNameOffset[slot] = offset;
+                stored->_callGraph._weight[slot] = weight;
+                slot++;
+            } else {
+                residueWeight += weight;
+            }
+        }
+        if ((0 == slot) && (0 == residueWeight))
+            return false;
+        stored->_ID = TR_IPBCD_CALL_GRAPH;
+        stored->_residueWeight = (residueWeight > 0x7FFF) ? 0x7FFF : residueWeight;
+        stored->_tooBigToBeInlined = csInfo->_tooBigToBeInlined;
+    } else {
+        // Direct call counts are not worth persisting; they are repopulated quickly
+        return false;
+    }
+    return true;
+}
+
+// Write the IProfiler table to the snapshot file named by -Xjit:iprofilerSnapshotFile=.
+// Unlike persistAllEntries(), this does not need the classes to be in the SCC:
+// methods and receiver classes are identified by name and the snapshot is
+// memory-mapped and consulted lazily by the next run (see loadProfileFromSnapshot).
+void TR_IProfiler::writeSnapshot(J9VMThread *vmThread, bool forCheckpoint)
+{
+    const char *fileName = getSnapshotFileName();
+    if (!fileName || !_bcHashTable.isInitialized())
+        return;
+
+    J9JavaVM *javaVM = vmThread->javaVM;
+    TR_J9VMBase *fe = TR_J9VMBase::get(_compInfo->getJITConfig(), vmThread);
+    // Map the previous snapshot if it was never needed, so that its profiles are carried over
+    TR_IProfilerSnapshot *oldSnapshot = getSnapshot();
+    bool success = false;
+    uint32_t numMethods = 0;
+    uint32_t numEntries = 0;
+
+    try {
+        TR::RawAllocator rawAllocator(javaVM);
+        J9::SegmentAllocator segmentAllocator(MEMORY_TYPE_JIT_SCRATCH_SPACE | MEMORY_TYPE_VIRTUAL, *javaVM);
+        J9::SystemSegmentProvider regionSegmentProvider(1 << 20, 1 << 20, TR::Options::getScratchSpaceLimit(),
+            segmentAllocator, rawAllocator);
+        TR::Region region(regionSegmentProvider, rawAllocator);
+
+        TR_AggregationHT aggregationHT(TR::Options::_iProfilerBcHashTableSize);
+        if (aggregationHT.getSize() == 0) // OOM
+        {
+            if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseIProfilerPersistence))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+                    "IProfiler: Cannot allocate memory. Bailing out writing snapshot %s", fileName);
+            closeSnapshot(forCheckpoint);
+            return;
+        }
+        traverseIProfilerTableAndCollectEntries(&aggregationHT, vmThread);
+
+        size_t maxMethods = aggregationHT.numTrackedMethods();
+        size_t maxEntries = 0;
+        for (int32_t bucket = 0; bucket < aggregationHT.getSize(); bucket++)
+            for (TR_AggregationHT::TR_AggregationHTNode *node = aggregationHT.getBucket(bucket); node;
+                 node = node->getNext())
+                for (TR_AggregationHT::TR_IPChainedEntry *ipEntry = node->getFirstIPEntry(); ipEntry;
+                     ipEntry = ipEntry->getNext())
+                    maxEntries++;
+        if (oldSnapshot) {
+            maxMethods += oldSnapshot->getNumMethods();
+            for (uint32_t i = 0; i < oldSnapshot->getNumMethods(); i++)
+                if (oldSnapshot->hasValidEntries(oldSnapshot->getMethod(i)))
+                    maxEntries += oldSnapshot->getMethod(i)->_numEntries;
+        }
+        if ((maxMethods > UINT_MAX) || (maxEntries > UINT_MAX)) {
+            closeSnapshot(forCheckpoint);
+            return;
+        }
+
+        TR_IPSnapshotMethod *methods
+            = (TR_IPSnapshotMethod *)region.allocate((maxMethods + 1) * sizeof(TR_IPSnapshotMethod));
+        TR_IPSnapshotEntry *entries
+            = (TR_IPSnapshotEntry *)region.allocate((maxEntries + 1) * sizeof(TR_IPSnapshotEntry));
+        TR_IProfilerSnapshotStringTable strings(region);
+
+        {
+            // Prevent class unloading while class names are read
+            TR::VMAccessCriticalSection writeSnapshotCriticalSection(fe);
+
+            for (int32_t bucket = 0; bucket < aggregationHT.getSize(); bucket++) {
+                for (TR_AggregationHT::TR_AggregationHTNode *node = aggregationHT.getBucket(bucket); node;
+                     node = node->getNext()) {
+                    J9ROMMethod *romMethod = node->getROMMethod();
+                    J9ROMClass *romClass = node->getROMClass();
+                    uintptr_t bytecodeStart = (uintptr_t)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
+                    uint32_t firstEntry = numEntries;
+                    for (TR_AggregationHT::TR_IPChainedEntry *ipEntry = node->getFirstIPEntry(); ipEntry;
+                         ipEntry = ipEntry->getNext()) {
+                        if (fillSnapshotEntry(ipEntry->getIPData(), bytecodeStart, entries + numEntries, strings))
+                            numEntries++;
+                    }
+                    if (numEntries == firstEntry)
+                        continue;
+
+                    TR_IPSnapshotMethod *method = methods + numMethods;
+                    method->_key = TR_IProfilerSnapshot::methodKey(romClass, romMethod);
+                    method->_bytecodeHash = TR_IProfilerSnapshot::bytecodeHash(romMethod);
+                    method->_classNameOffset = strings.add(J9ROMCLASS_CLASSNAME(romClass));
+                    method->_bytecodeSize = (uint32_t)J9_BYTECODE_SIZE_FROM_ROM_METHOD(romMethod);
+                    method->_firstEntry = firstEntry;
+                    method->_numEntries = numEntries - firstEntry;
+                    if (method->_classNameOffset)
+                        numMethods++;
+                    else
+                        numEntries = firstEntry;
+                }
+            }
+
+            struct MethodKeyLess {
+                bool operator()(const TR_IPSnapshotMethod &a, const TR_IPSnapshotMethod &b) const
+                {
+                    return a._key < b._key;
+                }
+            };
+            std::sort(methods, methods + numMethods, MethodKeyLess());
+
+            // Carry over the profiles of methods that were not looked up in this run. Methods whose
+            // profile was loaded are already in the IProfiler table, and stale profiles are dropped.
+            uint32_t numFreshMethods = numMethods;
+            for (uint32_t i = 0; oldSnapshot && (i < oldSnapshot->getNumMethods()); i++) {
+                const TR_IPSnapshotMethod *oldMethod = oldSnapshot->getMethod(i);
+                const J9UTF8 *className = oldSnapshot->getString(oldMethod->_classNameOffset);
+                if (oldSnapshot->isMethodClaimed(i) || !className || !oldSnapshot->hasValidEntries(oldMethod))
+                    continue;
+
+                // Skip methods that were profiled in this run
+                TR_IPSnapshotMethod *fresh = std::lower_bound(methods, methods + numFreshMethods, *oldMethod,
+                    MethodKeyLess());
+                bool profiledInThisRun = false;
+                for (; (fresh < methods + numFreshMethods) && (fresh->_key == oldMethod->_key); fresh++) {
+                    const J9UTF8 *freshClassName = (const J9UTF8 *)(strings.getData() + fresh->_classNameOffset);
+                    if (J9UTF8_EQUALS(freshClassName, className)) {
+                        profiledInThisRun = true;
+                        break;
+                    }
+                }
+                if (profiledInThisRun)
+                    continue;
+
+                TR_IPSnapshotMethod *method = methods + numMethods;
+                *method = *oldMethod;
+                method->_classNameOffset = strings.add(className);
+                method->_firstEntry = numEntries;
+                if (!method->_classNameOffset)
+                    continue;
+
+                const TR_IPSnapshotEntry *oldEntries = oldSnapshot->getEntries(oldMethod);
+                for (uint32_t j = 0; j < oldMethod->_numEntries; j++) {
+                    TR_IPSnapshotEntry *stored = entries + numEntries + j;
+                    *stored = oldEntries[j];
+                    if (stored->_ID == TR_IPBCD_CALL_GRAPH) {
+                        for (int32_t k = 0; k < NUM_CS_SLOTS; k++)
+                            stored->_callGraph._classNameOffset[k]
+                                = strings.add(oldSnapshot->getString(oldEntries[j]._callGraph._classNameOffset[k]));
+                    }
+                }
+                numEntries += oldMethod->_numEntries;
+                numMethods++;
+            }
+            std::stable_sort(methods, methods + numMethods, MethodKeyLess());
+        }
+
+        // Unmap the previous snapshot before it is replaced
+        closeSnapshot();
+
+        success = TR_IProfilerSnapshot::write(_portLib, fileName, methods, numMethods, entries, numEntries,
+            strings.getData(), strings.getSize());
+    } catch (const std::exception &e) {
+        success = false;
+    }
+
+    // After a checkpoint, the snapshot written here is mapped again when needed. This keeps the profiles
+    // carried over from previous runs when the snapshot is written again at shutdown.
+    closeSnapshot(forCheckpoint);
+
+    if (success) {
+        _STATS_snapshotMethodsWritten = numMethods;
+        _STATS_snapshotEntriesWritten = numEntries;
+    }
+    if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseIProfilerPersistence)) {
+        if (success)
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "IProfiler: wrote %u methods and %u entries to snapshot %s",
+                numMethods, numEntries, fileName);
+        else
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "IProfiler: Failed to write snapshot %s", fileName);
+    }
+}
+
 // Generates histograms IP info related to virtual/interface calls.
 // (1) Histogram for the "weight" of the dominant target (as a percentage of all targets)
 // (2) Histogram for the number of distinct targets of a particular call
@@ -4578,61 +4916,60 @@ void TR_IProfiler::traverseIProfilerTableAndGenerateHistograms(J9JITConfig *jitC
 
     // TR::VMAccessCriticalSection dumpCallGraph(fe); // prevent class unloading
 
-    for (int32_t bucket = 0; bucket < TR::Options::_iProfilerBcHashTableSize; bucket++) {
-        for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
-            // Skip invalid entries
-            if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
-                continue;
-            // Skip the artificial entries
-            if (!entry->getCanPersistEntryFlag())
-                continue;
-            // Skip non-callgraph entries
-            TR_IPBCDataCallGraph *cgEntry = entry->asIPBCDataCallGraph();
-            if (!cgEntry)
-                continue;
-            CallSiteProfileInfo *cgData = cgEntry->getCGData();
-
-            uint32_t sumWeight = 0;
-            uint32_t maxWeight = 0;
-            int maxIndex = -1;
-            int numTargets = 0;
-            for (int j = 0; j < NUM_CS_SLOTS; j++) {
-                sumWeight += cgData->_weight[j];
-                if (maxWeight < cgData->_weight[j]) {
-                    maxWeight = cgData->_weight[j];
-                    maxIndex = j;
-                }
-                if (cgData->getClazz(j) && cgData->_weight[j] > 0)
-                    numTargets++;
+    TR_IPBytecodeHashTable::Iterator iter(_bcHashTable);
+    for (TR_IPBytecodeHashTableEntry *entry = iter.getFirst(); entry; entry = iter.getNext()) {
+        // Skip invalid entries
+        if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
+            continue;
+        // Skip the artificial entries
+        if (!entry->getCanPersistEntryFlag())
+            continue;
+        // Skip non-callgraph entries
+        TR_IPBCDataCallGraph *cgEntry = entry->asIPBCDataCallGraph();
+        if (!cgEntry)
+            continue;
+        CallSiteProfileInfo *cgData = cgEntry->getCGData();
+
+        uint32_t sumWeight = 0;
+        uint32_t maxWeight = 0;
+        int maxIndex = -1;
+        int numTargets = 0;
+        for (int j = 0; j < NUM_CS_SLOTS; j++) {
+            sumWeight += cgData->_weight[j];
+            if (maxWeight < cgData->_weight[j]) {
+                maxWeight = cgData->_weight[j];
+                maxIndex = j;
             }
-            sumWeight += cgData->_residueWeight;
-            if (cgData->_residueWeight)
+            if (cgData->getClazz(j) && cgData->_weight[j] > 0)
                 numTargets++;
-            if (sumWeight > 1)
-                numTargetsHisto.update(numTargets);
-            if (numTargets == 0) {
-                fprintf(stderr, "Entry with no weight\n");
-                for (int j = 0; j < NUM_CS_SLOTS; j++)
-                    fprintf(stderr, "Class %" OMR_PRIuPTR ", weight=%u\n", cgData->getClazz(j), cgData->_weight[j]);
-            }
+        }
+        sumWeight += cgData->_residueWeight;
+        if (cgData->_residueWeight)
+            numTargets++;
+        if (sumWeight > 1)
+            numTargetsHisto.update(numTargets);
+        if (numTargets == 0) {
+            fprintf(stderr, "Entry with no weight\n");
+            for (int j = 0; j < NUM_CS_SLOTS; j++)
+                fprintf(stderr, "Class %" OMR_PRIuPTR ", weight=%u\n", cgData->getClazz(j), cgData->_weight[j]);
+        }
 
-            double percentage = 0;
-            if (maxIndex != -1)
-                percentage = maxWeight * 100.0 / (double)sumWeight;
-            else
-                fprintf(stderr, "maxIndex is 1\n");
-            if (sumWeight > 1)
-                maxWeightHisto.update(percentage);
-            if (sumWeight > 1) {
-                if (numTargets == 1) {
-                    if (percentage < 100.0) {
-                        fprintf(stderr, "Single target but percentage is %f  maxWeight=%u maxIndex=%d sumWeight=%u\n",
-                            percentage, maxWeight, maxIndex, sumWeight);
-                    }
+        double percentage = 0;
+        if (maxIndex != -1)
+            percentage = maxWeight * 100.0 / (double)sumWeight;
+        else
+            fprintf(stderr, "maxIndex is 1\n");
+        if (sumWeight > 1)
+            maxWeightHisto.update(percentage);
+        if (sumWeight > 1) {
+            if (numTargets == 1) {
+                if (percentage < 100.0) {
+                    fprintf(stderr, "Single target but percentage is %f  maxWeight=%u maxIndex=%d sumWeight=%u\n",
+                        percentage, maxWeight, maxIndex, sumWeight);
                 }
             }
         }
-    } // for each bucket
+    }
     maxWeightHisto.report(stderr);
     numTargetsHisto.report(stderr);
 }
@@ -69,6 +69,7 @@
 #include "il/Node.hpp"
 #include "infra/Link.hpp"
 #include "runtime/ExternalProfiler.hpp"
+#include "runtime/IProfilerHashTable.hpp"
 
 #undef EXPERIMENTAL_IPROFILER
 
@@ -86,6 +87,9 @@ class TR_IPBCDataFourBytes;
 class TR_IPBCDataEightWords;
 class TR_IPBCDataAllocation;
 class TR_IPByteVector;
+class TR_IProfilerSnapshot;
+class TR_IProfilerSnapshotStringTable;
+struct TR_IPSnapshotEntry;
 class TR_J9ByteCodeIterator;
 class TR_ExternalValueProfileInfo;
 class TR_OpaqueMethodBlock;
@@ -220,8 +224,7 @@ public:
     void operator delete(void *p, void *) {}
 
     TR_IPBytecodeHashTableEntry(uintptr_t pc)
-        : _next(NULL)
-        , _pc(pc)
+        : _pc(pc)
         , _lastSeenClassUnloadID(-1)
         , _entryFlags(0)
         , _persistFlags(IPBC_ENTRY_CAN_PERSIST_FLAG)
@@ -232,10 +235,6 @@ public:
 
     uintptr_t getPC() const { return _pc; }
 
-    TR_IPBytecodeHashTableEntry *getNext() const { return _next; }
-
-    void setNext(TR_IPBytecodeHashTableEntry *n) { _next = n; }
-
     int32_t getLastSeenClassUnloadID() const { return _lastSeenClassUnloadID; }
 
     void setLastSeenClassUnloadID(int32_t v) { _lastSeenClassUnloadID = v; }
@@ -340,7 +339,6 @@ public:
     } // only for CallGraph entries
 
 protected:
-    TR_IPBytecodeHashTableEntry *_next;
     uintptr_t _pc;
     int32_t _lastSeenClassUnloadID;
 
@@ -400,7 +398,6 @@ public:
 
     void operator delete(void *p) throw() {}
 
-    TR_IPMethodHashTableEntry *_next; // for chaining in the hashtable
     TR_OpaqueMethodBlock *_method; // callee
     TR_IPMethodData _caller; // link list of callers and their weights. Capped at MAX_IPMETHOD_CALLERS
     TR_DummyBucket _otherBucket;
@@ -408,6 +405,29 @@ public:
     void add(TR_OpaqueMethodBlock *caller, TR_OpaqueMethodBlock *callee, uint32_t pcIndex);
 };
 
+// Keys of the IProfiler hashtables (see TR_IPHashTable)
+struct TR_IPBytecodeKeyTraits {
+    static uintptr_t getKey(const TR_IPBytecodeHashTableEntry *entry) { return entry->getPC(); }
+};
+
+struct TR_IPMethodKeyTraits {
+    static uintptr_t getKey(const TR_IPMethodHashTableEntry *entry) { return (uintptr_t)entry->_method; }
+};
+
+// Records that the profile snapshot was already consulted for a method
+struct TR_IPSnapshotLookupEntry {
+    TR_OpaqueMethodBlock *_method;
+};
+
+struct TR_IPSnapshotLookupKeyTraits {
+    static uintptr_t getKey(const TR_IPSnapshotLookupEntry *entry) { return (uintptr_t)entry->_method; }
+};
+
+typedef TR_IPHashTable<TR_IPBytecodeHashTableEntry, TR_IPBytecodeKeyTraits> TR_IPBytecodeHashTable;
+typedef TR_IPHashTable<TR_IPBCDataAllocation, TR_IPBytecodeKeyTraits> TR_IPAllocHashTable;
+typedef TR_IPHashTable<TR_IPMethodHashTableEntry, TR_IPMethodKeyTraits> TR_IPMethodHashTable;
+typedef TR_IPHashTable<TR_IPSnapshotLookupEntry, TR_IPSnapshotLookupKeyTraits> TR_IPSnapshotLookupHashTable;
+
 class TR_IPBCDataFourBytes : public TR_IPBytecodeHashTableEntry {
 public:
     TR_IPBCDataFourBytes(uintptr_t pc)
@@ -930,6 +950,18 @@ public:
 
     void persistAllEntries(); // Persists all entries from IProfiler table into the SCC; TODO: check that JITServer does
                               // not execute this
+    /**
+     * @brief Writes all branch, switch and call-graph entries to the profile snapshot file,
+     * independently of the SCC. Profiles of the previous snapshot that were not used in
+     * this run are carried over. The previous snapshot is unmapped.
+     *
+     * @param forCheckpoint if true, the snapshot just written is mapped again the next time it
+     * is needed, so that it is used after restore and carried over by the write at shutdown
+     *
+     * @note Must be called when compilation threads can no longer query the IProfiler,
+     * i.e. at shutdown or checkpoint.
+     */
+    void writeSnapshot(J9VMThread *vmThread, bool forCheckpoint = false);
     void traverseIProfilerTableAndCollectEntries(TR_AggregationHT *aggregationHT, J9VMThread *vmThread,
         bool collectOnlyCallGraphEntries = false);
 
@@ -1001,8 +1033,8 @@ public:
     static uintptr_t getSearchPCFromMethodAndBCIndex(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex);
     static uintptr_t getSearchPCFromMethodAndBCIndex(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex,
         TR::Compilation *comp);
-    virtual TR_IPBytecodeHashTableEntry *searchForSample(uintptr_t pc, int32_t bucket);
-    virtual TR_IPMethodHashTableEntry *searchForMethodSample(TR_OpaqueMethodBlock *omb, int32_t bucket);
+    virtual TR_IPBytecodeHashTableEntry *searchForSample(uintptr_t pc);
+    virtual TR_IPMethodHashTableEntry *searchForMethodSample(TR_OpaqueMethodBlock *omb);
 
     // Use _iprofilerMonitor for these two routines
     TR_IprofilerThreadLifetimeStates getIProfilerThreadLifetimeState() const { return _iprofilerThreadLifetimeState; }
@@ -1052,17 +1084,11 @@ private:
     TR_IPBCDataStorageHeader *getJ9SharedDataDescriptorForMethod(J9SharedDataDescriptor *descriptor,
         unsigned char *buffer, uint32_t length, TR_OpaqueMethodBlock *method, TR::Compilation *comp);
 
-    static int32_t bcHash(uintptr_t);
-    static int32_t allocHash(uintptr_t);
-
-    static int32_t methodHash(uintptr_t pc);
-    //   static int32_t pcHash(uintptr_t pc);
-
     bool acquireHashTableWriteLock(bool forceFullLock);
     void releaseHashTableWriteLock();
 
     TR_IPBCDataStorageHeader *searchForPersistentSample(TR_IPBCDataStorageHeader *root, uintptr_t pc);
-    TR_IPBCDataAllocation *searchForAllocSample(uintptr_t pc, int32_t bucket);
+    TR_IPBCDataAllocation *searchForAllocSample(uintptr_t pc);
 
     TR_IPBytecodeHashTableEntry *persistentProfilingSample(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex,
         TR::Compilation *comp, bool *methodProfileExistsInSCC);
@@ -1070,8 +1096,8 @@ private:
         TR::Compilation *comp, bool *methodProfileExistsInSCC, TR_IPBCDataStorageHeader *store);
 
     TR_IPBCDataAllocation *profilingAllocSample(uintptr_t pc, uintptr_t data, bool addIt);
-    TR_IPBytecodeHashTableEntry *findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt);
-    TR_IPBCDataAllocation *findOrCreateAllocEntry(int32_t bucket, uintptr_t pc, bool addIt);
+    TR_IPBytecodeHashTableEntry *findOrCreateEntry(uintptr_t pc, bool addIt);
+    TR_IPBCDataAllocation *findOrCreateAllocEntry(uintptr_t pc, bool addIt);
     TR_OpaqueMethodBlock *getMethodFromNode(TR::Node *node, TR::Compilation *comp);
     bool addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data, bool isRIData = false, uint32_t freq = 1);
     TR_AbstractInfo *createIProfilingValueInfo(TR::Node *node, TR::Compilation *comp);
@@ -1090,6 +1116,25 @@ private:
         TR::Compilation *comp);
 
     J9ROMMethod *findROMMethodFromPC(J9VMThread *vmThread, uintptr_t methodPC, J9ROMClass *&romClass);
+
+    enum TR_IProfilerSnapshotStates {
+        SNAPSHOT_NOT_OPENED = 0,
+        SNAPSHOT_OPENING,
+        SNAPSHOT_OPEN,
+        SNAPSHOT_UNAVAILABLE
+    };
+
+    const char *getSnapshotFileName() const;
+    // Maps the profile snapshot the first time it is needed; returns NULL if there is none
+    TR_IProfilerSnapshot *getSnapshot();
+    // Unmaps the snapshot. If reopen is true, the snapshot is mapped again the next time it is
+    // needed (e.g. after a checkpoint is restored); otherwise it is not used any more.
+    void closeSnapshot(bool reopen = false);
+    // Copies the profile of a method from the snapshot into the bytecode hashtable.
+    // The snapshot is consulted at most once per method. Returns true if any entry was loaded.
+    bool loadProfileFromSnapshot(TR_OpaqueMethodBlock *method, TR::Compilation *comp);
+    bool fillSnapshotEntry(TR_IPBytecodeHashTableEntry *entry, uintptr_t bytecodeStart, TR_IPSnapshotEntry *stored,
+        TR_IProfilerSnapshotStringTable &strings);
     uintptr_t createBalancedBST(TR_IPBytecodeHashTableEntry **ipEntries, int32_t low, int32_t high, uintptr_t memChunk,
         TR_J9SharedCache *sharedCache);
     uintptr_t createBalancedBST(uintptr_t *pcEntries, int32_t low, int32_t high, uintptr_t memChunk,
@@ -1128,12 +1173,12 @@ private:
 
     // bytecode hashtable
 protected:
-    TR_IPBytecodeHashTableEntry **_bcHashTable;
+    TR_IPBytecodeHashTable _bcHashTable;
 
 private:
 #if defined(EXPERIMENTAL_IPROFILER)
-    // bytecode hashtable
-    TR_IPBCDataAllocation **_allocHashTable;
+    // allocation hashtable
+    TR_IPAllocHashTable _allocHashTable;
 #endif
 
     // giving out profiling information for inlined calls
@@ -1157,7 +1202,7 @@ private:
     uint64_t _numRequestsHandedToIProfilerThread;
     uint64_t _iprofilerNumRecords; // info stats only
 
-    TR_IPMethodHashTableEntry **_methodHashTable;
+    TR_IPMethodHashTable _methodHashTable;
     uint32_t _numMethodHashEntries;
 
     uint32_t _iprofilerBufferSize;
@@ -1165,6 +1210,10 @@ private:
 
     volatile TR_IprofilerThreadLifetimeStates _iprofilerThreadLifetimeState;
 
+    TR_IProfilerSnapshot *_snapshot;
+    volatile uint32_t _snapshotState; // TR_IProfilerSnapshotStates
+    TR_IPSnapshotLookupHashTable _snapshotLookups; // methods for which the snapshot was consulted
+
 public:
     static int32_t _STATS_noProfilingInfo;
     static int32_t _STATS_doesNotWantToGiveProfilingInfo;
@@ -1199,6 +1248,12 @@ public:
 
     static int32_t _STATS_IPEntryRead;
     static int32_t _STATS_IPEntryChoosePersistent;
+
+    static int32_t _STATS_snapshotMethodsLoaded;
+    static int32_t _STATS_snapshotEntriesLoaded;
+    static int32_t _STATS_snapshotMethodsStale;
+    static int32_t _STATS_snapshotMethodsWritten;
+    static int32_t _STATS_snapshotEntriesWritten;
 };
 
 void printIprofilerStats(TR::Options *options, J9JITConfig *jitConfig, TR_IProfiler *iProfiler, const char *event);
@@ -0,0 +1,329 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef IPROFILER_HASHTABLE_HPP
+#define IPROFILER_HASHTABLE_HPP
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "j9.h"
+#include "AtomicSupport.hpp"
+#include "env/PersistentAllocator.hpp"
+
+/**
+ * @brief An open-addressed hashtable of IProfiler entries that grows online.
+ *
+ * Entries are never removed, which keeps the table simple:
+ *    - Lookups take no locks and never wait. They probe the table that is current
+ *      when the lookup starts; an entry added while the table is being grown may be
+ *      missed, which callers already tolerate as "no profiling information yet".
+ *    - Inserts claim an empty slot with a compare-and-swap. When two threads insert
+ *      entries for the same key at the same time, only one of them is published and
+ *      the other thread gets the published entry back.
+ *    - When the table becomes half full, one inserting thread allocates a table twice
+ *      as large, freezes the old one and copies the entries over. Inserts that race with
+ *      the copy notice the freeze and repeat themselves in the new table.
+ *
+ * Retired tables are not freed while the hashtable is alive because lookups may still
+ * be probing them; their total size is less than the size of the current table.
+ *
+ * KeyTraits must provide "static uintptr_t getKey(const Entry *)". The key 0 is reserved.
+ */
+template <class Entry, class KeyTraits> class TR_IPHashTable {
+    struct Table;
+
+public:
+    struct Stats {
+        size_t _capacity; // number of slots in the current table
+        size_t _occupancy; // number of entries in the current table
+        uint32_t _numResizes;
+        uint32_t _maxProbeLength;
+        double _avgProbeLength; // average number of slots probed to find an entry
+    };
+
+    TR_IPHashTable()
+        : _table(NULL)
+        , _allocator(NULL)
+        , _resizing(0)
+        , _numResizes(0)
+        , _growthFailed(false)
+    {}
+
+    /**
+     * @brief Allocates the initial table, rounding the size up to a power of 2.
+     * @return false if the table could not be allocated
+     */
+    bool init(TR::PersistentAllocator *allocator, size_t initialSize)
+    {
+        _allocator = allocator;
+        size_t capacity = MIN_CAPACITY;
+        while (capacity < initialSize)
+            capacity <<= 1;
+        _table = allocateTable(capacity);
+        return _table != NULL;
+    }
+
+    bool isInitialized() const { return _table != NULL; }
+
+    Entry *find(uintptr_t key) const
+    {
+        Table *table = _table;
+        if (!table)
+            return NULL;
+        return findInTable(table, key);
+    }
+
+    /**
+     * @brief Adds entry to the table unless there is already an entry with the same key.
+     * @return the entry in the table for the key of entry, which is not necessarily entry,
+     * or NULL if the table is full and cannot grow
+     */
+    Entry *insert(Entry *entry)
+    {
+        uintptr_t key = KeyTraits::getKey(entry);
+        while (true) {
+            Table *table = _table;
+            if (!table)
+                return NULL;
+            if (table->_frozen) {
+                waitForResize(table);
+                continue;
+            }
+
+            bool inserted = false;
+            Entry *found = insertInTable(table, entry, key, inserted);
+            if (!found) {
+                // The table is full
+                if (!grow(table) && (_table == table))
+                    return NULL;
+                continue;
+            }
+            if (inserted) {
+                uintptr_t occupancy = VM_AtomicSupport::add(&table->_occupancy, 1);
+                if (occupancy > (table->_capacity >> 1))
+                    grow(table);
+            }
+            // Pairs with the freeze in grow(): either the resizing thread copies the slot
+            // we published or we see the freeze and publish the entry in the new table too
+            VM_AtomicSupport::readWriteBarrier();
+            if (!table->_frozen)
+                return found;
+            waitForResize(table);
+            entry = found;
+        }
+    }
+
+    /**
+     * @brief Iterates over the entries of the current table. Entries added during
+     * the iteration may or may not be seen.
+     */
+    class Iterator {
+    public:
+        Iterator(const TR_IPHashTable &hashTable)
+            : _table(hashTable._table)
+            , _index(0)
+        {}
+
+        Entry *getFirst()
+        {
+            _index = 0;
+            return getNext();
+        }
+
+        Entry *getNext()
+        {
+            if (!_table)
+                return NULL;
+            while (_index < _table->_capacity) {
+                Entry *entry = _table->_slots[_index++];
+                if (entry)
+                    return entry;
+            }
+            return NULL;
+        }
+
+    private:
+        Table *_table;
+        size_t _index;
+    };
+
+    /**
+     * @brief Computes the occupancy and probe length statistics of the current table.
+     * This walks the whole table and is meant for diagnostics only.
+     */
+    void getStats(Stats &stats) const
+    {
+        memset(&stats, 0, sizeof(stats));
+        Table *table = _table;
+        if (!table)
+            return;
+        stats._capacity = table->_capacity;
+        stats._numResizes = _numResizes;
+        uint64_t totalProbeLength = 0;
+        for (size_t i = 0; i < table->_capacity; i++) {
+            Entry *entry = table->_slots[i];
+            if (!entry)
+                continue;
+            // Linear probing: an entry is found after probing every slot from its home slot to its own
+            uint32_t probeLength = (uint32_t)(((i - homeSlot(table, KeyTraits::getKey(entry))) & table->_mask) + 1);
+            totalProbeLength += probeLength;
+            if (probeLength > stats._maxProbeLength)
+                stats._maxProbeLength = probeLength;
+            stats._occupancy++;
+        }
+        if (stats._occupancy)
+            stats._avgProbeLength = (double)totalProbeLength / stats._occupancy;
+    }
+
+private:
+    enum {
+        MIN_CAPACITY = 64
+    };
+
+    struct Table {
+        Table *_retired; // the table this one replaced
+        size_t _capacity; // power of 2
+        size_t _mask;
+        uint32_t _shift;
+        volatile uint32_t _frozen; // set when the table is being copied into a larger one
+        volatile uintptr_t _occupancy;
+        Entry *volatile _slots[1];
+    };
+
+    Table *allocateTable(size_t capacity)
+    {
+        size_t size = offsetof(Table, _slots) + capacity * sizeof(Entry *);
+        Table *table = (Table *)_allocator->allocate(size, std::nothrow);
+        if (!table)
+            return NULL;
+        memset(table, 0, size);
+        table->_capacity = capacity;
+        table->_mask = capacity - 1;
+        table->_shift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1)
+            table->_shift--;
+        return table;
+    }
+
+    // Fibonacci hashing spreads the mostly aligned pcs and J9Method pointers over the table
+    static size_t homeSlot(Table *table, uintptr_t key)
+    {
+        return (size_t)(((uint64_t)key * 0x9E3779B97F4A7C15ULL) >> table->_shift) & table->_mask;
+    }
+
+    static Entry *findInTable(Table *table, uintptr_t key)
+    {
+        size_t slot = homeSlot(table, key);
+        for (size_t probes = 0; probes < table->_capacity; probes++) {
+            Entry *entry = table->_slots[slot];
+            if (!entry)
+                return NULL;
+            if (KeyTraits::getKey(entry) == key)
+                return entry;
+            slot = (slot + 1) & table->_mask;
+        }
+        return NULL;
+    }
+
+    // Returns the entry in the table for key, or NULL if the table is full
+    static Entry *insertInTable(Table *table, Entry *entry, uintptr_t key, bool &inserted)
+    {
+        size_t slot = homeSlot(table, key);
+        for (size_t probes = 0; probes < table->_capacity; probes++) {
+            Entry *current = table->_slots[slot];
+            if (!current) {
+                current = (Entry *)VM_AtomicSupport::lockCompareExchange((uintptr_t *)&table->_slots[slot],
+                    (uintptr_t)NULL, (uintptr_t)entry);
+                if (!current) {
+                    inserted = true;
+                    return entry;
+                }
+                // Another thread took the slot first; it may have added the same key
+            }
+            if (KeyTraits::getKey(current) == key)
+                return current;
+            slot = (slot + 1) & table->_mask;
+        }
+        return NULL;
+    }
+
+    // Replaces table with a table twice as large; returns false if it cannot be done
+    bool grow(Table *table)
+    {
+        if (_growthFailed)
+            return false;
+        if (0 != VM_AtomicSupport::lockCompareExchangeU32((uint32_t *)&_resizing, 0, 1))
+            return true; // another thread is growing the table
+        if (_table != table) {
+            // Somebody else has already grown this table
+            VM_AtomicSupport::writeBarrier();
+            _resizing = 0;
+            return true;
+        }
+
+        Table *newTable = allocateTable(table->_capacity << 1);
+        if (!newTable) {
+            _growthFailed = true;
+            VM_AtomicSupport::writeBarrier();
+            _resizing = 0;
+            return false;
+        }
+
+        table->_frozen = 1;
+        VM_AtomicSupport::readWriteBarrier();
+        for (size_t i = 0; i < table->_capacity; i++) {
+            Entry *entry = table->_slots[i];
+            if (entry) {
+                bool inserted = false;
+                // Only this thread can see newTable, which is twice as large: this cannot fail
+                insertInTable(newTable, entry, KeyTraits::getKey(entry), inserted);
+                if (inserted)
+                    newTable->_occupancy++;
+            }
+        }
+        newTable->_retired = table;
+        _numResizes++;
+        VM_AtomicSupport::writeBarrier();
+        _table = newTable;
+        VM_AtomicSupport::writeBarrier();
+        _resizing = 0;
+        return true;
+    }
+
+    void waitForResize(Table *table)
+    {
+        while (_table == table) {
+            VM_AtomicSupport::yieldCPU();
+            VM_AtomicSupport::readBarrier();
+        }
+    }
+
+    Table *volatile _table;
+    TR::PersistentAllocator *_allocator;
+    volatile uint32_t _resizing;
+    uint32_t _numResizes;
+    bool _growthFailed;
+};
+
+#endif // IPROFILER_HASHTABLE_HPP
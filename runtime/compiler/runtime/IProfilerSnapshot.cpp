@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <limits.h>
+#include <new>
+#include <string.h>
+#include "j9.h"
+#include "j9port.h"
+#include "rommeth.h"
+#include "AtomicSupport.hpp"
+#include "runtime/IProfilerSnapshot.hpp"
+
+#define FNV_OFFSET_BASIS_64 CONSTANT64(0xcbf29ce484222325)
+#define FNV_PRIME_64 CONSTANT64(0x100000001b3)
+
+static uint64_t hashBytes(uint64_t hash, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME_64;
+    }
+    return hash;
+}
+
+static uint64_t hashUTF8(uint64_t hash, const J9UTF8 *str)
+{
+    return hashBytes(hash, J9UTF8_DATA(str), J9UTF8_LENGTH(str));
+}
+
+uint64_t TR_IProfilerSnapshot::methodKey(J9ROMClass *romClass, J9ROMMethod *romMethod)
+{
+    uint64_t hash = hashUTF8(FNV_OFFSET_BASIS_64, J9ROMCLASS_CLASSNAME(romClass));
+    hash = hashUTF8(hash, J9ROMMETHOD_NAME(romMethod));
+    return hashUTF8(hash, J9ROMMETHOD_SIGNATURE(romMethod));
+}
+
+uint64_t TR_IProfilerSnapshot::bytecodeHash(J9ROMMethod *romMethod)
+{
+    return hashBytes(FNV_OFFSET_BASIS_64, J9_BYTECODE_START_FROM_ROM_METHOD(romMethod),
+        (size_t)J9_BYTECODE_SIZE_FROM_ROM_METHOD(romMethod));
+}
+
+TR_IProfilerSnapshot::TR_IProfilerSnapshot(J9PortLibrary *portLib, J9MmapHandle *mmapHandle, uint32_t *methodStates)
+    : _portLib(portLib)
+    , _mmapHandle(mmapHandle)
+    , _methodStates(methodStates)
+{
+    const uint8_t *start = (const uint8_t *)mmapHandle->pointer;
+    _header = (const TR_IPSnapshotHeader *)start;
+    _methods = (const TR_IPSnapshotMethod *)(start + _header->_methodsOffset);
+    _entries = (const TR_IPSnapshotEntry *)(start + _header->_entriesOffset);
+    _strings = start + _header->_stringsOffset;
+}
+
+TR_IProfilerSnapshot *TR_IProfilerSnapshot::open(J9PortLibrary *portLib, const char *fileName)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    IDATA fd = j9file_open(fileName, EsOpenRead, 0);
+    if (-1 == fd)
+        return NULL;
+
+    I_64 fileLength = j9file_flength(fd);
+    J9MmapHandle *mmapHandle = NULL;
+    if (fileLength >= (I_64)sizeof(TR_IPSnapshotHeader))
+        mmapHandle = j9mmap_map_file(fd, 0, (UDATA)fileLength, fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_JIT);
+    // The mapping stays valid after the file is closed
+    j9file_close(fd);
+    if (!mmapHandle)
+        return NULL;
+
+    // Reject files from other releases as well as truncated or corrupted files
+    const TR_IPSnapshotHeader *header = (const TR_IPSnapshotHeader *)mmapHandle->pointer;
+    uint64_t size = (uint64_t)fileLength;
+    if ((header->_magic != TR_IPSNAPSHOT_MAGIC) || (header->_version != TR_IPSNAPSHOT_VERSION)
+        || (header->_methodsOffset > size)
+        || ((size - header->_methodsOffset) / sizeof(TR_IPSnapshotMethod) < header->_numMethods)
+        || (header->_entriesOffset > size)
+        || ((size - header->_entriesOffset) / sizeof(TR_IPSnapshotEntry) < header->_numEntries)
+        || (header->_stringsOffset > size) || (size - header->_stringsOffset < header->_stringsSize)
+        || (header->_methodsOffset % sizeof(uint64_t)) || (header->_entriesOffset % sizeof(uint64_t))
+        || (header->_stringsOffset % sizeof(uint16_t))) {
+        j9mmap_unmap_file(mmapHandle);
+        return NULL;
+    }
+
+    size_t statesSize = (header->_numMethods + 1) * sizeof(uint32_t);
+    uint32_t *methodStates = (uint32_t *)j9mem_allocate_memory(statesSize, J9MEM_CATEGORY_JIT);
+    void *mem = j9mem_allocate_memory(sizeof(TR_IProfilerSnapshot), J9MEM_CATEGORY_JIT);
+    if (!methodStates || !mem) {
+        j9mem_free_memory(methodStates);
+        j9mem_free_memory(mem);
+        j9mmap_unmap_file(mmapHandle);
+        return NULL;
+    }
+    memset(methodStates, 0, statesSize);
+    return new (mem) TR_IProfilerSnapshot(portLib, mmapHandle, methodStates);
+}
+
+void TR_IProfilerSnapshot::close()
+{
+    PORT_ACCESS_FROM_PORT(_portLib);
+    j9mmap_unmap_file(_mmapHandle);
+    j9mem_free_memory((void *)_methodStates);
+    j9mem_free_memory(this);
+}
+
+const J9UTF8 *TR_IProfilerSnapshot::getString(uint32_t offset) const
+{
+    uint64_t stringsSize = _header->_stringsSize;
+    if ((0 == offset) || (offset % sizeof(uint16_t)) || ((uint64_t)offset + sizeof(uint16_t) > stringsSize))
+        return NULL;
+    const J9UTF8 *str = (const J9UTF8 *)(_strings + offset);
+    if ((uint64_t)offset + sizeof(uint16_t) + J9UTF8_LENGTH(str) > stringsSize)
+        return NULL;
+    return str;
+}
+
+bool TR_IProfilerSnapshot::hasValidEntries(const TR_IPSnapshotMethod *method) const
+{
+    return (method->_firstEntry <= _header->_numEntries)
+        && (method->_numEntries <= _header->_numEntries - method->_firstEntry);
+}
+
+const TR_IPSnapshotMethod *TR_IProfilerSnapshot::claimMethod(J9ROMClass *romClass, J9ROMMethod *romMethod,
+    bool &isStale)
+{
+    isStale = false;
+    uint64_t key = methodKey(romClass, romMethod);
+
+    // Binary search for the first record with this key
+    uint32_t low = 0;
+    uint32_t high = _header->_numMethods;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        if (_methods[middle]._key < key)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    // Different methods may share a key; the class name settles those collisions.
+    // Method name and signature collisions within a class are caught by the bytecode hash.
+    J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+    for (uint32_t i = low; i < _header->_numMethods && _methods[i]._key == key; i++) {
+        const TR_IPSnapshotMethod *method = _methods + i;
+        const J9UTF8 *storedName = getString(method->_classNameOffset);
+        if (!storedName || !J9UTF8_EQUALS(storedName, className))
+            continue;
+
+        if (_methodStates[i] != METHOD_NOT_LOADED)
+            return NULL;
+
+        if (!hasValidEntries(method) || (method->_bytecodeSize != J9_BYTECODE_SIZE_FROM_ROM_METHOD(romMethod))
+            || (method->_bytecodeHash != bytecodeHash(romMethod))) {
+            if (METHOD_NOT_LOADED
+                == VM_AtomicSupport::lockCompareExchangeU32((uint32_t *)&_methodStates[i], METHOD_NOT_LOADED,
+                    METHOD_STALE))
+                isStale = true;
+            return NULL;
+        }
+
+        // Only one thread gets to load the profile of a method
+        if (METHOD_NOT_LOADED
+            == VM_AtomicSupport::lockCompareExchangeU32((uint32_t *)&_methodStates[i], METHOD_NOT_LOADED,
+                METHOD_LOADED))
+            return method;
+        return NULL;
+    }
+    return NULL;
+}
+
+static bool writeFully(J9PortLibrary *portLib, IDATA fd, const void *buffer, uint64_t length)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    const uint8_t *cursor = (const uint8_t *)buffer;
+    while (length > 0) {
+        IDATA chunk = (IDATA)((length > (1 << 30)) ? (1 << 30) : length);
+        IDATA written = j9file_write(fd, (void *)cursor, chunk);
+        if (written <= 0)
+            return false;
+        cursor += written;
+        length -= written;
+    }
+    return true;
+}
+
+bool TR_IProfilerSnapshot::write(J9PortLibrary *portLib, const char *fileName, TR_IPSnapshotMethod *methods,
+    uint32_t numMethods, TR_IPSnapshotEntry *entries, uint32_t numEntries, uint8_t *strings, uint64_t stringsSize)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+
+    TR_IPSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    header._magic = TR_IPSNAPSHOT_MAGIC;
+    header._version = TR_IPSNAPSHOT_VERSION;
+    header._numMethods = numMethods;
+    header._numEntries = numEntries;
+    header._methodsOffset = sizeof(TR_IPSnapshotHeader);
+    header._entriesOffset = header._methodsOffset + (uint64_t)numMethods * sizeof(TR_IPSnapshotMethod);
+    header._stringsOffset = header._entriesOffset + (uint64_t)numEntries * sizeof(TR_IPSnapshotEntry);
+    header._stringsSize = stringsSize;
+
+    size_t nameLength = strlen(fileName);
+    char *tempFileName = (char *)j9mem_allocate_memory(nameLength + sizeof(".tmp"), J9MEM_CATEGORY_JIT);
+    if (!tempFileName)
+        return false;
+    memcpy(tempFileName, fileName, nameLength);
+    memcpy(tempFileName + nameLength, ".tmp", sizeof(".tmp"));
+
+    bool success = false;
+    IDATA fd = j9file_open(tempFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0660);
+    if (-1 != fd) {
+        success = writeFully(portLib, fd, &header, sizeof(header))
+            && writeFully(portLib, fd, methods, (uint64_t)numMethods * sizeof(TR_IPSnapshotMethod))
+            && writeFully(portLib, fd, entries, (uint64_t)numEntries * sizeof(TR_IPSnapshotEntry))
+            && writeFully(portLib, fd, strings, stringsSize);
+        if (0 != j9file_close(fd))
+            success = false;
+
+        if (success) {
+            j9file_unlink(fileName);
+            success = (0 == j9file_move(tempFileName, fileName));
+        }
+        if (!success)
+            j9file_unlink(tempFileName);
+    }
+    j9mem_free_memory(tempFileName);
+    return success;
+}
+
+bool TR_IProfilerSnapshotStringTable::UTF8Less::operator()(const J9UTF8 *a, const J9UTF8 *b) const
+{
+    if (J9UTF8_LENGTH(a) != J9UTF8_LENGTH(b))
+        return J9UTF8_LENGTH(a) < J9UTF8_LENGTH(b);
+    return memcmp(J9UTF8_DATA(a), J9UTF8_DATA(b), J9UTF8_LENGTH(a)) < 0;
+}
+
+TR_IProfilerSnapshotStringTable::TR_IProfilerSnapshotStringTable(TR::Region &region)
+    : _region(region)
+    , _offsets(UTF8Less(), OffsetMapAllocator(region))
+    , _data(NULL)
+    , _size(sizeof(uint16_t)) // offset 0 is reserved for "no string"
+    , _capacity(0)
+{}
+
+uint32_t TR_IProfilerSnapshotStringTable::add(const J9UTF8 *str)
+{
+    if (!str)
+        return 0;
+
+    OffsetMap::iterator it = _offsets.find(str);
+    if (it != _offsets.end())
+        return it->second;
+
+    uint64_t length = (sizeof(uint16_t) + J9UTF8_LENGTH(str) + 1) & ~(uint64_t)1;
+    if (_size + length > UINT_MAX)
+        return 0;
+
+    if (_size + length > _capacity) {
+        uint64_t newCapacity = (_capacity ? _capacity * 2 : 64 * 1024);
+        while (newCapacity < _size + length)
+            newCapacity *= 2;
+        uint8_t *newData = (uint8_t *)_region.allocate(newCapacity);
+        memset(newData, 0, newCapacity);
+        if (_data)
+            memcpy(newData, _data, _size);
+        _data = newData;
+        _capacity = newCapacity;
+    }
+
+    uint32_t offset = (uint32_t)_size;
+    memcpy(_data + offset, str, sizeof(uint16_t) + J9UTF8_LENGTH(str));
+    _size += length;
+    _offsets.insert(std::make_pair(str, offset));
+    return offset;
+}
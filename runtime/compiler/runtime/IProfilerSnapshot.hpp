@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef IPROFILER_SNAPSHOT_HPP
+#define IPROFILER_SNAPSHOT_HPP
+
+#include <map>
+#include <stdint.h>
+#include "j9.h"
+#include "env/Region.hpp"
+#include "env/TypedAllocator.hpp"
+#include "runtime/IProfiler.hpp"
+
+// A profile snapshot is a standalone file holding IProfiler data for bytecodes of
+// methods, independent of the shared class cache. The layout is:
+//
+//    TR_IPSnapshotHeader
+//    TR_IPSnapshotMethod[_numMethods]   sorted by _key
+//    TR_IPSnapshotEntry[_numEntries]    grouped by method
+//    string area                        J9UTF8 class names, 2-byte aligned
+//
+// Methods are identified by their class name and a hash of the ROM method (name,
+// signature and bytecodes), so profiles survive restarts and redeployments but
+// are ignored for methods whose bytecodes changed. Class pointers in call-graph
+// entries are stored as class names and resolved again when the profile is loaded.
+// Section offsets in the header are relative to the start of the file; string offsets
+// are relative to the start of the string area, where offset 0 means "no string".
+
+#define TR_IPSNAPSHOT_MAGIC 0x4E535049 // "IPSN"
+#define TR_IPSNAPSHOT_VERSION 1
+
+struct TR_IPSnapshotHeader {
+    uint32_t _magic;
+    uint32_t _version;
+    uint32_t _numMethods;
+    uint32_t _numEntries;
+    uint64_t _methodsOffset;
+    uint64_t _entriesOffset;
+    uint64_t _stringsOffset;
+    uint64_t _stringsSize;
+};
+
+struct TR_IPSnapshotMethod {
+    uint64_t _key; // hash of class name, method name and method signature
+    uint64_t _bytecodeHash; // hash of the bytecodes; a mismatch means the profile is stale
+    uint32_t _classNameOffset;
+    uint32_t _bytecodeSize;
+    uint32_t _firstEntry; // index into the entry array
+    uint32_t _numEntries;
+};
+
+struct TR_IPSnapshotEntry {
+    uint32_t _bytecodeIndex;
+    uint8_t _ID; // TR_IPBCD_FOUR_BYTES, TR_IPBCD_EIGHT_WORDS or TR_IPBCD_CALL_GRAPH
+    uint8_t _tooBigToBeInlined;
+    uint16_t _residueWeight;
+
+    union {
+        uint32_t _branchData;
+        uint64_t _switchData[SWITCH_DATA_COUNT];
+
+        struct {
+            uint32_t _classNameOffset[NUM_CS_SLOTS]; // 0 for an empty slot
+            uint16_t _weight[NUM_CS_SLOTS];
+        } _callGraph;
+    };
+};
+
+/**
+ * @brief A read-only, memory-mapped view of a profile snapshot file.
+ *
+ * Method records are claimed at most once, so that concurrent compilation threads
+ * looking up the same method do not load its profile into the IProfiler table twice.
+ */
+class TR_IProfilerSnapshot {
+public:
+    enum MethodState {
+        METHOD_NOT_LOADED = 0,
+        METHOD_LOADED,
+        METHOD_STALE
+    };
+
+    /**
+     * @brief Maps the snapshot file and validates its header.
+     * @return the snapshot, or NULL if the file does not exist or cannot be used
+     */
+    static TR_IProfilerSnapshot *open(J9PortLibrary *portLib, const char *fileName);
+
+    /**
+     * @brief Unmaps the file and frees the snapshot. No method or entry obtained
+     * from the snapshot can be used afterwards.
+     */
+    void close();
+
+    /**
+     * @brief Finds the record for romMethod of romClass and claims it for loading.
+     * @param isStale set to true if the method was profiled with different bytecodes
+     * @return the record, or NULL if the method is not in the snapshot, has already been
+     * claimed, or its bytecodes do not match the profiled ones
+     */
+    const TR_IPSnapshotMethod *claimMethod(J9ROMClass *romClass, J9ROMMethod *romMethod, bool &isStale);
+
+    // Checks that the entries of a method record lie within the entry array
+    bool hasValidEntries(const TR_IPSnapshotMethod *method) const;
+
+    const TR_IPSnapshotEntry *getEntries(const TR_IPSnapshotMethod *method) const
+    {
+        return _entries + method->_firstEntry;
+    }
+
+    /**
+     * @brief Returns the string at the given offset in the string area, or NULL if
+     * the offset is 0 or the string does not fit in the string area.
+     */
+    const J9UTF8 *getString(uint32_t offset) const;
+
+    uint32_t getNumMethods() const { return _header->_numMethods; }
+
+    const TR_IPSnapshotMethod *getMethod(uint32_t index) const { return _methods + index; }
+
+    bool isMethodClaimed(uint32_t index) const { return _methodStates[index] != METHOD_NOT_LOADED; }
+
+    static uint64_t methodKey(J9ROMClass *romClass, J9ROMMethod *romMethod);
+    static uint64_t bytecodeHash(J9ROMMethod *romMethod);
+
+    /**
+     * @brief Writes a snapshot to fileName. The file is written under a temporary
+     * name and then renamed, so readers never see a partially written snapshot.
+     * @return true on success
+     */
+    static bool write(J9PortLibrary *portLib, const char *fileName, TR_IPSnapshotMethod *methods,
+        uint32_t numMethods, TR_IPSnapshotEntry *entries, uint32_t numEntries, uint8_t *strings,
+        uint64_t stringsSize);
+
+private:
+    TR_IProfilerSnapshot(J9PortLibrary *portLib, J9MmapHandle *mmapHandle, uint32_t *methodStates);
+
+    J9PortLibrary *_portLib;
+    J9MmapHandle *_mmapHandle;
+    const TR_IPSnapshotHeader *_header;
+    const TR_IPSnapshotMethod *_methods;
+    const TR_IPSnapshotEntry *_entries;
+    const uint8_t *_strings;
+    volatile uint32_t *_methodStates; // one MethodState per method record
+};
+
+/**
+ * @brief Builds the string area of a snapshot being written, storing each distinct
+ * string once. The strings passed to add() must stay valid while the table is in use.
+ */
+class TR_IProfilerSnapshotStringTable {
+public:
+    TR_IProfilerSnapshotStringTable(TR::Region &region);
+
+    /**
+     * @brief Returns the offset of str in the string area, adding it if needed.
+     * @return the offset, or 0 if str is NULL or the string area would overflow
+     */
+    uint32_t add(const J9UTF8 *str);
+
+    uint8_t *getData() const { return _data; }
+
+    uint64_t getSize() const { return _size; }
+
+private:
+    struct UTF8Less {
+        bool operator()(const J9UTF8 *a, const J9UTF8 *b) const;
+    };
+
+    typedef TR::typed_allocator<std::pair<const J9UTF8 *const, uint32_t>, TR::Region &> OffsetMapAllocator;
+    typedef std::map<const J9UTF8 *, uint32_t, UTF8Less, OffsetMapAllocator> OffsetMap;
+
+    TR::Region &_region;
+    OffsetMap _offsets;
+    uint8_t *_data;
+    uint64_t _size;
+    uint64_t _capacity;
+};
+
+#endif // IPROFILER_SNAPSHOT_HPP
@@ -26,6 +26,7 @@
 #if defined(LINUX)
 #include <sys/mman.h> // for madvise
 #endif // LINUX
+#include "AtomicSupport.hpp"
 #include "OMR/Bytes.hpp"
 #include "j9.h"
 #include "j9cp.h"
@@ -64,6 +65,8 @@ J9JITConfig *J9::CodeCacheManager::_jitConfig = NULL;
 J9::CodeCacheManager::CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator)
     : OMR::CodeCacheManagerConnector(rawAllocator)
     , _fe(fe)
+    , _fullCount(0)
+    , _fullCountReportedToJFR(0)
 {
     _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
     _disclaimEnabled = TR::Options::getCmdLineOptions()->getOption(TR_EnableCodeCacheDisclaiming);
@@ -184,8 +187,48 @@ void J9::CodeCacheManager::setCodeCacheFull()
 {
     self()->OMR::CodeCacheManager::setCodeCacheFull();
     _jitConfig->runtimeFlags |= J9JIT_CODE_CACHE_FULL;
+    VM_AtomicSupport::add(&_fullCount, 1);
 }
 
+#if defined(J9VM_OPT_JFR)
+void J9::CodeCacheManager::reportCodeCacheFullToJFR(J9VMThread *vmThread)
+{
+    uintptr_t fullCount = _fullCount;
+    uintptr_t reportedCount = _fullCountReportedToJFR;
+    if (fullCount == reportedCount)
+        return;
+    // Only one thread reports each transition
+    if (reportedCount != VM_AtomicSupport::lockCompareExchange(&_fullCountReportedToJFR, reportedCount, fullCount))
+        return;
+
+    J9InternalVMFunctions *vmFuncs = vmThread->javaVM->internalVMFunctions;
+    if (!vmFuncs->isJFRRecordingStarted(vmThread->javaVM))
+        return;
+
+    TR::CodeCacheConfig &config = self()->codeCacheConfig();
+    U_64 startAddress = 0;
+    U_64 topAddress = 0;
+    U_64 unallocatedCapacity = 0;
+    I_32 entryCount = 0;
+    {
+        CacheListCriticalSection scanCacheList(self());
+        for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next()) {
+            if (0 == entryCount) {
+                startAddress = (U_64)(uintptr_t)codeCache->getCodeBase();
+                topAddress = (U_64)(uintptr_t)codeCache->getCodeTop();
+            }
+            unallocatedCapacity += codeCache->getFreeContiguousSpace();
+            entryCount++;
+        }
+    }
+
+    // Code caches are committed when they are allocated, so the committed and reserved tops are the same.
+    // The number of bodies in the code caches is not tracked and is reported as 0.
+    vmFuncs->jfrCodeCacheFull(vmThread, startAddress, topAddress, topAddress, unallocatedCapacity,
+        (U_64)config.codeCacheTotalKB() << 10, entryCount, 0, (I_32)fullCount);
+}
+#endif /* defined(J9VM_OPT_JFR) */
+
 void J9::CodeCacheManager::purgeClassLoaderFromFaintBlocks(J9ClassLoader *classLoader)
 {
     OMR::FaintCacheBlock *currentFaintBlock = static_cast<OMR::FaintCacheBlock *>(_jitConfig->methodsToDelete);
@@ -103,6 +103,18 @@ public:
 
     void setCodeCacheFull();
 
+#if defined(J9VM_OPT_JFR)
+    /**
+     * @brief Emit a JFR code cache full event if the code cache has become full
+     *        since the last report. Setting the code cache full can happen while
+     *        holding JIT monitors, so the event is deferred to the end of the
+     *        compilation when it is safe to write to the JFR buffers.
+     *
+     * @param[in] vmThread : the current compilation thread
+     */
+    void reportCodeCacheFullToJFR(J9VMThread *vmThread);
+#endif /* defined(J9VM_OPT_JFR) */
+
     void onFSDDecompile();
     void onClassRedefinition(TR_OpaqueMethodBlock *oldMethod, TR_OpaqueMethodBlock *newMethod);
 
@@ -165,6 +177,8 @@ private:
     static J9JITConfig *_jitConfig;
     static J9JavaVM *_javaVM;
     bool _disclaimEnabled; // If true, code cache can be disclaimed to a file or swap
+    volatile uintptr_t _fullCount; // Number of times the code cache has become full
+    volatile uintptr_t _fullCountReportedToJFR;
 };
 
 } // namespace J9
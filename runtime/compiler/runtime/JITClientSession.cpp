@@ -86,14 +86,15 @@ ClientSessionData::ClientSessionData(uint64_t clientUID, uint32_t seqNo, TR_Pers
     _javaLangClassPtr = NULL;
     _inUse = 1;
     _numActiveThreads = 0;
-    _romMapMonitor = TR::Monitor::create("JIT-JITServerROMMapMonitor");
-    _classMapMonitor = TR::Monitor::create("JIT-JITServerClassMapMonitor");
-    _methodMapMonitor = TR::Monitor::create("JIT-JITServerMethodMapMonitor");
+    _romMapMonitor = JITServerReadMostlyMonitor::create("JIT-JITServerROMMapMonitor", persistentMemory);
+    _classMapMonitor = JITServerReadMostlyMonitor::create("JIT-JITServerClassMapMonitor", persistentMemory);
+    _methodMapMonitor = JITServerReadMostlyMonitor::create("JIT-JITServerMethodMapMonitor", persistentMemory);
     _DLTSetMonitor = TR::Monitor::create("JIT-JITServerDLTSetMonitor");
     _classChainDataMapMonitor = TR::Monitor::create("JIT-JITServerClassChainDataMapMonitor");
     _sequencingMonitor = TR::Monitor::create("JIT-JITServerSequencingMonitor");
     _cacheInitMonitor = TR::Monitor::create("JIT-JITServerCacheInitMonitor");
-    _constantPoolMapMonitor = TR::Monitor::create("JIT-JITServerConstantPoolMonitor");
+    _constantPoolMapMonitor
+        = JITServerReadMostlyMonitor::create("JIT-JITServerConstantPoolMonitor", persistentMemory);
     _vmInfo = NULL;
     _staticMapMonitor = TR::Monitor::create("JIT-JITServerStaticMapMonitor");
     _markedForDeletion = false;
@@ -138,14 +139,14 @@ ClientSessionData::~ClientSessionData()
 
 void ClientSessionData::destroyMonitors()
 {
-    TR::Monitor::destroy(_romMapMonitor);
-    TR::Monitor::destroy(_classMapMonitor);
-    TR::Monitor::destroy(_methodMapMonitor);
+    JITServerReadMostlyMonitor::destroy(_romMapMonitor);
+    JITServerReadMostlyMonitor::destroy(_classMapMonitor);
+    JITServerReadMostlyMonitor::destroy(_methodMapMonitor);
     TR::Monitor::destroy(_DLTSetMonitor);
     TR::Monitor::destroy(_classChainDataMapMonitor);
     TR::Monitor::destroy(_sequencingMonitor);
     TR::Monitor::destroy(_cacheInitMonitor);
-    TR::Monitor::destroy(_constantPoolMapMonitor);
+    JITServerReadMostlyMonitor::destroy(_constantPoolMapMonitor);
     TR::Monitor::destroy(_staticMapMonitor);
     TR::Monitor::destroy(_thunkSetMonitor);
     TR::Monitor::destroy(_permanentLoadersMonitor);
@@ -165,7 +166,7 @@ void ClientSessionData::updateTimeOfLastAccess()
 void ClientSessionData::initializeUnloadedClassAddrRanges(const std::vector<TR_AddressRange> &unloadedClassRanges,
     int32_t maxRanges)
 {
-    OMR::CriticalSection getUnloadedClasses(getROMMapMonitor());
+    JITServerWriteSection getUnloadedClasses(getROMMapMonitor());
 
     if (!_unloadedClassAddresses)
         _unloadedClassAddresses = new (_persistentMemory) TR_AddressSet(_persistentMemory, maxRanges);
@@ -199,7 +200,7 @@ void ClientSessionData::processUnloadedClasses(const std::vector<TR_OpaqueClassB
         = compInfoPT->getClientData()->getOrCacheVMInfo(compInfoPT->getMethodBeingCompiled()->_stream);
     J9ClassLoader *systemClassLoader = (J9ClassLoader *)(vminfo->_systemClassLoader);
     {
-        OMR::CriticalSection processUnloadedClasses(getROMMapMonitor());
+        JITServerWriteSection processUnloadedClasses(getROMMapMonitor());
 
         for (auto clazz : classes) {
             if (updateUnloadedClasses)
@@ -287,7 +288,7 @@ void ClientSessionData::processUnloadedClasses(const std::vector<TR_OpaqueClassB
     } // end critical section getROMMapMonitor()
 
     for (J9Class *unloadedClazz : unloadedClassesSystemClassLoader) {
-        OMR::CriticalSection methodByNameMapPurge(compInfoPT->getClientData()->getMethodMapMonitor());
+        JITServerWriteSection methodByNameMapPurge(compInfoPT->getClientData()->getMethodMapMonitor());
         for (auto it = _methodByNameMap.begin(); it != _methodByNameMap.end();) {
             if (it->first.first == unloadedClazz) {
                 it = _methodByNameMap.erase(it);
@@ -307,13 +308,13 @@ void ClientSessionData::processUnloadedClasses(const std::vector<TR_OpaqueClassB
 
     // purge Class by name cache
     {
-        OMR::CriticalSection classMapCS(getClassMapMonitor());
+        JITServerWriteSection classMapCS(getClassMapMonitor());
         purgeCache(unloadedClasses, getClassBySignatureMap(), &ClassUnloadedData::_pair);
     }
 
     // purge Constant pool to class cache
     {
-        OMR::CriticalSection constantPoolToClassMap(getConstantPoolMonitor());
+        JITServerWriteSection constantPoolToClassMap(getConstantPoolMonitor());
         purgeCache(unloadedClasses, getConstantPoolToClassMap(), &ClassUnloadedData::_cp);
     }
 
@@ -332,7 +333,7 @@ void ClientSessionData::processIllegalFinalFieldModificationList(const std::vect
             "%llu",
             compThreadID, numOfClasses, (unsigned long long)_clientUID);
     {
-        OMR::CriticalSection processClassesWithIllegalModification(getROMMapMonitor());
+        JITServerWriteSection processClassesWithIllegalModification(getROMMapMonitor());
         for (auto clazz : classes) {
             auto it = _romClassMap.find((J9Class *)clazz);
             if (it != _romClassMap.end()) {
@@ -358,7 +359,7 @@ void ClientSessionData::dumpAllBytecodeProfilingData()
         logFile = fopen(filename, "w+");
 
     if (logFile) {
-        OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(getROMMapMonitor());
         for (const auto &entry : getJ9MethodMap()) {
             const struct J9MethodInfo &methodInfo = entry.second;
             const auto iProfilerMap = methodInfo._IPData;
@@ -461,7 +462,7 @@ void ClientSessionData::printIProfilerCacheStats()
     size_t numBytecodeEntries = 0;
     size_t numSamples = 0;
     {
-        OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+        JITServerWriteSection getRemoteROMClass(getROMMapMonitor());
         for (const auto &entry : getJ9MethodMap()) {
             numMethodsProfiled++;
             const auto iProfilerMap = entry.second._IPData;
@@ -492,7 +493,7 @@ TR_IPBytecodeHashTableEntry *ClientSessionData::getCachedIProfilerInfo(TR_Opaque
 {
     *methodInfoPresent = false;
     TR_IPBytecodeHashTableEntry *ipEntry = NULL;
-    OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+    JITServerReadSection getRemoteROMClass(getROMMapMonitor());
     // check whether info about j9method is cached
     auto &j9methodMap = getJ9MethodMap();
     auto it = j9methodMap.find((J9Method *)method);
@@ -530,7 +531,7 @@ TR_IPBytecodeHashTableEntry *ClientSessionData::getCachedIProfilerInfo(TR_Opaque
 bool ClientSessionData::cacheIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex,
     TR_IPBytecodeHashTableEntry *entry, bool isCompiled)
 {
-    OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+    JITServerWriteSection getRemoteROMClass(getROMMapMonitor());
     // check whether info about j9method exists
     auto &j9methodMap = getJ9MethodMap();
     auto it = j9methodMap.find((J9Method *)method);
@@ -575,7 +576,7 @@ bool ClientSessionData::cacheIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_
 bool ClientSessionData::cacheIProfilerInfo(TR_OpaqueMethodBlock *method,
     const Vector<TR_IPBytecodeHashTableEntry *> &entries, bool isCompiled)
 {
-    OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+    JITServerWriteSection getRemoteROMClass(getROMMapMonitor());
     // check whether info about j9method exists
     auto &j9methodMap = getJ9MethodMap();
     auto it = j9methodMap.find((J9Method *)method);
@@ -617,7 +618,7 @@ void ClientSessionData::checkProfileDataMatching(J9Method *method, const std::st
     uint32_t methodSize = 0; // Will be computed later
     IPTable_t *iProfilerMap = NULL;
 
-    OMR::CriticalSection cs(getROMMapMonitor());
+    JITServerWriteSection cs(getROMMapMonitor());
     auto it = getJ9MethodMap().find(method);
     TR_ASSERT_FATAL(it != getJ9MethodMap().end(), "Method %p must be cached", method);
     J9MethodInfo &methodInfo = it->second;
@@ -691,7 +692,7 @@ ProfiledMethodEntry *ClientSessionData::getSharedProfileCacheForMethod(J9Method
     // Convert from J9method to AOTCacheMethodRecord.
     const AOTCacheMethodRecord *methodRecord = NULL;
     {
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         auto it = getJ9MethodMap().find(method);
         TR_ASSERT_FATAL(it != getJ9MethodMap().end(), "Method %p must be already cached", method);
         methodRecord = getMethodRecord(it->second, method);
@@ -716,7 +717,7 @@ BytecodeProfileSummary ClientSessionData::getSharedBytecodeProfileSummary(J9Meth
     // Convert from J9method to AOTCacheMethodRecord.
     const AOTCacheMethodRecord *methodRecord = NULL;
     {
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         auto it = getJ9MethodMap().find(method);
         TR_ASSERT_FATAL(it != getJ9MethodMap().end(), "Method %p must be already cached", method);
         methodRecord = getMethodRecord(it->second, method);
@@ -756,7 +757,7 @@ bool ClientSessionData::loadBytecodeDataFromSharedProfileCache(J9Method *method,
     const AOTCacheMethodRecord *methodRecord = NULL;
     J9MethodInfo *methodInfo = NULL;
     {
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         auto it = getJ9MethodMap().find(method); // This is the method I am interested in
         if (it != getJ9MethodMap().end()) {
             methodInfo = &it->second;
@@ -803,7 +804,7 @@ bool ClientSessionData::loadBytecodeDataFromSharedProfileCache(J9Method *method,
         Vector<Vector<std::pair<uint32_t, uint32_t> > > uncachedIndexes(region);
 
         {
-            OMR::CriticalSection cs(getROMMapMonitor());
+            JITServerWriteSection cs(getROMMapMonitor());
             for (uint32_t i = 0; i < cgEntries.size(); ++i) {
                 auto csInfo = cgEntries[i]->getCGData();
                 for (uint32_t j = 0; j < NUM_CS_SLOTS; ++j) {
@@ -951,7 +952,7 @@ bool ClientSessionData::loadBytecodeDataFromSharedProfileCache(J9Method *method,
             // and replace the classRecords with j9classes in the cgEntries.
             // Note that if the client couldn't find the right j9class once, it's likely that it will not
             // be able to find the right class in the future too, so we cache classRecord-->NULL mappings in this case.
-            OMR::CriticalSection cs(getROMMapMonitor()); // protect concurrent access to _classRecordMap
+            JITServerWriteSection cs(getROMMapMonitor()); // protect concurrent access to _classRecordMap
 
             if (TR::Options::getVerboseOption(TR_VerboseJITServerSharedProfileDetails))
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "\tWill start patching");
@@ -1109,7 +1110,7 @@ bool ClientSessionData::storeBytecodeProfileInSharedRepository(TR_OpaqueMethodBl
     J9MethodInfo *methodInfo = NULL;
     const AOTCacheMethodRecord *methodRecord = NULL;
     {
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         auto it = getJ9MethodMap().find((J9Method *)method);
         TR_ASSERT_FATAL(it != getJ9MethodMap().end(), "Method %p must be already cached", method);
         methodInfo = &it->second;
@@ -1199,7 +1200,7 @@ bool ClientSessionData::storeBytecodeProfileInSharedRepository(TR_OpaqueMethodBl
         std::vector<J9Class *> uncachedRAMClasses; // These will be sent to the client
         Vector<uint32_t> uncachedClassIndexes(region); // Remembers which classes in uniqueRAMClasses need attention
         {
-            OMR::CriticalSection cs(getROMMapMonitor());
+            JITServerWriteSection cs(getROMMapMonitor());
             for (uint32_t k = 0; k < uniqueRAMClasses.size(); ++k) {
                 J9Class *ramClass = uniqueRAMClasses[k]._ramClass;
                 bool missingLoaderInfo = false;
@@ -1251,7 +1252,7 @@ bool ClientSessionData::storeBytecodeProfileInSharedRepository(TR_OpaqueMethodBl
 
             // Get class records for newly cached classes
             {
-                OMR::CriticalSection cs(getROMMapMonitor());
+                JITServerWriteSection cs(getROMMapMonitor());
                 for (auto &idx : uncachedClassIndexes) {
                     J9Class *ramClass = uniqueRAMClasses[idx]._ramClass;
                     bool missingLoaderInfo = false;
@@ -1440,6 +1441,18 @@ void ClientSessionData::printStats()
         total += it.second._romClass->romSize;
 
     j9tty_printf(PORTLIB, "\tTotal size of cached ROM classes + methods: %d bytes\n", total);
+    j9tty_printf(PORTLIB, "\tROM map monitor:\n");
+    _romMapMonitor->printStats();
+    j9tty_printf(PORTLIB, "\tClass map monitor:\n");
+    _classMapMonitor->printStats();
+    j9tty_printf(PORTLIB, "\tMethod map monitor:\n");
+    _methodMapMonitor->printStats();
+    j9tty_printf(PORTLIB, "\tConstant pool map monitor:\n");
+    _constantPoolMapMonitor->printStats();
+    if (_usesPerClientMemory) {
+        j9tty_printf(PORTLIB, "\tPer-client persistent allocator:\n");
+        _persistentMemory->_persistentAllocator.get().printStats();
+    }
 }
 
 ClientSessionData::ClassInfo::ClassInfo(TR_PersistentMemory *persistentMemory)
@@ -1622,7 +1635,7 @@ void ClientSessionData::clearCachesLocked(TR_J9VMBase *fe)
     // while the client is still sending requests
     writeAcquireClassUnloadRWMutex();
     {
-        OMR::CriticalSection processUnloadedClasses(getROMMapMonitor());
+        JITServerWriteSection processUnloadedClasses(getROMMapMonitor());
         clearCaches(true);
     }
     writeReleaseClassUnloadRWMutex();
@@ -1913,7 +1926,7 @@ JITServerAOTCache *ClientSessionData::getOrCreateAOTCache(JITServer::ServerStrea
 const AOTCacheClassRecord *ClientSessionData::getClassRecord(ClassInfo &classInfo, bool &missingLoaderInfo,
     J9Class *&uncachedBaseComponent, J9::J9SegmentProvider *scratchSegmentProvider)
 {
-    TR_ASSERT(getROMMapMonitor()->owned_by_self(), "Must hold ROMMapMonitor");
+    TR_ASSERT(getROMMapMonitor()->writeOwnedBySelf(), "Must hold ROMMapMonitor for writing");
 
     if (classInfo._aotCacheClassRecord)
         return classInfo._aotCacheClassRecord;
@@ -1957,7 +1970,7 @@ const AOTCacheClassRecord *ClientSessionData::getClassRecord(ClassInfo &classInf
 const AOTCacheClassRecord *ClientSessionData::getClassRecord(J9Class *clazz, bool &missingLoaderInfo,
     bool &uncachedClass, J9Class *&uncachedBaseComponent, J9::J9SegmentProvider *scratchSegmentProvider)
 {
-    TR_ASSERT(getROMMapMonitor()->owned_by_self(), "Must hold ROMMapMonitor");
+    TR_ASSERT(getROMMapMonitor()->writeOwnedBySelf(), "Must hold ROMMapMonitor for writing");
 
     auto it = getROMClassMap().find(clazz);
     if (it != getROMClassMap().end())
@@ -1974,7 +1987,7 @@ const AOTCacheClassRecord *ClientSessionData::getClassRecord(J9Class *clazz, JIT
     bool uncachedClass = false;
     J9Class *uncachedBaseComponent = NULL;
     {
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         record = getClassRecord(clazz, missingLoaderInfo, uncachedClass, uncachedBaseComponent, scratchSegmentProvider);
     }
     if (record)
@@ -1986,7 +1999,7 @@ const AOTCacheClassRecord *ClientSessionData::getClassRecord(J9Class *clazz, JIT
         auto romClass = JITServerHelpers::getRemoteROMClass(clazz, stream, _persistentMemory, classInfoTuple);
         JITServerHelpers::cacheRemoteROMClassOrFreeIt(this, clazz, romClass, classInfoTuple);
 
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         record = getClassRecord(clazz, missingLoaderInfo, uncachedClass, uncachedBaseComponent, scratchSegmentProvider);
         TR_ASSERT(!uncachedClass, "Class %p must be already cached", clazz);
     }
@@ -1998,7 +2011,7 @@ const AOTCacheClassRecord *ClientSessionData::getClassRecord(J9Class *clazz, JIT
             = JITServerHelpers::getRemoteROMClass(uncachedBaseComponent, stream, _persistentMemory, classInfoTuple);
         JITServerHelpers::cacheRemoteROMClassOrFreeIt(this, uncachedBaseComponent, romClass, classInfoTuple);
 
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         record = getClassRecord(clazz, missingLoaderInfo, uncachedClass, uncachedBaseComponent, scratchSegmentProvider);
         TR_ASSERT(!uncachedClass && !uncachedBaseComponent, "Class %p and base component must be already cached",
             clazz);
@@ -2011,7 +2024,7 @@ const AOTCacheClassRecord *ClientSessionData::getClassRecord(J9Class *clazz, JIT
         uintptr_t offset = std::get<0>(recv);
         auto &name = std::get<1>(recv);
         if (!name.empty()) {
-            OMR::CriticalSection cs(getROMMapMonitor());
+            JITServerWriteSection cs(getROMMapMonitor());
             auto it = getROMClassMap().find((J9Class *)clazz);
             TR_ASSERT(it != getROMClassMap().end(), "Class %p must be already cached", clazz);
             it->second._classChainOffsetIdentifyingLoader = offset;
@@ -2037,7 +2050,7 @@ const AOTCacheClassRecord *ClientSessionData::getClassRecord(J9Class *clazz, JIT
 const AOTCacheMethodRecord *ClientSessionData::getMethodRecord(J9MethodInfo &methodInfo, J9Method *ramMethod)
 {
     // Typically, we already have an _aotCacheMethodRecord inside the methodInfo
-    TR_ASSERT(getROMMapMonitor()->owned_by_self(), "Must hold ROMMapMonitor");
+    TR_ASSERT(getROMMapMonitor()->writeOwnedBySelf(), "Must hold ROMMapMonitor for writing");
 
     // The methodInfo which is stored for any J9Method cached by the server
     // may already contain a pointer to a corresponding aotCacheMethodRecord
@@ -2061,7 +2074,7 @@ const AOTCacheMethodRecord *ClientSessionData::getMethodRecord(J9MethodInfo &met
 
 const AOTCacheMethodRecord *ClientSessionData::getMethodRecord(J9Method *ramMethod, const J9MethodInfo **methodInfo)
 {
-    OMR::CriticalSection cs(getROMMapMonitor());
+    JITServerWriteSection cs(getROMMapMonitor());
 
     auto it = getJ9MethodMap().find(ramMethod);
     TR_ASSERT(it != getJ9MethodMap().end(), "Method %p must be already cached", ramMethod);
@@ -2075,7 +2088,7 @@ const AOTCacheMethodRecord *ClientSessionData::getMethodRecord(J9Method *method,
     JITServer::ServerStream *stream)
 {
     {
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerReadSection cs(getROMMapMonitor());
         auto it = getJ9MethodMap().find(method);
         if ((it != getJ9MethodMap().end()) && it->second._aotCacheMethodRecord)
             return it->second._aotCacheMethodRecord;
@@ -2086,7 +2099,7 @@ const AOTCacheMethodRecord *ClientSessionData::getMethodRecord(J9Method *method,
     if (!classRecord)
         return NULL;
 
-    OMR::CriticalSection cs(getROMMapMonitor());
+    JITServerWriteSection cs(getROMMapMonitor());
     auto it = getJ9MethodMap().find(method);
     TR_ASSERT(it != getJ9MethodMap().end(), "Method %p must be already cached", method);
     it->second._aotCacheMethodRecord
@@ -2119,7 +2132,7 @@ const AOTCacheClassChainRecord *ClientSessionData::getClassChainRecord(J9Class *
 
     // Get class records for which all info is already available, remembering classes that we need to request info for
     {
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
 
         for (size_t i = 0; i < ramClassChain.size(); ++i) {
             bool missingLoaderRecord = false;
@@ -2173,7 +2186,7 @@ const AOTCacheClassChainRecord *ClientSessionData::getClassChainRecord(J9Class *
         }
 
         // Get class records for newly cached classes, remembering classes with missing class loader info
-        OMR::CriticalSection cs(getROMMapMonitor());
+        JITServerWriteSection cs(getROMMapMonitor());
         for (size_t i = 0; i < numUncachedClasses; ++i) // This possibly skips the last entry which could be the base
                                                         // component class which was processed separately
         {
@@ -2458,6 +2471,8 @@ void ClientSessionHT::purgeOldDataIfNeeded()
 void ClientSessionHT::printStats()
 {
     PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+    j9tty_printf(PORTLIB, "Global persistent allocator:\n");
+    TR::Compiler->persistentGlobalAllocator().printStats();
     j9tty_printf(PORTLIB, "Client sessions:\n");
     for (auto session : _clientSessionMap) {
         j9tty_printf(PORTLIB, "Session for id %d:\n", session.first);
@@ -30,6 +30,7 @@
 #include "env/VMJ9.h" // for TR_StaticFinalData
 #include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerProfileCache.hpp"
+#include "runtime/JITServerReadMostlyMonitor.hpp"
 #include "runtime/SymbolValidationManager.hpp"
 
 class J9ROMClass;
@@ -455,11 +456,11 @@ public:
     void processUnloadedClasses(const std::vector<TR_OpaqueClassBlock *> &classes, bool updateUnloadedClasses);
     void processIllegalFinalFieldModificationList(const std::vector<TR_OpaqueClassBlock *> &classes);
 
-    TR::Monitor *getROMMapMonitor() { return _romMapMonitor; }
+    JITServerReadMostlyMonitor *getROMMapMonitor() { return _romMapMonitor; }
 
-    TR::Monitor *getClassMapMonitor() { return _classMapMonitor; }
+    JITServerReadMostlyMonitor *getClassMapMonitor() { return _classMapMonitor; }
 
-    TR::Monitor *getMethodMapMonitor() { return _methodMapMonitor; }
+    JITServerReadMostlyMonitor *getMethodMapMonitor() { return _methodMapMonitor; }
 
     TR::Monitor *getDLTSetMonitor() { return _DLTSetMonitor; }
 
@@ -516,7 +517,7 @@ public:
 
     TR::Monitor *getCacheInitMonitor() { return _cacheInitMonitor; }
 
-    TR::Monitor *getConstantPoolMonitor() { return _constantPoolMapMonitor; }
+    JITServerReadMostlyMonitor *getConstantPoolMonitor() { return _constantPoolMapMonitor; }
 
     TR_MethodToBeCompiled *getOOSequenceEntryList() const { return _OOSequenceEntryList; }
 
@@ -707,16 +708,18 @@ private:
     PersistentUnorderedMap<J9Class *, ClassChainData> _classChainDataMap;
     // Constant pool to class map
     PersistentUnorderedMap<J9ConstantPool *, TR_OpaqueClassBlock *> _constantPoolToClassMap;
-    TR::Monitor *_romMapMonitor;
-    TR::Monitor *_classMapMonitor;
-    TR::Monitor *_methodMapMonitor;
+    // The maps below are looked up by all compilation threads and rarely updated. Lookups that do not
+    // modify the cached data use JITServerReadSection so that they do not serialize on these monitors.
+    JITServerReadMostlyMonitor *_romMapMonitor;
+    JITServerReadMostlyMonitor *_classMapMonitor;
+    JITServerReadMostlyMonitor *_methodMapMonitor;
     TR::Monitor *_DLTSetMonitor; // Protects the set of methods that have been DLTed: _DLTedMethodSet
     TR::Monitor *_classChainDataMapMonitor;
     // The following monitor is used to protect access to _lastProcessedCriticalSeqNo and
     // the list of out-of-sequence compilation requests (_OOSequenceEntryList)
     TR::Monitor *_sequencingMonitor;
     TR::Monitor *_cacheInitMonitor;
-    TR::Monitor *_constantPoolMapMonitor;
+    JITServerReadMostlyMonitor *_constantPoolMapMonitor;
     // Compilation requests that arrived out-of-sequence wait in
     // _OOSequenceEntryList for their turn to be processed
     TR_MethodToBeCompiled *_OOSequenceEntryList;
@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <algorithm>
 #include "bcnames.h"
 #include "control/CompilationRuntime.hpp"
 #include "control/JITServerCompilationThread.hpp"
@@ -50,8 +51,12 @@ JITServerIProfiler::JITServerIProfiler(J9JITConfig *jitConfig)
     , _statsIProfilerInfoReqNotCacheable(0)
     , _statsIProfilerInfoIsEmpty(0)
     , _statsIProfilerInfoCachingFailures(0)
+    , _statsIProfilerBatchMsgToClient(0)
+    , _statsIProfilerBatchMethods(0)
 {
     _useCaching = feGetEnv("TR_DisableIPCaching") ? false : true;
+    // Batched queries only make sense if their results can be cached
+    _useBatching = _useCaching && !feGetEnv("TR_DisableIPBatching");
 }
 
 /**
@@ -216,7 +221,7 @@ TR_IPBytecodeHashTableEntry *JITServerIProfiler::ipBytecodeHashTableEntryFactory
     return entry;
 }
 
-TR_IPMethodHashTableEntry *JITServerIProfiler::searchForMethodSample(TR_OpaqueMethodBlock *omb, int32_t bucket)
+TR_IPMethodHashTableEntry *JITServerIProfiler::searchForMethodSample(TR_OpaqueMethodBlock *omb)
 {
     TR_ASSERT_FATAL(false, "Unexpected call to searchForMethodSample made by the server");
     return NULL;
@@ -353,6 +358,124 @@ bool JITServerIProfiler::cacheProfilingDataForMethod(TR_OpaqueMethodBlock *metho
     return !cachingFailed;
 }
 
+/**
+ * @brief Cache the whole-method bytecode profile sent by the client for one method.
+ *        If the shared profile repository is enabled and it contains info about the method,
+ *        the quality of the client data is compared against the quality of the data in the
+ *        shared profile repository and the better of the two is cached.
+ *
+ * @param method The j9method whose profile was sent
+ * @param byteCodeIndex The bytecode index used to remember that the method has no profile
+ * @param ipdata The serialized profile sent by the client; may be empty
+ * @param numClientSamples Number of samples in the profile sent by the client
+ * @param numProfiledBytecodes Number of bytecodes with profile info sent by the client
+ * @param usePersistentCache If true, cache into the per-client cache; else into the per-compilation cache
+ * @param isCompiled If true, the method is compiled and its profile is stable
+ * @param uncachedRAMClasses Classes used by the profile that the server did not have yet
+ * @param classInfoTuples ClassInfos corresponding to elements in `uncachedRAMClasses`
+ */
+void JITServerIProfiler::cacheClientProfile(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex,
+    const std::string &ipdata, uint64_t numClientSamples, size_t numProfiledBytecodes, bool usePersistentCache,
+    bool isCompiled, std::vector<J9Class *> &uncachedRAMClasses,
+    std::vector<JITServerHelpers::ClassInfoTuple> &classInfoTuples, ClientSessionData *clientSession,
+    TR::CompilationInfoPerThreadRemote *compInfoPT, TR::Compilation *comp)
+{
+    // Assuming the profilingInfo for a method is not deleted from the shared profile map,
+    // we could keep in the methodInfo a pointer to the entry in the shared profile map.
+    // However, it's not clean to have pointers inside other containers.
+    // Question: can anybody delete entries from the shared profile map? Since the key it's a method record
+    // we can only do that when method records are deleted which may not happen at all. To double check.
+
+    // If the shared profile cache is enabled, we must compare the "quality" of the data in the
+    // shared repository to the "quality" of the data sent by the client.
+    int sharedProfileQuality = 0;
+    if (clientSession->useSharedProfileCache()) {
+        BytecodeProfileSummary clientProfileSummary(numClientSamples, numProfiledBytecodes, usePersistentCache);
+        BytecodeProfileSummary sharedProfileSummary
+            = clientSession->getSharedBytecodeProfileSummary((J9Method *)method);
+        sharedProfileQuality
+            = JITServerSharedProfileCache::compareBytecodeProfiles(sharedProfileSummary, clientProfileSummary);
+
+        if (TR::Options::getVerboseOption(TR_VerboseJITServerSharedProfileDetails)) {
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "Sent req for profile data for j9method %p. Client: profiled bytecodes=%zu samples=%" OMR_PRIu64
+                " stable=%d; "
+                "Shared repo: profiled bytecodes=%zu samples=%" OMR_PRIu64 " stable=%d",
+                method, clientProfileSummary._numProfiledBytecodes, clientProfileSummary._numSamples,
+                clientProfileSummary._stable, sharedProfileSummary._numProfiledBytecodes,
+                sharedProfileSummary._numSamples, sharedProfileSummary._stable);
+        }
+
+        // Process the extra classInfo that the client might have sent us.
+        // TODO: Consider doing this only if the server is likely to store this info into the shared profile cache.
+        // On the other hand, if the server sent us something, why not cache that information.
+        if (!uncachedRAMClasses.empty())
+            JITServerHelpers::cacheRemoteROMClassBatch(clientSession, uncachedRAMClasses, classInfoTuples);
+    }
+    if (sharedProfileQuality > 0) {
+        // Ignore the data sent by the client. Just use the data from the shared profile cache.
+        // This may send messages to transform the classRecords into J9Class pointers valid at the client
+        bool success = clientSession->loadBytecodeDataFromSharedProfileCache((J9Method *)method, usePersistentCache,
+            comp, ipdata);
+        if (!success) {
+            // We failed to load bytecode profile data shared repository.
+            // The best thing we could do is to load the data we have from the client instead.
+            bool result = cacheProfilingDataForMethod(method, ipdata, usePersistentCache, clientSession, compInfoPT,
+                isCompiled, comp);
+        } else {
+            // The data from the shared profile repository has been loaded into the per-client profile cache.
+            // If allowed, compare how well the data sent by the client matches the loaded data.
+            if (usePersistentCache && numClientSamples > 0) {
+                static bool sharedCacheDebugging = feGetEnv("TR_SharedCacheDebugging") ? true : false;
+                if (sharedCacheDebugging)
+                    clientSession->checkProfileDataMatching((J9Method *)method, ipdata);
+            }
+        }
+    } else if (sharedProfileQuality < 0) // The client has better quality for the bytecode profiling data
+    {
+        // Walk the data sent by the client and add new entries to our internal hashtable.
+        // This will acquire the getROMMapMonitor()
+        bool result = cacheProfilingDataForMethod(method, ipdata, usePersistentCache, clientSession, compInfoPT,
+            isCompiled, comp);
+        if (clientSession->useSharedProfileCache()) {
+            // Store the information from the client into the shared profile cache.
+            // We will store even if the information is not stable.
+            // TODO: if the data was not stable at the client, mark the entry as not stable for the shared data.
+            // TODO: what if stable shared data exists and now we want to overwrite with unstable data with more
+            // samples. This uses getROMMapMonitor() briefly to get to the methodInfo
+            clientSession->storeBytecodeProfileInSharedRepository(method, ipdata, numClientSamples,
+                usePersistentCache, comp);
+        }
+    } else // The quality of the two sources is comparable
+    {
+        // Walk the data sent by the client and add new entries to our internal hashtable.
+        // Do not update the shared profile cache, it's good enough as it is.
+        // TODO: what should we do if the "stability" of data from the two sources differs?
+        // clientData:stable   sharedData:unstable ==> Mark the sharedData as stable (should we replace it?)
+        // clientData:unstable  sharedData:stable  ==> Do nothing
+        // There is a special case when the client sent us nothing.
+        if (ipdata.empty()) // client didn't send us anything
+        {
+            _statsIProfilerInfoIsEmpty++;
+            // Cache some empty data so that we don't ask again for this method.
+            if (usePersistentCache) {
+                // Use the per-client cache
+                if (!clientSession->cacheIProfilerInfo(method, byteCodeIndex, NULL, isCompiled))
+                    _statsIProfilerInfoCachingFailures++;
+            } else // Use the per-compilation cache
+            {
+                if (!compInfoPT->cacheIProfilerInfo(method, byteCodeIndex, NULL))
+                    _statsIProfilerInfoCachingFailures++;
+            }
+            // The shared profile cache will not store such empty profiles.
+            return;
+        }
+        cacheProfilingDataForMethod(method, ipdata, usePersistentCache, clientSession, compInfoPT, isCompiled,
+            comp);
+        // TODO: replace shared IP data if it is non-stable but the data received from client is stable.
+    }
+}
+
 // This method is called by the optimizer at JITServer to search
 // for profiling information of a particular method and bytecodeIndex.
 // First, the local (per-client) cache is searched. If not found, the
@@ -461,100 +584,9 @@ TR_IPBytecodeHashTableEntry *JITServerIProfiler::profilingSample(TR_OpaqueMethod
         _statsIProfilerInfoReqNotCacheable++;
 
     if (doCache) {
-        // Assuming the profilingInfo for a method is not deleted from the shared profile map,
-        // we could keep in the methodInfo a pointer to the entry in the shared profile map.
-        // However, it's not clean to have pointers inside other containers.
-        // Question: can anybody delete entries from the shared profile map? Since the key it's a method record
-        // we can only do that when method records are deleted which may not happen at all. To double check.
-
-        // If the shared profile cache is enabled, we must compare the "quality" of the data in the
-        // shared repository to the "quality" of the data sent by the client.
-        int sharedProfileQuality = 0;
-        if (clientSession->useSharedProfileCache()) {
-            BytecodeProfileSummary clientProfileSummary(numClientSamples, numProfiledBytecodes, usePersistentCache);
-            BytecodeProfileSummary sharedProfileSummary
-                = clientSession->getSharedBytecodeProfileSummary((J9Method *)method);
-            sharedProfileQuality
-                = JITServerSharedProfileCache::compareBytecodeProfiles(sharedProfileSummary, clientProfileSummary);
-
-            if (TR::Options::getVerboseOption(TR_VerboseJITServerSharedProfileDetails)) {
-                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
-                    "Sent req for profile data for j9method %p. Client: profiled bytecodes=%zu samples=%" OMR_PRIu64
-                    " stable=%d; "
-                    "Shared repo: profiled bytecodes=%zu samples=%" OMR_PRIu64 " stable=%d",
-                    method, clientProfileSummary._numProfiledBytecodes, clientProfileSummary._numSamples,
-                    clientProfileSummary._stable, sharedProfileSummary._numProfiledBytecodes,
-                    sharedProfileSummary._numSamples, sharedProfileSummary._stable);
-            }
+        cacheClientProfile(method, byteCodeIndex, ipdata, numClientSamples, numProfiledBytecodes, usePersistentCache,
+            isCompiled, uncachedRAMClasses, classInfoTuples, clientSession, compInfoPT, comp);
 
-            // Process the extra classInfo that the client might have sent us.
-            // TODO: Consider doing this only if the server is likely to store this info into the shared profile cache.
-            // On the other hand, if the server sent us something, why not cache that information.
-            if (!uncachedRAMClasses.empty())
-                JITServerHelpers::cacheRemoteROMClassBatch(clientSession, uncachedRAMClasses, classInfoTuples);
-        }
-        if (sharedProfileQuality > 0) {
-            // Ignore the data sent by the client. Just use the data from the shared profile cache.
-            // This may send messages to transform the classRecords into J9Class pointers valid at the client
-            bool success = clientSession->loadBytecodeDataFromSharedProfileCache((J9Method *)method, usePersistentCache,
-                comp, ipdata);
-            if (!success) {
-                // We failed to load bytecode profile data shared repository.
-                // The best thing we could do is to load the data we have from the client instead.
-                bool result = cacheProfilingDataForMethod(method, ipdata, usePersistentCache, clientSession, compInfoPT,
-                    isCompiled, comp);
-            } else {
-                // The data from the shared profile repository has been loaded into the per-client profile cache.
-                // If allowed, compare how well the data sent by the client matches the loaded data.
-                if (usePersistentCache && numClientSamples > 0) {
-                    static bool sharedCacheDebugging = feGetEnv("TR_SharedCacheDebugging") ? true : false;
-                    if (sharedCacheDebugging)
-                        clientSession->checkProfileDataMatching((J9Method *)method, ipdata);
-                }
-            }
-        } else if (sharedProfileQuality < 0) // The client has better quality for the bytecode profiling data
-        {
-            // Walk the data sent by the client and add new entries to our internal hashtable.
-            // This will acquire the getROMMapMonitor()
-            bool result = cacheProfilingDataForMethod(method, ipdata, usePersistentCache, clientSession, compInfoPT,
-                isCompiled, comp);
-            if (clientSession->useSharedProfileCache()) {
-                // Store the information from the client into the shared profile cache.
-                // We will store even if the information is not stable.
-                // TODO: if the data was not stable at the client, mark the entry as not stable for the shared data.
-                // TODO: what if stable shared data exists and now we want to overwrite with unstable data with more
-                // samples. This uses getROMMapMonitor() briefly to get to the methodInfo
-                clientSession->storeBytecodeProfileInSharedRepository(method, ipdata, numClientSamples,
-                    usePersistentCache, comp);
-            }
-        } else // The quality of the two sources is comparable
-        {
-            // Walk the data sent by the client and add new entries to our internal hashtable.
-            // Do not update the shared profile cache, it's good enough as it is.
-            // TODO: what should we do if the "stability" of data from the two sources differs?
-            // clientData:stable   sharedData:unstable ==> Mark the sharedData as stable (should we replace it?)
-            // clientData:unstable  sharedData:stable  ==> Do nothing
-            // There is a special case when the client sent us nothing.
-            if (ipdata.empty()) // client didn't send us anything
-            {
-                _statsIProfilerInfoIsEmpty++;
-                // Cache some empty data so that we don't ask again for this method.
-                if (usePersistentCache) {
-                    // Use the per-client cache
-                    if (!clientSession->cacheIProfilerInfo(method, byteCodeIndex, NULL, isCompiled))
-                        _statsIProfilerInfoCachingFailures++;
-                } else // Use the per-compilation cache
-                {
-                    if (!compInfoPT->cacheIProfilerInfo(method, byteCodeIndex, NULL))
-                        _statsIProfilerInfoCachingFailures++;
-                }
-                // The shared profile cache will not store such empty profiles.
-                return NULL;
-            }
-            cacheProfilingDataForMethod(method, ipdata, usePersistentCache, clientSession, compInfoPT, isCompiled,
-                comp);
-            // TODO: replace shared IP data if it is non-stable but the data received from client is stable.
-        }
         // Now that all the entries are added to the cache, search the cache
         bool methodInfoPresent = false;
         if (usePersistentCache)
@@ -611,6 +643,88 @@ TR_IPBytecodeHashTableEntry *JITServerIProfiler::profilingSample(TR_OpaqueMethod
     return entry;
 }
 
+/**
+ * @brief Fetch the bytecode profiles of several methods from the client with a single message
+ *        and cache them. Methods whose profile is already cached (per-client or per-compilation)
+ *        are not requested again. Profiles that the client could not collect are left out and
+ *        will be requested with a regular query if they are needed.
+ *
+ * @param comp The compilation object
+ * @param methods The j9methods whose profiles are about to be needed; may contain duplicates
+ * @param numMethods Number of elements in `methods`
+ */
+void JITServerIProfiler::prefetchProfilingData(TR::Compilation *comp, TR_OpaqueMethodBlock *const *methods,
+    size_t numMethods)
+{
+    if (!_useBatching || numMethods < 2)
+        return;
+
+    auto compInfoPT = (TR::CompilationInfoPerThreadRemote *)(comp->fej9()->_compInfoPT);
+    ClientSessionData *clientSession = compInfoPT->getClientData();
+
+    std::vector<TR_OpaqueMethodBlock *> request;
+    request.reserve(numMethods);
+    {
+        JITServerReadSection getRemoteROMClass(clientSession->getROMMapMonitor());
+        auto &j9methodMap = clientSession->getJ9MethodMap();
+        for (size_t i = 0; i < numMethods; ++i) {
+            TR_OpaqueMethodBlock *method = methods[i];
+            if (std::find(request.begin(), request.end(), method) != request.end())
+                continue;
+            // Skip methods unknown to the server and methods whose profile is cached per-client
+            auto it = j9methodMap.find((J9Method *)method);
+            if (it == j9methodMap.end() || it->second._IPData)
+                continue;
+            request.push_back(method);
+        }
+    }
+    // Skip methods whose profile is cached for the duration of this compilation
+    for (size_t i = 0; i < request.size();) {
+        bool methodInfoPresent = false;
+        compInfoPT->getCachedIProfilerInfo(request[i], 0, &methodInfoPresent);
+        if (methodInfoPresent) {
+            request[i] = request.back();
+            request.pop_back();
+        } else {
+            ++i;
+        }
+    }
+    // A single method is better fetched by a regular query when, and if, it is needed
+    if (request.size() < 2)
+        return;
+
+    auto stream = comp->getStream();
+    stream->write(JITServer::MessageType::IProfiler_profilingSampleBatch, request,
+        clientSession->useSharedProfileCache());
+    auto recv = stream->read<std::vector<std::string>, std::vector<uint64_t>, std::vector<uint64_t>,
+        std::vector<uint8_t>, std::vector<J9Class *>, std::vector<JITServerHelpers::ClassInfoTuple> >();
+    auto &ipdata = std::get<0>(recv);
+    auto &numClientSamples = std::get<1>(recv);
+    auto &numProfiledBytecodes = std::get<2>(recv);
+    auto &flags = std::get<3>(recv);
+    auto &uncachedRAMClasses = std::get<4>(recv);
+    auto &classInfoTuples = std::get<5>(recv);
+    TR_ASSERT_FATAL(ipdata.size() == request.size() && numClientSamples.size() == request.size()
+            && numProfiledBytecodes.size() == request.size() && flags.size() == request.size(),
+        "Batched profile reply has the wrong number of methods");
+    _statsIProfilerBatchMsgToClient++;
+    _statsIProfilerBatchMethods += (uint32_t)request.size();
+
+    // The classes used by all the profiles were sent together; cache them once
+    if (clientSession->useSharedProfileCache() && !uncachedRAMClasses.empty())
+        JITServerHelpers::cacheRemoteROMClassBatch(clientSession, uncachedRAMClasses, classInfoTuples);
+
+    std::vector<J9Class *> noClasses;
+    std::vector<JITServerHelpers::ClassInfoTuple> noClassInfos;
+    for (size_t i = 0; i < request.size(); ++i) {
+        if (flags[i] & IPBATCH_ABORTED)
+            continue;
+        cacheClientProfile(request[i], 0, ipdata[i], numClientSamples[i], (size_t)numProfiledBytecodes[i],
+            (flags[i] & IPBATCH_USE_PERSISTENT_CACHE) != 0, (flags[i] & IPBATCH_IS_COMPILED) != 0, noClasses,
+            noClassInfos, clientSession, compInfoPT, comp);
+    }
+}
+
 void JITServerIProfiler::printStats()
 {
     PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
@@ -621,6 +735,10 @@ void JITServerIProfiler::printStats()
         j9tty_printf(PORTLIB, "IProfilerInfoCachingFailure: %6u\n", _statsIProfilerInfoCachingFailures);
         j9tty_printf(PORTLIB, "IProfilerInfoFromCache:   %6u\n", _statsIProfilerInfoFromCache);
     }
+    if (_useBatching) {
+        j9tty_printf(PORTLIB, "IProfilerBatchMsgToClient: %6u  IProfilerBatchMethods: %6u\n",
+            _statsIProfilerBatchMsgToClient, _statsIProfilerBatchMethods);
+    }
 }
 
 bool JITServerIProfiler::invalidateEntryIfInconsistent(TR_IPBytecodeHashTableEntry *entry)
@@ -899,29 +1017,33 @@ uintptr_t JITClientIProfiler::serializeIProfilerMethodEntries(const uintptr_t *p
 }
 
 /**
- * @brief Code to be executed by the JITClient to send all IProfiler info for a method to JITServer
+ * @brief Code to be executed by the JITClient to serialize all IProfiler info for a method
  *
  * @param method J9Method in question
  * @param comp The compilation object
- * @param client Connection to JITServer
- * @param usePersistentCache Passed to the server to indicate whether or not to use the persistent cache
- * @param isCompiled Whether the method is compiled at the moment. Passed to the server
  * @param sharedProfile Boolean indicating whether to collect info about classes the server does not have
- * @return Whether the operation was successful
+ * @param buffer OUTPUT. The serialized entries; empty if the method has no IProfiler info
+ * @param totalSamples OUTPUT. Total number of profiling samples for this method
+ * @param numEntries OUTPUT. Number of serialized entries
+ * @param uncachedClasses OUTPUT. Classes that server needs but does not have are appended here
+ * @param classInfos OUTPUT. ClassInfos corresponding to elements appended to `uncachedClasses`
+ * @return true if the info could not be collected, in which case the outputs must be ignored
  */
-bool JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp,
-    JITServer::ClientStream *client, bool usePersistentCache, bool isCompiled, bool sharedProfile)
+bool JITClientIProfiler::serializeIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp,
+    bool sharedProfile, std::string &buffer, uint64_t &totalSamples, uint32_t &numEntries,
+    std::vector<J9Class *> &uncachedClasses, std::vector<JITServerHelpers::ClassInfoTuple> &classInfos)
 {
     TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
-    uint32_t numEntries = 0;
     uint32_t bytesFootprint = 0;
     uintptr_t methodSize = (uintptr_t)TR::Compiler->mtd.bytecodeSize(method);
     uintptr_t methodStart = (uintptr_t)TR::Compiler->mtd.bytecodeStart(method);
 
     uintptr_t *pcEntries = NULL;
     bool abort = false;
+    numEntries = 0;
+    totalSamples = 0;
+    buffer.clear();
     try {
-        uint64_t totalSamples = 0; // Total number of profiling samples for this method
         TR_ResolvedJ9Method resolvedj9method = TR_ResolvedJ9Method(method, comp->fej9(), comp->trMemory());
         TR_J9ByteCodeIterator bci(NULL, &resolvedj9method, static_cast<TR_J9VMBase *>(comp->fej9()), comp);
         // Allocate memory for every possible node in this method
@@ -933,25 +1055,12 @@ bool JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBl
         // These profiling entries have been 'locked' so we must remember to unlock them
         bytesFootprint = walkILTreeForIProfilingEntries(pcEntries, numEntries, &bci, method, BCvisit, abort, comp);
 
-        if (!abort) {
-            std::vector<J9Class *> uncachedClasses; // This will be populated and send back to server
-            std::vector<JITServerHelpers::ClassInfoTuple> classInfos; // This will be populated and send back to server
-
-            if (numEntries) {
-                // Serialize the entries
-                std::string buffer(bytesFootprint, '\0');
-                intptr_t writtenBytes = serializeIProfilerMethodEntries(pcEntries, numEntries, (uintptr_t)&buffer[0],
-                    methodStart, comp, sharedProfile, totalSamples, uncachedClasses, classInfos);
-                TR_ASSERT(writtenBytes == bytesFootprint, "BST doesn't match expected footprint");
-                // Send the information to the server
-                client->write(JITServer::MessageType::IProfiler_profilingSample, buffer, totalSamples,
-                    (size_t)numEntries,
-                    /*wholeMethod=*/true, usePersistentCache, isCompiled, uncachedClasses, classInfos);
-            } else // Empty IProfiler data for this method
-            {
-                client->write(JITServer::MessageType::IProfiler_profilingSample, std::string(), (uint64_t)0, (size_t)0,
-                    /*wholeMethod=*/true, usePersistentCache, isCompiled, uncachedClasses, classInfos);
-            }
+        if (!abort && numEntries) {
+            // Serialize the entries
+            buffer.resize(bytesFootprint, '\0');
+            intptr_t writtenBytes = serializeIProfilerMethodEntries(pcEntries, numEntries, (uintptr_t)&buffer[0],
+                methodStart, comp, sharedProfile, totalSamples, uncachedClasses, classInfos);
+            TR_ASSERT(writtenBytes == bytesFootprint, "BST doesn't match expected footprint");
         }
 
         // release any entry that has been locked by us
@@ -972,6 +1081,36 @@ bool JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBl
     return abort;
 }
 
+/**
+ * @brief Code to be executed by the JITClient to send all IProfiler info for a method to JITServer
+ *
+ * @param method J9Method in question
+ * @param comp The compilation object
+ * @param client Connection to JITServer
+ * @param usePersistentCache Passed to the server to indicate whether or not to use the persistent cache
+ * @param isCompiled Whether the method is compiled at the moment. Passed to the server
+ * @param sharedProfile Boolean indicating whether to collect info about classes the server does not have
+ * @return Whether the operation was aborted; if so, nothing was sent to the server
+ */
+bool JITClientIProfiler::serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp,
+    JITServer::ClientStream *client, bool usePersistentCache, bool isCompiled, bool sharedProfile)
+{
+    std::string buffer;
+    uint64_t totalSamples = 0; // Total number of profiling samples for this method
+    uint32_t numEntries = 0;
+    std::vector<J9Class *> uncachedClasses; // This will be populated and send back to server
+    std::vector<JITServerHelpers::ClassInfoTuple> classInfos; // This will be populated and send back to server
+
+    bool abort = serializeIProfileInfoForMethod(method, comp, sharedProfile, buffer, totalSamples, numEntries,
+        uncachedClasses, classInfos);
+    if (!abort) {
+        // Send the information to the server; an empty buffer means there is no IProfiler data for this method
+        client->write(JITServer::MessageType::IProfiler_profilingSample, buffer, totalSamples, (size_t)numEntries,
+            /*wholeMethod=*/true, usePersistentCache, isCompiled, uncachedClasses, classInfos);
+    }
+    return abort;
+}
+
 /**
  * @brief Code executed by the JITClient to serialize fanin info for a method
  *
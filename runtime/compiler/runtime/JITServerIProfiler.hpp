@@ -35,6 +35,13 @@ class CompilationInfoPerThreadRemote;
 }
 class ClientSessionData;
 
+// Flags describing each method in the reply to a batched profile query
+enum TR_IPBatchMethodFlags {
+    IPBATCH_USE_PERSISTENT_CACHE = 0x1, // the profile can be cached in the per-client cache
+    IPBATCH_IS_COMPILED = 0x2, // the method was compiled when the profile was collected
+    IPBATCH_ABORTED = 0x4, // the profile could not be collected; ask again with a regular query
+};
+
 struct TR_ContiguousIPMethodData {
     TR_OpaqueMethodBlock *_method;
     uint32_t _pcIndex;
@@ -86,8 +93,13 @@ struct TR_ContiguousIPMethodHashTableEntry {
  * object while the global IProfile cache is stored in `struct J9MethodInfo`
  * which is part of `ClientSessionData` (thus, the global cache is more like
  * a collection of caches, one for each method).
+ * To avoid one round trip per method while the inliner explores a call graph,
+ * the server can also fetch the profiles of all the callees of a method in a
+ * single message (see prefetchProfilingData()). The profiles are then cached
+ * exactly as if they had been requested one by one.
  * As a RAS feature, caching can be disabled if the environment variable
- * TR_DisableIPCaching is set.
+ * TR_DisableIPCaching is set. Batched fetching can be disabled with
+ * TR_DisableIPBatching.
  * Another RAS feature is the validation of the cached data. For a build with
  * assumes enabled (or for a debug build) every time the server uses a cached
  * value it will send a message to the client and compare the cached value to
@@ -102,7 +114,7 @@ public:
 
     // Data accessors, overridden for JITServer
     //
-    virtual TR_IPMethodHashTableEntry *searchForMethodSample(TR_OpaqueMethodBlock *omb, int32_t bucket) override;
+    virtual TR_IPMethodHashTableEntry *searchForMethodSample(TR_OpaqueMethodBlock *omb) override;
 
     // This method is used to search only the hash table
     virtual TR_IPBytecodeHashTableEntry *profilingSample(uintptr_t pc, uintptr_t data, bool addIt,
@@ -114,6 +126,13 @@ public:
     virtual void persistIprofileInfo(TR::ResolvedMethodSymbol *methodSymbol, TR_ResolvedMethod *method,
         TR::Compilation *comp) override;
 
+    /**
+     * @brief Fetch from the client, in a single message, the bytecode profiles of the indicated
+     *        methods that are not cached yet. Used when the profiles of several methods are
+     *        about to be needed, e.g. for the callees of a method explored by the inliner.
+     */
+    void prefetchProfilingData(TR::Compilation *comp, TR_OpaqueMethodBlock *const *methods, size_t numMethods);
+
     static TR_IPBytecodeHashTableEntry *ipBytecodeHashTableEntryFactory(TR_IPBCDataStorageHeader *storage, uintptr_t pc,
         TR_Memory *mem, TR_AllocationKind allocKind);
     // This is used for fanin data
@@ -136,13 +155,20 @@ private:
     bool cacheProfilingDataForMethod(TR_OpaqueMethodBlock *method, const std::string &ipdata, bool usePersistentCache,
         ClientSessionData *clientSessionData, TR::CompilationInfoPerThreadRemote *compInfoPT, bool isCompiled,
         TR::Compilation *comp);
+    void cacheClientProfile(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, const std::string &ipdata,
+        uint64_t numClientSamples, size_t numProfiledBytecodes, bool usePersistentCache, bool isCompiled,
+        std::vector<J9Class *> &uncachedRAMClasses, std::vector<JITServerHelpers::ClassInfoTuple> &classInfoTuples,
+        ClientSessionData *clientSession, TR::CompilationInfoPerThreadRemote *compInfoPT, TR::Compilation *comp);
     bool _useCaching;
+    bool _useBatching;
     // Statistics
     uint32_t _statsIProfilerInfoFromCache; // IP cache answered the query
     uint32_t _statsIProfilerInfoMsgToClient; // queries sent to client
     uint32_t _statsIProfilerInfoReqNotCacheable; // info returned from client should not be cached
     uint32_t _statsIProfilerInfoIsEmpty; // client has no IP info for indicated PC
     uint32_t _statsIProfilerInfoCachingFailures;
+    uint32_t _statsIProfilerBatchMsgToClient; // batched queries sent to client
+    uint32_t _statsIProfilerBatchMethods; // methods whose profile was requested in batched queries
 };
 
 /**
@@ -163,6 +189,9 @@ public:
     // Thus, any virtual function here must call the corresponding method in
     // the base class. It may be better not to override any methods though
 
+    bool serializeIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp, bool sharedProfile,
+        std::string &buffer, uint64_t &totalSamples, uint32_t &numEntries, std::vector<J9Class *> &uncachedClasses,
+        std::vector<JITServerHelpers::ClassInfoTuple> &classInfos);
     bool serializeAndSendIProfileInfoForMethod(TR_OpaqueMethodBlock *method, TR::Compilation *comp,
         JITServer::ClientStream *client, bool usePersistentCache, bool isCompiled, bool sharedProfile);
     std::string serializeFaninMethodEntry(TR_OpaqueMethodBlock *omb);
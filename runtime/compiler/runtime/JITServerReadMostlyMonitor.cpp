@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include "AtomicSupport.hpp"
+#include "control/CompilationRuntime.hpp"
+#include "control/CompilationThread.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentCollections.hpp"
+#include "runtime/JITServerReadMostlyMonitor.hpp"
+
+JITServerReadMostlyMonitor::JITServerReadMostlyMonitor(TR::Monitor *writerMonitor,
+    TR_PersistentMemory *persistentMemory, ReaderSlot *slots, int32_t numSlots)
+    : _writerMonitor(writerMonitor)
+    , _persistentMemory(persistentMemory)
+    , _slots(slots)
+    , _numSlots(numSlots)
+    , _writerActive(0)
+    , _writeDepth(0)
+    , _numWrites(0)
+    , _numContendedWrites(0)
+    , _writeWaitTimeUs(0)
+    , _writeHoldTimeUs(0)
+    , _maxWriteHoldTimeUs(0)
+    , _writeStartTime(0)
+{}
+
+JITServerReadMostlyMonitor *JITServerReadMostlyMonitor::create(const char *name,
+    TR_PersistentMemory *persistentMemory)
+{
+    TR::Monitor *writerMonitor = TR::Monitor::create(name);
+    if (!writerMonitor)
+        return NULL;
+
+    // The object and its reader slots are allocated together; the slots are aligned to a cache line
+    int32_t numSlots = TR::CompilationInfo::get()->getNumTotalAllocatedCompilationThreads();
+    size_t size = sizeof(JITServerReadMostlyMonitor) + (numSlots + 1) * SLOT_SIZE;
+    void *mem = persistentMemory->allocatePersistentMemory(size);
+    if (!mem) {
+        TR::Monitor::destroy(writerMonitor);
+        return NULL;
+    }
+    uintptr_t slotsStart = (uintptr_t)mem + sizeof(JITServerReadMostlyMonitor);
+    slotsStart = (slotsStart + SLOT_SIZE - 1) & ~(uintptr_t)(SLOT_SIZE - 1);
+    ReaderSlot *slots = (ReaderSlot *)slotsStart;
+    memset(slots, 0, numSlots * SLOT_SIZE);
+
+    return new (mem) JITServerReadMostlyMonitor(writerMonitor, persistentMemory, slots, numSlots);
+}
+
+void JITServerReadMostlyMonitor::destroy(JITServerReadMostlyMonitor *monitor)
+{
+    if (!monitor)
+        return;
+    TR::Monitor::destroy(monitor->_writerMonitor);
+    monitor->_persistentMemory->freePersistentMemory(monitor);
+}
+
+JITServerReadMostlyMonitor::ReaderSlot *JITServerReadMostlyMonitor::getSlot() const
+{
+    TR::CompilationInfoPerThread *compInfoPT = TR::compInfoPT;
+    if (!compInfoPT)
+        return NULL;
+    int32_t compThreadId = compInfoPT->getCompThreadId();
+    if ((compThreadId < 0) || (compThreadId >= _numSlots))
+        return NULL;
+    return &_slots[compThreadId];
+}
+
+void JITServerReadMostlyMonitor::enterRead()
+{
+    ReaderSlot *slot = getSlot();
+    if (!slot) {
+        enterWrite();
+        return;
+    }
+
+    slot->_numReads++;
+    if (slot->_readDepth > 0) {
+        // Nested read: this thread already excludes writers
+        slot->_readDepth++;
+        return;
+    }
+
+    while (true) {
+        slot->_readDepth = 1;
+        // The store to our slot must be visible before we check for a writer; the writer
+        // does the opposite (raises the flag, then checks the slots), so at least one
+        // of the two threads will see the other.
+        VM_AtomicSupport::readWriteBarrier();
+        if (!_writerActive || _writerMonitor->owned_by_self()) {
+            // Acquire: loads inside the critical section must not be satisfied before the
+            // load of _writerActive, or they could see data from before the last writer's
+            // stores, which exitWrite publishes before clearing the flag
+            VM_AtomicSupport::readBarrier();
+            return;
+        }
+
+        // Back off and wait for the writer to finish
+        slot->_readDepth = 0;
+        VM_AtomicSupport::writeBarrier();
+        slot->_numBlockedReads++;
+        _writerMonitor->enter();
+        _writerMonitor->exit();
+    }
+}
+
+void JITServerReadMostlyMonitor::exitRead()
+{
+    ReaderSlot *slot = getSlot();
+    if (!slot) {
+        exitWrite();
+        return;
+    }
+
+    TR_ASSERT(slot->_readDepth > 0, "Read lock is not held by this thread");
+    // Loads done inside the critical section must complete before the writer can proceed
+    VM_AtomicSupport::readWriteBarrier();
+    slot->_readDepth--;
+}
+
+void JITServerReadMostlyMonitor::waitForReaders() const
+{
+    for (int32_t i = 0; i < _numSlots; ++i) {
+        uint32_t spins = 0;
+        while (_slots[i]._readDepth > 0) {
+            if (++spins < 64) {
+                VM_AtomicSupport::yieldCPU();
+            } else {
+                omrthread_yield();
+                spins = 0;
+            }
+            VM_AtomicSupport::readBarrier();
+        }
+    }
+}
+
+void JITServerReadMostlyMonitor::enterWrite()
+{
+    ReaderSlot *slot = getSlot();
+    TR_ASSERT_FATAL(!slot || (slot->_readDepth == 0) || _writerMonitor->owned_by_self(),
+        "Cannot acquire the write lock while holding the read lock");
+
+    PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+    uint64_t startTime = j9time_usec_clock();
+    bool contended = _writerActive != 0;
+    _writerMonitor->enter();
+    if (_writeDepth++ > 0)
+        return;
+
+    _writerActive = 1;
+    VM_AtomicSupport::readWriteBarrier();
+    for (int32_t i = 0; i < _numSlots; ++i) {
+        if (_slots[i]._readDepth > 0) {
+            contended = true;
+            waitForReaders();
+            break;
+        }
+    }
+    // Make sure loads inside the critical section are not hoisted above the wait
+    VM_AtomicSupport::readBarrier();
+
+    _writeStartTime = j9time_usec_clock();
+    _numWrites++;
+    if (contended)
+        _numContendedWrites++;
+    _writeWaitTimeUs += _writeStartTime - startTime;
+}
+
+void JITServerReadMostlyMonitor::exitWrite()
+{
+    TR_ASSERT(_writerMonitor->owned_by_self() && (_writeDepth > 0), "Write lock is not held by this thread");
+    if (--_writeDepth == 0) {
+        PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+        uint64_t holdTime = j9time_usec_clock() - _writeStartTime;
+        _writeHoldTimeUs += holdTime;
+        if (holdTime > _maxWriteHoldTimeUs)
+            _maxWriteHoldTimeUs = holdTime;
+
+        // Release: stores done inside the critical section must be visible before readers
+        // are let in; pairs with the read barrier on the enterRead fast path
+        VM_AtomicSupport::writeBarrier();
+        _writerActive = 0;
+    }
+    _writerMonitor->exit();
+}
+
+void JITServerReadMostlyMonitor::printStats() const
+{
+    // The counters are read without synchronization; the values are approximate
+    uint64_t numReads = 0;
+    uint64_t numBlockedReads = 0;
+    for (int32_t i = 0; i < _numSlots; ++i) {
+        numReads += _slots[i]._numReads;
+        numBlockedReads += _slots[i]._numBlockedReads;
+    }
+
+    PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
+    j9tty_printf(PORTLIB, "\t\treads: %llu (blocked by a writer: %llu)\n", numReads, numBlockedReads);
+    j9tty_printf(PORTLIB,
+        "\t\twrites: %llu (contended: %llu) wait time: %llu us hold time: %llu us max hold time: %llu us\n",
+        _numWrites, _numContendedWrites, _writeWaitTimeUs, _writeHoldTimeUs, _maxWriteHoldTimeUs);
+}
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#ifndef JITSERVER_READ_MOSTLY_MONITOR_H
+#define JITSERVER_READ_MOSTLY_MONITOR_H
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "infra/Monitor.hpp"
+
+class TR_PersistentMemory;
+
+// A reader-writer lock for the per-client caches of a JITServer session, which are
+// looked up by every compilation thread many times per compilation but updated rarely.
+//
+// Each compilation thread announces a read in its own cache line (indexed by its
+// compilation thread ID), so concurrent readers never write to shared memory and
+// do not serialize on a monitor. A writer enters a regular TR::Monitor, raises a
+// flag that sends new readers to wait on that monitor, and then waits for the
+// readers already inside to leave. Threads that are not compilation threads
+// (e.g. the thread printing statistics) always take the write path.
+//
+// Both reads and writes can be nested, and a thread that holds the write lock can
+// also read. A thread holding only the read lock must not try to acquire the write
+// lock: it would wait for itself to leave.
+class JITServerReadMostlyMonitor {
+public:
+    TR_PERSISTENT_ALLOC(TR_Memory::ClientSessionData)
+
+    static JITServerReadMostlyMonitor *create(const char *name, TR_PersistentMemory *persistentMemory);
+    static void destroy(JITServerReadMostlyMonitor *monitor);
+
+    void enterRead();
+    void exitRead();
+    void enterWrite();
+    void exitWrite();
+
+    // True if the current thread holds the write lock
+    bool writeOwnedBySelf() const { return _writerMonitor->owned_by_self(); }
+
+    void printStats() const;
+
+private:
+    static const size_t SLOT_SIZE = 64; // One cache line per reader
+
+    struct ReaderSlot {
+        volatile uint32_t _readDepth; // Only written by the owning thread
+        uint32_t _numBlockedReads; // Number of times a read had to wait for a writer
+        uint64_t _numReads;
+        uint8_t _padding[SLOT_SIZE - 2 * sizeof(uint32_t) - sizeof(uint64_t)];
+    };
+
+    JITServerReadMostlyMonitor(TR::Monitor *writerMonitor, TR_PersistentMemory *persistentMemory,
+        ReaderSlot *slots, int32_t numSlots);
+
+    ReaderSlot *getSlot() const;
+    void waitForReaders() const;
+
+    TR::Monitor * const _writerMonitor; // Serializes writers; readers block on it while a writer is active
+    TR_PersistentMemory * const _persistentMemory;
+    ReaderSlot * const _slots;
+    const int32_t _numSlots;
+    volatile uint32_t _writerActive;
+    uint32_t _writeDepth;
+
+    // Write statistics, updated with _writerMonitor in hand
+    uint64_t _numWrites;
+    uint64_t _numContendedWrites; // Writes that waited for another writer or for readers
+    uint64_t _writeWaitTimeUs; // Time spent acquiring _writerMonitor and waiting for readers
+    uint64_t _writeHoldTimeUs;
+    uint64_t _maxWriteHoldTimeUs;
+    uint64_t _writeStartTime;
+};
+
+// Scoped read and write locking of a JITServerReadMostlyMonitor, the counterparts of OMR::CriticalSection
+class JITServerReadSection {
+public:
+    JITServerReadSection(JITServerReadMostlyMonitor *monitor)
+        : _monitor(monitor)
+    {
+        _monitor->enterRead();
+    }
+
+    ~JITServerReadSection() { _monitor->exitRead(); }
+
+private:
+    JITServerReadMostlyMonitor *_monitor;
+};
+
+class JITServerWriteSection {
+public:
+    JITServerWriteSection(JITServerReadMostlyMonitor *monitor)
+        : _monitor(monitor)
+    {
+        _monitor->enterWrite();
+    }
+
+    ~JITServerWriteSection() { _monitor->exitWrite(); }
+
+private:
+    JITServerReadMostlyMonitor *_monitor;
+};
+
+#endif /* JITSERVER_READ_MOSTLY_MONITOR_H */
@@ -35,13 +35,23 @@
 
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp"
+#include "env/CompilerEnv.hpp"
 #include "env/TRMemory.hpp"
 #include "env/PersistentInfo.hpp"
 #include "env/VerboseLog.hpp"
 #include "env/VMJ9.h"
+#include "j9modron.h"
 #include "net/ServerStream.hpp"
+#include "runtime/CodeCacheManager.hpp"
 #include "runtime/MetricsServer.hpp"
 
+MetricsDatabase *MetricsDatabase::_instance = NULL;
+
+// Bucket bounds, in usec, of the histograms published by a client or a regular JVM
+static const uint64_t compilationTimeBuckets[]
+    = { 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000, 10000000 };
+static const uint64_t gcPauseTimeBuckets[] = { 100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000 };
+
 bool MetricsServer::useSSL(TR::CompilationInfo *compInfo)
 {
     return (compInfo->getJITServerMetricsSslKeys().size() || compInfo->getJITServerMetricsSslCerts().size());
@@ -132,28 +142,168 @@ double ActiveThreadsMetric::computeValue(TR::CompilationInfo *compInfo)
     return getValue();
 }
 
+PrometheusHistogram::PrometheusHistogram(const std::string &name, const std::string &help,
+    const uint64_t *upperBounds, size_t numBounds, double scale)
+    : PrometheusMetric(name, help)
+    , _numBounds(numBounds)
+    , _scale(scale)
+    , _sum(0)
+{
+    TR_ASSERT_FATAL(numBounds <= MAX_BUCKETS, "Too many buckets for histogram %s", name.c_str());
+    for (size_t i = 0; i < numBounds; i++)
+        _upperBounds[i] = upperBounds[i];
+    for (size_t i = 0; i <= MAX_BUCKETS; i++)
+        _bucketCounts[i] = 0;
+}
+
+void PrometheusHistogram::observe(uint64_t value)
+{
+    size_t bucket = 0;
+    while ((bucket < _numBounds) && (value > _upperBounds[bucket]))
+        bucket++;
+    VM_AtomicSupport::add(&_bucketCounts[bucket], 1);
+    VM_AtomicSupport::addU64(&_sum, value);
+}
+
+double PrometheusHistogram::computeValue(TR::CompilationInfo *compInfo)
+{
+    uintptr_t count = 0;
+    for (size_t i = 0; i <= _numBounds; i++)
+        count += _bucketCounts[i];
+    setValue((double)count);
+    return getValue();
+}
+
+std::string PrometheusHistogram::serialize()
+{
+    // Buckets are read one at a time while other threads may add observations, so the
+    // serialized counts can be slightly inconsistent with each other; Prometheus copes with that
+    std::string output = "# HELP " + getName() + " " + getHelp() + "\n# TYPE " + getName() + " " + getType() + "\n";
+    uintptr_t cumulativeCount = 0;
+    for (size_t i = 0; i < _numBounds; i++) {
+        cumulativeCount += _bucketCounts[i];
+        output += getName() + "_bucket{le=\"" + std::to_string(_upperBounds[i] / _scale) + "\"} "
+            + std::to_string(cumulativeCount) + "\n";
+    }
+    cumulativeCount += _bucketCounts[_numBounds];
+    output += getName() + "_bucket{le=\"+Inf\"} " + std::to_string(cumulativeCount) + "\n";
+    output += getName() + "_sum " + std::to_string(_sum / _scale) + "\n";
+    output += getName() + "_count " + std::to_string(cumulativeCount) + "\n";
+    return output;
+}
+
+double CompilationQueueSizeMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    // Read without the compilation queue monitor; a slightly stale value is fine here
+    setValue(compInfo->getMethodQueueSize());
+    return getValue();
+}
+
+double CodeCacheUsedMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    setValue(TR::CodeCacheManager::instance()->getCurrTotalUsedInBytes());
+    return getValue();
+}
+
+double CodeCacheOccupancyMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    uint64_t capacity = (uint64_t)compInfo->getJITConfig()->codeCacheTotalKB << 10;
+    if (capacity)
+        setValue((double)TR::CodeCacheManager::instance()->getCurrTotalUsedInBytes() / capacity);
+    return getValue();
+}
+
+void TLHRefreshesMetric::recordGCStart(J9JavaVM *javaVM)
+{
+    UDATA refreshes = 0;
+    if (javaVM->memoryManagerFunctions->j9gc_modron_getConfigurationValueForKey(javaVM,
+            j9gc_modron_configuration_tlhRefreshCount, &refreshes))
+        VM_AtomicSupport::addU64(&_refreshes, refreshes);
+}
+
+double TLHRefreshesMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    setValue((double)_refreshes);
+    return getValue();
+}
+
+double AOTLoadHitRatioMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    uintptr_t loads = _loads->getCount();
+    uintptr_t attempts = loads + _loadFailures->getCount();
+    if (attempts)
+        setValue((double)loads / attempts);
+    return getValue();
+}
+
 MetricsDatabase::MetricsDatabase(TR::CompilationInfo *compInfo)
-    : _compInfo(compInfo)
+    : _metrics(PersistentVector<PrometheusMetric *>::allocator_type(TR::Compiler->persistentAllocator()))
+    , _compInfo(compInfo)
+    , _compilationTime(NULL)
+    , _gcPauseTime(NULL)
+    , _aotLoads(NULL)
+    , _aotLoadFailures(NULL)
+    , _tlhRefreshes(NULL)
+    , _gcStartTime(0)
 {
-    _metrics[0] = new (PERSISTENT_NEW) CPUUtilMetric();
-    _metrics[1] = new (PERSISTENT_NEW) AvailableMemoryMetric();
-    _metrics[2] = new (PERSISTENT_NEW) ConnectedClientsMetric();
-    _metrics[3] = new (PERSISTENT_NEW) ActiveThreadsMetric();
-    static_assert(3 == MAX_METRICS - 1, "Unsupported number of metrics");
+    if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER) {
+        addMetric(new (PERSISTENT_NEW) CPUUtilMetric());
+        addMetric(new (PERSISTENT_NEW) AvailableMemoryMetric());
+        addMetric(new (PERSISTENT_NEW) ConnectedClientsMetric());
+        addMetric(new (PERSISTENT_NEW) ActiveThreadsMetric());
+        addMetric(new (PERSISTENT_NEW) CompilationQueueSizeMetric());
+    } else {
+        // A client or a regular JVM
+        _compilationTime = new (PERSISTENT_NEW) PrometheusHistogram("openj9_jit_compilation_time_seconds",
+            "Duration of JIT compilations", compilationTimeBuckets,
+            sizeof(compilationTimeBuckets) / sizeof(compilationTimeBuckets[0]), 1000000.0);
+        _gcPauseTime = new (PERSISTENT_NEW) PrometheusHistogram("openj9_gc_pause_seconds",
+            "Duration of stop-the-world garbage collections", gcPauseTimeBuckets,
+            sizeof(gcPauseTimeBuckets) / sizeof(gcPauseTimeBuckets[0]), 1000000.0);
+        _tlhRefreshes = new (PERSISTENT_NEW) TLHRefreshesMetric();
+        _aotLoads = new (PERSISTENT_NEW)
+            PrometheusCounter("openj9_aot_loads_total", "Number of AOT bodies loaded from the shared class cache");
+        _aotLoadFailures = new (PERSISTENT_NEW) PrometheusCounter("openj9_aot_load_failures_total",
+            "Number of AOT bodies from the shared class cache that failed to load");
+
+        addMetric(new (PERSISTENT_NEW) CompilationQueueSizeMetric());
+        addMetric(_compilationTime);
+        addMetric(new (PERSISTENT_NEW) CodeCacheUsedMetric());
+        addMetric(new (PERSISTENT_NEW) CodeCacheOccupancyMetric());
+        addMetric(_gcPauseTime);
+        addMetric(_tlhRefreshes);
+        addMetric(_aotLoads);
+        addMetric(_aotLoadFailures);
+        addMetric(new (PERSISTENT_NEW) AOTLoadHitRatioMetric(_aotLoads, _aotLoadFailures));
+    }
 }
 
 MetricsDatabase::~MetricsDatabase()
 {
-    for (int i = 0; i < MAX_METRICS; i++) {
+    if (_instance == this)
+        _instance = NULL;
+    for (size_t i = 0; i < _metrics.size(); i++) {
         _metrics[i]->~PrometheusMetric();
         TR_Memory::jitPersistentFree(_metrics[i]);
     }
 }
 
+MetricsDatabase *MetricsDatabase::allocate(TR::CompilationInfo *compInfo)
+{
+    MetricsDatabase *metricsDatabase = new (PERSISTENT_NEW) MetricsDatabase(compInfo);
+    _instance = metricsDatabase;
+    return metricsDatabase;
+}
+
+void MetricsDatabase::addMetric(PrometheusMetric *metric)
+{
+    _metrics.push_back(metric);
+}
+
 std::string MetricsDatabase::serializeMetrics()
 {
     std::string output;
-    for (int i = 0; i < MAX_METRICS; i++) {
+    for (size_t i = 0; i < _metrics.size(); i++) {
         _metrics[i]->computeValue(_compInfo);
         output.append(_metrics[i]->serialize());
     }
@@ -576,7 +726,7 @@ void MetricsServer::handleConnectionRequest()
     reArmSocketForReading(LISTEN_SOCKET);
 }
 
-void MetricsServer::handleDataForConnectedSocket(nfds_t sockIndex, MetricsDatabase &metricsDatabase)
+void MetricsServer::handleDataForConnectedSocket(nfds_t sockIndex, MetricsDatabase *metricsDatabase)
 {
     // Check for errors first; we only expect the POLLIN or POLLOUT flag to be set
     if (_pfd[sockIndex].revents & (POLLRDHUP | POLLERR | POLLHUP | POLLNVAL)) {
@@ -613,7 +763,7 @@ void MetricsServer::handleDataForConnectedSocket(nfds_t sockIndex, MetricsDataba
             case HttpGetRequest::HTTP_OK:
                 // Save the metric data response and wait to send it to requestor
                 if (_requests[sockIndex].getPath() == HttpGetRequest::Path::Metrics) {
-                    _requests[sockIndex].setResponse(metricsDatabase.buildMetricHttpResponse());
+                    _requests[sockIndex].setResponse(metricsDatabase->buildMetricHttpResponse());
                 } else // Valid, but unrecognized request type
                 {
                     _requests[sockIndex].setResponse(std::string("HTTP/1.1 200 OK\r\nConnection: close\r\n\r\n"));
@@ -677,7 +827,9 @@ void MetricsServer::serveMetricsRequests()
     reArmSocketForReading(0);
     _numActiveSockets = 1;
 
-    MetricsDatabase metricsDatabase(compInfo);
+    MetricsDatabase *metricsDatabase = MetricsDatabase::get();
+    if (!metricsDatabase)
+        metricsDatabase = MetricsDatabase::allocate(compInfo);
 
     if (useSSL(compInfo)) {
         auto &sslKeys = compInfo->getJITServerMetricsSslKeys();
@@ -26,6 +26,8 @@
 #include <poll.h> // for struct pollfd
 #include <string>
 #include "j9.h" // for J9JavaVM
+#include "AtomicSupport.hpp"
+#include "env/PersistentCollections.hpp"
 #include "infra/Monitor.hpp" // for TR::Monitor
 
 namespace TR {
@@ -38,13 +40,15 @@ class CompilationInfo;
 
    PrometheusMetric is an abstract class and concrete classes need to be derived from it.
    Derived classes need to implement the `computeValue()` function and possibly the
-   destructor, if they allocate memory dynamically.
+   destructor, if they allocate memory dynamically. By default a metric is a gauge;
+   metrics of other types override `getType()` and, if needed, `serialize()`.
  */
 class PrometheusMetric {
 public:
     PrometheusMetric(const std::string &name, const std::string &help)
         : _name(name)
         , _help(help)
+        , _value(0)
     {}
 
     virtual ~PrometheusMetric() {}
@@ -64,14 +68,19 @@ public:
 
     void setValue(double v) { _value = v; }
 
+    /**
+       @brief Return the Prometheus type of the metric: "gauge", "counter" or "histogram"
+    */
+    virtual const char *getType() const { return "gauge"; }
+
     /**
        @brief Build a std::string that encodes the value of the metric in a format understood by Prometheus
        @return Serialized value of the metric (as a std::string)
     */
-    std::string serialize()
+    virtual std::string serialize()
     {
-        return "# HELP " + getName() + " " + getHelp() + "\n# TYPE " + getName() + " gauge\n" + getName() + " "
-            + std::to_string(getValue()) + "\n";
+        return "# HELP " + getName() + " " + getHelp() + "\n# TYPE " + getName() + " " + getType() + "\n" + getName()
+            + " " + std::to_string(getValue()) + "\n";
     }
 
 protected:
@@ -80,6 +89,77 @@ protected:
     double _value;
 }; // class PrometheusMetric
 
+/**
+   @class PrometheusCounter
+   @brief Metric that counts events, like AOT loads, and never decreases
+
+   The counter is updated on hot paths with a single atomic add and is
+   only read when the metrics are scraped.
+ */
+class PrometheusCounter : public PrometheusMetric {
+public:
+    PrometheusCounter(const std::string &name, const std::string &help)
+        : PrometheusMetric(name, help)
+        , _count(0)
+    {}
+
+    void increment() { VM_AtomicSupport::add(&_count, 1); }
+
+    uintptr_t getCount() const { return _count; }
+
+    virtual double computeValue(TR::CompilationInfo *compInfo)
+    {
+        setValue((double)_count);
+        return getValue();
+    }
+
+    virtual const char *getType() const { return "counter"; }
+
+private:
+    volatile uintptr_t _count;
+}; // class PrometheusCounter
+
+/**
+   @class PrometheusHistogram
+   @brief Metric that records the distribution of a quantity, like compilation times
+
+   Observed values are integers (e.g. microseconds) that are divided by `scale` when
+   serialized, so that they are reported in base units (e.g. seconds) as Prometheus
+   expects. Each observation costs a search through at most MAX_BUCKETS bucket bounds
+   and two atomic adds. Percentiles are computed by Prometheus from the buckets,
+   e.g. with histogram_quantile().
+ */
+class PrometheusHistogram : public PrometheusMetric {
+public:
+    static const size_t MAX_BUCKETS = 16;
+
+    /**
+       @param upperBounds Increasing upper bounds of the buckets, excluding the implicit +Inf bucket
+       @param numBounds Number of entries in upperBounds; at most MAX_BUCKETS
+       @param scale Number of observed units in one reported unit
+    */
+    PrometheusHistogram(const std::string &name, const std::string &help, const uint64_t *upperBounds,
+        size_t numBounds, double scale);
+
+    void observe(uint64_t value);
+
+    /**
+       @brief Compute the number of observations
+    */
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+
+    virtual const char *getType() const { return "histogram"; }
+
+    virtual std::string serialize();
+
+private:
+    uint64_t _upperBounds[MAX_BUCKETS];
+    size_t _numBounds;
+    double _scale;
+    volatile uintptr_t _bucketCounts[MAX_BUCKETS + 1]; // Not cumulative; the last bucket is +Inf
+    volatile uint64_t _sum;
+}; // class PrometheusHistogram
+
 /**
    @brief Class used to serialize CPU utilization of OpenJ9, as a metric understood by Prometheus
  */
@@ -129,21 +209,166 @@ public:
     virtual double computeValue(TR::CompilationInfo *compInfo);
 }; // class ActiveThreadsMetric
 
+/**
+   @brief Class used to serialize the number of methods waiting in the compilation queue, as a metric understood by
+   Prometheus
+ */
+class CompilationQueueSizeMetric : public PrometheusMetric {
+public:
+    CompilationQueueSizeMetric()
+        : PrometheusMetric("openj9_jit_compilation_queue_size", "Number of methods in the compilation queue")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+}; // class CompilationQueueSizeMetric
+
+/**
+   @brief Class used to serialize the number of bytes used in the JIT code caches, as a metric understood by Prometheus
+ */
+class CodeCacheUsedMetric : public PrometheusMetric {
+public:
+    CodeCacheUsedMetric()
+        : PrometheusMetric("openj9_jit_code_cache_used_bytes", "Bytes used in the JIT code caches")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+}; // class CodeCacheUsedMetric
+
+/**
+   @brief Class used to serialize the fraction of the JIT code cache capacity that is in use, as a metric understood by
+   Prometheus
+ */
+class CodeCacheOccupancyMetric : public PrometheusMetric {
+public:
+    CodeCacheOccupancyMetric()
+        : PrometheusMetric("openj9_jit_code_cache_occupancy_ratio",
+              "Fraction of the JIT code cache capacity (-Xcodecachetotal) in use")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+}; // class CodeCacheOccupancyMetric
+
+/**
+   @brief Class used to serialize the number of thread local heap refreshes done by the allocating threads, as a metric
+   understood by Prometheus
+
+   The GC accumulates TLH refreshes between collections; the count is added to this
+   counter at the start of each collection. Use rate() in Prometheus to get the refresh rate.
+ */
+class TLHRefreshesMetric : public PrometheusMetric {
+public:
+    TLHRefreshesMetric()
+        : PrometheusMetric("openj9_gc_tlh_refreshes_total", "Number of thread local heap refreshes")
+        , _refreshes(0)
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+
+    virtual const char *getType() const { return "counter"; }
+
+    /**
+       @brief Add the TLH refreshes since the previous collection; must be called at the start of a collection
+    */
+    void recordGCStart(J9JavaVM *javaVM);
+
+private:
+    volatile uint64_t _refreshes;
+}; // class TLHRefreshesMetric
+
+/**
+   @brief Class used to serialize the fraction of AOT loads from the shared class cache that succeed, as a metric
+   understood by Prometheus
+ */
+class AOTLoadHitRatioMetric : public PrometheusMetric {
+public:
+    AOTLoadHitRatioMetric(PrometheusCounter *loads, PrometheusCounter *loadFailures)
+        : PrometheusMetric("openj9_aot_load_hit_ratio", "Fraction of AOT loads from the shared class cache that succeed")
+        , _loads(loads)
+        , _loadFailures(loadFailures)
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+
+private:
+    PrometheusCounter *_loads;
+    PrometheusCounter *_loadFailures;
+}; // class AOTLoadHitRatioMetric
+
 /**
    @class MetricsDatabase
    @brief Collection of metrics that need to be sent to Prometheus on demand
 
-   In order to add a new metric, derive a new class from PrometheusMetric and implement its
-   computeValue() method. Increment the MAX_METRICS constant accordingly. Change the constructor
-   of this class to dynamically allocate an instance of the new metric and store a pointer
-   of this metric instance into the _metrics array
+   There is a single database per JVM, created with allocate() when the metrics server is
+   enabled. A JITServer publishes server metrics; a client or a regular JVM publishes
+   metrics about the JIT, the GC and the shared class cache.
+
+   In order to add a new metric, derive a new class from PrometheusMetric (or use
+   PrometheusCounter or PrometheusHistogram) and implement its computeValue() method.
+   Change the constructor of this class to dynamically allocate an instance of the new
+   metric and register it with addMetric(). Metrics updated from hot paths get a
+   static record*() helper, which does nothing when the metrics server is not enabled.
  */
 class MetricsDatabase {
 public:
-    static const size_t MAX_METRICS = 4; // Maximum number of metrics our database can hold
     MetricsDatabase(TR::CompilationInfo *compInfo);
     ~MetricsDatabase();
 
+    static MetricsDatabase *allocate(TR::CompilationInfo *compInfo);
+
+    static MetricsDatabase *get() { return _instance; }
+
+    /**
+       @brief Add a metric to the database, which takes ownership of it.
+       Metrics must be added before the metrics thread starts serving requests.
+    */
+    void addMetric(PrometheusMetric *metric);
+
+    /**
+       @brief Record the duration of a compilation, in microseconds
+    */
+    static void recordCompilationTime(uint64_t usec)
+    {
+        if (_instance && _instance->_compilationTime)
+            _instance->_compilationTime->observe(usec);
+    }
+
+    /**
+       @brief Record the outcome of loading an AOT body from the shared class cache
+    */
+    static void recordAOTLoad(bool success)
+    {
+        if (_instance && _instance->_aotLoads) {
+            if (success)
+                _instance->_aotLoads->increment();
+            else
+                _instance->_aotLoadFailures->increment();
+        }
+    }
+
+    /**
+       @brief Record the start of a stop-the-world collection. Called from the GC start hooks,
+       which never run concurrently.
+    */
+    static void recordGCStart(J9JavaVM *javaVM, uint64_t usec)
+    {
+        if (_instance && _instance->_gcPauseTime) {
+            _instance->_gcStartTime = usec;
+            _instance->_tlhRefreshes->recordGCStart(javaVM);
+        }
+    }
+
+    /**
+       @brief Record the end of a stop-the-world collection
+    */
+    static void recordGCEnd(uint64_t usec)
+    {
+        if (_instance && _instance->_gcPauseTime && _instance->_gcStartTime) {
+            if (usec >= _instance->_gcStartTime)
+                _instance->_gcPauseTime->observe(usec - _instance->_gcStartTime);
+            _instance->_gcStartTime = 0;
+        }
+    }
+
     /**
        @brief Build a std::string that serializes the values of all the metrics in the database.
 
@@ -166,8 +391,18 @@ public:
     }
 
 private:
-    PrometheusMetric *_metrics[MAX_METRICS]; // Array with pointers to metrics to be scrapped
+    static MetricsDatabase *_instance;
+
+    PersistentVector<PrometheusMetric *> _metrics; // Metrics to be scrapped
     TR::CompilationInfo *_compInfo;
+
+    // Metrics updated from hot paths; NULL when they are not published
+    PrometheusHistogram *_compilationTime;
+    PrometheusHistogram *_gcPauseTime;
+    PrometheusCounter *_aotLoads;
+    PrometheusCounter *_aotLoadFailures;
+    TLHRefreshesMetric *_tlhRefreshes;
+    uint64_t _gcStartTime; // usec; 0 when no collection is in progress
 }; // MetricsDatabase
 
 /**
@@ -367,7 +602,7 @@ private:
     int openSocketForListening(uint32_t port);
     std::string messageForErrorCode(int err);
     void handleConnectionRequest();
-    void handleDataForConnectedSocket(nfds_t i, MetricsDatabase &metricsDatabase);
+    void handleDataForConnectedSocket(nfds_t i, MetricsDatabase *metricsDatabase);
     void reArmSocketForReading(int sockIndex);
     void reArmSocketForWriting(int sockIndex);
     void closeSocket(int sockIndex);
@@ -538,6 +538,8 @@ void TR_RelocationRuntime::relocateAOTCodeAndData(U_8 *tempDataStart, U_8 *oldDa
         /* Adjust exception table entires */
         _exceptionTable->ramMethod = _method;
         _exceptionTable->constantPool = ramCP();
+        /* The JFR compile ID stored with the body belongs to the JVM that compiled it */
+        _exceptionTable->jfrCompileID = 0;
         getClassNameSignatureFromMethod(_method, _exceptionTable->className, _exceptionTable->methodName,
             _exceptionTable->methodSignature);
         RELO_LOG(reloLogger(), 1, "relocateAOTCodeAndData: method %.*s.%.*s%.*s\n",
@@ -206,6 +206,9 @@ public:
 	MM_UserSpecifiedParameterBool virtualLargeObjectHeap; /**< off heap option */
 
 	bool dynamicHeapAdjustmentForRestore; /**< If set to true, the default heuristic-calculated softmx is prioritized over the user-specified values. */
+	bool stringDeduplication; /**< If set to true, balanced copy-forward makes old Strings with equal contents share one value array (unrelated to stringDedupPolicy) */
+	uintptr_t stringDeduplicationAgeThreshold; /**< Minimum region age of a copied String for its value array to be considered for deduplication */
+	uintptr_t tarokPauseTimeGoal; /**< Balanced PGC pause time goal in milliseconds, which caps eden size and the collection set (0 if no goal was specified) */
 	/**
 	 * Values for com.ibm.oti.vm.VM.J9_JIT_STRING_DEDUP_POLICY
 	 * must hava the same values as J9_JIT_STRING_DEDUP_POLICY_DISABLED, J9_JIT_STRING_DEDUP_POLICY_FAVOUR_LOWER and J9_JIT_STRING_DEDUP_POLICY_FAVOUR_HIGHER.
@@ -417,6 +420,9 @@ public:
 		, tlhMaximumSizeSpecified(false)
 		, virtualLargeObjectHeap()
 		, dynamicHeapAdjustmentForRestore(false)
+		, stringDeduplication(false)
+		, stringDeduplicationAgeThreshold(3)
+		, tarokPauseTimeGoal(0)
 		, stringDedupPolicy(J9_JIT_STRING_DEDUP_POLICY_UNDEFINED)
 		, _asyncCallbackKey(-1)
 		, _TLHAsyncCallbackKey(-1)
@@ -50,6 +50,7 @@
 #include "ConstantPoolObjectSlotIterator.hpp"
 #include "ConstantPoolClassSlotIterator.hpp"
 #include "HashTableIterator.hpp"
+#include "JNIGlobalReferenceIterator.hpp"
 
 #if defined(J9VM_OPT_JVMTI)
 #include "JVMTIObjectTagTableIterator.hpp"
@@ -85,7 +86,6 @@ typedef GC_SublistIterator GC_RememberedSetIterator;
 typedef GC_SublistSlotIterator GC_RememberedSetSlotIterator;
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 
-typedef GC_PoolIterator GC_JNIGlobalReferenceIterator;
 typedef GC_PoolIterator GC_JNIWeakGlobalReferenceIterator;
 
 #if defined(J9VM_INTERP_DEBUG_SUPPORT)
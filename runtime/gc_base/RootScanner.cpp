@@ -773,6 +773,22 @@ MM_RootScanner::scanContinuationObjects(MM_EnvironmentBase *env)
 	reportScanningEnded(RootScannerEntity_ContinuationObjects);
 }
 
+/**
+ * Scan the object monitor lookup cache shared by all threads.
+ * Like the per-thread caches, it must be flushed before scanMonitorReferences destroys monitors.
+ */
+void
+MM_RootScanner::scanSharedMonitorLookupCache(MM_EnvironmentBase *env)
+{
+	j9objectmonitor_t *monitorLookupCache = _javaVM->monitorLookupCache;
+	if (NULL != monitorLookupCache) {
+		uintptr_t cacheIndex = 0;
+		for (; cacheIndex < _javaVM->monitorLookupCacheSize; cacheIndex++) {
+			doMonitorLookupCacheSlot(&monitorLookupCache[cacheIndex]);
+		}
+	}
+}
+
 /**
  * Scan the per-thread object monitor lookup caches.
  * Note that this is not a root since the cache contains monitors from the global monitor table
@@ -783,6 +799,9 @@ void
 MM_RootScanner::scanMonitorLookupCaches(MM_EnvironmentBase *env)
 {
 	reportScanningStarted(RootScannerEntity_MonitorLookupCaches);
+	if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		scanSharedMonitorLookupCache(env);
+	}
 	GC_VMThreadListIterator vmThreadListIterator(_javaVM);
 	while (J9VMThread *walkThread = vmThreadListIterator.nextVMThread()) {
 		if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
@@ -459,6 +459,7 @@ public:
     virtual void scanMonitorReferences(MM_EnvironmentBase *env);
     virtual CompletePhaseCode scanMonitorReferencesComplete(MM_EnvironmentBase *env);
 	virtual void scanMonitorLookupCaches(MM_EnvironmentBase *env);
+	void scanSharedMonitorLookupCache(MM_EnvironmentBase *env);
 
 #if defined(J9VM_OPT_JVMTI)
 	void scanJVMTIObjectTagTables(MM_EnvironmentBase *env);
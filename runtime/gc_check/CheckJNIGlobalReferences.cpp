@@ -61,7 +61,7 @@ void
 GC_CheckJNIGlobalReferences::print()
 {
 	J9Pool *pool = _javaVM->jniGlobalReferences;
-	GC_PoolIterator poolReferenceIterator(pool);
+	GC_JNIGlobalReferenceIterator poolReferenceIterator(pool);
 	J9Object **slotPtr;
 
 	GC_ScanFormatter formatter(_portLibrary, "jniGlobalReferences", (void *) pool);
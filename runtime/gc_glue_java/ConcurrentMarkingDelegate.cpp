@@ -29,6 +29,7 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
+#include "JNIGlobalReferenceIterator.hpp"
 #include "ReferenceObjectList.hpp"
 #include "StackSlotValidator.hpp"
 #include "VMAccess.hpp"
@@ -150,7 +151,7 @@ MM_ConcurrentMarkingDelegate::collectJNIRoots(MM_EnvironmentBase *env, bool *com
 	Assert_GC_true_with_message(env, ((J9VMThread *)env->getLanguageVMThread())->privateFlags & J9_PRIVATE_FLAGS_CONCURRENT_MARK_ACTIVE, "MM_ConcurrentStats::_executionMode = %zu\n", _collector->getConcurrentGCStats()->getExecutionMode());
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
 	GC_VMInterface::lockJNIGlobalReferences(extensions);
-	GC_PoolIterator jniGlobalReferenceIterator(_javaVM->jniGlobalReferences);
+	GC_JNIGlobalReferenceIterator jniGlobalReferenceIterator(_javaVM->jniGlobalReferences);
 	omrobjectptr_t *slotPtr;
 	uintptr_t slotNum = 0;
 	while((slotPtr = (omrobjectptr_t *)jniGlobalReferenceIterator.nextSlot()) != NULL) {
@@ -100,6 +100,7 @@ typedef enum {
 	j9gc_modron_configuration_heapRegionStateTable, /* a pointer to the base of the region state table */
 	j9gc_modron_configuration_gcConcurrentThreadCount,  /* a UDATA representing the MAX number of GC threads being used during concurrent GC operations */
 	j9gc_modron_configuration_gcUsesDynamicThreads, /* a UDATA (TRUE or FALSE) representing whether or not dynamic number of GC threads is using */
+	j9gc_modron_configuration_tlhRefreshCount, /* a UDATA representing the number of TLH refreshes since the previous GC; only valid at the start of a GC */
 	/* Add new values before this comment */
 	j9gc_modron_configuration_count /* Total number of known configuration keys */
 } J9GCConfigurationKey;
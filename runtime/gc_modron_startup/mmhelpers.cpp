@@ -462,6 +462,14 @@ j9gc_modron_getConfigurationValueForKey(J9JavaVM *javaVM, UDATA key, void *value
 		keyFound = TRUE;
 		break;
 
+	case j9gc_modron_configuration_tlhRefreshCount:
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+		/* the per-thread allocation stats are merged when the caches are flushed for the GC */
+		*((UDATA *)value) = extensions->allocationStats._tlhRefreshCountFresh + extensions->allocationStats._tlhRefreshCountReused;
+		keyFound = TRUE;
+#endif /* defined(J9VM_GC_THREAD_LOCAL_HEAP) */
+		break;
+
 	default:
 		/* key is either invalid or unknown for this configuration - should not have been requested */
 		Assert_MM_unreachable();
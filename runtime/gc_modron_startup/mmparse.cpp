@@ -1522,6 +1522,18 @@ gcParseXXArguments(J9JavaVM *vm)
 			}
 		}
 	}
+	{
+		IDATA stringDeduplicationIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:+StringDeduplication", NULL);
+		IDATA noStringDeduplicationIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:-StringDeduplication", NULL);
+		if (stringDeduplicationIndex != noStringDeduplicationIndex) {
+			/* At least one option is set. Find the right most one. */
+			if (stringDeduplicationIndex > noStringDeduplicationIndex) {
+				extensions->stringDeduplication = true;
+			} else {
+				extensions->stringDeduplication = false;
+			}
+		}
+	}
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 	{
 		IDATA index = -1;
@@ -307,6 +307,24 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		/* parse the minimum region age of Strings considered by -XX:+StringDeduplication */
+		if (try_scan(&scan_start, "stringDeduplicationAgeThreshold=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->stringDeduplicationAgeThreshold), "stringDeduplicationAgeThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		/* parse the balanced PGC pause time goal, in milliseconds (0 disables the goal) */
+		if (try_scan(&scan_start, "tarokPauseTimeGoal=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->tarokPauseTimeGoal), "tarokPauseTimeGoal=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
 		if (try_scan(&scan_start, "tarokKickoffHeadroomRegionRate=")) {
 			if(!scan_u32_helper(vm, &scan_start, &(extensions->tarokKickoffHeadroomRegionRate), "tarokKickoffHeadroomRegionRate=")) {
 				returnValue = JNI_EINVAL;
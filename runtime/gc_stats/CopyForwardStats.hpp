@@ -67,6 +67,10 @@ public:
 	uintptr_t _monitorReferenceCleared; /**< The number of monitor references that have been cleared during marking */
 	uintptr_t _monitorReferenceCandidates; /**< The number of monitor references that have been visited in monitor table during marking */
 
+	uintptr_t _stringDedupCandidates; /**< The number of Strings whose value array was looked up in the deduplication table */
+	uintptr_t _stringDedupDeduplicated; /**< The number of Strings whose value was redirected to an equal array */
+	uintptr_t _stringDedupBytesSaved; /**< The size of the value arrays made unreachable by deduplication */
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 	uintptr_t _offHeapRegionsCleared; /**< The number of sparse heap allocated regions that have been cleared during marking */
 	uintptr_t _offHeapRegionCandidates; /**< The number of sparse heap allocated regions that have been visited during marking */
@@ -101,6 +105,10 @@ public:
 		_monitorReferenceCleared = 0;
 		_monitorReferenceCandidates = 0;
 
+		_stringDedupCandidates = 0;
+		_stringDedupDeduplicated = 0;
+		_stringDedupBytesSaved = 0;
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		_offHeapRegionsCleared = 0;
 		_offHeapRegionCandidates = 0;
@@ -129,6 +137,10 @@ public:
 		_monitorReferenceCleared += stats->_monitorReferenceCleared;
 		_monitorReferenceCandidates += stats->_monitorReferenceCandidates;
 
+		_stringDedupCandidates += stats->_stringDedupCandidates;
+		_stringDedupDeduplicated += stats->_stringDedupDeduplicated;
+		_stringDedupBytesSaved += stats->_stringDedupBytesSaved;
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		_offHeapRegionsCleared += stats->_offHeapRegionsCleared;
 		_offHeapRegionCandidates += stats->_offHeapRegionCandidates;
@@ -148,6 +160,9 @@ public:
 		, _stringConstantsCandidates(0)
 		, _monitorReferenceCleared(0)
 		, _monitorReferenceCandidates(0)
+		, _stringDedupCandidates(0)
+		, _stringDedupDeduplicated(0)
+		, _stringDedupBytesSaved(0)
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		, _offHeapRegionsCleared(0)
 		, _offHeapRegionCandidates(0)
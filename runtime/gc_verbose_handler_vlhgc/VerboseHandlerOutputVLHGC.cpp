@@ -465,6 +465,11 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 	outputStringConstantInfo(env, 1, copyForwardStats->_stringConstantsCandidates, copyForwardStats->_stringConstantsCleared);
 	outputMonitorReferenceInfo(env, 1, copyForwardStats->_monitorReferenceCandidates, copyForwardStats->_monitorReferenceCleared);
 
+	if (extensions->stringDeduplication) {
+		writer->formatAndOutput(env, 1, "<string-deduplication candidates=\"%zu\" deduplicated=\"%zu\" bytessaved=\"%zu\" />",
+				copyForwardStats->_stringDedupCandidates, copyForwardStats->_stringDedupDeduplicated, copyForwardStats->_stringDedupBytesSaved);
+	}
+
 	if(0 != copyForwardStats->_heapExpandedCount) {
 		U_64 expansionMicros = j9time_hires_delta(0, copyForwardStats->_heapExpandedTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
 		outputCollectorHeapResizeInfo(env, 1, HEAP_EXPAND, copyForwardStats->_heapExpandedBytes, copyForwardStats->_heapExpandedCount, MEMORY_TYPE_OLD, SATISFY_COLLECTOR, expansionMicros);
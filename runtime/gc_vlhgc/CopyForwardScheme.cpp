@@ -104,6 +104,7 @@
 #include "SparseAddressOrderedFixedSizeDataPool.hpp"
 #endif /* defined(J9VM_GC_SPARSE_HEAP_ALLOCATION) */
 #include "StackSlotValidator.hpp"
+#include "StringDeduplicationTable.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -197,6 +198,8 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
 	, _compressedSurvivorTable(NULL)
 	, _regionShouldMark(NULL)
+	, _stringDeduplicationTable(NULL)
+	, _stringDeduplicationClass(NULL)
 {
 	_typeId = __FUNCTION__;
 }
@@ -344,6 +347,14 @@ MM_CopyForwardScheme::initialize(MM_EnvironmentVLHGC *env)
 	}
 	memset(_regionShouldMark, 0, _regionManager->getTableRegionCount() * sizeof(bool));
 
+	if (_extensions->stringDeduplication) {
+		/* up to 64K candidate Strings per cycle, looked up in a table of 128K entries */
+		_stringDeduplicationTable = MM_StringDeduplicationTable::newInstance(env, 64 * 1024, 17);
+		if (NULL == _stringDeduplicationTable) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -395,6 +406,11 @@ MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC *env)
 		env->getForge()->free(_regionShouldMark);
 		_regionShouldMark = NULL;
 	}
+
+	if (NULL != _stringDeduplicationTable) {
+		_stringDeduplicationTable->kill(env);
+		_stringDeduplicationTable = NULL;
+	}
 }
 
 MM_AllocationContextTarok *
@@ -1445,6 +1461,15 @@ MM_CopyForwardScheme::mainSetupForCopyForward(MM_EnvironmentVLHGC *env)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	_collectStringConstantsEnabled = _extensions->collectStringConstants;
 
+	/* Strings are not deduplicated while a GMP is in progress, since redirecting a value slot to an array
+	 * the GMP has not marked could hide that array from it
+	 */
+	_stringDeduplicationClass = NULL;
+	if ((NULL != _stringDeduplicationTable) && (NULL == env->_cycleState->_externalCycleState)) {
+		_stringDeduplicationClass = J9VMJAVALANGSTRING_OR_NULL(_javaVM);
+		_stringDeduplicationTable->reset(env);
+	}
+
 	/* ensure heap base is aligned to region size */
 	uintptr_t heapBase = (uintptr_t)_extensions->heap->getHeapBase();
 	uintptr_t regionSize = _regionManager->getRegionSize();
@@ -2451,10 +2476,57 @@ MM_CopyForwardScheme::scanMixedObjectSlots(MM_EnvironmentVLHGC *env, MM_Allocati
 		success = iterateAndCopyforwardSlotReference(env, reservingContext, objectPtr);
 	}
 
+	if (success && (NULL != _stringDeduplicationClass) && (J9GC_J9OBJECT_CLAZZ(objectPtr, env) == _stringDeduplicationClass)) {
+		addStringDeduplicationCandidate(env, objectPtr);
+	}
+
 	updateScanStats(env, objectPtr, reason);
 	return success;
 }
 
+MMINLINE void
+MM_CopyForwardScheme::addStringDeduplicationCandidate(MM_EnvironmentVLHGC *env, J9Object *objectPtr)
+{
+	/* only Strings copied in this cycle are considered, so that each of them is recorded once */
+	if (isObjectInSurvivorMemory(objectPtr)) {
+		MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(objectPtr);
+		if (region->getAge() >= _extensions->stringDeduplicationAgeThreshold) {
+			_stringDeduplicationTable->addCandidate(env, objectPtr);
+		}
+	}
+}
+
+void
+MM_CopyForwardScheme::deduplicateStrings(MM_EnvironmentVLHGC *env)
+{
+	GC_ArrayObjectModel *indexableObjectModel = &_extensions->indexableObjectModel;
+	MM_CopyForwardStats *copyForwardStats = &env->_copyForwardStats;
+	uintptr_t candidateCount = _stringDeduplicationTable->getCandidateCount();
+	const uintptr_t candidatesPerWorkUnit = 256;
+
+	for (uintptr_t start = 0; start < candidateCount; start += candidatesPerWorkUnit) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t end = OMR_MIN(start + candidatesPerWorkUnit, candidateCount);
+			for (uintptr_t index = start; index < end; index++) {
+				J9Object *stringObject = _stringDeduplicationTable->getCandidate(index);
+				GC_SlotObject valueSlot(_javaVM->omrVM, J9GC_J9VMJAVALANGSTRING_VALUE_ADDRESS(env, stringObject));
+				J9IndexableObject *value = (J9IndexableObject *)valueSlot.readReferenceFromSlot();
+				/* Arrays copied in this cycle cannot be held in a JNI critical section, and are never discontiguous or off-heap */
+				if ((NULL != value) && isObjectInSurvivorMemory((J9Object *)value) && indexableObjectModel->isInlineContiguousArraylet(value)) {
+					copyForwardStats->_stringDedupCandidates += 1;
+					J9IndexableObject *canonical = _stringDeduplicationTable->findOrInsert(env, value);
+					if ((NULL != canonical) && (canonical != value)) {
+						valueSlot.writeReferenceToSlot((J9Object *)canonical);
+						_interRegionRememberedSet->rememberReferenceForCopyForward(env, stringObject, (J9Object *)canonical);
+						copyForwardStats->_stringDedupDeduplicated += 1;
+						copyForwardStats->_stringDedupBytesSaved += indexableObjectModel->getSizeInBytesWithHeader(value);
+					}
+				}
+			}
+		}
+	}
+}
+
 void
 MM_CopyForwardScheme::scanReferenceObjectSlots(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, ScanReason reason)
 {
@@ -4384,6 +4456,11 @@ MM_CopyForwardScheme::workThreadGarbageCollect(MM_EnvironmentVLHGC *env)
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
+	/* all objects have been copied (and all threads synchronized) so the value arrays can be compared */
+	if ((NULL != _stringDeduplicationClass) && !abortFlagRaised()) {
+		deduplicateStrings(env);
+	}
+
 	if (!abortFlagRaised()) {
 		clearCardTableForPartialCollect(env);
 	}
@@ -57,6 +57,7 @@ class MM_InterRegionRememberedSet;
 class MM_MarkMap;
 class MM_MemoryPoolAddressOrderedList;
 class MM_ReferenceStats;
+class MM_StringDeduplicationTable;
 /* Forward declaration of classes defined within the cpp */
 class MM_CopyForwardSchemeAbortScanner;
 class MM_CopyForwardSchemeRootScanner;
@@ -165,6 +166,9 @@ private:
 
 	bool *_regionShouldMark;	/**< Array of region _shouldMark values to improve access time by caching */
 
+	MM_StringDeduplicationTable *_stringDeduplicationTable;	/**< Candidates and canonical value arrays for String deduplication (NULL unless -XX:+StringDeduplication) */
+	J9Class *_stringDeduplicationClass;	/**< The String class if Strings are deduplicated in the current cycle, NULL otherwise */
+
 protected:
 public:
 private:
@@ -310,6 +314,20 @@ private:
 	 * @return true if all slots have been copied successfully
 	 */
 	bool scanMixedObjectSlots(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, ScanReason reason);
+
+	/**
+	 * Record a scanned String as a deduplication candidate if it was copied into a region old enough.
+	 * @param env current GC thread.
+	 * @param objectPtr String whose slots have been copied and forwarded
+	 */
+	MMINLINE void addStringDeduplicationCandidate(MM_EnvironmentVLHGC *env, J9Object *objectPtr);
+
+	/**
+	 * Redirect the value of each String deduplication candidate to the first equal array found in this cycle.
+	 * Must be called once all objects have been copied, since the contents of the arrays are compared.
+	 * @param env current GC thread.
+	 */
+	void deduplicateStrings(MM_EnvironmentVLHGC *env);
 	/**
 	 * Scan the slots of a reference mixed object.
 	 * Copy and forward all relevant slots values found in the object.
@@ -37,6 +37,7 @@
 #include "CompactGroupManager.hpp"
 #include "CompactGroupPersistentStats.hpp"
 #include "CycleState.hpp"
+#include "CycleStateVLHGC.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "GlobalAllocationManagerTarok.hpp"
 #include "MemorySubSpace.hpp"
@@ -48,6 +49,7 @@
 #include "MarkMap.hpp"
 #include "MemoryPool.hpp"
 #include "RegionValidator.hpp"
+#include "SchedulingDelegate.hpp"
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 #include "AllocationContextBalanced.hpp"
 #include "SparseVirtualMemory.hpp"
@@ -61,6 +63,7 @@ MM_ProjectedSurvivalCollectionSetDelegate::MM_ProjectedSurvivalCollectionSetDele
 	, _setSelectionDataTable(NULL)
 	, _dynamicSelectionList(NULL)
 	, _dynamicSelectionRegionList(NULL)
+	, _copyBudgetRemaining(UDATA_MAX)
 {
 	_typeId = __FUNCTION__;
 }
@@ -224,6 +227,10 @@ MM_ProjectedSurvivalCollectionSetDelegate::selectRegion(MM_EnvironmentVLHGC *env
 
 	_extensions->compactGroupPersistentStats[compactGroup]._regionsInRegionCollectionSetForPGC += 1;
 
+	if (UDATA_MAX != _copyBudgetRemaining) {
+		_copyBudgetRemaining -= OMR_MIN(_copyBudgetRemaining, region->_projectedLiveBytes);
+	}
+
 	Trc_MM_CollectionSetDelegate_selectRegionsForBudget(env->getLanguageVMThread(), tableIndex, compactGroup, (100 * freeMemory)/regionSize, (100 * projectedFreeMemoryAfterGC)/regionSize, (100 * projectedReclaimableBytes)/regionSize);
 }
 
@@ -240,7 +247,7 @@ MM_ProjectedSurvivalCollectionSetDelegate::selectRegionsForBudget(MM_Environment
 	MM_HeapRegionDescriptorVLHGC *regionSelectionPtr = setSelectionData->_regionList;
 	while((0 != ageGroupBudgetRemaining) && (NULL != regionSelectionPtr)) {
 		regionSelectionIndex += regionSelectionIncrement;
-		if (regionSelectionIndex >= regionSelectionThreshold) {
+		if ((regionSelectionIndex >= regionSelectionThreshold) && fitsCopyBudget(regionSelectionPtr)) {
 			/* The region is to be selected as part of the dynamic set */
 			selectRegion(env, regionSelectionPtr);
 			ageGroupBudgetRemaining -= 1;
@@ -305,9 +312,12 @@ MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(MM_En
 		double projectedReclaimableBytesFraction = (double)projectedReclaimableBytes / (double)regionSize;
 
 		if (projectedReclaimableBytesFraction > _extensions->tarokCopyForwardFragmentationTarget) {
-			selectRegion(env, region);
-			_setSelectionDataTable[compactGroup]._dynamicSelectionThisCycle = true;
-			regionBudget -= 1;
+			/* A region that would exceed the pause time goal is skipped, but a later one with fewer live bytes may still fit */
+			if (fitsCopyBudget(region)) {
+				selectRegion(env, region);
+				_setSelectionDataTable[compactGroup]._dynamicSelectionThisCycle = true;
+				regionBudget -= 1;
+			}
 		} else {
 			/* Since _dynamicSelectionRegionList is sorted by projectedReclaimableBytes, they'll be no more regions to select so break */
 			break;
@@ -410,6 +420,14 @@ MM_ProjectedSurvivalCollectionSetDelegate::createRegionCollectionSetForPartialGC
 
 	bool dynamicCollectionSet = _extensions->tarokEnableDynamicCollectionSetSelection;
 
+	/* With a pause time goal, the projected live bytes of every selected region are charged against what copy-forward can
+	 * evacuate within the goal. The nursery is always collected; non-nursery regions which do not fit are left for later PGCs.
+	 */
+	_copyBudgetRemaining = UDATA_MAX;
+	if (env->_cycleState->_shouldRunCopyForward) {
+		_copyBudgetRemaining = static_cast<MM_CycleStateVLHGC *>(env->_cycleState)->_schedulingDelegate->getPauseTimeGoalCopyBudget(env);
+	}
+
 	/* If dynamic collection sets are enabled, reset all related data structures that are used for selection */
 	if (dynamicCollectionSet) {
 		MM_CompactGroupPersistentStats *persistentStats = _extensions->compactGroupPersistentStats;
@@ -132,6 +132,8 @@ private:
 
 	MM_HeapRegionDescriptorVLHGC **_dynamicSelectionRegionList;  /**< Pointer table used for sorting or iterating over regions */
 
+	UDATA _copyBudgetRemaining;  /**< Projected live bytes that can still be added to the collection set within the pause time goal (UDATA_MAX if there is no goal) */
+
 protected:
 public:
 
@@ -153,6 +155,17 @@ private:
 	 */
 	void selectRegion(MM_EnvironmentVLHGC *env, MM_HeapRegionDescriptorVLHGC *region);
 
+	/**
+	 * Determine if a region can be added to the collection set without exceeding the copy budget of the pause time goal.
+	 * Only optional (non-nursery) regions are subject to the budget.
+	 * @param region[in] The candidate region
+	 * @return true if the projected live bytes of the region fit in the remaining copy budget
+	 */
+	bool fitsCopyBudget(MM_HeapRegionDescriptorVLHGC *region)
+	{
+		return (UDATA_MAX == _copyBudgetRemaining) || (region->_projectedLiveBytes <= _copyBudgetRemaining);
+	}
+
 	/**
 	 * Support routine to select a number of regions based on a budget to include in the collection set.
 	 * Given a set selection age group and a budget, use an form of counting to select the budgeted number of regions available in the age group.
@@ -73,6 +73,7 @@ const uintptr_t minimumEdenRegionChangeHeapNotFullyExpanded = 2;
 const uintptr_t maximumEdenRegionChangeHeapNotFullyExpanded = 10;
 const uintptr_t minimumPgcTime = 5;
 const uintptr_t consecutivePGCToChangeEden = 16;
+const double pauseTimeGoalEdenBudgetRatio = 0.8;
 
 MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager)
 	: MM_BaseNonVirtual()
@@ -1660,6 +1661,19 @@ MM_SchedulingDelegate::adjustIdealEdenRegionCount(MM_EnvironmentVLHGC *env)
 		edenChange = (intptr_t)_maxEdenRegionCount - (intptr_t)_idealEdenRegionCount;
 	}
 
+	if (0 != _extensions->tarokPauseTimeGoal) {
+		uintptr_t copyBudget = getPauseTimeGoalCopyBudget(env);
+		double survivorBytesPerEdenRegion = _edenSurvivalRateCopyForward * (double)_regionManager->getRegionSize();
+		if ((UDATA_MAX != copyBudget) && (0.0 < survivorBytesPerEdenRegion)) {
+			/* Leave part of the budget for non-eden regions, so that PGCs can keep defragmenting. -Xmns still takes precedence over the goal */
+			uintptr_t edenRegionCountForGoal = (uintptr_t)(((double)copyBudget * pauseTimeGoalEdenBudgetRatio) / survivorBytesPerEdenRegion);
+			edenRegionCountForGoal = OMR_MAX(edenRegionCountForGoal, _minEdenRegionCount);
+			if ((intptr_t)edenRegionCountForGoal < ((intptr_t)_idealEdenRegionCount + edenChange)) {
+				edenChange = (intptr_t)edenRegionCountForGoal - (intptr_t)_idealEdenRegionCount;
+			}
+		}
+	}
+
 	Trc_MM_SchedulingDelegate_adjustIdealEdenRegionCount(env->getLanguageVMThread(), _minEdenRegionCount, _maxEdenRegionCount, _idealEdenRegionCount, edenChange);
 
 	/* Inform the _idealEdenRegionCount that we need to change from current value. If there are not enough free regions, then eden will only as big as the amount of free regions */
@@ -1670,6 +1684,22 @@ MM_SchedulingDelegate::adjustIdealEdenRegionCount(MM_EnvironmentVLHGC *env)
 	_minimumEdenRegionCount = OMR_MIN(_minimumEdenRegionCount, _idealEdenRegionCount);
 }
 
+uintptr_t
+MM_SchedulingDelegate::getPauseTimeGoalCopyBudget(MM_EnvironmentVLHGC *env)
+{
+	uintptr_t copyBudget = UDATA_MAX;
+
+	if ((0 != _extensions->tarokPauseTimeGoal) && (0.0 < _averageCopyForwardBytesCopied)) {
+		double pauseTimeGoalUs = (double)_extensions->tarokPauseTimeGoal * 1000.0;
+		double copyTimeUs = _averageCopyForwardBytesCopied / _averageCopyForwardRate;
+		double fixedPgcTimeUs = OMR_MAX(0.0, ((double)_historicalPartialGCTime * 1000.0) - copyTimeUs);
+		double copyTimeBudgetUs = OMR_MAX(0.0, pauseTimeGoalUs - fixedPgcTimeUs);
+		copyBudget = (uintptr_t)(copyTimeBudgetUs * _averageCopyForwardRate);
+	}
+
+	return copyBudget;
+}
+
 uintptr_t
 MM_SchedulingDelegate::currentGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC *env) const
 {
@@ -334,6 +334,7 @@ private:
 	 * Modify the _idealEdenRegionCount count based on _edenSizeFactor. If _edenSizeFactor is postive, we increase eden.
 	 * If _edenSizeFactor is negative, we shrink eden.
 	 * Eden will be bounded by _maxEdenPercent and _minEdenPercent, or by any -Xmn/s/x options if provided
+	 * If a pause time goal is set, eden is also bounded by the number of regions copy-forward can evacuate within the goal
 	 * @param env[in] the main GC thread
 	 */
 	void adjustIdealEdenRegionCount(MM_EnvironmentVLHGC *env);
@@ -451,6 +452,15 @@ public:
 	 */
 	double getAverageCopyForwardRate() { return _averageCopyForwardRate; }
 
+	/**
+	 * Calculate how many bytes a copy-forward PGC can evacuate while staying within -Xgc:tarokPauseTimeGoal.
+	 * The part of the PGC time which does not depend on the amount of copying (roots, remembered set, clearing) is estimated from
+	 * the historical PGC time and copy-forward rate, and is deducted from the goal first.
+	 * @param env[in] the main GC thread
+	 * @return The copy budget in bytes, or UDATA_MAX if no pause time goal is set or no copy-forward has been measured yet
+	 */
+	uintptr_t getPauseTimeGoalCopyBudget(MM_EnvironmentVLHGC *env);
+
 	/*
 	 * Returns the scan time cost (in microseconds) we attribute to performing a GMP.  Attempts to
 	 * factor in stop-the-world global mark increment time as well as any concurrent global marking which
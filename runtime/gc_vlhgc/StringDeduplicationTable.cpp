@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup gc_vlhgc
+ */
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "ModronAssertions.h"
+
+#include <string.h>
+
+#include "StringDeduplicationTable.hpp"
+
+#include "EnvironmentVLHGC.hpp"
+#include "GCExtensions.hpp"
+
+MM_StringDeduplicationTable::MM_StringDeduplicationTable(MM_EnvironmentVLHGC *env)
+	: MM_BaseNonVirtual()
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _candidates(NULL)
+	, _candidateCount(0)
+	, _candidatesSize(0)
+	, _entries(NULL)
+	, _entriesMask(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_StringDeduplicationTable *
+MM_StringDeduplicationTable::newInstance(MM_EnvironmentVLHGC *env, uintptr_t candidatesSize, uintptr_t entriesLog2)
+{
+	MM_StringDeduplicationTable *table = (MM_StringDeduplicationTable *)env->getForge()->allocate(sizeof(MM_StringDeduplicationTable), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != table) {
+		new(table) MM_StringDeduplicationTable(env);
+		if (!table->initialize(env, candidatesSize, entriesLog2)) {
+			table->kill(env);
+			table = NULL;
+		}
+	}
+	return table;
+}
+
+bool
+MM_StringDeduplicationTable::initialize(MM_EnvironmentVLHGC *env, uintptr_t candidatesSize, uintptr_t entriesLog2)
+{
+	_candidates = (J9Object **)env->getForge()->allocate(candidatesSize * sizeof(J9Object *), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _candidates) {
+		return false;
+	}
+	_candidatesSize = candidatesSize;
+
+	uintptr_t entryCount = (uintptr_t)1 << entriesLog2;
+	_entries = (volatile uintptr_t *)env->getForge()->allocate(entryCount * sizeof(uintptr_t), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _entries) {
+		return false;
+	}
+	_entriesMask = entryCount - 1;
+
+	reset(env);
+	return true;
+}
+
+void
+MM_StringDeduplicationTable::kill(MM_EnvironmentVLHGC *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_StringDeduplicationTable::tearDown(MM_EnvironmentVLHGC *env)
+{
+	if (NULL != _candidates) {
+		env->getForge()->free(_candidates);
+		_candidates = NULL;
+	}
+	if (NULL != _entries) {
+		env->getForge()->free((void *)_entries);
+		_entries = NULL;
+	}
+}
+
+void
+MM_StringDeduplicationTable::reset(MM_EnvironmentVLHGC *env)
+{
+	_candidateCount = 0;
+	memset((void *)_entries, 0, (_entriesMask + 1) * sizeof(uintptr_t));
+}
+
+uintptr_t
+MM_StringDeduplicationTable::hash(J9IndexableObject *array)
+{
+	GC_ArrayObjectModel *indexableObjectModel = &_extensions->indexableObjectModel;
+	uintptr_t sizeInBytes = indexableObjectModel->getDataSizeInBytes(array);
+	uint8_t *data = (uint8_t *)indexableObjectModel->getDataPointerForContiguous(array);
+
+	/* FNV-1a over the contents, seeded with the length */
+	uint32_t result = 2166136261U ^ (uint32_t)sizeInBytes;
+	for (uintptr_t i = 0; i < sizeInBytes; i++) {
+		result = (result ^ data[i]) * 16777619U;
+	}
+	return (uintptr_t)result;
+}
+
+bool
+MM_StringDeduplicationTable::isEqual(J9IndexableObject *array, J9IndexableObject *other)
+{
+	GC_ArrayObjectModel *indexableObjectModel = &_extensions->indexableObjectModel;
+	bool result = false;
+	if ((J9GC_J9OBJECT_CLAZZ(array, _extensions) == J9GC_J9OBJECT_CLAZZ(other, _extensions))
+		&& (indexableObjectModel->getSizeInElements(array) == indexableObjectModel->getSizeInElements(other))
+	) {
+		result = (0 == memcmp(
+				indexableObjectModel->getDataPointerForContiguous(array),
+				indexableObjectModel->getDataPointerForContiguous(other),
+				indexableObjectModel->getDataSizeInBytes(array)));
+	}
+	return result;
+}
+
+J9IndexableObject *
+MM_StringDeduplicationTable::findOrInsert(MM_EnvironmentVLHGC *env, J9IndexableObject *array)
+{
+	J9IndexableObject *result = NULL;
+	uintptr_t index = hash(array) & _entriesMask;
+
+	for (uintptr_t probe = 0; (NULL == result) && (probe < MAX_PROBES); probe++) {
+		uintptr_t entry = _entries[index];
+		if (0 == entry) {
+			/* if another thread takes this entry first, it may have inserted an equal array */
+			entry = MM_AtomicOperations::lockCompareExchange(&_entries[index], 0, (uintptr_t)array);
+		}
+		if (0 == entry) {
+			/* array is now the canonical array for its contents */
+			result = array;
+		} else if ((entry == (uintptr_t)array) || isEqual(array, (J9IndexableObject *)entry)) {
+			result = (J9IndexableObject *)entry;
+		} else {
+			index = (index + 1) & _entriesMask;
+		}
+	}
+	return result;
+}
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup gc_vlhgc
+ */
+
+#if !defined(STRINGDEDUPLICATIONTABLE_HPP_)
+#define STRINGDEDUPLICATIONTABLE_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentVLHGC;
+class MM_GCExtensions;
+
+/**
+ * Storage used by copy-forward to deduplicate the value arrays of Strings (-XX:+StringDeduplication).
+ * While objects are copied, the String objects eligible for deduplication are recorded as candidates.
+ * Once copying is complete, the value arrays of the candidates are looked up by contents in a fixed
+ * size open addressing table, the first array seen with given contents becoming the canonical one.
+ * Both structures only hold addresses valid for the current cycle and are reset before each copy-forward.
+ */
+class MM_StringDeduplicationTable : public MM_BaseNonVirtual
+{
+public:
+protected:
+private:
+	MM_GCExtensions *_extensions; /**< Cached pointer to the extensions */
+	J9Object **_candidates; /**< Strings recorded during the current copy-forward */
+	volatile uintptr_t _candidateCount; /**< Number of candidates reserved (may exceed _candidatesSize) */
+	uintptr_t _candidatesSize; /**< Capacity of _candidates */
+	volatile uintptr_t *_entries; /**< Canonical value arrays, indexed by the hash of their contents (0 for an empty entry) */
+	uintptr_t _entriesMask; /**< Number of entries - 1 (the number of entries is a power of 2) */
+
+	enum {
+		MAX_PROBES = 16 /**< Entries examined before a lookup gives up on an array */
+	};
+
+public:
+	/**
+	 * Create new instance of class
+	 * @param env current thread environment
+	 * @param candidatesSize maximum number of Strings considered in one copy-forward
+	 * @param entriesLog2 log2 of the number of entries of the table
+	 */
+	static MM_StringDeduplicationTable *newInstance(MM_EnvironmentVLHGC *env, uintptr_t candidatesSize, uintptr_t entriesLog2);
+
+	/**
+	 * General class kill
+	 * @param env current thread environment
+	 */
+	void kill(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Forget the candidates and the canonical arrays of the previous cycle. Must be called single threaded.
+	 * @param env current thread environment
+	 */
+	void reset(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Record a String to be deduplicated once copying is complete. Safe to call from parallel GC threads.
+	 * @param env current thread environment
+	 * @param stringObject String in its final location for this cycle
+	 * @return false if the candidate list is full and the String was dropped
+	 */
+	MMINLINE bool addCandidate(MM_EnvironmentVLHGC *env, J9Object *stringObject)
+	{
+		bool added = false;
+		if (_candidateCount < _candidatesSize) {
+			uintptr_t index = MM_AtomicOperations::add(&_candidateCount, 1) - 1;
+			if (index < _candidatesSize) {
+				_candidates[index] = stringObject;
+				added = true;
+			}
+		}
+		return added;
+	}
+
+	/**
+	 * @return the number of candidates recorded in the current cycle
+	 */
+	MMINLINE uintptr_t getCandidateCount()
+	{
+		return OMR_MIN(_candidateCount, _candidatesSize);
+	}
+
+	/**
+	 * @param index index of the candidate, less than getCandidateCount()
+	 * @return the candidate String
+	 */
+	MMINLINE J9Object *getCandidate(uintptr_t index)
+	{
+		return _candidates[index];
+	}
+
+	/**
+	 * Find an array with the same class, length and contents as the given one, or make the given
+	 * array the canonical one for its contents. Safe to call from parallel GC threads, provided
+	 * no array passed in is being copied or modified.
+	 * @param env current thread environment
+	 * @param array a contiguous primitive array
+	 * @return the canonical array equal to array (which may be array itself), or NULL if the table is too full to tell
+	 */
+	J9IndexableObject *findOrInsert(MM_EnvironmentVLHGC *env, J9IndexableObject *array);
+
+protected:
+	/**
+	 * General class initialization
+	 * @param env current thread environment
+	 * @param candidatesSize maximum number of Strings considered in one copy-forward
+	 * @param entriesLog2 log2 of the number of entries of the table
+	 */
+	bool initialize(MM_EnvironmentVLHGC *env, uintptr_t candidatesSize, uintptr_t entriesLog2);
+
+	/**
+	 * General class tear down
+	 * @param env current thread environment
+	 */
+	void tearDown(MM_EnvironmentVLHGC *env);
+
+	MM_StringDeduplicationTable(MM_EnvironmentVLHGC *env);
+
+private:
+	/**
+	 * Hash the class, length and contents of an array
+	 * @param array a contiguous array
+	 * @return the hash value
+	 */
+	uintptr_t hash(J9IndexableObject *array);
+
+	/**
+	 * @return true if the two arrays have the same class, length and contents
+	 */
+	bool isEqual(J9IndexableObject *array, J9IndexableObject *other);
+};
+
+#endif /* STRINGDEDUPLICATIONTABLE_HPP_ */
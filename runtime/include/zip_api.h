@@ -145,6 +145,16 @@ J9ZipCachePool *zipCachePool_new(J9PortLibrary * portLib, void * userData);
 */
 BOOLEAN zipCachePool_release(J9ZipCachePool *zcp, J9ZipCache *zipCache);
 
+
+/**
+* @brief Sets whether zip files opened with a cache from the pool are read through a read-only mapping.
+* Only zip files the VM opens itself (e.g. -Xbootclasspath/a jars) use the pool; application classpath jars do not.
+* @param *zcp
+* @param mapZipFiles
+* @return void
+*/
+void zipCachePool_setMapZipFiles(J9ZipCachePool *zcp, BOOLEAN mapZipFiles);
+
 /* ---------------- zipalloc.c ---------------- */
 
 #if (defined(J9VM_OPT_ZLIB_SUPPORT)) 
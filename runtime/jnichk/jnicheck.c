@@ -1252,6 +1252,10 @@ jniIsGlobalRef(JNIEnv* env, jobject reference)
 #endif
 	/* walk the JNIGlobalReferences pool */
 	rc = pool_includesElement(vm->jniGlobalReferences, reference);
+	if (rc && (NULL == *(j9object_t*)reference)) {
+		/* Strong global refs are never NULL: this is a deleted ref whose slot is cached for reuse */
+		rc = FALSE;
+	}
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
@@ -893,6 +893,34 @@ done:
 		return J9_ARE_NO_BITS_SET((UDATA)method->extra, J9_STARTPC_NOT_TRANSLATED);
 	}
 
+	/**
+	 * Find the address of a range of elements of a byte or char array, if the
+	 * elements are contiguous in memory, so that they can be processed in bulk.
+	 *
+	 * @param currentThread[in] the current J9VMThread
+	 * @param array[in] the byte or char array
+	 * @param index[in] the index of the first element
+	 * @param count[in] the number of elements, which must not be 0
+	 * @param logElementSize[in] 0 for a byte array, 1 for a char array
+	 *
+	 * @returns the address of the first element, or NULL if the range spans arraylet leaves
+	 */
+	static VMINLINE void *
+	contiguousStringDataRange(J9VMThread *currentThread, j9object_t array, UDATA index, UDATA count, UDATA logElementSize)
+	{
+		void *address = NULL;
+		UDATA arrayletLeafSizeInElements = currentThread->javaVM->arrayletLeafSize >> logElementSize;
+		UDATA lastIndex = index + count - 1;
+		if ((lastIndex ^ index) < arrayletLeafSizeInElements) {
+			if (0 == logElementSize) {
+				address = J9JAVAARRAY_EA(currentThread, array, index, U_8);
+			} else {
+				address = J9JAVAARRAY_EA(currentThread, array, index, U_16);
+			}
+		}
+		return address;
+	}
+
 	/**
 	 * Determine the number of UTF8 bytes required to encode a unicode character.
 	 *
@@ -105,6 +105,17 @@ extern "C" {
 #endif /* J9VM_ARCH_X86 */
 #endif /* J9VM_ENV_DATA64 */
 
+/* Default size above which the continuation caches release the stack of a recycled continuation.
+ * Most virtual threads grow past the default -Xiss, so releasing every grown stack would defeat the caches.
+ */
+#define J9_CONTINUATION_CACHE_MAX_STACK_SIZE (64 * 1024)
+
+/* Number of consecutive yields with most of its stack unused after which the stack of a continuation is compacted.
+ * The number doubles, up to the maximum, each time a compacted stack has to grow again.
+ */
+#define J9_CONTINUATION_COMPACT_IDLE_YIELDS 4
+#define J9_CONTINUATION_COMPACT_MAX_IDLE_YIELDS 256
+
 /* The maximum number of bytes allowed in the data portion of an array object. This value must be
  * small enough that adding the header size and any other non-arrayoid overhead (such as the alignment
  * value for keeping objects aligned) can not overflow a UDATA.
@@ -403,6 +414,9 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME3_USE_VECTOR_LENGTH_256 0x800
 #define J9_EXTENDED_RUNTIME3_USE_VECTOR_LENGTH_512 0x1000
 #define J9_EXTENDED_RUNTIME3_ENABLE_VT_FLATTENING  0x2000
+#define J9_EXTENDED_RUNTIME3_MAP_ZIP_FILES 0x4000
+#define J9_EXTENDED_RUNTIME3_JNI_GLOBAL_REF_CACHE 0x8000
+#define J9_EXTENDED_RUNTIME3_COMPACT_CONTINUATION_STACKS 0x10000
 
 
 #define J9_OBJECT_HEADER_AGE_DEFAULT 0xA /* OBJECT_HEADER_AGE_DEFAULT */
@@ -1025,6 +1039,11 @@ extern "C" {
 #define J9JFR_EVENT_TYPE_THREAD_DUMP 33
 #define J9JFR_EVENT_TYPE_THREAD_ALLOCATION_STATISTICS 34
 #define J9JFR_EVENT_TYPE_STACKTRACE 35
+#define J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE 36
+#define J9JFR_EVENT_TYPE_COMPILATION 37
+#define J9JFR_EVENT_TYPE_COMPILATION_FAILURE 38
+#define J9JFR_EVENT_TYPE_CODE_CACHE_FULL 39
+#define J9JFR_EVENT_TYPE_DEOPTIMIZATION 40
 
 /* JFR thread states. */
 
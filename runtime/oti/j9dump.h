@@ -38,6 +38,9 @@ typedef struct RasDumpGlobalStorage {
 	U_32 noFailover; /* If set, do not failover to /tmp etc if unable to write dump. */
 
 	U_32 dumpFlags; /* Flags to control java dump behaviour. */
+
+	omrthread_monitor_t spoolWritersMutex;
+	UDATA spoolWritersActive; /* Number of threads writing spooled heap dumps in the background. */
 } RasDumpGlobalStorage;
 
 /* Flags on how to handle resolving native stack symbols. */
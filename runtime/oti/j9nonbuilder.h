@@ -377,6 +377,7 @@ typedef struct J9ThreadJFRState {
 	omrthread_thread_time_t prevThreadCPUTimes;
 	int64_t prevTimestamp;
 	U_64 dataLostTotal;
+	UDATA lastAllocationSampleBytes;
 } J9ThreadJFRState;
 
 typedef struct J9JFRBufferWalkState {
@@ -480,6 +481,19 @@ typedef struct J9JFRMonitorEntered {
 
 #define J9JFRMONITORENTERED_STACKTRACE(jfrEvent) ((UDATA *)(((J9JFRMonitorEntered *)(jfrEvent)) + 1))
 
+/* Variable-size structure - stackTraceSize worth of UDATA follow the fixed portion */
+typedef struct J9JFRObjectAllocationSample {
+	J9JFR_EVENT_WITH_STACKTRACE_FIELDS
+	struct J9Class *objectClass;
+	UDATA allocationSize;
+	UDATA tlabSize; /* 0 if the object was allocated outside of a TLAB */
+	U_64 weight;
+	BOOLEAN recordSample;
+	BOOLEAN recordTLABEvent;
+} J9JFRObjectAllocationSample;
+
+#define J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(jfrEvent) ((UDATA *)(((J9JFRObjectAllocationSample *)(jfrEvent)) + 1))
+
 typedef struct J9JFRCPULoad {
 	J9JFR_EVENT_COMMON_FIELDS
 	float jvmUser;
@@ -601,6 +615,48 @@ typedef struct J9JFRPhysicalMemory {
 	U_64 usedSize;
 } J9JFRPhysicalMemory;
 
+typedef struct J9JFRCompilation {
+	J9JFR_EVENT_COMMON_FIELDS
+	I_64 duration;
+	struct J9Method *method;
+	U_32 compileID;
+	U_32 compileLevel;
+	U_32 codeSize;
+	U_32 inlinedBytes;
+	BOOLEAN succeeded;
+	BOOLEAN isOSR;
+	BOOLEAN isRemote; /* compiled by a JITServer */
+	BOOLEAN isAOTLoad; /* loaded from the shared class cache rather than compiled */
+} J9JFRCompilation;
+
+/* Variable-size structure - messageLength worth of U_8 follow the fixed portion */
+typedef struct J9JFRCompilationFailure {
+	J9JFR_EVENT_COMMON_FIELDS
+	U_32 compileID;
+	UDATA messageLength;
+} J9JFRCompilationFailure;
+
+#define J9JFRCOMPILATIONFAILURE_MESSAGE(jfrEvent) ((U_8 *)(((J9JFRCompilationFailure *)(jfrEvent)) + 1))
+
+typedef struct J9JFRCodeCacheFull {
+	J9JFR_EVENT_COMMON_FIELDS
+	U_64 startAddress;
+	U_64 commitedTopAddress;
+	U_64 reservedTopAddress;
+	U_64 unallocatedCapacity;
+	U_64 codeCacheMaxCapacity;
+	I_32 entryCount;
+	I_32 methodCount;
+	I_32 fullCount;
+} J9JFRCodeCacheFull;
+
+typedef struct J9JFRDeoptimization {
+	J9JFR_EVENT_COMMON_FIELDS
+	struct J9Method *method;
+	U_32 bytecodeIndex;
+	U_32 compileID; /* jdk.Compilation ID of the body being left, 0 if it was not recorded */
+} J9JFRDeoptimization;
+
 #endif /* defined(J9VM_OPT_JFR) */
 
 /* @ddr_namespace: map_to_type=J9CfrError */
@@ -932,6 +988,9 @@ typedef struct J9JITExceptionTable {
 	 * won't depend on configure options.
 	 */
 	J9ConstRefArrayPtrForJITMetadata constRefArrays;
+
+	/* ID of the jdk.Compilation event recorded for this body, or 0 if none was recorded. */
+	U_32 jfrCompileID;
 } J9JITExceptionTable;
 
 #define JIT_METADATA_FLAGS_USED_FOR_SIZE 0x1
@@ -1519,6 +1578,9 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA nattach;
 	UDATA currentOSPageSize; /* memory page size of the current running OS */
 	U_32 extraStartupHints;
+	UDATA startupROMClassBytes;
+	UDATA startupMinorFaults;
+	UDATA startupMajorFaults;
 } J9SharedClassJavacoreDataDescriptor;
 
 typedef struct J9SharedStringFarm {
@@ -1596,9 +1658,9 @@ typedef struct J9SharedCacheHeader {
 	UDATA unused5;
 	UDATA unused6;
 	U_32 softMaxBytes;
-	UDATA unused8;
-	UDATA unused9;
-	UDATA unused10;
+	UDATA startupROMClassBytes; /* Bytes at the start of the ROMClass area used during the last recorded startup */
+	UDATA startupMinorFaults; /* Minor page faults incurred during the last recorded startup */
+	UDATA startupMajorFaults; /* Major page faults incurred during the last recorded startup */
 } J9SharedCacheHeader;
 
 #define J9SHAREDCACHEHEADER_UPDATECOUNTPTR(base) WSRP_GET((base)->updateCountPtr, UDATA*)
@@ -4312,6 +4374,20 @@ typedef struct J9JNIReferenceFrame {
 #define JNIFRAME_TYPE_USER  1
 #define JNIFRAME_TYPE_INTERNAL  0
 
+#define J9JNI_GLOBAL_REF_CACHE_SIZE  64
+#define J9JNI_GLOBAL_REF_CACHE_REFILL  16
+
+/* Slots of J9JavaVM->jniGlobalReferences owned by a thread and not in use as global refs.
+ * They are allocated in the pool and hold NULL, which the GC JNI global ref iterator skips.
+ */
+typedef struct J9JNIGlobalRefCache {
+	UDATA count;
+	j9object_t *slots[J9JNI_GLOBAL_REF_CACHE_SIZE];
+	/* Bounds of the last pool puddle found to contain a deleted ref, 0 if none */
+	UDATA puddleStart;
+	UDATA puddleEnd;
+} J9JNIGlobalRefCache;
+
 typedef struct J9Method {
 	U_8* bytecodes;
 	struct J9ConstantPool* constantPool;
@@ -5736,6 +5812,10 @@ typedef struct J9InternalVMFunctions {
 	BOOLEAN (*setupChunkMonitor)(struct J9VMThread *currentThread);
 	I_64 (*getThreadTID)(struct J9VMThread *currentThread, struct J9VMThread *vmThread);
 	U_32 (*emitStackTrace)(struct J9VMThread *currentThread, I_32 skipCount);
+	void (*jfrCompilation)(struct J9VMThread *currentThread, struct J9Method *method, U_32 compileID, U_32 compileLevel, I_64 duration, BOOLEAN succeeded, BOOLEAN isOSR, U_32 codeSize, U_32 inlinedBytes, BOOLEAN isRemote, BOOLEAN isAOTLoad);
+	void (*jfrCompilationFailure)(struct J9VMThread *currentThread, U_32 compileID, const char *failureMessage);
+	void (*jfrCodeCacheFull)(struct J9VMThread *currentThread, U_64 startAddress, U_64 commitedTopAddress, U_64 reservedTopAddress, U_64 unallocatedCapacity, U_64 codeCacheMaxCapacity, I_32 entryCount, I_32 methodCount, I_32 fullCount);
+	void (*jfrDeoptimization)(struct J9VMThread *currentThread, struct J9Method *method, U_32 bytecodeIndex, U_32 compileID);
 #endif /* defined(J9VM_OPT_JFR) */
 #if defined(J9VM_OPT_SNAPSHOTS)
 	void (*initializeSnapshotClassLoaderObject)(struct J9JavaVM *javaVM, struct J9ClassLoader *classLoader, j9object_t classLoaderObject);
@@ -5863,6 +5943,9 @@ typedef struct J9VMContinuation {
 	struct J9VMEntryLocalStorage* oldEntryLocalStorage;
 	UDATA dropFlags;
 	UDATA returnState;
+	UDATA compactedStackSize;
+	U_32 compactableYields;
+	U_32 compactYieldThreshold;
 #if JAVA_SPEC_VERSION >= 24
 	IDATA waitingMonitorEnterCount;
 	UDATA ownedMonitorCount;
@@ -6162,6 +6245,7 @@ typedef struct J9VMThread {
 #endif /* defined(J9VM_OPT_JFR) */
 	U_8 *superClassNameBytes;
 	UDATA superClassNameLength;
+	J9JNIGlobalRefCache *jniGlobalRefCache;
 } J9VMThread;
 
 #if defined(J9VM_ENV_DATA64)
@@ -6278,6 +6362,11 @@ typedef struct JFRState {
 	 */
 	U_8 *jfrEventEnabledFlags;
 	jlong jfrEventEnabledFlagsSize;
+	/* Allocation sampling throttle: samples accepted in the window starting at allocationSampleWindowStart. */
+	U_64 allocationSampleWindowStart;
+	U_32 allocationSampleWindowCount;
+	BOOLEAN isAllocationSamplingHooked;
+	BOOLEAN setAllocationSamplingInterval;
 } JFRState;
 
 typedef struct J9ReflectFunctionTable {
@@ -6522,6 +6611,11 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t monitorTableMutex;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
+	omrthread_monitor_t* monitorTableMutexes;
+	j9objectmonitor_t* monitorLookupCache;
+	UDATA monitorLookupCacheSize;
+	UDATA monitorLookupCacheHits;
+	UDATA monitorLookupCacheMisses;
 	UDATA thrStaggerStep;
 	UDATA thrStaggerMax;
 	UDATA thrStagger;
@@ -6793,12 +6887,16 @@ typedef struct J9JavaVM {
 	J9VMContinuation **continuationT2Cache;
 	U_32 continuationT1Size;
 	U_32 continuationT2Size;
+	UDATA continuationCacheMaxStackSize;
 	volatile U_32 t1CacheHit;
 	volatile U_32 t2CacheHit;
 	volatile U_32 cacheMiss;
 	volatile U_32 t2store;
 	volatile U_32 cacheFree;
 	volatile U_64 totalContinuationStackSize;
+	volatile U_32 continuationStacksReleased;
+	volatile U_32 continuationStackCompactions;
+	volatile U_64 continuationStackBytesCompacted;
 #if defined(J9VM_PROF_CONTINUATION_ALLOCATION)
 	volatile I_64 avgCacheLookupTime;
 	volatile U_32 fastAlloc;
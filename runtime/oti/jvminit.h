@@ -411,6 +411,10 @@ enum INIT_STAGE {
 #define VMOPT_XXENABLELEGACYMANGLING "-XX:+UseLegacyJNINameEscaping"
 #define VMOPT_XXENABLEUTFCACHE "-XX:+UTFCache"
 #define VMOPT_XXDISABLEUTFCACHE "-XX:-UTFCache"
+#define VMOPT_XXENABLEMAPZIPFILES "-XX:+MapZipFiles"
+#define VMOPT_XXDISABLEMAPZIPFILES "-XX:-MapZipFiles"
+#define VMOPT_XXENABLEJNIGLOBALREFCACHE "-XX:+JNIGlobalRefCache"
+#define VMOPT_XXDISABLEJNIGLOBALREFCACHE "-XX:-JNIGlobalRefCache"
 #define VMOPT_XXENABLEENSUREHASHED "-XX:+EnsureHashed:"
 #define VMOPT_XXDISABLEENSUREHASHED "-XX:-EnsureHashed:"
 #define VMOPT_XXOPENJ9COMMANDLINEENV "-XX:+OpenJ9CommandLineEnv"
@@ -608,6 +612,8 @@ enum INIT_STAGE {
 #define VMOPT_XXDISABLEOPENJ9EXPERIMENTALFLIGHTRECORDING "-XX:-EnableOpenJ9ExperimentalFlightRecording"
 
 #define VMOPT_XXCONTINUATIONCACHE "-XX:ContinuationCache:"
+#define VMOPT_XXCOMPACTCONTINUATIONSTACKS "-XX:+CompactContinuationStacks"
+#define VMOPT_XXNOCOMPACTCONTINUATIONSTACKS "-XX:-CompactContinuationStacks"
 
 #define VMOPT_XXGCCONTAINERHEURISTICS "-XX:+GCContainerHeuristics"
 #define VMOPT_XXNOGCCONTAINERHEURISTICS "-XX:-GCContainerHeuristics"
@@ -131,6 +131,8 @@
 #define J9SHR_RUNTIMEFLAG2_TEST_DOUBLE_PAGESIZE 2
 #define J9SHR_RUNTIMEFLAG2_TEST_HALF_PAGESIZE 4
 #define J9SHR_RUNTIMEFLAG2_SHARE_LAMBDAFORM 8
+#define J9SHR_RUNTIMEFLAG2_HUGE_PAGES 16
+#define J9SHR_RUNTIMEFLAG2_PREFETCH 32
 
 #define J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT  1
 #define J9SHR_VERBOSEFLAG_ENABLE_VERBOSE  2
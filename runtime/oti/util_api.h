@@ -1176,6 +1176,16 @@ U_32 j9crc32(U_32 crc, U_8 *bytes, U_32 len);
 */
 U_32 j9crcSparse32(U_32 crc, U_8 *bytes, U_32 len, U_32 step);
 
+/**
+* @brief Compute the same result as j9crc32() without using any CPU specific instructions.
+* Used to test the accelerated implementations.
+* @param crc
+* @param *bytes
+* @param len
+* @return U_32
+*/
+U_32 j9crc32Portable(U_32 crc, U_8 *bytes, U_32 len);
+
 
 /* ---------------- j9fptr.c ---------------- */
 
@@ -1321,6 +1321,16 @@ freeStacks(J9VMThread * vmThread, UDATA * bp);
 UDATA
 growJavaStack(J9VMThread * vmThread, UDATA newStackSize);
 
+/**
+* @brief Move the frames of the current thread to a smaller stack. Unlike growJavaStack,
+* no GC is triggered if the new stack cannot be allocated.
+* @param vmThread
+* @param newStackSize
+* @return UDATA 0 on success
+*/
+UDATA
+shrinkJavaStack(J9VMThread * vmThread, UDATA newStackSize);
+
 
 #endif /* J9VM_INTERP_GROWABLE_STACKS */ /* End File Level Build Flags */
 
@@ -1580,6 +1590,15 @@ void
 jniPopFrame(J9VMThread * vmThread, UDATA type);
 
 
+/**
+* @brief Return the JNI global ref slots cached by a thread to the pool and free the cache.
+* The thread must not be able to run, and the caller must prevent exclusive VM access.
+* @param vmThread
+*/
+void
+cleanupVMThreadJNIGlobalRefCache(J9VMThread *vmThread);
+
+
 /**
 * @brief
 * @param *vmThread
@@ -2562,7 +2581,7 @@ cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor*
  * @brief Search the monitor tables in vm->monitorTable for the inflated monitor corresponding to an
  * object. Similar to monitorTableAt(), but doesn't add the monitor if it isn't found in the hashtable.
  *
- * This function may block on vm->monitorTableMutex.
+ * This function may block on one of vm->monitorTableMutexes.
  * This function can work out-of-process.
  *
  * @param[in] vm the JavaVM. For out-of-process: may be a local or target pointer.
@@ -6050,6 +6069,62 @@ getThreadTID(J9VMThread *currentThread, J9VMThread *vmThread);
 
 U_32
 emitStackTrace(J9VMThread *currentThread, I_32 skipCount);
+
+/**
+ * Record the end of a JIT compilation. May be called with or without VM access.
+ *
+ * @param currentThread[in] the current J9VMThread (usually a compilation thread)
+ * @param method[in] the method that was compiled
+ * @param compileID[in] the compilation sequence number
+ * @param compileLevel[in] the optimization level of the compilation
+ * @param duration[in] the duration of the compilation in ticks
+ * @param succeeded[in] TRUE if the compilation produced a body
+ * @param isOSR[in] TRUE if this was an OSR compilation
+ * @param codeSize[in] the size of the generated code in bytes
+ * @param inlinedBytes[in] the number of bytecodes inlined
+ * @param isRemote[in] TRUE if the method was compiled by a JITServer
+ * @param isAOTLoad[in] TRUE if the body was loaded from the shared class cache
+ */
+void
+jfrCompilation(J9VMThread *currentThread, J9Method *method, U_32 compileID, U_32 compileLevel, I_64 duration, BOOLEAN succeeded, BOOLEAN isOSR, U_32 codeSize, U_32 inlinedBytes, BOOLEAN isRemote, BOOLEAN isAOTLoad);
+
+/**
+ * Record a failed JIT compilation. May be called with or without VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param compileID[in] the compilation sequence number
+ * @param failureMessage[in] the reason for the failure, copied into the event
+ */
+void
+jfrCompilationFailure(J9VMThread *currentThread, U_32 compileID, const char *failureMessage);
+
+/**
+ * Record that a code cache could not satisfy an allocation. May be called with or without VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param startAddress[in] the start of the code cache segment
+ * @param commitedTopAddress[in] the top of the committed code cache memory
+ * @param reservedTopAddress[in] the top of the reserved code cache memory
+ * @param unallocatedCapacity[in] the number of bytes still free in the code cache
+ * @param codeCacheMaxCapacity[in] the maximum size of all code caches in bytes
+ * @param entryCount[in] the number of code caches
+ * @param methodCount[in] the number of compiled method bodies
+ * @param fullCount[in] the number of times the code cache has been full
+ */
+void
+jfrCodeCacheFull(J9VMThread *currentThread, U_64 startAddress, U_64 commitedTopAddress, U_64 reservedTopAddress, U_64 unallocatedCapacity, U_64 codeCacheMaxCapacity, I_32 entryCount, I_32 methodCount, I_32 fullCount);
+
+/**
+ * Record the OSR transition of a JIT compiled frame to the interpreter.
+ * Called with VM access from a GC-safe point, VM access may be released.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param method[in] the outermost method of the frame being transitioned
+ * @param bytecodeIndex[in] the bytecode index at which execution resumes in the interpreter
+ * @param compileID[in] the jdk.Compilation ID of the compiled body, 0 if it was not recorded
+ */
+void
+jfrDeoptimization(J9VMThread *currentThread, J9Method *method, U_32 bytecodeIndex, U_32 compileID);
 #endif /* defined(J9VM_OPT_JFR) */
 
 #ifdef __cplusplus
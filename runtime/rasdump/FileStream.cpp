@@ -95,19 +95,28 @@ FileStream::writeCharacters(const char* data)
 /* Method for writing a number to the file */
 void
 FileStream::writeNumber(IDATA data, int length)
+{
+	char buffer[8];
+
+	encodeNumber(buffer, data, length);
+
+	/* Write the data to the file */
+	writeCharacters(buffer, length);
+}
+
+/* Method for encoding a number in network order into a buffer */
+void
+FileStream::encodeNumber(char* buffer, IDATA data, int length)
 {
 	/* Validate the parameters */
 	IDATA number = data;
 	int   count  = (length > 8) ? 8 : length;
 
-	/* Copy the characters of the number to a buffer in network order encoding */
-	char buffer[8] = {0,0,0,0,0,0,0,0};
+	/* Copy the characters of the number to the buffer in network order encoding */
+	memset(buffer, 0, 8);
 
 	while (count-- > 0) {
 		buffer[count] = (char)(number & 0xFF);
 		number >>= 8;
 	}
-
-	/* Write the data to the file */
-	writeCharacters(buffer, length);
 }
@@ -54,6 +54,9 @@ public :
 	void writeCharacters (const char* data);
 	void writeNumber     (IDATA data, int length);
 
+	/* Method for encoding a number of length bytes in network order into an 8 byte buffer */
+	static void encodeNumber(char* buffer, IDATA data, int length);
+
 private :
 	/* Prevent use of the copy constructor and assignment operator */
 	FileStream(const FileStream& source);
@@ -0,0 +1,489 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/* Includes */
+#include <string.h>
+#include "SpoolFileStream.hpp"
+#include "FileStream.hpp"
+#include "j9dump.h"
+#include "j9dmpnls.h"
+#include "zlib.h"
+#include "ut_j9dmp.h"
+#include "../oti/util_api.h"
+
+/* Size of the chunks the data is spooled in */
+#define SPOOL_CHUNK_SIZE (1024 * 1024)
+
+/* Size of the buffer holding compressed data before it is written to the file */
+#define SPOOL_DEFLATE_BUFFER_SIZE (64 * 1024)
+
+/* Share of the currently available physical memory the spool may use, as a divisor */
+#define SPOOL_AVAILABLE_MEMORY_DIVISOR 8
+
+/* Suffix of the file holding the data that did not fit in the spool */
+#define SPOOL_OVERFLOW_SUFFIX ".spool"
+
+/* Size of the buffer used to copy the overflow file to the dump file */
+#define SPOOL_OVERFLOW_BUFFER_SIZE (1024 * 1024)
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* Class holding the spooled data and writing it to the file                                      */
+/*                                                                                                */
+/**************************************************************************************************/
+class SpoolFileStream::Spool
+{
+public :
+	struct Chunk
+	{
+		Chunk* _Next;
+		UDATA  _Used;
+		char   _Data[SPOOL_CHUNK_SIZE];
+	};
+
+	/* Method for creating a spool; returns NULL if the file or the compressor cannot be set up */
+	static Spool* create(J9JavaVM* virtualMachine, const char* fileName, bool compress, U_64 spoolLimit);
+
+	/* Method for writing out the spooled data and closing the file */
+	void flush(void);
+	void finish(void);
+	void destroy(void);
+
+	/* Method for adding data to the spool, or writing it directly once the spool has been flushed */
+	void write(const char* data, IDATA length);
+
+	/* Methods for spooling the data that does not fit in memory to the overflow file */
+	bool openOverflow(void);
+	void writeToOverflow(const char* data, IDATA length);
+	void drainOverflow(void);
+
+	/* Entry point of the background writer thread */
+	static int J9THREAD_PROC writerThreadProc(void* entryArg);
+
+	J9PortLibrary*         _PortLibrary;
+	RasDumpGlobalStorage*  _DumpStorage;
+	char*                  _FileName;
+	IDATA                  _FileHandle;
+	char*                  _OverflowFileName;
+	IDATA                  _OverflowHandle;
+	U_64                   _OverflowBytes;
+	bool                   _Compress;
+	bool                   _Spooling;
+	bool                   _Overflowing;
+	bool                   _Error;
+	z_stream               _Deflater;
+	char*                  _DeflateBuffer;
+	Chunk*                 _Head;
+	Chunk*                 _Tail;
+	U_64                   _SpooledBytes;
+	U_64                   _Limit;
+
+private :
+	void writeToFile(const char* data, IDATA length, int flush);
+};
+
+SpoolFileStream::Spool*
+SpoolFileStream::Spool::create(J9JavaVM* virtualMachine, const char* fileName, bool compress, U_64 spoolLimit)
+{
+	PORT_ACCESS_FROM_JAVAVM(virtualMachine);
+	J9MemoryInfo memoryInfo;
+	UDATA nameLength = strlen(fileName) + 1;
+	UDATA overflowNameLength = nameLength + strlen(SPOOL_OVERFLOW_SUFFIX);
+
+	Spool* spool = (Spool*)j9mem_allocate_memory(sizeof(Spool) + nameLength + overflowNameLength, OMRMEM_CATEGORY_VM);
+	if (NULL == spool) {
+		return NULL;
+	}
+	memset(spool, 0, sizeof(Spool));
+	spool->_PortLibrary = PORTLIB;
+	spool->_DumpStorage = (RasDumpGlobalStorage*)virtualMachine->j9rasdumpGlobalStorage;
+	spool->_FileName = (char*)(spool + 1);
+	memcpy(spool->_FileName, fileName, nameLength);
+	spool->_OverflowFileName = spool->_FileName + nameLength;
+	j9str_printf(spool->_OverflowFileName, overflowNameLength, "%s" SPOOL_OVERFLOW_SUFFIX, fileName);
+	spool->_OverflowHandle = -1;
+	spool->_Compress = compress;
+
+	/* Never take more than a small share of the physical memory that is currently available: the
+	 * dump may have been triggered because memory is short. A limit of 0 writes directly to the file. */
+	spool->_Limit = spoolLimit;
+	memset(&memoryInfo, 0, sizeof(memoryInfo));
+	if ((0 == j9sysinfo_get_memory_info(&memoryInfo)) && (J9PORT_MEMINFO_NOT_AVAILABLE != memoryInfo.availPhysical)
+		&& ((memoryInfo.availPhysical / SPOOL_AVAILABLE_MEMORY_DIVISOR) < spool->_Limit)
+	) {
+		spool->_Limit = memoryInfo.availPhysical / SPOOL_AVAILABLE_MEMORY_DIVISOR;
+	}
+	spool->_Spooling = (spool->_Limit >= sizeof(Chunk));
+
+	/* Open the file now so that failures are reported while the dump is being taken */
+	spool->_FileHandle = j9cached_file_open(PORTLIB, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
+	if (-1 == spool->_FileHandle) {
+		j9mem_free_memory(spool);
+		return NULL;
+	}
+
+	if (compress) {
+		spool->_DeflateBuffer = (char*)j9mem_allocate_memory(SPOOL_DEFLATE_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+		/* A window of 15 bits plus 16 selects the gzip format; favour speed over size */
+		if ((NULL == spool->_DeflateBuffer)
+			|| (Z_OK != deflateInit2(&spool->_Deflater, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY))
+		) {
+			j9mem_free_memory(spool->_DeflateBuffer);
+			j9cached_file_close(PORTLIB, spool->_FileHandle);
+			j9mem_free_memory(spool);
+			return NULL;
+		}
+	}
+
+	return spool;
+}
+
+void
+SpoolFileStream::Spool::writeToFile(const char* data, IDATA length, int flush)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_Error) {
+		return;
+	}
+
+	if (!_Compress) {
+		if (j9cached_file_write(PORTLIB, _FileHandle, data, length) != length) {
+			_Error = true;
+		}
+		return;
+	}
+
+	_Deflater.next_in = (Bytef*)data;
+	_Deflater.avail_in = (uInt)length;
+	do {
+		_Deflater.next_out = (Bytef*)_DeflateBuffer;
+		_Deflater.avail_out = SPOOL_DEFLATE_BUFFER_SIZE;
+		if (Z_STREAM_ERROR == deflate(&_Deflater, flush)) {
+			_Error = true;
+			return;
+		}
+		IDATA compressedLength = SPOOL_DEFLATE_BUFFER_SIZE - _Deflater.avail_out;
+		if ((compressedLength > 0) && (j9cached_file_write(PORTLIB, _FileHandle, _DeflateBuffer, compressedLength) != compressedLength)) {
+			_Error = true;
+			return;
+		}
+	} while (0 == _Deflater.avail_out);
+}
+
+void
+SpoolFileStream::Spool::write(const char* data, IDATA length)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (!_Spooling) {
+		writeToFile(data, length, Z_NO_FLUSH);
+		return;
+	}
+
+	if (_Overflowing) {
+		writeToOverflow(data, length);
+		return;
+	}
+
+	while (length > 0) {
+		if ((NULL == _Tail) || (SPOOL_CHUNK_SIZE == _Tail->_Used)) {
+			Chunk* chunk = NULL;
+			if ((_SpooledBytes + sizeof(Chunk)) <= _Limit) {
+				chunk = (Chunk*)j9mem_allocate_memory(sizeof(Chunk), OMRMEM_CATEGORY_VM);
+			}
+			if (NULL == chunk) {
+				if (openOverflow()) {
+					/* The spool cannot grow: spool the rest to the overflow file */
+					Trc_dump_spoolFileStream_overflowed(_FileName, _SpooledBytes, _OverflowFileName);
+					writeToOverflow(data, length);
+				} else {
+					/* There is nowhere to spool the rest: write what has been spooled and carry on synchronously */
+					Trc_dump_spoolFileStream_flushed(_FileName, _SpooledBytes);
+					flush();
+					writeToFile(data, length, Z_NO_FLUSH);
+				}
+				return;
+			}
+			chunk->_Next = NULL;
+			chunk->_Used = 0;
+			if (NULL == _Tail) {
+				_Head = chunk;
+			} else {
+				_Tail->_Next = chunk;
+			}
+			_Tail = chunk;
+			_SpooledBytes += sizeof(Chunk);
+		}
+
+		UDATA copyLength = SPOOL_CHUNK_SIZE - _Tail->_Used;
+		if ((UDATA)length < copyLength) {
+			copyLength = (UDATA)length;
+		}
+		memcpy(_Tail->_Data + _Tail->_Used, data, copyLength);
+		_Tail->_Used += copyLength;
+		data += copyLength;
+		length -= copyLength;
+	}
+}
+
+/* Method for creating the overflow file; the data written to it is not compressed, as it is read back */
+bool
+SpoolFileStream::Spool::openOverflow(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	_OverflowHandle = j9cached_file_open(PORTLIB, _OverflowFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0600);
+	_Overflowing = (-1 != _OverflowHandle);
+	return _Overflowing;
+}
+
+void
+SpoolFileStream::Spool::writeToOverflow(const char* data, IDATA length)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (j9cached_file_write(PORTLIB, _OverflowHandle, data, length) != length) {
+		_Error = true;
+		return;
+	}
+	_OverflowBytes += length;
+}
+
+/* Method appending the contents of the overflow file to the dump file and deleting the overflow file */
+void
+SpoolFileStream::Spool::drainOverflow(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	char* buffer = NULL;
+	IDATA readHandle = -1;
+	U_64 remaining = _OverflowBytes;
+
+	if (0 != j9cached_file_close(PORTLIB, _OverflowHandle)) {
+		_Error = true;
+	}
+	_OverflowHandle = -1;
+	_Overflowing = false;
+
+	if (!_Error) {
+		buffer = (char*)j9mem_allocate_memory(SPOOL_OVERFLOW_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+		readHandle = j9file_open(_OverflowFileName, EsOpenRead, 0);
+		if ((NULL == buffer) || (-1 == readHandle)) {
+			_Error = true;
+		}
+	}
+
+	while (!_Error && (remaining > 0)) {
+		IDATA length = SPOOL_OVERFLOW_BUFFER_SIZE;
+		if (remaining < (U_64)length) {
+			length = (IDATA)remaining;
+		}
+		length = j9file_read(readHandle, buffer, length);
+		if (length <= 0) {
+			_Error = true;
+			break;
+		}
+		writeToFile(buffer, length, Z_NO_FLUSH);
+		remaining -= length;
+	}
+
+	if (-1 != readHandle) {
+		j9file_close(readHandle);
+	}
+	j9mem_free_memory(buffer);
+	j9file_unlink(_OverflowFileName);
+}
+
+/* Method writing the spooled data to the file and freeing it; the spool stops being used afterwards */
+void
+SpoolFileStream::Spool::flush(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	while (NULL != _Head) {
+		Chunk* chunk = _Head;
+		_Head = chunk->_Next;
+		writeToFile(chunk->_Data, chunk->_Used, Z_NO_FLUSH);
+		j9mem_free_memory(chunk);
+	}
+	_Tail = NULL;
+	_SpooledBytes = 0;
+	_Spooling = false;
+}
+
+/* Method writing out everything still pending and closing the file */
+void
+SpoolFileStream::Spool::finish(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	flush();
+	if (-1 != _OverflowHandle) {
+		drainOverflow();
+	}
+	if (_Compress) {
+		writeToFile(NULL, 0, Z_FINISH);
+		deflateEnd(&_Deflater);
+	}
+	j9cached_file_sync(PORTLIB, _FileHandle);
+	j9cached_file_close(PORTLIB, _FileHandle);
+	_FileHandle = -1;
+}
+
+void
+SpoolFileStream::Spool::destroy(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	j9mem_free_memory(_DeflateBuffer);
+	j9mem_free_memory(this);
+}
+
+int J9THREAD_PROC
+SpoolFileStream::Spool::writerThreadProc(void* entryArg)
+{
+	Spool* spool = (Spool*)entryArg;
+	RasDumpGlobalStorage* dumpStorage = spool->_DumpStorage;
+	PORT_ACCESS_FROM_PORT(spool->_PortLibrary);
+
+	spool->finish();
+
+	if (spool->_Error) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", j9error_last_error_message());
+		Trc_dump_reportDumpError_Event2("Heap", j9error_last_error_message());
+	} else {
+		j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", spool->_FileName);
+		Trc_dump_reportDumpEnd_Event2("Heap", spool->_FileName);
+	}
+	spool->destroy();
+
+	/* Let the VM shut down once the last background writer is done */
+	omrthread_monitor_enter(dumpStorage->spoolWritersMutex);
+	dumpStorage->spoolWritersActive -= 1;
+	omrthread_monitor_notify_all(dumpStorage->spoolWritersMutex);
+	omrthread_monitor_exit(dumpStorage->spoolWritersMutex);
+
+	return 0;
+}
+
+/* Constructor */
+SpoolFileStream::SpoolFileStream(J9JavaVM* virtualMachine) :
+	_VirtualMachine(virtualMachine),
+	_Spool(NULL),
+	_Error(false)
+{
+	/* Nothing to do */
+}
+
+/* Destructor */
+SpoolFileStream::~SpoolFileStream()
+{
+	close();
+}
+
+/* Method for opening the file */
+void
+SpoolFileStream::open(const char* fileName, bool compress, U_64 spoolLimit)
+{
+	if (fileName[0] != '-') {
+		_Spool = Spool::create(_VirtualMachine, fileName, compress, spoolLimit);
+		_Error = false;
+	}
+}
+
+/* Method for closing the file */
+bool
+SpoolFileStream::close(void)
+{
+	Spool* spool = _Spool;
+	RasDumpGlobalStorage* dumpStorage = (RasDumpGlobalStorage*)_VirtualMachine->j9rasdumpGlobalStorage;
+	bool writingInBackground = false;
+
+	if (NULL == spool) {
+		return false;
+	}
+	_Spool = NULL;
+
+	if (spool->_Spooling && !spool->_Error && (NULL != dumpStorage) && (NULL != dumpStorage->spoolWritersMutex)) {
+		omrthread_monitor_enter(dumpStorage->spoolWritersMutex);
+		dumpStorage->spoolWritersActive += 1;
+		omrthread_monitor_exit(dumpStorage->spoolWritersMutex);
+
+		Trc_dump_spoolFileStream_backgroundWrite(spool->_FileName, spool->_SpooledBytes);
+		if (0 == omrthread_create(NULL, _VirtualMachine->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0, Spool::writerThreadProc, spool)) {
+			writingInBackground = true;
+		} else {
+			omrthread_monitor_enter(dumpStorage->spoolWritersMutex);
+			dumpStorage->spoolWritersActive -= 1;
+			omrthread_monitor_exit(dumpStorage->spoolWritersMutex);
+		}
+	}
+
+	if (!writingInBackground) {
+		/* Write the file on this thread; the caller reports the outcome */
+		spool->finish();
+		_Error = spool->_Error;
+		spool->destroy();
+	}
+
+	return writingInBackground;
+}
+
+/* Methods for getting the object's status */
+bool
+SpoolFileStream::isOpen(void) const
+{
+	return NULL != _Spool;
+}
+
+bool
+SpoolFileStream::hasError(void) const
+{
+	return _Error || ((NULL != _Spool) && _Spool->_Error);
+}
+
+/* Method for writing characters described by a pointer and a length to the file */
+void
+SpoolFileStream::writeCharacters(const char* data, IDATA length)
+{
+	if ((NULL != _Spool) && !_Spool->_Error) {
+		_Spool->write(data, length);
+	}
+}
+
+void
+SpoolFileStream::writeCharacters(const char* data)
+{
+	writeCharacters(data, strlen(data));
+}
+
+/* Method for writing a number to the file */
+void
+SpoolFileStream::writeNumber(IDATA data, int length)
+{
+	char buffer[8];
+
+	FileStream::encodeNumber(buffer, data, length);
+
+	/* Write the data to the file */
+	writeCharacters(buffer, length);
+}
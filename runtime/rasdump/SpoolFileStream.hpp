@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SPOOLFILESTREAM_HPP
+#define SPOOLFILESTREAM_HPP
+
+/* Includes */
+#include "j9.h"
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* Class for writing a dump file in the background                                                */
+/*                                                                                                */
+/* Data written to the stream is spooled in memory. When the stream is closed, a background       */
+/* thread writes the spooled data to the file, optionally gzip compressed, so the caller can      */
+/* release exclusive VM access before the dump file is written. The spool is bounded by a limit   */
+/* given when the file is opened, and by a small share of the available physical memory. Data     */
+/* that does not fit is spooled uncompressed to an overflow file next to the dump file, which the */
+/* background thread appends to the dump file and deletes. Only if the overflow file cannot be    */
+/* created is the spooled data written out immediately, and the stream carries on writing         */
+/* synchronously.                                                                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+class SpoolFileStream
+{
+public :
+	/* Constructor */
+	SpoolFileStream(J9JavaVM* virtualMachine);
+
+	/* Destructor */
+	~SpoolFileStream();
+
+	/* Method for opening the file; at most spoolLimit bytes are spooled in memory, and 0 writes synchronously */
+	void open(const char* fileName, bool compress, U_64 spoolLimit);
+
+	/* Method for closing the file. Returns true if the file is being written in the background,
+	 * in which case the background thread reports the outcome of the dump. */
+	bool close(void);
+
+	/* Methods for getting the object's status */
+	bool isOpen(void) const;
+	bool hasError(void) const;
+
+	/* Methods for writing data to the file */
+	void writeCharacters (const char* data, IDATA length);
+	void writeCharacters (const char* data);
+	void writeNumber     (IDATA data, int length);
+
+private :
+	/* Prevent use of the copy constructor and assignment operator */
+	SpoolFileStream(const SpoolFileStream& source);
+	SpoolFileStream& operator=(const SpoolFileStream& source);
+
+	/* The spooled data and the file; it outlives the stream when written in the background */
+	class Spool;
+
+	/* Declared data */
+	J9JavaVM* _VirtualMachine;
+	Spool*    _Spool;
+	bool      _Error;
+};
+
+#endif
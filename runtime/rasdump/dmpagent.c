@@ -1865,6 +1865,7 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 
 				if (strcmp(spec->name, "heap") == 0) {
 					j9tty_err_printf("\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf("  opts=PHD+STREAM[+GZIP][+SPOOL<MB>] Write the PHD file after exclusive access is released\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf("\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -1286,6 +1286,9 @@ initRasDumpGlobalStorage(J9JavaVM *vm)
 
 			omrthread_monitor_exit(dump_storage->dumpLabelTokensMutex);
 		}
+
+		/* the mutex for background heap dump writers; without it heap dumps are not written in the background */
+		omrthread_monitor_init_with_name(&dump_storage->spoolWritersMutex, 0, "dump spool writers mutex");
 	}
 }
 
@@ -1300,6 +1303,16 @@ freeRasDumpGlobalStorage(J9JavaVM *vm)
 	if (NULL != dump_storage) {
 		/* global storage exists. */
 
+		/* wait for heap dumps still being written in the background */
+		if (NULL != dump_storage->spoolWritersMutex) {
+			omrthread_monitor_enter(dump_storage->spoolWritersMutex);
+			while (0 != dump_storage->spoolWritersActive) {
+				omrthread_monitor_wait(dump_storage->spoolWritersMutex);
+			}
+			omrthread_monitor_exit(dump_storage->spoolWritersMutex);
+			omrthread_monitor_destroy(dump_storage->spoolWritersMutex);
+		}
+
 		/* free the contents */
 		if (NULL != dump_storage->dumpLabelTokensMutex) {
 			omrthread_monitor_destroy(dump_storage->dumpLabelTokensMutex);
@@ -26,7 +26,9 @@
 #include "j2sever.h"
 #include "HeapIteratorAPI.h"
 #include "j9dmpnls.h"
+#include "j9argscan.h"
 #include "FileStream.hpp"
+#include "SpoolFileStream.hpp"
 
 #include "ut_j9dmp.h"
 
@@ -856,7 +858,13 @@ private :
 	static int       numberSizeEncoding(int numberSize);
 	static int       wordSize(void);
 	void             checkForIOError(void);
-	/* Methods for writing data to output file (proxies to _OutputStream */
+	U_64             getSpoolLimit(void) const;
+	/* Methods for opening and closing the output file; closeOutputStream() returns true if the
+	 * file is being written in the background, which then reports the outcome of the dump */
+	void             openOutputStream(const char* fileName);
+	bool             closeOutputStream(void);
+	bool             isOutputStreamOpen(void) const;
+	/* Methods for writing data to output file (proxies to _OutputStream or _SpoolStream) */
 	void             writeCharacters (const char* data, IDATA length);
 	void             writeCharacters (const char* data);
 	void             writeNumber (IDATA data, int length);
@@ -869,10 +877,14 @@ private :
 	J9PortLibrary*    _PortLibrary;
 	CharacterString   _FileName;
 	FileStream        _OutputStream;
+	SpoolFileStream   _SpoolStream;
 	void*             _CurrentObject;
 	ClassCache        _ClassCache;
 	bool              _FileMode;
 	bool              _Error;
+	bool              _Streaming;  /* Spool the dump and write it once exclusive access is released */
+	bool              _Compress;   /* Write the spooled dump gzip compressed */
+	U_64              _SpoolLimit; /* Maximum number of bytes spooled before writing synchronously */
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
@@ -1122,9 +1134,13 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_PortLibrary(context->javaVM->portLibrary),
 	_FileName(context->javaVM->portLibrary),
 	_OutputStream(context->javaVM->portLibrary),
+	_SpoolStream(context->javaVM),
 	_CurrentObject(0),
 	_FileMode(false),
-	_Error(false)
+	_Error(false),
+	_Streaming(false),
+	_Compress(false),
+	_SpoolLimit(0)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 
@@ -1133,16 +1149,26 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		return;
 	}
 	
+	/* opts=PHD+STREAM writes the dump file in the background, after exclusive access is released */
+	if ((agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "STREAM") != 0)) {
+		_Streaming = true;
+		_Compress = (strstr(agent->dumpOptions, "GZIP") != 0);
+		_SpoolLimit = getSpoolLimit();
+	}
+
 	/* Remember the file name */
 	_FileName += fileName;
+	if (_Compress) {
+		_FileName += ".gz";
+	}
 	
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		reportDumpRequest(_PortLibrary,_Context,"Heap",_FileName.data());
 		
 		/* It's a single file so open it */
-		_OutputStream.open(_FileName.data());
+		openOutputStream(_FileName.data());
 	
 		/* Performance measuring code 
 		startTimer();
@@ -1167,20 +1193,20 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		*/
 
 		/* Record the status of the operation */
-		_FileMode = _FileMode || _OutputStream.isOpen();
+		_FileMode = _FileMode || isOutputStreamOpen();
 
 		/* Close the file */
-		_OutputStream.close();
+		bool writingInBackground = closeOutputStream();
 		
 		/* Write a message to standard error saying we have written a dump file */
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
-		if (! _Error) {
+		if (! _Error && ! writingInBackground) {
 			if (_FileMode) {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			} else {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			}
 		}
 	}
@@ -1227,7 +1253,7 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		_ClassCache.clear();
 
 		/* Open the file */
-		_OutputStream.open(fileName.data());
+		openOutputStream(fileName.data());
 
 		/* Start writing the file */
 		writeDumpFileHeader();
@@ -1250,14 +1276,14 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		}
 
 		/* Record the status of the operation */
-		_FileMode = _FileMode || _OutputStream.isOpen();
+		_FileMode = _FileMode || isOutputStreamOpen();
 
 		/* Close the file */
-		_OutputStream.close();
+		bool writingInBackground = closeOutputStream();
 		
 		/* Write a message to standard error saying we have written a dump file */
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
-		if (! _Error) {
+		if (! _Error && ! writingInBackground) {
 			if (_FileMode) {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName.data());
 				Trc_dump_reportDumpEnd_Event2("Heap", fileName.data());
@@ -2390,18 +2416,87 @@ void
 BinaryHeapDumpWriter::checkForIOError(void)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
-	if (_OutputStream.hasError()) {
+	if (_Streaming ? _SpoolStream.hasError() : _OutputStream.hasError()) {
 		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", j9error_last_error_message());
 		Trc_dump_reportDumpError_Event2("Heap", j9error_last_error_message());
 		_Error = true;
 	}
 }
 
+/* Method for choosing how much of the dump may be spooled in memory. By default the limit is
+ * the heap occupancy, which is usually more than the dump of it takes; whatever does not fit
+ * goes to an overflow file. A dump taken for an OutOfMemoryError is written directly: the
+ * memory for the spool is unlikely to be there, and what is left should not be taken from the
+ * application. opts=PHD+STREAM+SPOOL<MB> overrides the default limit.
+ */
+U_64
+BinaryHeapDumpWriter::getSpoolLimit(void) const
+{
+	J9RASdumpEventData* eventData = _Context->eventData;
+	const char* outOfMemoryError = "java/lang/OutOfMemoryError";
+	UDATA length = strlen(outOfMemoryError);
+
+	if ((0 != (_Context->eventFlags & J9RAS_DUMP_ON_EXCEPTION_SYSTHROW))
+		&& (NULL != eventData) && (length == eventData->detailLength)
+		&& (0 == memcmp(eventData->detailData, outOfMemoryError, length))
+	) {
+		return 0;
+	}
+
+	char* buf = strstr(_Agent->dumpOptions, "SPOOL");
+	if (NULL != buf) {
+		UDATA megabytes = 0;
+		buf += 5;
+		if (0 == scan_udata(&buf, &megabytes)) {
+			return (U_64)megabytes * 1024 * 1024;
+		}
+	}
+
+	J9MemoryManagerFunctions* mmFuncs = _VirtualMachine->memoryManagerFunctions;
+	return (U_64)(mmFuncs->j9gc_heap_total_memory(_VirtualMachine) - mmFuncs->j9gc_heap_free_memory(_VirtualMachine));
+}
+
+void
+BinaryHeapDumpWriter::openOutputStream(const char* fileName)
+{
+	if (_Streaming) {
+		_SpoolStream.open(fileName, _Compress, _SpoolLimit);
+	} else {
+		_OutputStream.open(fileName);
+	}
+}
+
+bool
+BinaryHeapDumpWriter::closeOutputStream(void)
+{
+	if (!_Streaming) {
+		_OutputStream.close();
+		return false;
+	}
+
+	bool writingInBackground = _SpoolStream.close();
+	if (!writingInBackground && !_Error) {
+		/* The spool was written synchronously; report any error it ran into */
+		checkForIOError();
+	}
+	return writingInBackground;
+}
+
+bool
+BinaryHeapDumpWriter::isOutputStreamOpen(void) const
+{
+	return _Streaming ? _SpoolStream.isOpen() : _OutputStream.isOpen();
+}
+
 void
 BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 {
 	if (!_Error) {
-		_OutputStream.writeCharacters(data,length);
+		if (_Streaming) {
+			_SpoolStream.writeCharacters(data, length);
+		} else {
+			_OutputStream.writeCharacters(data,length);
+		}
 
 		checkForIOError();
 	}
@@ -2411,7 +2506,11 @@ void
 BinaryHeapDumpWriter::writeCharacters (const char* data)
 {
 	if (!_Error) {
-		_OutputStream.writeCharacters(data);
+		if (_Streaming) {
+			_SpoolStream.writeCharacters(data);
+		} else {
+			_OutputStream.writeCharacters(data);
+		}
 
 		checkForIOError();
 	}
@@ -2421,7 +2520,11 @@ void
 BinaryHeapDumpWriter::writeNumber (IDATA data, int length)
 {
 	if (!_Error) {
-		_OutputStream.writeNumber(data, length);
+		if (_Streaming) {
+			_SpoolStream.writeNumber(data, length);
+		} else {
+			_OutputStream.writeNumber(data, length);
+		}
 
 		checkForIOError();
 	}
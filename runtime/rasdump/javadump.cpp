@@ -512,11 +512,18 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeMemorySection, _Error);
 
 	/* The monitor section is crash prone as objects mutate under it.
-	 * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutex ahead of the
-	 * thread lock as we will attempt to get it again for uninflated locks when calling getVMThreadRawState while looking
+	 * Lock ordering imposed by the lock inflation path means that we have to get the monitor table mutexes ahead of the
+	 * thread lock as we will attempt to get them again for uninflated locks when calling getVMThreadRawState while looking
 	 * for waiting threads on any given monitor
 	 */
 	omrthread_monitor_enter(_VirtualMachine->monitorTableMutex);
+	if (NULL != _VirtualMachine->monitorTableMutexes) {
+		for (UDATA tableIndex = 0; tableIndex < _VirtualMachine->monitorTableCount; tableIndex++) {
+			if (NULL != _VirtualMachine->monitorTableMutexes[tableIndex]) {
+				omrthread_monitor_enter(_VirtualMachine->monitorTableMutexes[tableIndex]);
+			}
+		}
+	}
 	omrthread_t self = omrthread_self();
 	if (!omrthread_lib_try_lock(self)) {
 		/* got both locks so we shouldn't deadlock getting thread state */
@@ -531,6 +538,13 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 			"1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
 			"NULL           ------------------------------------------------------------------------\n");
 	}
+	if (NULL != _VirtualMachine->monitorTableMutexes) {
+		for (UDATA tableIndex = _VirtualMachine->monitorTableCount; tableIndex > 0; tableIndex--) {
+			if (NULL != _VirtualMachine->monitorTableMutexes[tableIndex - 1]) {
+				omrthread_monitor_exit(_VirtualMachine->monitorTableMutexes[tableIndex - 1]);
+			}
+		}
+	}
 	omrthread_monitor_exit(_VirtualMachine->monitorTableMutex);
 
 	/* If request=preempt (for native stack collection) we attempt to acquire the mutex and note if we got it */
@@ -1986,7 +2000,7 @@ JavaCoreDumpWriter::writeNativeAllocator(const char * name, U_32 depth, BOOLEAN
 void
 JavaCoreDumpWriter::writeMonitorSection(void)
 {
-	/* The code calling this method must have taken the monitorTableMutex and the thread library monitor_mutex
+	/* The code calling this method must have taken the monitor table mutexes and the thread library monitor_mutex
 	 * (in that order) prior to calling and must release those locks on return from this method.
 	 */
 	J9ThreadMonitor *monitor = NULL;
@@ -36,7 +36,12 @@
 #include "j9shrnls.h"
 #include "j9comp.h"
 #include "j9consts.h"
+#include "util_api.h"
+#include "romclasswalk.h"
 #include <string.h>
+#if defined(LINUX)
+#include <sys/resource.h>
+#endif /* defined(LINUX) */
 extern "C" {
 #include "shrinit.h"
 }
@@ -63,6 +68,7 @@ extern "C" {
 
 static char* formatAttachedDataString(J9VMThread* currentThread, U_8 *attachedData, UDATA attachedDataLength, char *attachedDataStringBuffer, UDATA bufferLength);
 static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
+static void getProcessPageFaults(UDATA *minorFaults, UDATA *majorFaults);
 /* If you make this sleep a lot longer, it almost eliminates store contention
  * because the VMs get out of step with each other, but you delay excessively */
 #define WRITE_HASH_WAIT_MAX_MICROS 80000
@@ -244,6 +250,37 @@ SH_CacheMap::dontNeedMetadata(J9VMThread* currentThread)
 	} while (NULL != ccToUse);
 }
 
+/**
+ * Record the startup access profile of the top layer cache: how much of the ROMClass
+ * area was used during startup, which -Xshareclasses:prefetch reads ahead on the next
+ * startup, and the page faults incurred while starting up, which are shown by printStats.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+SH_CacheMap::storeStartupAccessProfile(J9VMThread* currentThread)
+{
+	const char* fnName = "storeStartupAccessProfile";
+	UDATA minorFaults = 0;
+	UDATA majorFaults = 0;
+
+	/* The profile is recorded whether or not the hints are enabled, so that runs
+	 * with and without them can be compared and the first prefetching run has a profile.
+	 */
+	if (_ccHead->isRunningReadOnly()) {
+		return;
+	}
+
+	getProcessPageFaults(&minorFaults, &majorFaults);
+	minorFaults -= _startupMinorFaults;
+	majorFaults -= _startupMajorFaults;
+
+	if (0 == _ccHead->enterWriteMutex(currentThread, false, fnName)) {
+		_ccHead->setStartupAccessProfile(currentThread, minorFaults, majorFaults);
+		_ccHead->exitWriteMutex(currentThread, fnName);
+	}
+}
+
 /**
  * Builds a new SH_CacheMap for retrieving cache statistics
  *
@@ -288,6 +325,8 @@ SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, Bl
 	_bytesRead = 0;
 	_isAssertEnabled = true;
 	_metadataReleaseCounter = 0;
+	_startupMinorFaults = 0;
+	_startupMajorFaults = 0;
 	_ccPool = NULL;
 
 	_managers = SH_Managers::newInstance(vm, (SH_Managers *)allocPtr);
@@ -455,6 +494,8 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 	_cacheName = rootName;				/* Store the original name as the cache name */
 	_cacheDir = cacheDirName;
 
+	getProcessPageFaults(&_startupMinorFaults, &_startupMajorFaults);
+
 	if (*_runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_READONLY) {
 		/* If running readonly, we can't recreate a cache after we delete it, so disable autopunt */
 		*_runtimeFlags &= ~J9SHR_RUNTIMEFLAG_AUTOKILL_DIFF_BUILDID;
@@ -499,6 +540,10 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 
 			rc = ccToUse->startup(currentThread, piconfig, cacheMemoryUT, runtimeFlags, _verboseFlags, _cacheName, cacheDirName, cacheDirPerm, &_actualSize, &_localCrashCntr, true, cacheHasIntegrity);
 			if (rc == CC_STARTUP_OK) {
+				/* Give the advice before the ROMClass segment and the metadata are walked below */
+				ccToUse->adviseMemoryPattern(currentThread,
+						J9_ARE_ALL_BITS_SET(_sharedClassConfig->runtimeFlags2, J9SHR_RUNTIMEFLAG2_HUGE_PAGES),
+						J9_ARE_ALL_BITS_SET(_sharedClassConfig->runtimeFlags2, J9SHR_RUNTIMEFLAG2_PREFETCH));
 				if (sanityWalkROMClassSegment(currentThread, ccToUse) == 0) {
 					rc = CC_STARTUP_CORRUPT;
 					goto error;
@@ -1141,6 +1186,10 @@ SH_CacheMap::readCacheUpdates(J9VMThread* currentThread)
  * If expectedUpdates == -1, this indicates to read until no more data is found.
  * Otherwise, only read expectedUpdates entries.
  *
+ * When reading until no more data is found, the items are first collected per manager and
+ * the managers' hashtables are populated afterwards, on helper threads if there are many items.
+ * The managers are independent of each other, and each still sees its items in cache order.
+ *
  * @return	number of entries successfully read, or
  * 			CM_READ_CACHE_FAILED if the call fails for some reason, or
  * 			CM_CACHE_CORRUPT if cache is corrupt
@@ -1152,6 +1201,9 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 	IDATA result = 0;
 	IDATA expectedCntr = expectedUpdates;
 	SH_Manager* manager = NULL;
+	bool batchItems = (-1 == expectedUpdates);
+	StoreBatch batches[NUM_MANAGERS];
+	UDATA numBatches = 0;
 	PORT_ACCESS_FROM_PORT(_portlib);
 
 	if (!cache->hasWriteMutex(currentThread)) {
@@ -1183,7 +1235,14 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 					++result;
 				} else if ((rc > 0) && ((UDATA)rc == itemType)) {
 					/* Success - we have a started manager */
-					if (manager->storeNew(currentThread, it, cache)) {
+					bool stored = false;
+
+					if (batchItems) {
+						stored = batchNewItem(currentThread, batches, &numBatches, manager, cache, it);
+					} else {
+						stored = manager->storeNew(currentThread, it, cache);
+					}
+					if (stored) {
 						if (expectedCntr != -1) {
 							--expectedCntr;
 						}
@@ -1210,6 +1269,21 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 		}
 	}
 
+	if (batchItems) {
+		if ((CM_READ_CACHE_FAILED != result) && (CM_CACHE_CORRUPT != result)) {
+			if (!storeBatches(currentThread, batches, numBatches)) {
+				CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_HASHTABLE_ADD_FAILURE);
+				Trc_SHR_CM_readCache_Exit2(currentThread);
+				result = CM_READ_CACHE_FAILED;
+			}
+		}
+		for (UDATA i = 0; i < numBatches; i++) {
+			if (NULL != batches[i].items) {
+				j9mem_free_memory((void*)batches[i].items);
+			}
+		}
+	}
+
 	if ((expectedUpdates != -1) && (result != expectedUpdates)) {
 		Trc_SHR_CM_readCache_Event_NotMatched(currentThread, expectedUpdates, result);
 	}
@@ -1220,6 +1294,165 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 	return result;
 }
 
+/**
+ * Add an item read from the cache to the batch of items of its manager.
+ * If the batch cannot be grown, the items batched so far and all later items of the manager
+ * are stored immediately instead.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in,out] batches  The batches of the managers seen so far
+ * @param [in,out] numBatches  The number of batches in use
+ * @param [in] manager  The started manager for the item
+ * @param [in] cache  The cache the item was read from
+ * @param [in] item  The item
+ *
+ * @return false if an item could not be stored, true otherwise
+ */
+bool
+SH_CacheMap::batchNewItem(J9VMThread* currentThread, StoreBatch* batches, UDATA* numBatches, SH_Manager* manager, SH_CompositeCacheImpl* cache, const ShcItem* item)
+{
+	StoreBatch* batch = NULL;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	for (UDATA i = 0; i < *numBatches; i++) {
+		if (batches[i].manager == manager) {
+			batch = &batches[i];
+			break;
+		}
+	}
+	if (NULL == batch) {
+		Trc_SHR_Assert_True(*numBatches < NUM_MANAGERS);
+		batch = &batches[*numBatches];
+		*numBatches += 1;
+		memset(batch, 0, sizeof(StoreBatch));
+		batch->manager = manager;
+		batch->cache = cache;
+	}
+
+	if (!batch->storeInline && (batch->count == batch->capacity)) {
+		UDATA newCapacity = (0 == batch->capacity) ? 256 : (batch->capacity * 2);
+		const ShcItem** newItems = (const ShcItem**)j9mem_allocate_memory(newCapacity * sizeof(ShcItem*), J9MEM_CATEGORY_CLASSES);
+
+		if (NULL == newItems) {
+			storeBatch(currentThread, batch);
+			batch->storeInline = true;
+		} else if (0 != batch->count) {
+			memcpy((void*)newItems, (void*)batch->items, batch->count * sizeof(ShcItem*));
+		}
+		if (NULL != batch->items) {
+			j9mem_free_memory((void*)batch->items);
+		}
+		batch->items = newItems;
+		batch->capacity = newCapacity;
+		if (batch->storeInline) {
+			batch->count = 0;
+			batch->capacity = 0;
+		}
+	}
+
+	if (batch->storeInline) {
+		if (!batch->failed && !manager->storeNew(currentThread, item, cache)) {
+			batch->failed = true;
+		}
+	} else {
+		batch->items[batch->count] = item;
+		batch->count += 1;
+	}
+	return !batch->failed;
+}
+
+/**
+ * Store the items of a batch in the hashtables of its manager, in the order they were read.
+ *
+ * @param [in] currentThread  The current thread, or NULL on a helper thread
+ * @param [in] batch  The batch
+ */
+void
+SH_CacheMap::storeBatch(J9VMThread* currentThread, StoreBatch* batch)
+{
+	for (UDATA i = 0; (i < batch->count) && !batch->failed; i++) {
+		if (!batch->manager->storeNew(currentThread, batch->items[i], batch->cache)) {
+			batch->failed = true;
+		}
+	}
+}
+
+int J9THREAD_PROC
+SH_CacheMap::storeBatchThread(void* entryArg)
+{
+	/* Helper threads are not attached to the VM, the managers only pass the thread to tracepoints */
+	storeBatch(NULL, (StoreBatch*)entryArg);
+	return 0;
+}
+
+/**
+ * Store the batched items in the managers' hashtables. When there are enough items, each
+ * manager except the classpath manager and the one with the most items is populated by a helper thread.
+ * The classpath manager may need the VM thread, and populating the largest batch gives this
+ * thread its share of the work.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] batches  The batches
+ * @param [in] numBatches  The number of batches
+ *
+ * @return false if an item could not be stored, true otherwise
+ */
+bool
+SH_CacheMap::storeBatches(J9VMThread* currentThread, StoreBatch* batches, UDATA numBatches)
+{
+	UDATA totalItems = 0;
+	UDATA numThreads = 0;
+	StoreBatch* largest = NULL;
+	bool succeeded = true;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	for (UDATA i = 0; i < numBatches; i++) {
+		totalItems += batches[i].count;
+		batches[i].thread = NULL;
+		if ((batches[i].manager != _cpm) && ((NULL == largest) || (batches[i].count > largest->count))) {
+			largest = &batches[i];
+		}
+	}
+
+	if ((totalItems >= CM_PARALLEL_STORE_MIN_ITEMS) && (j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_ONLINE) > 1)) {
+		for (UDATA i = 0; i < numBatches; i++) {
+			StoreBatch* batch = &batches[i];
+
+			if ((0 != batch->count) && (batch != largest) && (batch->manager != _cpm)) {
+				omrthread_attr_t attr = NULL;
+
+				if (J9THREAD_SUCCESS == omrthread_attr_init(&attr)) {
+					if ((J9THREAD_SUCCESS == omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+						&& (J9THREAD_SUCCESS == omrthread_create_ex(&batch->thread, &attr, 0, storeBatchThread, batch))
+					) {
+						numThreads += 1;
+					} else {
+						batch->thread = NULL;
+					}
+					omrthread_attr_destroy(&attr);
+				}
+			}
+		}
+	}
+	Trc_SHR_CM_storeBatches_Event(currentThread, totalItems, numBatches, numThreads);
+
+	for (UDATA i = 0; i < numBatches; i++) {
+		if (NULL == batches[i].thread) {
+			storeBatch(currentThread, &batches[i]);
+		}
+	}
+	for (UDATA i = 0; i < numBatches; i++) {
+		if (NULL != batches[i].thread) {
+			omrthread_join(batches[i].thread);
+			batches[i].thread = NULL;
+		}
+		if (batches[i].failed) {
+			succeeded = false;
+		}
+	}
+	return succeeded;
+}
+
 /* THREADING: MUST be protected by cache write mutex - therefore single-threaded within this JVM */
 IDATA
 SH_CacheMap::checkForCrash(J9VMThread* currentThread, bool hasClassSegmentMutex, bool canUnlockCache)
@@ -2717,6 +2950,12 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 			*foundAtIndex = locateResult.foundAtIndex;
 		}
 		returnVal = (J9ROMClass*)getAddressFromJ9ShrOffset(&((locateResult.known)->romClassOffset));
+		if ((J9VM_PHASE_STARTUP == currentThread->javaVM->phase)
+			&& _ccHead->isAddressInROMClassSegment(returnVal)
+		) {
+			/* Only the profile of the top layer can be stored, lower layers are read-only */
+			_ccHead->updateStartupROMClassAccess(currentThread, (U_8 *)returnVal + returnVal->romSize);
+		}
 #if !defined(J9ZOS390) && !defined(AIXPPC)
 		if (_metadataReleaseCounter >= CM_CACHE_MAX_METADATA_RELEASES
 #if defined(LINUX)
@@ -5201,6 +5440,11 @@ SH_CacheMap::printCacheStatsAllLayersStatsHelper(J9VMThread* currentThread, UDAT
 	) {
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_NUM_EXTRA_STARTUP_HINTS, javacoreData->extraStartupHints);
 	}
+	if ((0 != javacoreData->startupMinorFaults) || (0 != javacoreData->startupMajorFaults)) {
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_STARTUP_ROMCLASS_BYTES, javacoreData->startupROMClassBytes);
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_STARTUP_MINOR_FAULTS, javacoreData->startupMinorFaults);
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_STARTUP_MAJOR_FAULTS, javacoreData->startupMajorFaults);
+	}
 	if (J9_ARE_ALL_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_DETAILED_STATS)) {
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_NUM_JCL_ENTRIES, javacoreData->numJclEntries);
 	}
@@ -5263,151 +5507,1272 @@ SH_CacheMap::printCacheStats(J9VMThread* currentThread, UDATA showFlags, U_64 ru
 			printCacheStatsAllLayersStatsHelper(currentThread, showFlags, runtimeFlags, &javacoreData, staleBytes);
 			printCacheStatsTopLayerSummaryStatsHelper(currentThread, showFlags, runtimeFlags, &javacoreData);
 		}
+		if (J9_ARE_ALL_BITS_SET(showFlags, PRINTSTATS_SHOW_RECLAIMABLE)) {
+			printReclaimableStats(currentThread, javacoreData.cacheSize - javacoreData.freeBytes);
+		}
 	}
 	return 0;
 }
 
-bool
-SH_CacheMap::isBytecodeAgentInstalled(void)
+static UDATA
+addressHashFn(void* entry, void* userData)
 {
-	return ((*_runtimeFlags & J9SHR_RUNTIMEFLAG_BYTECODE_AGENT_RUNNING) != 0);
+	return *(UDATA*)entry >> 3;
 }
 
-/**
- * Print verbose stats on cache shutdown
- */
-void
-SH_CacheMap::printShutdownStats(void)
+static UDATA
+addressHashEqualFn(void* left, void* right, void* userData)
 {
-	UDATA bytesStored = 0;
-	U_64 bytesRead = (U_64)_bytesRead;		/* U_64 for compatibility so that we don't have to change all the nls msgs */
-	U_32 softmxUnstoredBytes = 0;
-	U_32 maxAOTUnstoredBytes = 0;
-	U_32 maxJITUnstoredBytes = 0;
-	SH_CompositeCacheImpl* cache = _ccHead;
-	PORT_ACCESS_FROM_PORT(_portlib);
-
-	while (cache) {
-		bytesStored += cache->getTotalStoredBytes();
-		cache = cache->getNext();
-	}
-	getUnstoredBytes(&softmxUnstoredBytes, &maxAOTUnstoredBytes, &maxJITUnstoredBytes);
-
-	CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_READ_STORED, bytesRead, bytesStored);
-	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_UNSTORED_V1, softmxUnstoredBytes, maxAOTUnstoredBytes, maxJITUnstoredBytes);
+	return *(UDATA*)left == *(UDATA*)right;
 }
 
 /**
- * Run required code on JVM exit
+ * Print how much space is held by the metadata of stale items, the ROMClasses that are
+ * only referenced by stale items, and the AOT code and JIT data attached to the methods
+ * of those ROMClasses. Nothing is printed if the cache cannot be walked.
+ *
+ * The space is reclaimed by -Xshareclasses:compact, see compactCache(). Compacting also drops
+ * the AOT code and JIT data of the ROMClasses that are kept, as they refer to cache offsets.
+ *
+ * @param[in] currentThread  The current thread
+ * @param[in] usedBytes  The number of bytes in use in the cache
+ *
+ * THREADING: Only ever single-threaded
  */
 void
-SH_CacheMap::runExitCode(J9VMThread* currentThread)
-{
-	SH_Manager* walkManager;
-	SH_Managers::ManagerWalkState state;
-	SH_CompositeCacheImpl* cache = _ccHead;
-
-	printShutdownStats();
-
-	walkManager = managers()->startDo(currentThread, 0, &state);
-	while (walkManager) {
-		walkManager->runExitCode();
-		walkManager = managers()->nextDo(&state);
-	}
-
-	while (cache) {
-		cache->runExitCode(currentThread);
-		cache = cache->getNext();
-	}
-}
-
-/* Note: className can be NULL and if not, is not necessarily null-terminated */
-/* THREADING: Can be called multi-threaded */
-IDATA /*static */
-SH_CacheMap::createPathString(J9VMThread* currentThread, J9SharedClassConfig* config, char** pathBuf, UDATA pathBufSize, ClasspathEntryItem* cpei, const char* className, UDATA classNameLen, bool* doFreeBuffer)
-{
-	char* fullPath = *pathBuf;
-	U_16 cpeiPathLen = 0;
-	const char* cpeiPath = cpei->getLocation(&cpeiPathLen);
-	char* classNamePos = (char*)className;
-	UDATA cNameLen = classNameLen;
-	char* lastSlashPos = NULL;
-	UDATA sizeNeeded = 0;
-	const char* classNameTrc = NULL;
-	UDATA classNameTrcLen = 0;
-	J9PortLibrary* _portlib = currentThread->javaVM->portLibrary;
-
+SH_CacheMap::printReclaimableStats(J9VMThread* currentThread, UDATA usedBytes)
+{
+	const char* fnName = "printReclaimableStats";
+	J9HashTable* liveROMClasses = NULL;
+	J9HashTable* staleROMClasses = NULL;
+	J9HashTable* deadROMMethods = NULL;
+	J9HashTableState walkState;
+	J9ROMClass** romClassEntry = NULL;
+	SH_CompositeCacheImpl* cache = NULL;
+	UDATA staleMetadataBytes = 0;
+	UDATA numDeadROMClasses = 0;
+	UDATA deadROMClassBytes = 0;
+	UDATA numDeadMethodData = 0;
+	UDATA deadMethodDataBytes = 0;
+	UDATA reclaimableBytes = 0;
+	bool failed = false;
 	PORT_ACCESS_FROM_PORT(_portlib);
 
-	*doFreeBuffer = false;		/* Initialize to false */
-
-	if (!className) {
-		classNameTrc = "NULL";
-		classNameTrcLen = strlen(classNameTrc);
-	} else {
-		classNameTrc = className;
-		classNameTrcLen = classNameLen;
+	liveROMClasses = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), 0, sizeof(J9ROMClass*), sizeof(J9ROMClass*), 0, J9MEM_CATEGORY_CLASSES, addressHashFn, addressHashEqualFn, NULL, NULL);
+	staleROMClasses = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), 0, sizeof(J9ROMClass*), sizeof(J9ROMClass*), 0, J9MEM_CATEGORY_CLASSES, addressHashFn, addressHashEqualFn, NULL, NULL);
+	deadROMMethods = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), 0, sizeof(J9ROMMethod*), sizeof(J9ROMMethod*), 0, J9MEM_CATEGORY_CLASSES, addressHashFn, addressHashEqualFn, NULL, NULL);
+	if ((NULL == liveROMClasses) || (NULL == staleROMClasses) || (NULL == deadROMMethods)) {
+		goto done;
 	}
 
-	Trc_SHR_CM_createPathString_Entry(currentThread, cpeiPathLen, cpeiPath, classNameTrcLen, classNameTrc);
+	/* Sort the ROMClasses by whether any item which is not stale refers to them */
+	for (cache = _ccTail; (NULL != cache) && !failed; cache = cache->getPrevious()) {
+		ShcItem* it = NULL;
 
-	/* cannot use strrchr as may not be null-terminated */
-	if (classNamePos) {
-		IDATA cntr = cNameLen-1;
-		for (; cntr>=0; cntr--) {
-			if (classNamePos[cntr]=='/' || classNamePos[cntr]=='.') {
-				lastSlashPos = &(classNamePos[cntr]);
+		if (0 != cache->enterWriteMutex(currentThread, false, fnName)) {
+			failed = true;
+			break;
+		}
+		cache->findStart(currentThread);
+		while (!failed && (NULL != (it = (ShcItem*)cache->nextEntry(currentThread, NULL)))) {
+			ShcItemHdr* ih = (ShcItemHdr*)ITEMEND(it);
+			bool isStale = (0 != cache->stale((BlockPtr)ih));
+			J9ROMClass* romClass = NULL;
+
+			if (isStale) {
+				staleMetadataBytes += CCITEMLEN(ih);
+			}
+			switch (ITEMTYPE(it)) {
+			case TYPE_ROMCLASS :
+			case TYPE_SCOPED_ROMCLASS :
+				romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(it))->romClassOffset));
+				break;
+			case TYPE_ORPHAN :
+				romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(it))->romClassOffset));
+				break;
+			default :
 				break;
 			}
+			if ((NULL != romClass) && (NULL == hashTableAdd(isStale ? staleROMClasses : liveROMClasses, &romClass))) {
+				failed = true;
+			}
 		}
+		cache->exitWriteMutex(currentThread, fnName);
 	}
-	sizeNeeded = cpeiPathLen + cNameLen + SHARE_CLASS_FILE_EXT_STRLEN + 2;	/* 2 = pathsep + \0 */
-	if (sizeNeeded > pathBufSize) {
-		*pathBuf = (char*)j9mem_allocate_memory(sizeNeeded, J9MEM_CATEGORY_CLASSES);
-		fullPath = *pathBuf;
-		if (!fullPath) {
-			if (config->verboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT) {
-				CACHEMAP_PRINT(J9NLS_ERROR, J9NLS_SHRC_CM_FAILED_STRINGBUF_ALLOC);
+	if (failed) {
+		goto done;
+	}
+
+	romClassEntry = (J9ROMClass**)hashTableStartDo(staleROMClasses, &walkState);
+	while (!failed && (NULL != romClassEntry)) {
+		J9ROMClass* romClass = *romClassEntry;
+
+		if (NULL == hashTableFind(liveROMClasses, &romClass)) {
+			J9ROMMethod* romMethod = J9ROMCLASS_ROMMETHODS(romClass);
+
+			numDeadROMClasses += 1;
+			deadROMClassBytes += romClass->romSize;
+			for (U_32 i = 0; i < romClass->romMethodCount; i++) {
+				if (NULL == hashTableAdd(deadROMMethods, &romMethod)) {
+					failed = true;
+					break;
+				}
+				romMethod = nextROMMethod(romMethod);
 			}
-			Trc_SHR_CM_createPathString_Exception1(currentThread);
-			return -1;
 		}
-		Trc_SHR_CM_createPathString_AllocateBuffer(currentThread, sizeNeeded, fullPath);
-		*doFreeBuffer = true;
+		romClassEntry = (J9ROMClass**)hashTableNextDo(&walkState);
+	}
+	if (failed) {
+		goto done;
 	}
-	strncpy(fullPath, (char*)cpeiPath, cpeiPathLen);
-	fullPath[cpeiPathLen]='\0';
 
-	/* Create Package directory */
-	if (lastSlashPos) {
-		UDATA packageLen = (UDATA)(lastSlashPos - className);
-		char* packagePos = fullPath + cpeiPathLen + 1;
+	/* Find the AOT code and JIT data of the methods of the ROMClasses that can be dropped */
+	for (cache = _ccTail; (NULL != cache) && !failed; cache = cache->getPrevious()) {
+		ShcItem* it = NULL;
 
-		if (fullPath[strlen(fullPath)-1] != PATHSEP[0]) {
-			strcat(fullPath, PATHSEP);
+		if (0 != cache->enterWriteMutex(currentThread, false, fnName)) {
+			failed = true;
+			break;
 		}
-		strncat(fullPath, className, packageLen);
-		fullPath[cpeiPathLen + packageLen + 1] = '\0';
-		while (*packagePos) {				/* guaranteed to be null-terminated */
-			if ((*packagePos == '/') || (*packagePos == '.')) {
-				*packagePos = PATHSEP[0];
+		cache->findStart(currentThread);
+		while (NULL != (it = (ShcItem*)cache->nextEntry(currentThread, NULL))) {
+			ShcItemHdr* ih = (ShcItemHdr*)ITEMEND(it);
+			J9ROMMethod* romMethod = NULL;
+
+			if (0 != cache->stale((BlockPtr)ih)) {
+				/* Already counted as stale metadata */
+				continue;
+			}
+			switch (ITEMTYPE(it)) {
+			case TYPE_COMPILED_METHOD :
+				romMethod = (J9ROMMethod*)getAddressFromJ9ShrOffset(&(((CompiledMethodWrapper*)ITEMDATA(it))->romMethodOffset));
+				break;
+			case TYPE_ATTACHED_DATA :
+				romMethod = (J9ROMMethod*)getAddressFromJ9ShrOffset(&(((AttachedDataWrapper*)ITEMDATA(it))->cacheOffset));
+				break;
+			default :
+				break;
+			}
+			if ((NULL != romMethod) && (NULL != hashTableFind(deadROMMethods, &romMethod))) {
+				numDeadMethodData += 1;
+				deadMethodDataBytes += CCITEMLEN(ih);
 			}
-			packagePos++;
 		}
-		classNamePos = lastSlashPos+1;
-		cNameLen = classNameLen - packageLen - 1;
+		cache->exitWriteMutex(currentThread, fnName);
 	}
-	if (classNamePos) {
-		if (fullPath[strlen(fullPath)-1] != PATHSEP[0]) {
-			strcat(fullPath, PATHSEP);
-		}
-		strncat(fullPath, classNamePos, cNameLen);
-		fullPath[cpeiPathLen + classNameLen + 1] = '\0';
-		strcat(fullPath, SHARE_CLASS_FILE_EXT_STRING);
+	if (failed) {
+		goto done;
 	}
 
-	Trc_SHR_CM_createPathString_Exit(currentThread, fullPath);
-	return 0;
+	reclaimableBytes = staleMetadataBytes + deadROMClassBytes + deadMethodDataBytes;
+	j9tty_printf(_portlib, "\n");
+	CACHEMAP_PRINT(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_TITLE);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_STALE_METADATA_BYTES, staleMetadataBytes);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_NUM_ROMCLASSES, numDeadROMClasses);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_ROMCLASS_BYTES, deadROMClassBytes);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_NUM_METHOD_DATA, numDeadMethodData);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_METHOD_DATA_BYTES, deadMethodDataBytes);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_TOTAL_BYTES, reclaimableBytes);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RECLAIMABLE_PERC, (0 == usedBytes) ? 0 : (UDATA)(((U_64)reclaimableBytes * 100) / usedBytes));
+
+done:
+	if (NULL != deadROMMethods) {
+		hashTableFree(deadROMMethods);
+	}
+	if (NULL != staleROMClasses) {
+		hashTableFree(staleROMClasses);
+	}
+	if (NULL != liveROMClasses) {
+		hashTableFree(liveROMClasses);
+	}
+}
+
+#define COMPACT_CLASS_LIVE 0x1
+#define COMPACT_CLASS_PINNED 0x2
+#define COMPACT_CLASS_HOT 0x4
+
+#define COMPACT_CACHE_NAME_SUFFIX "_compact"
+
+/* Runtime flags of the running JVM that must not be applied to the cache created by compactCache() */
+#define COMPACT_CLEARED_RUNTIME_FLAGS \
+	(J9SHR_RUNTIMEFLAG_ENABLE_READONLY | J9SHR_RUNTIMEFLAG_ENABLE_STATS | J9SHR_RUNTIMEFLAG_DENY_CACHE_ACCESS \
+	| J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES | J9SHR_RUNTIMEFLAG_AUTOKILL_DIFF_BUILDID | J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT \
+	| J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT_ALL | J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT_RW | J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT_PARTIAL_PAGES \
+	| J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT_ONFIND | J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP | J9SHR_RUNTIMEFLAG_BLOCK_SPACE_FULL \
+	| J9SHR_RUNTIMEFLAG_AVAILABLE_SPACE_FULL | J9SHR_RUNTIMEFLAG_AOT_SPACE_FULL | J9SHR_RUNTIMEFLAG_JIT_SPACE_FULL \
+	| J9SHR_RUNTIMEFLAG_SNAPSHOT | J9SHR_RUNTIMEFLAG_RESTORE | J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE | J9SHR_RUNTIMEFLAG_CREATE_OLD_GEN \
+	| J9SHR_RUNTIMEFLAG_ENABLE_TEST_BAD_BUILDID | J9SHR_RUNTIMEFLAG_FAKE_CORRUPTION)
+
+/* The cache header flags that describe the classes in the cache, rather than the JVM that created it */
+#define COMPACT_COPIED_EXTRA_FLAGS \
+	(J9SHR_EXTRA_FLAGS_NO_LINE_NUMBERS | J9SHR_EXTRA_FLAGS_NO_LINE_NUMBER_CONTENT | J9SHR_EXTRA_FLAGS_LINE_NUMBER_CONTENT \
+	| J9SHR_EXTRA_FLAGS_BCI_ENABLED | J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS)
+
+/* A ROMClass of the cache being compacted, the extent of its out-of-line debug data and where both are copied to */
+typedef struct CompactClassEntry {
+	J9ROMClass* romClass;
+	SH_CompositeCacheImpl* cache;
+	ShcItem* firstLiveItem;
+	U_8* lntStart;
+	U_8* lntEnd;
+	U_8* lvtStart;
+	U_8* lvtEnd;
+	U_8* newROMClass;
+	U_8* newLNT;
+	U_8* newLVT;
+	UDATA flags;
+} CompactClassEntry;
+
+typedef struct CompactWalkState {
+	CompactClassEntry* classes;
+	UDATA classCount;
+	CompactClassEntry* current;
+	U_8* debugStart;
+	U_8* lntLimit;
+	U_8* lvtLimit;
+	U_8* debugEnd;
+	CompactClassEntry** worklist;
+	UDATA worklistCount;
+	bool fixup;
+	bool failed;
+} CompactWalkState;
+
+typedef struct CompactMovedItem {
+	void* oldAddress;
+	void* newAddress;
+} CompactMovedItem;
+
+static int
+compactClassCompare(const void* left, const void* right)
+{
+	UDATA leftAddress = (UDATA)((const CompactClassEntry*)left)->romClass;
+	UDATA rightAddress = (UDATA)((const CompactClassEntry*)right)->romClass;
+
+	if (leftAddress < rightAddress) {
+		return -1;
+	}
+	return (leftAddress > rightAddress) ? 1 : 0;
+}
+
+static CompactClassEntry*
+compactFindClass(CompactWalkState* state, U_8* address)
+{
+	UDATA low = 0;
+	UDATA high = state->classCount;
+
+	while (low < high) {
+		UDATA mid = low + ((high - low) / 2);
+		CompactClassEntry* entry = &state->classes[mid];
+		U_8* romClassStart = (U_8*)entry->romClass;
+
+		if (address < romClassStart) {
+			high = mid;
+		} else if (address >= (romClassStart + entry->romClass->romSize)) {
+			low = mid + 1;
+		} else {
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+static void
+compactSetCurrentClass(CompactWalkState* state, CompactClassEntry* entry)
+{
+	SH_CompositeCacheImpl* cache = entry->cache;
+
+	state->current = entry;
+	state->debugStart = (U_8*)cache->getClassDebugDataStartAddress();
+	state->debugEnd = state->debugStart + cache->getDebugBytes();
+	state->lntLimit = state->debugStart + cache->getLineNumberTableBytes();
+	state->lvtLimit = state->debugEnd - cache->getLocalVariableTableBytes();
+}
+
+static UDATA
+compactSlotSize(U_32 slotType)
+{
+	switch (slotType) {
+	case J9ROM_U8 :
+		return sizeof(U_8);
+	case J9ROM_U16 :
+		return sizeof(U_16);
+	case J9ROM_U64 :
+		return sizeof(U_64);
+	case J9ROM_WSRP :
+		return sizeof(J9WSRP);
+	default :
+		return sizeof(U_32);
+	}
+}
+
+/* Slots in the debug data are not aligned, so read them with memcpy() */
+static U_8*
+compactSlotTarget(U_32 slotType, void* slot)
+{
+	IDATA value = 0;
+
+	if (J9ROM_WSRP == slotType) {
+		J9WSRP wsrp = 0;
+		memcpy(&wsrp, slot, sizeof(J9WSRP));
+		value = (IDATA)wsrp;
+	} else {
+		J9SRP srp = 0;
+		memcpy(&srp, slot, sizeof(J9SRP));
+		value = (IDATA)srp;
+	}
+	return (0 == value) ? NULL : ((U_8*)slot + value);
+}
+
+/**
+ * Map an address in a ROMClass or in the out-of-line debug data of the current class
+ * to where it has been copied to. An address just past the end of the current class
+ * belongs to it, as SRPs to empty trailing sections point there.
+ */
+static U_8*
+compactNewAddress(CompactWalkState* state, U_8* address)
+{
+	CompactClassEntry* entry = state->current;
+	U_8* romClassStart = (U_8*)entry->romClass;
+
+	if ((address >= romClassStart) && (address <= (romClassStart + entry->romClass->romSize))) {
+		return entry->newROMClass + (address - romClassStart);
+	}
+	if ((address >= entry->lntStart) && (address < entry->lntEnd)) {
+		return entry->newLNT + (address - entry->lntStart);
+	}
+	if ((address >= entry->lvtStart) && (address < entry->lvtEnd)) {
+		return entry->newLVT + (address - entry->lvtStart);
+	}
+	entry = compactFindClass(state, address);
+	if ((NULL == entry) || (NULL == entry->newROMClass)) {
+		return NULL;
+	}
+	return entry->newROMClass + (address - (U_8*)entry->romClass);
+}
+
+/**
+ * Before the copy, pin the ROMClass that a slot of the current class points into.
+ * After the copy, rewrite the copy of the slot to point at the copy of its target.
+ */
+static void
+compactPointerSlot(CompactWalkState* state, U_32 slotType, void* slot)
+{
+	U_8* target = compactSlotTarget(slotType, slot);
+	U_8* romClassStart = (U_8*)state->current->romClass;
+	U_8* romClassEnd = romClassStart + state->current->romClass->romSize;
+
+	if (NULL == target) {
+		return;
+	}
+	if ((J9ROM_SRP == slotType) && (target >= state->debugStart) && (target < state->lntLimit)) {
+		/* Out-of-line debug info refers to its local variable table by an SRP that the walker reports as a U_32 */
+		J9MethodDebugInfo* methodDebugInfo = (J9MethodDebugInfo*)target;
+
+		if ((0 != methodDebugInfo->varInfoCount) && (0 == (methodDebugInfo->srpToVarInfo & 1))) {
+			compactPointerSlot(state, J9ROM_SRP, &methodDebugInfo->srpToVarInfo);
+		}
+	}
+
+	if (state->fixup) {
+		U_8* newSlot = compactNewAddress(state, (U_8*)slot);
+		U_8* newTarget = compactNewAddress(state, target);
+
+		if ((NULL == newSlot) || (NULL == newTarget)) {
+			state->failed = true;
+		} else if (J9ROM_WSRP == slotType) {
+			J9WSRP wsrp = (J9WSRP)(newTarget - newSlot);
+			memcpy(newSlot, &wsrp, sizeof(J9WSRP));
+		} else {
+			J9SRP srp = (J9SRP)(newTarget - newSlot);
+			memcpy(newSlot, &srp, sizeof(J9SRP));
+		}
+	} else if (((target < romClassStart) || (target > romClassEnd))
+		&& ((target < state->debugStart) || (target >= state->debugEnd))
+	) {
+		CompactClassEntry* entry = compactFindClass(state, target);
+
+		if (NULL == entry) {
+			state->failed = true;
+		} else if (J9_ARE_NO_BITS_SET(entry->flags, COMPACT_CLASS_LIVE | COMPACT_CLASS_PINNED)) {
+			/* A UTF8 shared with a ROMClass that no cache entry refers to */
+			entry->flags |= COMPACT_CLASS_PINNED;
+			state->worklist[state->worklistCount] = entry;
+			state->worklistCount += 1;
+		}
+	}
+}
+
+static void
+compactSlotCallback(J9ROMClass* romClass, U_32 slotType, void* slotPtr, const char* slotName, void* userData)
+{
+	CompactWalkState* state = (CompactWalkState*)userData;
+	CompactClassEntry* current = state->current;
+	U_8* slot = (U_8*)slotPtr;
+
+	if (state->failed) {
+		return;
+	}
+	if (!state->fixup && (slot >= state->debugStart) && (slot < state->debugEnd)) {
+		U_8* slotEnd = slot + compactSlotSize(slotType);
+
+		if (slot < state->lntLimit) {
+			if ((NULL == current->lntStart) || (slot < current->lntStart)) {
+				current->lntStart = slot;
+			}
+			if (slotEnd > current->lntEnd) {
+				current->lntEnd = slotEnd;
+			}
+		} else {
+			if ((NULL == current->lvtStart) || (slot < current->lvtStart)) {
+				current->lvtStart = slot;
+			}
+			if (slotEnd > current->lvtEnd) {
+				current->lvtEnd = slotEnd;
+			}
+		}
+	}
+
+	switch (slotType) {
+	case J9ROM_NAS :
+	{
+		/* The walker does not report the UTF8 SRPs of a J9ROMNameAndSignature it reaches through an SRP */
+		J9ROMNameAndSignature* nas = (J9ROMNameAndSignature*)compactSlotTarget(J9ROM_SRP, slot);
+
+		if (NULL != nas) {
+			compactPointerSlot(state, J9ROM_UTF8, &nas->name);
+			compactPointerSlot(state, J9ROM_UTF8, &nas->signature);
+		}
+		compactPointerSlot(state, J9ROM_SRP, slot);
+		break;
+	}
+	case J9ROM_SRP :
+	case J9ROM_WSRP :
+	case J9ROM_UTF8 :
+		compactPointerSlot(state, slotType, slot);
+		break;
+	default :
+		break;
+	}
+}
+
+static BOOLEAN
+compactValidateRangeCallback(J9ROMClass* romClass, void* address, UDATA length, void* userData)
+{
+	CompactWalkState* state = (CompactWalkState*)userData;
+	U_8* start = (U_8*)address;
+	U_8* romClassStart = (U_8*)romClass;
+
+	if ((start >= romClassStart) && ((start + length) <= (romClassStart + romClass->romSize))) {
+		return TRUE;
+	}
+	return ((start >= state->debugStart) && ((start + length) <= state->debugEnd)) ? TRUE : FALSE;
+}
+
+static void
+compactSetOffset(SH_CompositeCacheImpl* cache, const void* address, J9ShrOffset* offset)
+{
+#if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
+	offset->cacheLayer = 0;
+#endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
+	offset->offset = (U_32)((U_8*)address - (U_8*)cache->getCacheHeaderAddress());
+}
+
+static U_32
+compactWrapperSize(U_16 itemType)
+{
+	switch (itemType) {
+	case TYPE_ROMCLASS :
+		return sizeof(ROMClassWrapper);
+	case TYPE_SCOPED_ROMCLASS :
+		return sizeof(ScopedROMClassWrapper);
+	default :
+		return sizeof(OrphanWrapper);
+	}
+}
+
+/**
+ * Copy a classpath or scope item into the cache being created by compactCache(),
+ * and record where it moved to so the offsets of the items which refer to it can be updated.
+ *
+ * @param[in] currentThread  The current thread
+ * @param[in] newCache  The cache being created
+ * @param[in] movedItems  Maps the data of each copied item to its copy
+ * @param[in] it  The item to copy
+ * @param[in] dataLen  The length of the item data
+ * @param[in] isStale  Whether the item is stale
+ *
+ * @return true if the item was copied, false if the cache is full or out of memory
+ */
+bool
+SH_CacheMap::compactCopyItem(J9VMThread* currentThread, SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, ShcItem* it, U_32 dataLen, bool isStale)
+{
+	ShcItem item;
+	ShcItem* itemPtr = &item;
+	ShcItem* itemInCache = NULL;
+	CompactMovedItem moved;
+
+	newCache->initBlockData(&itemPtr, dataLen, ITEMTYPE(it));
+	itemInCache = (ShcItem*)newCache->allocateBlock(currentThread, itemPtr, SHC_WORDALIGN, 0);
+	if (NULL == itemInCache) {
+		return false;
+	}
+	memcpy(ITEMDATA(itemInCache), ITEMDATA(it), dataLen);
+	newCache->commitUpdate(currentThread, false);
+	if (isStale) {
+		/* ROMClass entries which are not stale may still refer to a stale classpath */
+		newCache->markStale(currentThread, (BlockPtr)ITEMEND(itemInCache), false);
+	}
+
+	moved.oldAddress = ITEMDATA(it);
+	moved.newAddress = ITEMDATA(itemInCache);
+	return (NULL != hashTableAdd(movedItems, &moved));
+}
+
+/**
+ * Point an offset of an item copied by compactCache() at the copy of the item it refers to.
+ *
+ * @param[in] newCache  The cache being created
+ * @param[in] movedItems  Maps the data of each copied item to its copy
+ * @param[in,out] offset  The offset to update. A zero offset is left as it is.
+ *
+ * @return true if the offset was updated, false if the item it refers to was not copied
+ */
+bool
+SH_CacheMap::compactRemapOffset(SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, J9ShrOffset* offset)
+{
+	CompactMovedItem* moved = NULL;
+	CompactMovedItem query;
+
+	if (
+#if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
+		(0 == offset->cacheLayer) &&
+#endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
+		(0 == offset->offset)
+	) {
+		return true;
+	}
+	query.oldAddress = getAddressFromJ9ShrOffset(offset);
+	moved = (CompactMovedItem*)hashTableFind(movedItems, &query);
+	if (NULL == moved) {
+		return false;
+	}
+	compactSetOffset(newCache, moved->newAddress, offset);
+	return true;
+}
+
+/**
+ * Write the copy of a ROMClass, scoped ROMClass or orphan wrapper, pointing it at the copy of its ROMClass
+ * and at the copies of its classpath and scopes.
+ *
+ * @param[in] newCache  The cache being created
+ * @param[in] movedItems  Maps the data of each copied classpath and scope to its copy
+ * @param[in] it  The wrapper item to copy
+ * @param[in] newItem  The item allocated for the copy
+ * @param[in] newROMClass  The copy of the ROMClass of the wrapper
+ *
+ * @return true if the wrapper was written, false if it refers to an item that was not copied
+ */
+bool
+SH_CacheMap::compactWriteROMClassWrapper(SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, ShcItem* it, ShcItem* newItem, U_8* newROMClass)
+{
+	U_16 itemType = ITEMTYPE(it);
+
+	memcpy(ITEMDATA(newItem), ITEMDATA(it), compactWrapperSize(itemType));
+	switch (itemType) {
+	case TYPE_ROMCLASS :
+	{
+		ROMClassWrapper* rcw = (ROMClassWrapper*)ITEMDATA(newItem);
+
+		compactSetOffset(newCache, newROMClass, &rcw->romClassOffset);
+		return compactRemapOffset(newCache, movedItems, &rcw->theCpOffset);
+	}
+	case TYPE_SCOPED_ROMCLASS :
+	{
+		ScopedROMClassWrapper* srcw = (ScopedROMClassWrapper*)ITEMDATA(newItem);
+
+		compactSetOffset(newCache, newROMClass, &srcw->romClassOffset);
+		return compactRemapOffset(newCache, movedItems, &srcw->theCpOffset)
+			&& compactRemapOffset(newCache, movedItems, &srcw->modContextOffset)
+			&& compactRemapOffset(newCache, movedItems, &srcw->partitionOffset);
+	}
+	default :
+		compactSetOffset(newCache, newROMClass, &((OrphanWrapper*)ITEMDATA(newItem))->romClassOffset);
+		return true;
+	}
+}
+
+/**
+ * Copy a byte data item into the cache being created by compactCache(). Private data is
+ * released, as the JVM which owned it is not attached to the new cache.
+ *
+ * @param[in] currentThread  The current thread
+ * @param[in] newCache  The cache being created
+ * @param[in] movedItems  Maps the data of each copied scope to its copy
+ * @param[in] it  The byte data item to copy
+ *
+ * @return true if the item was copied, false if the cache is full or the token was not copied
+ */
+bool
+SH_CacheMap::compactCopyByteData(J9VMThread* currentThread, SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, ShcItem* it)
+{
+	ByteDataWrapper* bdw = (ByteDataWrapper*)ITEMDATA(it);
+	ByteDataWrapper* newBdw = NULL;
+	U_32 dataLength = BDWLEN(bdw);
+	ShcItem item;
+	ShcItem* itemPtr = &item;
+	ShcItem* itemInCache = NULL;
+	BlockPtr externalBlock = NULL;
+	bool isReadWrite = (
+#if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
+		(0 != bdw->externalBlockOffset.cacheLayer) ||
+#endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
+		(0 != bdw->externalBlockOffset.offset));
+
+	if (isReadWrite) {
+		newCache->initBlockData(&itemPtr, sizeof(ByteDataWrapper), TYPE_BYTE_DATA);
+		itemInCache = (ShcItem*)newCache->allocateWithReadWriteBlock(currentThread, itemPtr, dataLength, &externalBlock);
+	} else {
+		newCache->initBlockData(&itemPtr, sizeof(ByteDataWrapper) + dataLength, TYPE_BYTE_DATA);
+		itemInCache = (ShcItem*)newCache->allocateBlock(currentThread, itemPtr, SHC_WORDALIGN, sizeof(ByteDataWrapper));
+	}
+	if (NULL == itemInCache) {
+		return false;
+	}
+
+	newBdw = (ByteDataWrapper*)ITEMDATA(itemInCache);
+	memcpy(newBdw, bdw, sizeof(ByteDataWrapper));
+	newBdw->inPrivateUse = 0;
+	newBdw->privateOwnerID = 0;
+	if (isReadWrite) {
+		compactSetOffset(newCache, externalBlock, &newBdw->externalBlockOffset);
+		memcpy(externalBlock, getDataFromByteDataWrapper(bdw), dataLength);
+	} else {
+		memcpy((U_8*)(newBdw + 1), getDataFromByteDataWrapper(bdw), dataLength);
+	}
+	if (!compactRemapOffset(newCache, movedItems, &newBdw->tokenOffset)) {
+		newCache->rollbackUpdate(currentThread);
+		return false;
+	}
+	newCache->commitUpdate(currentThread, false);
+	return true;
+}
+
+/**
+ * Rewrite the cache into a new layer 0 cache of the same name, merging all of its layers.
+ *
+ * Only the ROMClasses which a cache entry that is not stale refers to are copied, along with the
+ * ROMClasses whose UTF8s they share, their out-of-line debug data, their entries, the classpaths and
+ * scopes, and the byte data. The ROMClasses that were loaded during startup are copied first, so they
+ * are packed together at the start of the new cache.
+ *
+ * Cache entries refer to each other by their offset in the cache, and the JIT embeds those offsets in
+ * AOT code, class chains and JIT hints, none of which can be relocated. AOT code, JIT data, AOT headers,
+ * class chains, thunks and JIT hints are therefore dropped, and are regenerated by the JVMs that use
+ * the compacted cache.
+ *
+ * The new cache is created under a temporary name and replaces the layer 0 cache file once it is
+ * complete, after which the files of the upper layers are deleted. The cache is left unchanged on failure.
+ *
+ * @param[in] currentThread  The current thread
+ * @param[in] piconfig  The configuration the cache was started with
+ *
+ * @return 0 if the cache was compacted, -1 otherwise
+ *
+ * THREADING: Only ever single-threaded
+ */
+IDATA
+SH_CacheMap::compactCache(J9VMThread* currentThread, J9SharedClassPreinitConfig* piconfig)
+{
+	const char* fnName = "compactCache";
+	J9JavaVM* vm = currentThread->javaVM;
+	SH_CompositeCacheImpl* cache = NULL;
+	SH_CompositeCacheImpl* newCache = NULL;
+	SH_CompositeCacheImpl* newCacheMemory = NULL;
+	J9SharedClassCacheDescriptor* cacheDescriptorList = NULL;
+	J9SharedClassCacheDescriptor newCacheDescriptor;
+	J9SharedClassPreinitConfig newPiconfig;
+	J9HashTable* movedItems = NULL;
+	CompactClassEntry* classes = NULL;
+	CompactClassEntry** worklist = NULL;
+	CompactWalkState state;
+	char newCacheName[USER_SPECIFIED_CACHE_NAME_MAXLEN];
+	char cacheDirBuf[J9SH_MAXPATH];
+	char newCachePath[J9SH_MAXPATH];
+	char cachePath[J9SH_MAXPATH];
+	U_64 newRuntimeFlags = 0;
+	U_32 actualSize = 0;
+	UDATA localCrashCntr = 0;
+	bool cacheHasIntegrity = false;
+	bool newCacheStarted = false;
+	bool newCacheCreated = false;
+	bool newCacheLocked = false;
+	bool compacted = false;
+	UDATA lockedLayers = 0;
+	UDATA layerCount = 0;
+	UDATA classCount = 0;
+	UDATA copiedClasses = 0;
+	UDATA droppedItems = 0;
+	UDATA oldUsedBytes = 0;
+	UDATA newUsedBytes = 0;
+	UDATA extraFlags = 0;
+	UDATA nameLen = strlen(_cacheName);
+	U_8* startupEnd = NULL;
+	I_32 minAOT = -1;
+	I_32 maxAOT = -1;
+	I_32 minJIT = -1;
+	I_32 maxJIT = -1;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	memset(&state, 0, sizeof(CompactWalkState));
+
+	/* Hold the write mutex of every layer so that no other JVM adds to the cache while it is copied */
+	for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+		if (0 != cache->enterWriteMutex(currentThread, false, fnName)) {
+			CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_FAILED_ENTER_WRITE_MUTEX);
+			goto done;
+		}
+		lockedLayers += 1;
+		layerCount += 1;
+		oldUsedBytes += cache->getUsedBytes();
+		extraFlags |= cache->getCacheHeaderAddress()->extraFlags;
+		for (U_8* walk = (U_8*)cache->getBaseAddress(); walk < (U_8*)cache->getSegmentAllocPtr(); walk += ((J9ROMClass*)walk)->romSize) {
+			classCount += 1;
+		}
+	}
+
+	classes = (CompactClassEntry*)j9mem_allocate_memory((classCount + 1) * sizeof(CompactClassEntry), J9MEM_CATEGORY_CLASSES);
+	worklist = (CompactClassEntry**)j9mem_allocate_memory((classCount + 1) * sizeof(CompactClassEntry*), J9MEM_CATEGORY_CLASSES);
+	movedItems = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), 0, sizeof(CompactMovedItem), sizeof(void*), 0, J9MEM_CATEGORY_CLASSES, addressHashFn, addressHashEqualFn, NULL, NULL);
+	if ((NULL == classes) || (NULL == worklist) || (NULL == movedItems)) {
+		goto done;
+	}
+	memset(classes, 0, (classCount + 1) * sizeof(CompactClassEntry));
+	state.classes = classes;
+	state.classCount = classCount;
+	state.worklist = worklist;
+
+	classCount = 0;
+	for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+		J9SharedCacheHeader* header = cache->getCacheHeaderAddress();
+		U_8* startupROMClassEnd = (U_8*)cache->getBaseAddress() + header->startupROMClassBytes;
+
+		for (U_8* walk = (U_8*)cache->getBaseAddress(); walk < (U_8*)cache->getSegmentAllocPtr(); walk += ((J9ROMClass*)walk)->romSize) {
+			CompactClassEntry* entry = &classes[classCount];
+
+			entry->romClass = (J9ROMClass*)walk;
+			entry->cache = cache;
+			if ((walk + entry->romClass->romSize) <= startupROMClassEnd) {
+				entry->flags |= COMPACT_CLASS_HOT;
+			}
+			classCount += 1;
+		}
+	}
+	J9_SORT(classes, classCount, sizeof(CompactClassEntry), compactClassCompare);
+
+	/* The ROMClasses that an entry which is not stale refers to are kept */
+	for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+		ShcItem* it = NULL;
+
+		cache->findStart(currentThread);
+		while (NULL != (it = (ShcItem*)cache->nextEntry(currentThread, NULL))) {
+			J9ROMClass* romClass = NULL;
+			CompactClassEntry* entry = NULL;
+
+			if (0 != cache->stale((BlockPtr)ITEMEND(it))) {
+				continue;
+			}
+			switch (ITEMTYPE(it)) {
+			case TYPE_ROMCLASS :
+			case TYPE_SCOPED_ROMCLASS :
+				romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(it))->romClassOffset));
+				break;
+			case TYPE_ORPHAN :
+				romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(it))->romClassOffset));
+				break;
+			default :
+				continue;
+			}
+			entry = compactFindClass(&state, (U_8*)romClass);
+			if ((NULL == entry) || (entry->romClass != romClass)) {
+				CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_WALK_FAILED);
+				goto done;
+			}
+			if (NULL == entry->firstLiveItem) {
+				entry->firstLiveItem = it;
+				entry->flags |= COMPACT_CLASS_LIVE;
+				state.worklist[state.worklistCount] = entry;
+				state.worklistCount += 1;
+			}
+		}
+	}
+
+	/* Find the extent of the debug data of the kept ROMClasses, and keep the ROMClasses whose UTF8s they share */
+	while (0 != state.worklistCount) {
+		CompactClassEntry* entry = NULL;
+
+		state.worklistCount -= 1;
+		entry = state.worklist[state.worklistCount];
+		compactSetCurrentClass(&state, entry);
+		allSlotsInROMClassDo(entry->romClass, compactSlotCallback, NULL, compactValidateRangeCallback, &state);
+		if (state.failed) {
+			J9UTF8* className = J9ROMCLASS_CLASSNAME(entry->romClass);
+			CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_ROMCLASS_FAILED, (U_32)J9UTF8_LENGTH(className), J9UTF8_DATA(className));
+			goto done;
+		}
+	}
+
+	/* Create the new cache under a temporary name, sized to hold all the layers */
+	if (nameLen > (sizeof(newCacheName) - sizeof(COMPACT_CACHE_NAME_SUFFIX))) {
+		nameLen = sizeof(newCacheName) - sizeof(COMPACT_CACHE_NAME_SUFFIX);
+	}
+	j9str_printf(PORTLIB, newCacheName, sizeof(newCacheName), "%.*s%s", (U_32)nameLen, _cacheName, COMPACT_CACHE_NAME_SUFFIX);
+	memcpy(&newPiconfig, piconfig, sizeof(J9SharedClassPreinitConfig));
+	newPiconfig.sharedClassCacheSize = 0;
+	newPiconfig.sharedClassDebugAreaBytes = 0;
+	newPiconfig.sharedClassReadWriteBytes = 0;
+	for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+		newPiconfig.sharedClassCacheSize += cache->getTotalSize();
+		newPiconfig.sharedClassDebugAreaBytes += cache->getDebugBytes();
+		newPiconfig.sharedClassReadWriteBytes += cache->getReadWriteBytes();
+	}
+	_ccTail->getMinMaxBytes(NULL, &minAOT, &maxAOT, &minJIT, &maxJIT);
+	newPiconfig.sharedClassMinAOTSize = minAOT;
+	newPiconfig.sharedClassMaxAOTSize = maxAOT;
+	newPiconfig.sharedClassMinJITSize = minJIT;
+	newPiconfig.sharedClassMaxJITSize = maxJIT;
+	newPiconfig.sharedClassSoftMaxBytes = -1;
+	newRuntimeFlags = *_runtimeFlags & ~COMPACT_CLEARED_RUNTIME_FLAGS;
+
+	newCacheMemory = (SH_CompositeCacheImpl*)j9mem_allocate_memory(SH_CompositeCacheImpl::getRequiredConstrBytesWithCommonInfo(false, false), J9MEM_CATEGORY_CLASSES);
+	if (NULL == newCacheMemory) {
+		goto done;
+	}
+	newCache = SH_CompositeCacheImpl::newInstance(vm, _sharedClassConfig, newCacheMemory, newCacheName, J9PORT_SHR_CACHE_TYPE_PERSISTENT, false, 0);
+	/* Starting a layer 0 cache records it in the cache descriptor list of the JVM, which must keep describing the running cache */
+	memset(&newCacheDescriptor, 0, sizeof(J9SharedClassCacheDescriptor));
+	cacheDescriptorList = _sharedClassConfig->cacheDescriptorList;
+	_sharedClassConfig->cacheDescriptorList = &newCacheDescriptor;
+	newCacheStarted = (CC_STARTUP_OK == newCache->startup(currentThread, &newPiconfig, NULL, &newRuntimeFlags, _verboseFlags, newCacheName, _cacheDir,
+			vm->sharedCacheAPI->cacheDirPerm, &actualSize, &localCrashCntr, true, &cacheHasIntegrity));
+	_sharedClassConfig->cacheDescriptorList = cacheDescriptorList;
+	if (!newCacheStarted) {
+		CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_CREATE_FAILED, newCacheName);
+		goto done;
+	}
+	if (!newCache->isNewCache()) {
+		/* Never delete or overwrite a cache this function did not create */
+		CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_CACHE_EXISTS, newCacheName);
+		goto done;
+	}
+	newCacheCreated = true;
+	if (0 != newCache->enterWriteMutex(currentThread, false, fnName)) {
+		CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_FAILED_ENTER_WRITE_MUTEX);
+		goto done;
+	}
+	newCacheLocked = true;
+
+	/* Copy the classpaths and scopes first, so the ROMClass entries and byte data can refer to their copies */
+	for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+		ShcItem* it = NULL;
+
+		cache->findStart(currentThread);
+		while (NULL != (it = (ShcItem*)cache->nextEntry(currentThread, NULL))) {
+			bool isStale = (0 != cache->stale((BlockPtr)ITEMEND(it)));
+			U_32 dataLen = 0;
+
+			if (TYPE_CLASSPATH == ITEMTYPE(it)) {
+				dataLen = sizeof(ClasspathWrapper) + ((ClasspathWrapper*)ITEMDATA(it))->classpathItemSize;
+			} else if (TYPE_SCOPE == ITEMTYPE(it)) {
+				dataLen = (U_32)J9UTF8_TOTAL_SIZE((J9UTF8*)ITEMDATA(it));
+			} else {
+				continue;
+			}
+			if (!compactCopyItem(currentThread, newCache, movedItems, it, dataLen, isStale)) {
+				CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_COPY_FAILED, newCacheName);
+				goto done;
+			}
+		}
+	}
+
+	/* Copy the ROMClasses loaded during startup of every layer first, then the others */
+	for (UDATA pass = 0; pass < 2; pass++) {
+		UDATA passFlags = (0 == pass) ? COMPACT_CLASS_HOT : 0;
+
+		for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+			for (UDATA i = 0; i < classCount; i++) {
+				CompactClassEntry* entry = &classes[i];
+				J9UTF8* className = J9ROMCLASS_CLASSNAME(entry->romClass);
+				U_16 classNameLength = J9UTF8_LENGTH(className);
+				const char* classNameData = (const char*)J9UTF8_DATA(className);
+				ShcItem item;
+				ShcItem* itemPtr = &item;
+				ShcItem* itemInCache = NULL;
+				BlockPtr romClassBuffer = NULL;
+				J9RomClassRequirements sizes;
+				J9SharedRomClassPieces pieces;
+				bool hasDebugData = false;
+
+				if ((entry->cache != cache)
+					|| J9_ARE_NO_BITS_SET(entry->flags, COMPACT_CLASS_LIVE | COMPACT_CLASS_PINNED)
+					|| ((entry->flags & COMPACT_CLASS_HOT) != passFlags)
+				) {
+					continue;
+				}
+
+				memset(&sizes, 0, sizeof(J9RomClassRequirements));
+				memset(&pieces, 0, sizeof(J9SharedRomClassPieces));
+				sizes.lineNumberTableSize = (U_32)ROUND_UP_TO(sizeof(U_32), (UDATA)(entry->lntEnd - entry->lntStart));
+				sizes.localVariableTableSize = (U_32)ROUND_UP_TO(sizeof(U_32), (UDATA)(entry->lvtEnd - entry->lvtStart));
+				hasDebugData = ((0 != sizes.lineNumberTableSize) || (0 != sizes.localVariableTableSize));
+				if (hasDebugData && (0 != newCache->allocateClassDebugData(currentThread, classNameLength, classNameData, &sizes, &pieces))) {
+					CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_COPY_FAILED, newCacheName);
+					goto done;
+				}
+
+				if (NULL != entry->firstLiveItem) {
+					newCache->initBlockData(&itemPtr, compactWrapperSize(ITEMTYPE(entry->firstLiveItem)), ITEMTYPE(entry->firstLiveItem));
+				} else {
+					/* A ROMClass kept only for the UTF8s it shares is stored as an orphan */
+					newCache->initBlockData(&itemPtr, sizeof(OrphanWrapper), TYPE_ORPHAN);
+				}
+				itemInCache = (ShcItem*)newCache->allocateWithSegment(currentThread, itemPtr, SHC_ROMCLASSPAD(entry->romClass->romSize), &romClassBuffer);
+				if (NULL == itemInCache) {
+					if (hasDebugData) {
+						newCache->rollbackClassDebugData(currentThread, classNameLength, classNameData);
+					}
+					CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_COPY_FAILED, newCacheName);
+					goto done;
+				}
+
+				memcpy(romClassBuffer, entry->romClass, entry->romClass->romSize);
+				entry->newROMClass = (U_8*)romClassBuffer;
+				if (NULL != entry->lntStart) {
+					entry->newLNT = (U_8*)pieces.lineNumberTable;
+					memcpy(entry->newLNT, entry->lntStart, entry->lntEnd - entry->lntStart);
+				}
+				if (NULL != entry->lvtStart) {
+					entry->newLVT = (U_8*)pieces.localVariableTable;
+					memcpy(entry->newLVT, entry->lvtStart, entry->lvtEnd - entry->lvtStart);
+				}
+
+				if (NULL != entry->firstLiveItem) {
+					if (!compactWriteROMClassWrapper(newCache, movedItems, entry->firstLiveItem, itemInCache, entry->newROMClass)) {
+						newCache->rollbackUpdate(currentThread);
+						if (hasDebugData) {
+							newCache->rollbackClassDebugData(currentThread, classNameLength, classNameData);
+						}
+						CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_COPY_FAILED, newCacheName);
+						goto done;
+					}
+				} else {
+					compactSetOffset(newCache, entry->newROMClass, &((OrphanWrapper*)ITEMDATA(itemInCache))->romClassOffset);
+				}
+				if (hasDebugData) {
+					newCache->commitClassDebugData(currentThread, classNameLength, classNameData);
+				}
+				newCache->commitUpdate(currentThread, false);
+				copiedClasses += 1;
+				if (0 == pass) {
+					startupEnd = entry->newROMClass + entry->romClass->romSize;
+				}
+			}
+		}
+	}
+
+	/* Copy the other ROMClass entries which are not stale, and the byte data that does not refer to cache offsets */
+	for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+		ShcItem* it = NULL;
+
+		cache->findStart(currentThread);
+		while (NULL != (it = (ShcItem*)cache->nextEntry(currentThread, NULL))) {
+			bool copied = true;
+
+			if (0 != cache->stale((BlockPtr)ITEMEND(it))) {
+				continue;
+			}
+			switch (ITEMTYPE(it)) {
+			case TYPE_ROMCLASS :
+			case TYPE_SCOPED_ROMCLASS :
+			case TYPE_ORPHAN :
+			{
+				ShcItem item;
+				ShcItem* itemPtr = &item;
+				ShcItem* itemInCache = NULL;
+				J9ShrOffset* romClassOffset = (TYPE_ORPHAN == ITEMTYPE(it))
+						? &(((OrphanWrapper*)ITEMDATA(it))->romClassOffset)
+						: &(((ROMClassWrapper*)ITEMDATA(it))->romClassOffset);
+				CompactClassEntry* entry = compactFindClass(&state, (U_8*)getAddressFromJ9ShrOffset(romClassOffset));
+
+				if (entry->firstLiveItem == it) {
+					break;
+				}
+				newCache->initBlockData(&itemPtr, compactWrapperSize(ITEMTYPE(it)), ITEMTYPE(it));
+				itemInCache = (ShcItem*)newCache->allocateBlock(currentThread, itemPtr, SHC_WORDALIGN, 0);
+				if (NULL == itemInCache) {
+					copied = false;
+				} else if (!compactWriteROMClassWrapper(newCache, movedItems, it, itemInCache, entry->newROMClass)) {
+					newCache->rollbackUpdate(currentThread);
+					copied = false;
+				} else {
+					newCache->commitUpdate(currentThread, false);
+				}
+				break;
+			}
+			case TYPE_BYTE_DATA :
+				switch (BDWTYPE((ByteDataWrapper*)ITEMDATA(it))) {
+				case J9SHR_DATA_TYPE_AOTHEADER :
+				case J9SHR_DATA_TYPE_CACHELET :
+				case J9SHR_DATA_TYPE_JITHINT :
+				case J9SHR_DATA_TYPE_AOTCLASSCHAIN :
+				case J9SHR_DATA_TYPE_AOTTHUNK :
+					droppedItems += 1;
+					break;
+				default :
+					copied = compactCopyByteData(currentThread, newCache, movedItems, it);
+					break;
+				}
+				break;
+			case TYPE_COMPILED_METHOD :
+			case TYPE_INVALIDATED_COMPILED_METHOD :
+			case TYPE_ATTACHED_DATA :
+			case TYPE_UNINDEXED_BYTE_DATA :
+			case TYPE_CACHELET :
+				droppedItems += 1;
+				break;
+			default :
+				/* Classpaths and scopes are already copied, and the merged cache has no prerequisite cache */
+				break;
+			}
+			if (!copied) {
+				CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_COPY_FAILED, newCacheName);
+				goto done;
+			}
+		}
+	}
+
+	/* Point the SRPs of the copied ROMClasses and debug data at the copies of their targets */
+	state.fixup = true;
+	for (UDATA i = 0; i < classCount; i++) {
+		CompactClassEntry* entry = &classes[i];
+
+		if (NULL == entry->newROMClass) {
+			continue;
+		}
+		compactSetCurrentClass(&state, entry);
+		allSlotsInROMClassDo(entry->romClass, compactSlotCallback, NULL, compactValidateRangeCallback, &state);
+		if (state.failed) {
+			J9UTF8* className = J9ROMCLASS_CLASSNAME(entry->romClass);
+			CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_ROMCLASS_FAILED, (U_32)J9UTF8_LENGTH(className), J9UTF8_DATA(className));
+			goto done;
+		}
+	}
+
+	newCache->setCacheHeaderExtraFlags(currentThread, extraFlags & COMPACT_COPIED_EXTRA_FLAGS);
+	if (NULL != startupEnd) {
+		J9SharedCacheHeader* header = _ccHead->getCacheHeaderAddress();
+
+		newCache->updateStartupROMClassAccess(currentThread, startupEnd);
+		newCache->setStartupAccessProfile(currentThread, header->startupMinorFaults, header->startupMajorFaults);
+	}
+	newUsedBytes = newCache->getUsedBytes();
+
+	/* Exit the write mutex before runExitCode() so that the CRC of the new cache is updated */
+	newCache->exitWriteMutex(currentThread, fnName);
+	newCacheLocked = false;
+	newCache->runExitCode(currentThread);
+	SH_OSCache::getCacheDir(vm, _cacheDir, cacheDirBuf, J9SH_MAXPATH, J9PORT_SHR_CACHE_TYPE_PERSISTENT, false);
+	SH_OSCache::getCachePathName(PORTLIB, cacheDirBuf, newCachePath, J9SH_MAXPATH, newCache->getCacheNameWithVGen());
+	SH_OSCache::getCachePathName(PORTLIB, cacheDirBuf, cachePath, J9SH_MAXPATH, _ccTail->getCacheNameWithVGen());
+	newCache->cleanup(currentThread);
+	newCacheCreated = false;
+	newCache = NULL;
+
+	/* The layer 0 cache file is replaced as a whole. Any failure before this point leaves the cache unchanged. */
+	if (0 != j9file_move(newCachePath, cachePath)) {
+		CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_RENAME_FAILED, cachePath, newCachePath);
+		j9file_unlink(newCachePath);
+		goto done;
+	}
+	for (cache = _ccTail->getPrevious(); NULL != cache; cache = cache->getPrevious()) {
+		SH_OSCache::getCachePathName(PORTLIB, cacheDirBuf, cachePath, J9SH_MAXPATH, cache->getCacheNameWithVGen());
+		if (0 != j9file_unlink(cachePath)) {
+			CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_COMPACT_LAYER_DELETE_FAILED, (I_32)cache->getLayer(), cachePath);
+		}
+	}
+	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_INFO, J9NLS_SHRC_CM_COMPACT_CLASSES, copiedClasses, layerCount, classCount - copiedClasses);
+	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_INFO, J9NLS_SHRC_CM_COMPACT_BYTES, oldUsedBytes, newUsedBytes, droppedItems);
+	compacted = true;
+
+done:
+	if (newCacheLocked) {
+		newCache->exitWriteMutex(currentThread, fnName);
+	}
+	if (newCacheCreated) {
+		newCache->deleteCache(currentThread, true);
+	}
+	if (NULL != newCache) {
+		newCache->cleanup(currentThread);
+	}
+	if (NULL != newCacheMemory) {
+		j9mem_free_memory(newCacheMemory);
+	}
+	if (NULL != movedItems) {
+		hashTableFree(movedItems);
+	}
+	if (NULL != worklist) {
+		j9mem_free_memory(worklist);
+	}
+	if (NULL != classes) {
+		j9mem_free_memory(classes);
+	}
+	for (cache = _ccTail; (NULL != cache) && (0 != lockedLayers); cache = cache->getPrevious()) {
+		cache->exitWriteMutex(currentThread, fnName);
+		lockedLayers -= 1;
+	}
+	return compacted ? 0 : -1;
+}
+
+bool
+SH_CacheMap::isBytecodeAgentInstalled(void)
+{
+	return ((*_runtimeFlags & J9SHR_RUNTIMEFLAG_BYTECODE_AGENT_RUNNING) != 0);
+}
+
+/**
+ * Print verbose stats on cache shutdown
+ */
+void
+SH_CacheMap::printShutdownStats(void)
+{
+	UDATA bytesStored = 0;
+	U_64 bytesRead = (U_64)_bytesRead;		/* U_64 for compatibility so that we don't have to change all the nls msgs */
+	U_32 softmxUnstoredBytes = 0;
+	U_32 maxAOTUnstoredBytes = 0;
+	U_32 maxJITUnstoredBytes = 0;
+	SH_CompositeCacheImpl* cache = _ccHead;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	while (cache) {
+		bytesStored += cache->getTotalStoredBytes();
+		cache = cache->getNext();
+	}
+	getUnstoredBytes(&softmxUnstoredBytes, &maxAOTUnstoredBytes, &maxJITUnstoredBytes);
+
+	CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_READ_STORED, bytesRead, bytesStored);
+	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_UNSTORED_V1, softmxUnstoredBytes, maxAOTUnstoredBytes, maxJITUnstoredBytes);
+}
+
+/**
+ * Run required code on JVM exit
+ */
+void
+SH_CacheMap::runExitCode(J9VMThread* currentThread)
+{
+	SH_Manager* walkManager;
+	SH_Managers::ManagerWalkState state;
+	SH_CompositeCacheImpl* cache = _ccHead;
+
+	printShutdownStats();
+
+	walkManager = managers()->startDo(currentThread, 0, &state);
+	while (walkManager) {
+		walkManager->runExitCode();
+		walkManager = managers()->nextDo(&state);
+	}
+
+	while (cache) {
+		cache->runExitCode(currentThread);
+		cache = cache->getNext();
+	}
+}
+
+/* Note: className can be NULL and if not, is not necessarily null-terminated */
+/* THREADING: Can be called multi-threaded */
+IDATA /*static */
+SH_CacheMap::createPathString(J9VMThread* currentThread, J9SharedClassConfig* config, char** pathBuf, UDATA pathBufSize, ClasspathEntryItem* cpei, const char* className, UDATA classNameLen, bool* doFreeBuffer)
+{
+	char* fullPath = *pathBuf;
+	U_16 cpeiPathLen = 0;
+	const char* cpeiPath = cpei->getLocation(&cpeiPathLen);
+	char* classNamePos = (char*)className;
+	UDATA cNameLen = classNameLen;
+	char* lastSlashPos = NULL;
+	UDATA sizeNeeded = 0;
+	const char* classNameTrc = NULL;
+	UDATA classNameTrcLen = 0;
+	J9PortLibrary* _portlib = currentThread->javaVM->portLibrary;
+
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	*doFreeBuffer = false;		/* Initialize to false */
+
+	if (!className) {
+		classNameTrc = "NULL";
+		classNameTrcLen = strlen(classNameTrc);
+	} else {
+		classNameTrc = className;
+		classNameTrcLen = classNameLen;
+	}
+
+	Trc_SHR_CM_createPathString_Entry(currentThread, cpeiPathLen, cpeiPath, classNameTrcLen, classNameTrc);
+
+	/* cannot use strrchr as may not be null-terminated */
+	if (classNamePos) {
+		IDATA cntr = cNameLen-1;
+		for (; cntr>=0; cntr--) {
+			if (classNamePos[cntr]=='/' || classNamePos[cntr]=='.') {
+				lastSlashPos = &(classNamePos[cntr]);
+				break;
+			}
+		}
+	}
+	sizeNeeded = cpeiPathLen + cNameLen + SHARE_CLASS_FILE_EXT_STRLEN + 2;	/* 2 = pathsep + \0 */
+	if (sizeNeeded > pathBufSize) {
+		*pathBuf = (char*)j9mem_allocate_memory(sizeNeeded, J9MEM_CATEGORY_CLASSES);
+		fullPath = *pathBuf;
+		if (!fullPath) {
+			if (config->verboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT) {
+				CACHEMAP_PRINT(J9NLS_ERROR, J9NLS_SHRC_CM_FAILED_STRINGBUF_ALLOC);
+			}
+			Trc_SHR_CM_createPathString_Exception1(currentThread);
+			return -1;
+		}
+		Trc_SHR_CM_createPathString_AllocateBuffer(currentThread, sizeNeeded, fullPath);
+		*doFreeBuffer = true;
+	}
+	strncpy(fullPath, (char*)cpeiPath, cpeiPathLen);
+	fullPath[cpeiPathLen]='\0';
+
+	/* Create Package directory */
+	if (lastSlashPos) {
+		UDATA packageLen = (UDATA)(lastSlashPos - className);
+		char* packagePos = fullPath + cpeiPathLen + 1;
+
+		if (fullPath[strlen(fullPath)-1] != PATHSEP[0]) {
+			strcat(fullPath, PATHSEP);
+		}
+		strncat(fullPath, className, packageLen);
+		fullPath[cpeiPathLen + packageLen + 1] = '\0';
+		while (*packagePos) {				/* guaranteed to be null-terminated */
+			if ((*packagePos == '/') || (*packagePos == '.')) {
+				*packagePos = PATHSEP[0];
+			}
+			packagePos++;
+		}
+		classNamePos = lastSlashPos+1;
+		cNameLen = classNameLen - packageLen - 1;
+	}
+	if (classNamePos) {
+		if (fullPath[strlen(fullPath)-1] != PATHSEP[0]) {
+			strcat(fullPath, PATHSEP);
+		}
+		strncat(fullPath, classNamePos, cNameLen);
+		fullPath[cpeiPathLen + classNameLen + 1] = '\0';
+		strcat(fullPath, SHARE_CLASS_FILE_EXT_STRING);
+	}
+
+	Trc_SHR_CM_createPathString_Exit(currentThread, fullPath);
+	return 0;
 }
 
 /**
@@ -7123,3 +8488,23 @@ SH_CacheMap::setExtraStartupHints(J9VMThread* currentThread)
 	CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_INFO, J9NLS_SHRC_CC_EXTRA_STARTUPHINTS_SET, val);
 	_ccHead->exitWriteMutex(currentThread, fnName);
 }
+
+/**
+ * Get the number of page faults incurred by this process so far.
+ *
+ * @param [out] minorFaults Faults that were serviced without I/O
+ * @param [out] majorFaults Faults that required I/O
+ */
+static void
+getProcessPageFaults(UDATA *minorFaults, UDATA *majorFaults)
+{
+	*minorFaults = 0;
+	*majorFaults = 0;
+#if defined(LINUX)
+	struct rusage usage;
+	if (0 == getrusage(RUSAGE_SELF, &usage)) {
+		*minorFaults = (UDATA)usage.ru_minflt;
+		*majorFaults = (UDATA)usage.ru_majflt;
+	}
+#endif /* defined(LINUX) */
+}
@@ -41,6 +41,9 @@
 
 #define CM_CACHE_MAX_METADATA_RELEASES 2
 
+/* Number of items read at startup from which the manager hashtables are populated by helper threads */
+#define CM_PARALLEL_STORE_MIN_ITEMS 4096
+
 /*
  * The maximum width of the hexadecimal representation of a value of type 'T'.
  */
@@ -135,6 +138,8 @@ public:
 
 	void dontNeedMetadata(J9VMThread* currentThread);
 
+	void storeStartupAccessProfile(J9VMThread* currentThread);
+
 	/**
 	 * This function is extremely hot.
 	 * Peeks to see whether compiled code exists for a given ROMMethod in the CompiledMethodManager hashtable
@@ -282,6 +287,8 @@ public:
 
 	void setExtraStartupHints(J9VMThread* currentThread);
 
+	IDATA compactCache(J9VMThread* currentThread, J9SharedClassPreinitConfig* piconfig);
+
 private:
 	SH_CompositeCacheImpl* _cc; /* current cache */
 
@@ -324,6 +331,8 @@ private:
 	U_32 _actualSize;
 	J9Pool* _ccPool;
 	int32_t _metadataReleaseCounter;
+	UDATA _startupMinorFaults; /* page faults of this process when the cache was attached */
+	UDATA _startupMajorFaults;
 
 	bool _isAssertEnabled; /* flag to turn on/off assertion before acquiring local mutex */
 
@@ -335,6 +344,26 @@ private:
 
 	IDATA readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, IDATA expectedUpdates, bool startupForStats);
 
+	/* Items read from the cache for one manager, stored in its hashtables once the whole cache has been read */
+	struct StoreBatch {
+		SH_Manager* manager;
+		SH_CompositeCacheImpl* cache;
+		const ShcItem** items;
+		UDATA count;
+		UDATA capacity;
+		bool storeInline; /* the items array could not be grown, items are stored as they are read */
+		bool failed;
+		omrthread_t thread;
+	};
+
+	bool batchNewItem(J9VMThread* currentThread, StoreBatch* batches, UDATA* numBatches, SH_Manager* manager, SH_CompositeCacheImpl* cache, const ShcItem* item);
+
+	bool storeBatches(J9VMThread* currentThread, StoreBatch* batches, UDATA numBatches);
+
+	static void storeBatch(J9VMThread* currentThread, StoreBatch* batch);
+
+	static int J9THREAD_PROC storeBatchThread(void* entryArg);
+
 	IDATA refreshHashtables(J9VMThread* currentThread, bool hasClassSegmentMutex);
 
 	ClasspathWrapper* addClasspathToCache(J9VMThread* currentThread, ClasspathItem* obj);
@@ -384,6 +413,16 @@ private:
 
 	IDATA printAllCacheStats(J9VMThread* currentThread, UDATA showFlags, SH_CompositeCacheImpl* cache, U_32* staleBytes);
 
+	void printReclaimableStats(J9VMThread* currentThread, UDATA usedBytes);
+
+	bool compactCopyItem(J9VMThread* currentThread, SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, ShcItem* it, U_32 dataLen, bool isStale);
+
+	bool compactRemapOffset(SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, J9ShrOffset* offset);
+
+	bool compactWriteROMClassWrapper(SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, ShcItem* it, ShcItem* newItem, U_8* newROMClass);
+
+	bool compactCopyByteData(J9VMThread* currentThread, SH_CompositeCacheImpl* newCache, J9HashTable* movedItems, ShcItem* it);
+
 	IDATA resetAllManagers(J9VMThread* currentThread);
 
 	void updateAllManagersWithNewCacheArea(J9VMThread* currentThread, SH_CompositeCacheImpl* newArea);
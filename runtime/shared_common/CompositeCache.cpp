@@ -159,9 +159,9 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
 	ca->extraStartupHints = DEFAULT_STARTUPHINTS;
-	ca->unused8 = 0;
-	ca->unused9 = 0;
-	ca->unused10 = 0;
+	ca->startupROMClassBytes = 0;
+	ca->startupMinorFaults = 0;
+	ca->startupMajorFaults = 0;
 	/* Note that the updateCountLockWord is only ever used single threaded, so no need to dereference this */
 	WSRP_SET(ca->updateCountPtr, &(ca->updateCount));
 	WSRP_SET(ca->corruptFlagPtr, &(ca->corruptFlag));
@@ -230,6 +230,7 @@ SH_CompositeCacheImpl::commonInit(J9JavaVM* vm)
 	_initializingNewCache = false;
 	_minimumAccessedShrCacheMetadata = 0;
 	_maximumAccessedShrCacheMetadata = 0;
+	_maximumStartupROMClassAccess = 0;
 	_layer = 0;
 }
 
@@ -4491,6 +4492,9 @@ SH_CompositeCacheImpl::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDe
 		descriptor->softMaxBytes = (UDATA)((U_32)-1 == _theca->softMaxBytes ? descriptor->cacheSize : _theca->softMaxBytes);
 		descriptor->currentOSPageSize = getOSPageSize();
 		descriptor->extraStartupHints = getExtraStartupHints();
+		descriptor->startupROMClassBytes = _theca->startupROMClassBytes;
+		descriptor->startupMinorFaults = _theca->startupMinorFaults;
+		descriptor->startupMajorFaults = _theca->startupMajorFaults;
 #if defined(J9VM_OPT_JITSERVER)
 		descriptor->usingJITServerAOTCacheLayer = vm->sharedCacheAPI->usingJITServerAOTCacheLayer;
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -6814,3 +6818,93 @@ SH_CompositeCacheImpl::setExtraStartupHints(J9VMThread* currentThread, U_32 val)
 	protectHeaderReadWriteArea(currentThread, false);
 	Trc_SHR_CC_setExtraStartupHints_Event(currentThread, val);
 }
+
+/**
+ * Advise the OS how the cache is going to be accessed. Must be called after the cache has been started.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] hugePages If true, advise the OS to back the cache with huge pages
+ * @param [in] prefetch If true, read ahead the metadata and the part of the ROMClass area
+ * that was used during the last recorded startup
+ */
+void
+SH_CompositeCacheImpl::adviseMemoryPattern(J9VMThread* currentThread, bool hugePages, bool prefetch)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	/* _osPageSize is zero on some AIX boxes, where there is nothing to advise anyway */
+	if (0 == _osPageSize) {
+		return;
+	}
+
+	UDATA cacheStart = ROUND_DOWN_TO(_osPageSize, (UDATA)CASTART(_theca));
+	UDATA cacheEnd = (UDATA)CAEND(_theca);
+
+	if (hugePages) {
+		_oscache->adviseHugePages(currentThread, (const void *)cacheStart, (size_t)(cacheEnd - cacheStart));
+	}
+	if (prefetch) {
+		/* All of the metadata is read when the cache is started */
+		UDATA metadataStart = ROUND_DOWN_TO(_osPageSize, (UDATA)UPDATEPTR(_theca));
+		UDATA romClassEnd = (UDATA)CASTART(_theca) + _theca->startupROMClassBytes;
+
+		_oscache->willNeed(currentThread, (const void *)metadataStart, (size_t)(cacheEnd - metadataStart));
+		if (romClassEnd > (UDATA)SEGUPDATEPTR(_theca)) {
+			romClassEnd = (UDATA)SEGUPDATEPTR(_theca);
+		}
+		if (romClassEnd > cacheStart) {
+			_oscache->willNeed(currentThread, (const void *)cacheStart, (size_t)(romClassEnd - cacheStart));
+		}
+	}
+}
+
+/**
+ * Record that a ROMClass has been used during startup. ROMClasses are allocated upwards from
+ * the start of the ROMClass area, so the profile is the highest address used.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] romClassEnd The end address of the ROMClass
+ */
+void
+SH_CompositeCacheImpl::updateStartupROMClassAccess(J9VMThread* currentThread, const U_8* romClassEnd)
+{
+	uintptr_t const newValue = (uintptr_t const)romClassEnd;
+	uintptr_t currentValue = (uintptr_t)_maximumStartupROMClassAccess;
+
+	while (newValue > currentValue) {
+		compareAndSwapUDATA((uintptr_t *)&_maximumStartupROMClassAccess, currentValue, newValue);
+		currentValue = (uintptr_t)_maximumStartupROMClassAccess;
+	}
+}
+
+/**
+ * Store the startup access profile in the cache header. Must be called holding the write mutex.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] minorFaults Minor page faults incurred during startup
+ * @param [in] majorFaults Major page faults incurred during startup
+ */
+void
+SH_CompositeCacheImpl::setStartupAccessProfile(J9VMThread* currentThread, UDATA minorFaults, UDATA majorFaults)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	if (_readOnlyOSCache) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+	unprotectHeaderReadWriteArea(currentThread, false);
+	/* Keep the previous ROMClass profile if no ROMClass was recorded by this JVM */
+	if (0 != _maximumStartupROMClassAccess) {
+		_theca->startupROMClassBytes = _maximumStartupROMClassAccess - (UDATA)CASTART(_theca);
+	}
+	_theca->startupMinorFaults = minorFaults;
+	_theca->startupMajorFaults = majorFaults;
+	protectHeaderReadWriteArea(currentThread, false);
+	Trc_SHR_CC_setStartupAccessProfile_Event(currentThread, _theca->startupROMClassBytes, minorFaults, majorFaults);
+}
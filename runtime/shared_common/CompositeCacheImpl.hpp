@@ -401,6 +401,12 @@ public:
 
 	void setExtraStartupHints(J9VMThread* currentThread, U_32 val);
 
+	void adviseMemoryPattern(J9VMThread* currentThread, bool hugePages, bool prefetch);
+
+	void updateStartupROMClassAccess(J9VMThread* currentThread, const U_8* romClassEnd);
+
+	void setStartupAccessProfile(J9VMThread* currentThread, UDATA minorFaults, UDATA majorFaults);
+
 private:
 	J9SharedClassConfig* _sharedClassConfig;
 	SH_OSCache* _oscache;
@@ -492,6 +498,8 @@ private:
 	UDATA  _minimumAccessedShrCacheMetadata;
 
 	UDATA _maximumAccessedShrCacheMetadata;
+
+	UDATA _maximumStartupROMClassAccess;
 	
 	I_8 _layer;
 
@@ -40,6 +40,11 @@
 #include "OSCachemmap.hpp"
 #include "CacheMap.hpp"
 
+#if defined(LINUX)
+#include <errno.h>
+#include <sys/mman.h>
+#endif /* defined(LINUX) */
+
 /**
  * Function which builds a cache filename from a cache name, version data and generation.
  * A cache file name is currently a composite of the cache name with a version prefix and generation postfix
@@ -455,6 +460,31 @@ SH_OSCache::dontNeedMetadata(J9VMThread* currentThread, const void* startAddress
 	return;
 }
 
+/* override if the cache can be backed by huge pages.
+ * Transparent huge pages only apply to anonymous and shared memory mappings, so the
+ * advice has no effect on a memory-mapped cache file and is not given for one.
+ */
+void
+SH_OSCache::adviseHugePages(J9VMThread* currentThread, const void* startAddress, size_t length) {
+	return;
+}
+
+/**
+ * Advise the OS that a section of the shared classes cache will be accessed soon,
+ * so that it is read ahead instead of being faulted in one page at a time.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] startAddress Start of the section, aligned to the OS page size
+ * @param [in] length Length of the section in bytes
+ */
+void
+SH_OSCache::willNeed(J9VMThread* currentThread, const void* startAddress, size_t length) {
+#if defined(LINUX)
+	IDATA rc = (IDATA)madvise((void *)startAddress, length, MADV_WILLNEED);
+	Trc_SHR_OSC_willNeed_Event(currentThread, startAddress, length, rc, (IDATA)((0 == rc) ? 0 : errno));
+#endif /* defined(LINUX) */
+}
+
 /* Function that initializes class variables common to OSCache subclasses */
 void
 SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
@@ -270,6 +270,10 @@ public:
 
 	virtual void  dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
 
+	virtual void adviseHugePages(J9VMThread* currentThread, const void* startAddress, size_t length);
+
+	virtual void willNeed(J9VMThread* currentThread, const void* startAddress, size_t length);
+
 	virtual IDATA detach(void) = 0;
 
 protected:
@@ -40,6 +40,14 @@
 #include "OSCacheFile.hpp"
 #include "UnitTest.hpp"
 
+#if defined(LINUX)
+#include <errno.h>
+#include <sys/mman.h>
+#ifndef MADV_HUGEPAGE
+#define MADV_HUGEPAGE 14
+#endif /* MADV_HUGEPAGE */
+#endif /* defined(LINUX) */
+
 #define OSCACHESYSV_RESTART 4
 #define OSCACHESYSV_OPENED 3
 #define OSCACHESYSV_CREATED 2
@@ -1660,6 +1668,24 @@ SH_OSCachesysv::getPermissionsRegionGranularity(struct J9PortLibrary* portLibrar
 	return j9shmem_get_region_granularity(_cacheDirName, _groupPerm, (void*)_dataStart);
 }
 
+/**
+ * Advise the OS to back a section of the shared memory segment with transparent huge pages.
+ * The advice is ignored where transparent huge pages are disabled for shared memory
+ * (see /sys/kernel/mm/transparent_hugepage/shmem_enabled).
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] startAddress Start of the section, aligned to the OS page size
+ * @param [in] length Length of the section in bytes
+ */
+void
+SH_OSCachesysv::adviseHugePages(J9VMThread* currentThread, const void* startAddress, size_t length)
+{
+#if defined(LINUX)
+	IDATA rc = (IDATA)madvise((void *)startAddress, length, MADV_HUGEPAGE);
+	Trc_SHR_OSC_adviseHugePages_Event(currentThread, startAddress, length, rc, (IDATA)((0 == rc) ? 0 : errno));
+#endif /* defined(LINUX) */
+}
+
 /**
  * Returns the total size of the cache memory
  *
@@ -157,6 +157,8 @@ public:
 
 	virtual U_32 getTotalSize();
 
+	virtual void adviseHugePages(J9VMThread* currentThread, const void* startAddress, size_t length);
+
 	static UDATA getHeaderSize(void);
 
 	static IDATA findAllKnownCaches(struct J9PortLibrary* portlib, UDATA j2seVersion, struct J9Pool* cacheList);
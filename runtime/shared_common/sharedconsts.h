@@ -97,6 +97,7 @@
 #define PRINTSTATS_SHOW_ALL_STALE 0x40000
 #define PRINTSTATS_SHOW_STARTUPHINT 0x80000
 #define PRINTSTATS_SHOW_TOP_LAYER_ONLY 0x100000
+#define PRINTSTATS_SHOW_RECLAIMABLE 0x200000
 
 /* Private filters */
 #define PRINTSTATS_SHOW_EXTRA (PRINTSTATS_SHOW_ALL|PRINTSTATS_SHOW_ORPHAN|PRINTSTATS_SHOW_AOTCH|PRINTSTATS_SHOW_AOTTHUNK|PRINTSTATS_SHOW_AOTDATA|PRINTSTATS_SHOW_JCL|PRINTSTATS_SHOW_BYTEDATA)
@@ -187,6 +187,8 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{OPTION_DESTROYALL, J9NLS_SHRC_SHRINIT_HELPTEXT_DESTROYALL, 0, 0},
 	{OPTION_DESTROYALLLAYERS, J9NLS_SHRC_SHRINIT_HELPTEXT_DESTROYALLLAYERS, 0, 0},
 	HELPTEXT_NEWLINE,
+	{OPTION_COMPACT, J9NLS_SHRC_SHRINIT_HELPTEXT_COMPACT, 0, 0},
+	HELPTEXT_NEWLINE,
 	{OPTION_RESET, J9NLS_SHRC_SHRINIT_HELPTEXT_RESET, 0, 0},
 	{HELPTEXT_EXPIRE_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_EXPIRE, 0, 0},
 	HELPTEXT_NEWLINE,
@@ -267,6 +269,8 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{OPTION_NO_AUTOPUNT, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_AUTOPUNT},
 	{OPTION_NO_DETECT_NETWORK_CACHE, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_DETECT_NETWORK_CACHE},
 	{OPTION_NO_SEMAPHORE_CHECK, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_SEMAPHORE_CHECK},
+	{OPTION_HUGE_PAGES, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_HUGE_PAGES},
+	{OPTION_PREFETCH, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_PREFETCH},
 #if defined(AIXPPC)
 	{OPTION_NO_COREMMAP, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_COREMMAP},
 #endif
@@ -294,6 +298,7 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_DESTROY, PARSE_TYPE_EXACT, RESULT_DO_DESTROY, 0},
 	{ OPTION_DESTROYALL, PARSE_TYPE_EXACT, RESULT_DO_DESTROYALL, 0},
 	{ OPTION_DESTROYALLLAYERS, PARSE_TYPE_EXACT, RESULT_DO_DESTROYALLLAYERS, 0},
+	{ OPTION_COMPACT, PARSE_TYPE_EXACT, RESULT_DO_COMPACT, 0},
 	{ OPTION_EXPIRE_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_EXPIRE, 0},
 	{ OPTION_LISTALLCACHES, PARSE_TYPE_EXACT, RESULT_DO_LISTALLCACHES, 0},
 	{ OPTION_PRINTSTATS, PARSE_TYPE_EXACT, RESULT_DO_PRINTSTATS, 0},
@@ -390,6 +395,8 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_TEST_HALF_PAGESIZE, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_TEST_HALF_PAGESIZE},
 	{ OPTION_EXTRA_STARTUPHINTS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_SET_EXTRA_STARTUPHINTS, 0},
 	{ OPTION_SHARE_LAMBDAFORM, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_SHARE_LAMBDAFORM},
+	{ OPTION_HUGE_PAGES, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_HUGE_PAGES},
+	{ OPTION_PREFETCH, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_PREFETCH},
 	{ NULL, 0, 0 }
 };
 
@@ -954,6 +961,9 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, U_64* runtimeFlags2,
 		         } else if ((filterLength == sizeof(SUB_OPTION_PRINTSTATS_STARTUPHINT))
 		        		 && (0 != try_scan(&filter, SUB_OPTION_PRINTSTATS_STARTUPHINT))) {
 		        	  *printStatsOptions |= PRINTSTATS_SHOW_STARTUPHINT;
+		         } else if ((filterLength == sizeof(SUB_OPTION_PRINTSTATS_RECLAIMABLE))
+		        		 && (0 != try_scan(&filter, SUB_OPTION_PRINTSTATS_RECLAIMABLE))) {
+		        	 *printStatsOptions |= PRINTSTATS_SHOW_RECLAIMABLE;
 		         /* -Xshareclasses:printallstats=<private options> For private options, it is default to print details. */
 		         } else if ((filterLength == sizeof(SUB_OPTION_PRINTSTATS_EXTRA))
 		        		 && (0 != try_scan(&filter, SUB_OPTION_PRINTSTATS_EXTRA))) {
@@ -1065,6 +1075,16 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, U_64* runtimeFlags2,
 			}
 			break;
 
+		case RESULT_DO_COMPACT:
+			/* ignore 'readOnly' when compacting, the cache files are replaced */
+			if (J9_ARE_ALL_BITS_SET(*runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY)) {
+				*runtimeFlags &= ~J9SHR_RUNTIMEFLAG_ENABLE_READONLY;
+				SHRINIT_WARNING_TRACE3(*verboseFlags, J9NLS_SHRC_SHRINIT_OPTION_IGNORED_WARNING, OPTION_READONLY, OPTION_COMPACT, OPTION_READONLY);
+			}
+			*runtimeFlags |= J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE;
+			returnAction = J9SHAREDCLASSESOPTIONS[i].action;
+			break;
+
 		case RESULT_NO_COREMMAP_SET:
 #if defined(AIXPPC)
 			noCoreMmap = true;
@@ -2485,6 +2505,7 @@ static void j9shr_printStats_dump_help(J9JavaVM* vm, bool moreHelp, UDATA comman
 	SHRINIT_TRACE_NOTAG(1, J9NLS_SHRC_SHRINIT_HELPTEXT_PRINTSTATS_ZIPCACHE);
 	SHRINIT_TRACE_NOTAG(1, J9NLS_SHRC_SHRINIT_HELPTEXT_PRINTSTATS_STALE);
 	SHRINIT_TRACE_NOTAG(1, J9NLS_SHRC_SHRINIT_HELPTEXT_PRINTSTATS_STARTUPHINT);
+	SHRINIT_TRACE_NOTAG(1, J9NLS_SHRC_SHRINIT_HELPTEXT_PRINTSTATS_RECLAIMABLE);
 	j9tty_printf(PORTLIB, "\n");
 	if (moreHelp) {
 		SHRINIT_TRACE_NOTAG(1, J9NLS_SHRC_SHRINIT_HELPTEXT_PRINTSTATS_EXTRA);
@@ -2576,6 +2597,15 @@ performSharedClassesCommandLineAction(J9JavaVM* vm, J9SharedClassConfig* sharedC
 		}
 		break;
 #endif /* !defined(WIN32) */
+	case RESULT_DO_COMPACT:
+		if (J9_ARE_NO_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_PERSISTENT_CACHE)) {
+			SHRINIT_ERR_TRACE1(verboseFlags, J9NLS_SHRC_SHRINIT_COMPACT_NONPERSISTENT, cacheName);
+			break;
+		}
+		if (1 == checkIfCacheExists(vm, sharedClassConfig->ctrlDirName, cacheDirName, cacheName, &versionData, cacheType, layer)) {
+			return J9VMDLLMAIN_OK;
+		}
+		break;
 	case RESULT_DO_LISTALLCACHES:
 		j9shr_list_caches(vm, sharedClassConfig->ctrlDirName, groupPerm, verboseFlags);
 		break;
@@ -3562,6 +3592,11 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 		}
 	}
 
+	if ((RESULT_DO_COMPACT == parseResult) && (-1 != maxLayer)) {
+		/* Compacting merges every layer, so always start up the whole layer stack */
+		vm->sharedClassConfig->layer = maxLayer;
+	}
+
 	/*Add the cachemap before calling startup to enable debug extensions in jextract etc*/
 	cm = SH_CacheMap::newInstance(vm, vm->sharedClassConfig, cmPtr, cacheName, cacheType);
 	vm->sharedClassConfig->sharedClassCache = (void*)cm;
@@ -3910,6 +3945,14 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 	} else if (RESULT_DO_SET_EXTRA_STARTUPHINTS == parseResult) {
 		cm->setExtraStartupHints(currentThread);
 		returnVal = J9VMDLLMAIN_SILENT_EXIT_VM;
+	} else if (RESULT_DO_COMPACT == parseResult) {
+		*nonfatal = 0;
+		if (0 == cm->compactCache(currentThread, piconfig)) {
+			SHRINIT_TRACE1(verboseFlags, J9NLS_SHRC_SHRINIT_COMPACT_SUCCESS, cacheName);
+		} else {
+			SHRINIT_ERR_TRACE1(verboseFlags, J9NLS_SHRC_SHRINIT_COMPACT_FAILURE, cacheName);
+		}
+		returnVal = J9VMDLLMAIN_SILENT_EXIT_VM;
 	}
 
 	return returnVal;
@@ -5108,6 +5151,7 @@ j9shr_jvmPhaseChange(J9VMThread *currentThread, UDATA phase)
 		/* OpenJ9 issue; https://github.com/eclipse-openj9/openj9/issues/3743
 		 * GC decides whether to calls vm->sharedClassConfig->storeGCHints() to store the GC hints into the shared cache. */
 		storeStartupHintsToSharedCache(currentThread);
+		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->storeStartupAccessProfile(currentThread);
 		if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP)) {
 			((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->protectPartiallyFilledPages(currentThread);
 		}
@@ -107,6 +107,7 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_DESTROY "destroy"
 #define OPTION_DESTROYALL "destroyAll"
 #define OPTION_DESTROYALLLAYERS "destroyAllLayers"
+#define OPTION_COMPACT "compact"
 #define OPTION_EXPIRE_EQUALS "expire="
 #define OPTION_LISTALLCACHES "listAllCaches"
 #define OPTION_HELP "help"
@@ -201,6 +202,8 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_TEST_HALF_PAGESIZE "testHalfPageSize"
 #define OPTION_EXTRA_STARTUPHINTS_EQUALS "extraStartupHints="
 #define OPTION_SHARE_LAMBDAFORM "shareLambdaForm" /* internal option for dev/testing */
+#define OPTION_HUGE_PAGES "hugePages"
+#define OPTION_PREFETCH "prefetch"
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -216,6 +219,7 @@ typedef struct J9SharedClassesOptions {
 #define SUB_OPTION_PRINTSTATS_JITHINT "jithint"
 #define SUB_OPTION_PRINTSTATS_STALE "stale"
 #define SUB_OPTION_PRINTSTATS_STARTUPHINT "startuphint"
+#define SUB_OPTION_PRINTSTATS_RECLAIMABLE "reclaimable"
 /* private options for printallstats= and printstats= */
 #define SUB_OPTION_PRINTSTATS_EXTRA "extra"
 #define SUB_OPTION_PRINTSTATS_ORPHAN "orphan"
@@ -283,6 +287,7 @@ typedef struct J9SharedClassesOptions {
 #define RESULT_DO_PRINT_TOP_LAYER_STATS_EQUALS 54
 #define RESULT_DO_ADD_RUNTIMEFLAG2 55
 #define RESULT_DO_SET_EXTRA_STARTUPHINTS 56
+#define RESULT_DO_COMPACT 57
 
 #define PARSE_TYPE_EXACT 1
 #define PARSE_TYPE_STARTSWITH 2
@@ -123,6 +123,18 @@ verifySRPHashtable(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 I_32
 verifyPrimeNumberHelper(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 
+/* ---------------- crc32test.c ---------------- */
+
+/**
+* @brief Check j9crc32() against a reference implementation and report its throughput.
+* @param *portLib
+* @param *passCount
+* @param *failCount
+* @return I_32
+*/
+I_32
+verifyCRC32(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
+
 #ifdef __cplusplus
 }
 #endif
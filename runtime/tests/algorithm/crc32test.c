@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <string.h>
+#include "util_api.h"
+#include "algorithm_test_internal.h"
+
+#define CRC32_TEST_BUFFER_SIZE (1024 * 1024)
+#define CRC32_BENCHMARK_ITERATIONS 100
+
+/**
+ * The byte at a time table implementation that j9crc32() used to have. All the faster
+ * implementations must give exactly the same results, since CRCs computed by older VMs
+ * are stored in shared class caches.
+ */
+static U_32
+referenceCRC32(U_32 crc, U_8 *bytes, U_32 len)
+{
+	U_32 i = 0;
+
+	crc = ~crc;
+	while (len-- > 0) {
+		crc ^= *bytes++;
+		for (i = 0; i < 8; i++) {
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+static void
+testKnownValue(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_8 check[] = "123456789";
+	U_32 crc = j9crc32(j9crc32(0, NULL, 0), check, 9);
+
+	if (0xCBF43926 != crc) {
+		j9tty_printf(PORTLIB, "\tj9crc32(\"123456789\") returned 0x%x, expected 0xcbf43926\n", crc);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+}
+
+/**
+ * Compare j9crc32() and j9crc32Portable() with the reference implementation for every
+ * length up to a few fold blocks and every alignment of the start of the buffer.
+ */
+static void
+testLengthsAndAlignments(J9PortLibrary *portLib, U_8 *buffer, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	UDATA failures = 0;
+	U_32 offset = 0;
+	U_32 len = 0;
+
+	for (offset = 0; offset < 16; offset++) {
+		for (len = 0; len <= 520; len++) {
+			U_32 expected = referenceCRC32(0, buffer + offset, len);
+			U_32 actual = j9crc32(0, buffer + offset, len);
+			U_32 portable = j9crc32Portable(0, buffer + offset, len);
+
+			if ((expected != actual) || (expected != portable)) {
+				if (failures < 10) {
+					j9tty_printf(PORTLIB, "\toffset=%u len=%u: expected 0x%x, j9crc32 returned 0x%x, j9crc32Portable returned 0x%x\n",
+						offset, len, expected, actual, portable);
+				}
+				failures++;
+			}
+		}
+	}
+	if (0 != failures) {
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+}
+
+/**
+ * Check that computing the CRC of a buffer in pieces gives the same result as computing it at once.
+ */
+static void
+testIncremental(J9PortLibrary *portLib, U_8 *buffer, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_32 expected = j9crc32(0, buffer, CRC32_TEST_BUFFER_SIZE);
+	U_32 crc = 0;
+	U_32 done = 0;
+	U_32 piece = 1;
+
+	while (done < CRC32_TEST_BUFFER_SIZE) {
+		U_32 len = OMR_MIN(piece, CRC32_TEST_BUFFER_SIZE - done);
+		crc = j9crc32(crc, buffer + done, len);
+		done += len;
+		piece = (piece * 3) + 1;
+	}
+	if ((expected != crc) || (expected != referenceCRC32(0, buffer, CRC32_TEST_BUFFER_SIZE))) {
+		j9tty_printf(PORTLIB, "\tincremental CRC 0x%x does not match 0x%x\n", crc, expected);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+}
+
+static void
+reportThroughput(J9PortLibrary *portLib, const char *name, U_32 (*function)(U_32, U_8 *, U_32), U_8 *buffer)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_32 crc = 0;
+	UDATA i = 0;
+	U_64 start = j9time_hires_clock();
+	U_64 micros = 0;
+
+	for (i = 0; i < CRC32_BENCHMARK_ITERATIONS; i++) {
+		crc = function(crc, buffer, CRC32_TEST_BUFFER_SIZE);
+	}
+	micros = j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	if (0 == micros) {
+		micros = 1;
+	}
+	j9tty_printf(PORTLIB, "\t%-16s %8llu MB/s (crc 0x%x)\n", name, ((U_64)CRC32_BENCHMARK_ITERATIONS * 1000000) / micros, crc);
+}
+
+I_32
+verifyCRC32(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_8 *buffer = NULL;
+	U_32 seed = 0x12345678;
+	UDATA i = 0;
+
+	j9tty_printf(PORTLIB, "Testing j9crc32...\n");
+
+	buffer = j9mem_allocate_memory(CRC32_TEST_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+	if (NULL == buffer) {
+		j9tty_printf(PORTLIB, "\tunable to allocate the test buffer\n");
+		return -1;
+	}
+	for (i = 0; i < CRC32_TEST_BUFFER_SIZE; i++) {
+		seed = (seed * 1103515245) + 12345;
+		buffer[i] = (U_8)(seed >> 16);
+	}
+
+	testKnownValue(portLib, passCount, failCount);
+	testLengthsAndAlignments(portLib, buffer, passCount, failCount);
+	testIncremental(portLib, buffer, passCount, failCount);
+
+	j9tty_printf(PORTLIB, "\tThroughput on a %u byte buffer:\n", CRC32_TEST_BUFFER_SIZE);
+	reportThroughput(portLib, "bit at a time", referenceCRC32, buffer);
+	reportThroughput(portLib, "j9crc32Portable", j9crc32Portable, buffer);
+	reportThroughput(portLib, "j9crc32", j9crc32, buffer);
+
+	j9mem_free_memory(buffer);
+	j9tty_printf(PORTLIB, "Finished testing j9crc32.\n");
+	return 0;
+}
@@ -28,6 +28,13 @@ omr_add_exports(j9ben
 	Java_jvmti_test_nativeMethodPrefixes_DirectNative_gac4gac3gac2gac1nat
 	Java_jvmti_test_nativeMethodPrefixes_WrappedNative_nat
 	Java_jit_test_vich_JNIObjectArray_getObjectArrayElement
+	Java_jit_test_vich_JNIStrings_newStringUTF
+	Java_jit_test_vich_JNIStrings_getStringUTFChars
+	Java_jit_test_vich_JNIStrings_getStringUTFRegion
+	Java_jit_test_vich_JNIStrings_getStringChars
+	Java_jit_test_vich_JNIGlobalRef_globalReference
+	Java_jit_test_vich_JNIGlobalRef_createGlobalRefs
+	Java_jit_test_vich_JNIGlobalRef_checkAndDeleteGlobalRefs
 	Java_jit_test_vich_JNILocalRef_localReference32
 	Java_jit_test_vich_JNILocalRef_localReference8
 	Java_jit_test_vich_JNIArray_getPrimitiveArrayCritical
@@ -3727,4 +3727,166 @@ void JNICALL Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env
 }
 
 
+jstring JNICALL Java_jit_test_vich_JNIStrings_newStringUTF(JNIEnv *env, jobject obj, jstring string, jint loopCount)
+{
+	jint i;
+	jstring result = NULL;
+	const char *utf = (*env)->GetStringUTFChars(env, string, NULL);
+
+	if (NULL == utf) {
+		return NULL;
+	}
+	for (i = 0; i < loopCount; i++) {
+		if (NULL != result) {
+			(*env)->DeleteLocalRef(env, result);
+		}
+		result = (*env)->NewStringUTF(env, utf);
+		if (NULL == result) {
+			break;
+		}
+	}
+	(*env)->ReleaseStringUTFChars(env, string, utf);
+	return result;
+}
+
+
+jint JNICALL Java_jit_test_vich_JNIStrings_getStringUTFChars(JNIEnv *env, jobject obj, jstring string, jint loopCount)
+{
+	jint i;
+	jint length = -1;
+
+	for (i = 0; i < loopCount; i++) {
+		const char *utf = (*env)->GetStringUTFChars(env, string, NULL);
+		if (NULL == utf) {
+			return -1;
+		}
+		length = (jint)strlen(utf);
+		(*env)->ReleaseStringUTFChars(env, string, utf);
+	}
+	return length;
+}
+
+
+jint JNICALL Java_jit_test_vich_JNIStrings_getStringUTFRegion(JNIEnv *env, jobject obj, jstring string, jint loopCount)
+{
+	jint i;
+	jint length = (*env)->GetStringLength(env, string);
+	jint utfLength = (*env)->GetStringUTFLength(env, string);
+	char *buffer = (char *)malloc(utfLength + 1);
+
+	if (NULL == buffer) {
+		return -1;
+	}
+	for (i = 0; i < loopCount; i++) {
+		(*env)->GetStringUTFRegion(env, string, 0, length, buffer);
+	}
+	utfLength = (jint)strlen(buffer);
+	free(buffer);
+	return utfLength;
+}
+
+
+jstring JNICALL Java_jit_test_vich_JNIStrings_getStringChars(JNIEnv *env, jobject obj, jstring string, jint loopCount)
+{
+	jint i;
+	jint length = (*env)->GetStringLength(env, string);
+	jstring result = NULL;
+
+	for (i = 0; i < loopCount; i++) {
+		const jchar *chars = (*env)->GetStringChars(env, string, NULL);
+		if (NULL == chars) {
+			return NULL;
+		}
+		if (i == (loopCount - 1)) {
+			result = (*env)->NewString(env, chars, length);
+		}
+		(*env)->ReleaseStringChars(env, string, chars);
+	}
+	return result;
+}
+
+
+jint JNICALL Java_jit_test_vich_JNIGlobalRef_globalReference(JNIEnv *env, jobject obj, jobject o, jint batchSize, jint loopCount)
+{
+	jint i, j;
+	jint failures = 0;
+	jobject refs[128];
+
+	if ((batchSize <= 0) || (batchSize > 128)) {
+		return -1;
+	}
+
+	for (i = 0; i < loopCount; i++) {
+		for (j = 0; j < batchSize; j++) {
+			refs[j] = (*env)->NewGlobalRef(env, o);
+		}
+		for (j = 0; j < batchSize; j++) {
+			if (!(*env)->IsSameObject(env, refs[j], o)) {
+				failures += 1;
+			}
+			(*env)->DeleteGlobalRef(env, refs[j]);
+		}
+	}
+	return failures;
+}
+
 
+#define HELD_GLOBAL_REFS_MAX 128
+static jobject heldGlobalRefs[HELD_GLOBAL_REFS_MAX];
+static jint heldGlobalRefCount = 0;
+
+/* Create global refs to the given byte arrays and keep them across calls.
+ * Refs are created and deleted first so that the kept refs reuse freed slots.
+ */
+jint JNICALL Java_jit_test_vich_JNIGlobalRef_createGlobalRefs(JNIEnv *env, jobject obj, jobjectArray objects)
+{
+	jint i;
+	jint count = (*env)->GetArrayLength(env, objects);
+
+	if ((count > HELD_GLOBAL_REFS_MAX) || (0 != heldGlobalRefCount)) {
+		return -1;
+	}
+
+	for (i = 0; i < count; i++) {
+		jobject o = (*env)->GetObjectArrayElement(env, objects, i);
+		heldGlobalRefs[i] = (*env)->NewGlobalRef(env, o);
+		(*env)->DeleteLocalRef(env, o);
+	}
+	for (i = 0; i < count; i++) {
+		(*env)->DeleteGlobalRef(env, heldGlobalRefs[i]);
+	}
+	for (i = 0; i < count; i++) {
+		jobject o = (*env)->GetObjectArrayElement(env, objects, i);
+		heldGlobalRefs[i] = (*env)->NewGlobalRef(env, o);
+		(*env)->DeleteLocalRef(env, o);
+	}
+	heldGlobalRefCount = count;
+	return count;
+}
+
+/* Check that each kept global ref still refers to a byte array of length i + 1 filled with i, then delete the refs. */
+jint JNICALL Java_jit_test_vich_JNIGlobalRef_checkAndDeleteGlobalRefs(JNIEnv *env, jobject obj)
+{
+	jint i, j;
+	jint failures = 0;
+
+	for (i = 0; i < heldGlobalRefCount; i++) {
+		jbyteArray array = (jbyteArray)heldGlobalRefs[i];
+		if ((*env)->GetArrayLength(env, array) != (i + 1)) {
+			failures += 1;
+		} else {
+			jbyte bytes[HELD_GLOBAL_REFS_MAX];
+			(*env)->GetByteArrayRegion(env, array, 0, i + 1, bytes);
+			for (j = 0; j <= i; j++) {
+				if (bytes[j] != (jbyte)i) {
+					failures += 1;
+					break;
+				}
+			}
+		}
+		(*env)->DeleteGlobalRef(env, heldGlobalRefs[i]);
+		heldGlobalRefs[i] = NULL;
+	}
+	heldGlobalRefCount = 0;
+	return failures;
+}
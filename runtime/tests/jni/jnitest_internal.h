@@ -1740,6 +1740,88 @@ void JNICALL
 Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env, jobject obj, jobjectArray array, jobjectArray blankArray, jint arraySize, jint loopCount);
 
 
+/**
+* @brief
+* @param *env
+* @param obj
+* @param string
+* @param loopCount
+* @return the last string created
+*/
+jstring JNICALL 
+Java_jit_test_vich_JNIStrings_newStringUTF(JNIEnv *env, jobject obj, jstring string, jint loopCount);
+
+
+/**
+* @brief
+* @param *env
+* @param obj
+* @param string
+* @param loopCount
+* @return the length of the UTF8 data, or -1 on failure
+*/
+jint JNICALL 
+Java_jit_test_vich_JNIStrings_getStringUTFChars(JNIEnv *env, jobject obj, jstring string, jint loopCount);
+
+
+/**
+* @brief
+* @param *env
+* @param obj
+* @param string
+* @param loopCount
+* @return the length of the UTF8 data, or -1 on failure
+*/
+jint JNICALL 
+Java_jit_test_vich_JNIStrings_getStringUTFRegion(JNIEnv *env, jobject obj, jstring string, jint loopCount);
+
+
+/**
+* @brief
+* @param *env
+* @param obj
+* @param string
+* @param loopCount
+* @return a copy of the string made from the characters
+*/
+jstring JNICALL 
+Java_jit_test_vich_JNIStrings_getStringChars(JNIEnv *env, jobject obj, jstring string, jint loopCount);
+
+
+/**
+* @brief
+* @param *env
+* @param obj
+* @param o
+* @param batchSize
+* @param loopCount
+* @return the number of global refs that did not refer to o, or -1 if batchSize is invalid
+*/
+jint JNICALL 
+Java_jit_test_vich_JNIGlobalRef_globalReference(JNIEnv *env, jobject obj, jobject o, jint batchSize, jint loopCount);
+
+
+/**
+* @brief
+* @param *env
+* @param obj
+* @param objects
+* @return the number of global refs created, or -1 if there are too many objects
+*/
+jint JNICALL 
+Java_jit_test_vich_JNIGlobalRef_createGlobalRefs(JNIEnv *env, jobject obj, jobjectArray objects);
+
+
+/**
+* @brief
+* @param *env
+* @param obj
+* @return the number of global refs that no longer referred to their original byte array
+*/
+jint JNICALL 
+Java_jit_test_vich_JNIGlobalRef_checkAndDeleteGlobalRefs(JNIEnv *env, jobject obj);
+
+
 /* ---------------- jnitest.c ---------------- */
 
 /**
@@ -59,6 +59,12 @@
 
 #define OBJ_MON_NAME_BUF_SIZE  OBJ_MON_NAME_BUF_MINIMUM_SIZE
 
+/*
+ * Name of the pseudo-monitor reporting the object monitor lookup cache shared by all threads.
+ * Its entry count is the number of lookups and its slow count the number of misses.
+ */
+#define MONITOR_LOOKUP_CACHE_NAME "VM monitor lookup cache"
+
 /* ENDIAN_HELPERS */
 
 #ifndef SWAP_2BYTES
@@ -254,6 +260,29 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 		strcpy(dump, lnrl_lock->monitor_name);
 		dump += strlen(lnrl_lock->monitor_name) + 1;
 	}
+
+	/* Write the hit and miss counts of the shared object monitor lookup cache */
+	WRITE_1BYTE(JVMTI_MONITOR_RAW);
+	WRITE_1BYTE((unsigned char)held);
+	WRITE_4BYTES(jvm->monitorLookupCacheHits + jvm->monitorLookupCacheMisses);
+	WRITE_4BYTES(jvm->monitorLookupCacheMisses);
+	WRITE_4BYTES(0);
+	WRITE_4BYTES(0);
+	WRITE_4BYTES(0);
+	WRITE_8BYTES(0);
+	if (dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) {
+		WRITE_8BYTES(0);
+	} else {
+		/* The next field has a pointer size */
+		if (sizeof(void *) == 8) {
+			WRITE_8BYTES(0);
+		} else {
+			WRITE_4BYTES(0);
+		}
+	}
+	strcpy(dump, MONITOR_LOOKUP_CACHE_NAME);
+	dump += sizeof(MONITOR_LOOKUP_CACHE_NAME);
+
 	return (jint) JLM_SUCCESS;
 #else
 	return (jint) JLM_NOT_AVAILABLE;
@@ -265,6 +294,9 @@ jint
 JlmStart(J9VMThread* vmThread)
 {
 #if	defined(OMR_THR_JLM)
+	J9JavaVM *vm = vmThread->javaVM;
+	vm->monitorLookupCacheHits = 0;
+	vm->monitorLookupCacheMisses = 0;
 	return (omrthread_jlm_init(J9THREAD_LIB_FLAG_JLM_ENABLED) == 0) ? (jint) JLM_SUCCESS : (jint) JLM_NOT_AVAILABLE;
 #else
 	return (jint) JLM_NOT_AVAILABLE;
@@ -430,6 +462,9 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 		*dump_size += JLM_DUMP_COUNT_FIELD_SIZE + objIDfieldSize + strlen(lnrl_lock->monitor_name) + 1;
 	}
 
+	/* the shared object monitor lookup cache */
+	*dump_size += JLM_DUMP_COUNT_FIELD_SIZE + objIDfieldSize + sizeof(MONITOR_LOOKUP_CACHE_NAME);
+
 	return rc;
 }
 #else
@@ -34,6 +34,71 @@
 
 extern "C" {
 
+/**
+ * Size of the stack given to a new continuation. Stacks grow on demand from this size.
+ */
+static VMINLINE UDATA
+initialContinuationStackSize(J9JavaVM *vm)
+{
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+	return (vm->initialStackSize > (UDATA)vm->stackSize) ? vm->stackSize : vm->initialStackSize;
+#else /* defined(J9VM_INTERP_GROWABLE_STACKS) */
+	return vm->stackSize;
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
+}
+
+/**
+ * Move the frames of the mounted continuation to a stack sized to them, once the continuation
+ * has yielded several times in a row with at least half of its stack unused. Called before
+ * unmounting, so that idle continuations only keep the stack they use. A continuation whose
+ * compacted stack grows again waits twice as many yields before it is compacted again.
+ */
+static void
+compactContinuationStack(J9VMThread *currentThread, J9VMContinuation *continuation)
+{
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+	J9JavaVM *vm = currentThread->javaVM;
+	/* Monitor enter records of pinned continuations are left alone */
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_COMPACT_CONTINUATION_STACKS)
+	&& (0 == currentThread->ownedMonitorCount)
+	) {
+		J9JavaStack *stack = currentThread->stackObject;
+		UDATA usedBytes = (UDATA)stack->end - (UDATA)currentThread->sp;
+		/* Leave as much free space as a new continuation has, so that resuming does not immediately grow the stack. */
+		UDATA compactSize = ROUND_UP_TO_POWEROF2(usedBytes + initialContinuationStackSize(vm), sizeof(UDATA));
+
+		if (0 == continuation->compactYieldThreshold) {
+			continuation->compactYieldThreshold = J9_CONTINUATION_COMPACT_IDLE_YIELDS;
+		}
+		if ((0 != continuation->compactedStackSize) && (stack->size > continuation->compactedStackSize)) {
+			if (continuation->compactYieldThreshold < J9_CONTINUATION_COMPACT_MAX_IDLE_YIELDS) {
+				continuation->compactYieldThreshold *= 2;
+			}
+			continuation->compactedStackSize = 0;
+		}
+
+		if ((compactSize * 2) > stack->size) {
+			continuation->compactableYields = 0;
+		} else {
+			continuation->compactableYields += 1;
+			if (continuation->compactableYields >= continuation->compactYieldThreshold) {
+				UDATA oldSize = stack->size;
+				continuation->compactableYields = 0;
+				if (0 == shrinkJavaStack(currentThread, compactSize)) {
+					J9JavaStack *newStack = currentThread->stackObject;
+					continuation->compactedStackSize = newStack->size;
+					vm->continuationStackCompactions += 1;
+					/* The old stack is kept until the frames referring to it return, so nothing is released yet */
+					if (newStack->previous != stack) {
+						vm->continuationStackBytesCompacted += oldSize - newStack->size;
+					}
+				}
+			}
+		}
+	}
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
+}
+
 BOOLEAN
 createContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 {
@@ -90,21 +155,13 @@ createContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 			goto end;
 		}
 
-#ifdef J9VM_INTERP_GROWABLE_STACKS
-#define VMTHR_INITIAL_STACK_SIZE ((vm->initialStackSize > (UDATA) vm->stackSize) ? vm->stackSize : vm->initialStackSize)
-#else
-#define VMTHR_INITIAL_STACK_SIZE vm->stackSize
-#endif
-
-		if ((stack = allocateJavaStack(vm, VMTHR_INITIAL_STACK_SIZE, NULL)) == NULL) {
+		if ((stack = allocateJavaStack(vm, initialContinuationStackSize(vm), NULL)) == NULL) {
 			vm->internalVMFunctions->setNativeOutOfMemoryError(currentThread, 0, 0);
 			j9mem_free_memory(continuation);
 			result = FALSE;
 			goto end;
 		}
 
-#undef VMTHR_INITIAL_STACK_SIZE
-
 #if defined(J9VM_PROF_CONTINUATION_ALLOCATION)
 		I_64 totalTime = (I_64)j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
 		if (totalTime > 10000) {
@@ -116,6 +173,14 @@ createContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 		}
 #endif /* defined(J9VM_PROF_CONTINUATION_ALLOCATION) */
 		vm->cacheMiss += 1;
+	} else if (NULL == continuation->stackObject) {
+		/* The stack of the recycled continuation was released when it was cached. */
+		if ((stack = allocateJavaStack(vm, initialContinuationStackSize(vm), NULL)) == NULL) {
+			vm->internalVMFunctions->setNativeOutOfMemoryError(currentThread, 0, 0);
+			j9mem_free_memory(continuation);
+			result = FALSE;
+			goto end;
+		}
 	} else {
 		/* Reset and reuse the stack in the recycled continuation. */
 		stack = continuation->stackObject;
@@ -321,6 +386,8 @@ yieldContinuation(J9VMThread *currentThread, BOOLEAN isFinished, UDATA returnSta
 
 	if (isFinished) {
 		VM_ContinuationHelpers::setFinished(continuationStatePtr);
+	} else {
+		compactContinuationStack(currentThread, continuation);
 	}
 
 	currentThread->currentContinuation = NULL;
@@ -411,7 +478,19 @@ recycleContinuation(J9JavaVM *vm, J9VMThread *vmThread, J9VMContinuation* contin
 {
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	bool cached = false;
-	vm->totalContinuationStackSize += continuation->stackObject->size;
+
+	/* The stack of a continuation that was already cached may have been released (e.g. T1 entries of an exiting carrier). */
+	if (NULL != continuation->stackObject) {
+		UDATA stackSize = continuation->stackObject->size;
+		vm->totalContinuationStackSize += stackSize;
+
+		/* Do not let the caches keep large stacks alive; a new initial-size stack is allocated on reuse. */
+		if ((stackSize > vm->continuationCacheMaxStackSize) && (stackSize > initialContinuationStackSize(vm))) {
+			freeJavaStack(vm, continuation->stackObject);
+			continuation->stackObject = NULL;
+			vm->continuationStacksReleased += 1;
+		}
+	}
 
 	if (!skipLocalCache && (0 < vm->continuationT1Size)) {
 		/* If called by carrier thread (not global), try to store in local cache first.
@@ -453,7 +532,9 @@ T2:
 		if (!cached) {
 			vm->cacheFree += 1;
 			/* Caching failed, free the J9VMContinuation struct. */
-			freeJavaStack(vm, continuation->stackObject);
+			if (NULL != continuation->stackObject) {
+				freeJavaStack(vm, continuation->stackObject);
+			}
 			j9mem_free_memory(continuation);
 		}
 	}
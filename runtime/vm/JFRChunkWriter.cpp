@@ -938,6 +938,52 @@ VM_JFRChunkWriter::writeGCWhenTypesEvent()
 	writeEventSize(dataStart);
 }
 
+void
+VM_JFRChunkWriter::writeDeoptimizationReasonTypesEvent()
+{
+	U_8 *dataStart = writeCheckpointEventHeader(Generic, 1);
+
+	/* class ID */
+	_bufferWriter->writeLEB128(DeoptimizationReasonID);
+
+	/* number of reasons */
+	_bufferWriter->writeLEB128(DeoptimizationReasonTypeCount);
+
+	for (int i = 0; i < DeoptimizationReasonTypeCount; i++) {
+		/* constant index */
+		_bufferWriter->writeLEB128(i);
+
+		/* write string */
+		writeStringLiteral(deoptimizationReasons[i]);
+	}
+
+	/* write size */
+	writeEventSize(dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeDeoptimizationActionTypesEvent()
+{
+	U_8 *dataStart = writeCheckpointEventHeader(Generic, 1);
+
+	/* class ID */
+	_bufferWriter->writeLEB128(DeoptimizationActionID);
+
+	/* number of actions */
+	_bufferWriter->writeLEB128(DeoptimizationActionTypeCount);
+
+	for (int i = 0; i < DeoptimizationActionTypeCount; i++) {
+		/* constant index */
+		_bufferWriter->writeLEB128(i);
+
+		/* write string */
+		writeStringLiteral(deoptimizationActions[i]);
+	}
+
+	/* write size */
+	writeEventSize(dataStart);
+}
+
 void
 VM_JFRChunkWriter::writeGCHeapConfigurationEvent()
 {
@@ -1360,6 +1406,248 @@ VM_JFRChunkWriter::writeSystemGCEvent(void *anElement, void *userData)
 	writeEventSize(bufferWriter, dataStart);
 }
 
+void
+VM_JFRChunkWriter::writeObjectAllocationSampleEvent(void *anElement, void *userData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+	U_8 *dataStart = NULL;
+
+	if (entry->recordSample) {
+		/* Reserve size field */
+		dataStart = reserveEventSize(bufferWriter);
+
+		/* Write event type */
+		bufferWriter->writeLEB128(ObjectAllocationSampleID);
+
+		/* Write start time */
+		bufferWriter->writeLEB128(entry->ticks);
+
+		/* Write event thread index */
+		bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+		/* Write stacktrace index */
+		bufferWriter->writeLEB128(entry->stackTraceIndex);
+
+		/* Write object class index */
+		bufferWriter->writeLEB128(entry->objectClass);
+
+		/* Write weight, the bytes allocated by the thread since its previous sample */
+		bufferWriter->writeLEB128(entry->weight);
+
+		/* Write size */
+		writeEventSize(bufferWriter, dataStart);
+	}
+
+	if (entry->recordTLABEvent) {
+		/* Reserve size field */
+		dataStart = reserveEventSize(bufferWriter);
+
+		/* Write event type */
+		bufferWriter->writeLEB128((0 != entry->tlabSize) ? ObjectAllocationInNewTLABID : ObjectAllocationOutsideTLABID);
+
+		/* Write start time */
+		bufferWriter->writeLEB128(entry->ticks);
+
+		/* Write event thread index */
+		bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+		/* Write stacktrace index */
+		bufferWriter->writeLEB128(entry->stackTraceIndex);
+
+		/* Write object class index */
+		bufferWriter->writeLEB128(entry->objectClass);
+
+		/* Write allocation size */
+		bufferWriter->writeLEB128(entry->allocationSize);
+
+		if (0 != entry->tlabSize) {
+			/* Write TLAB size */
+			bufferWriter->writeLEB128(entry->tlabSize);
+		}
+
+		/* Write size */
+		writeEventSize(bufferWriter, dataStart);
+	}
+}
+
+void
+VM_JFRChunkWriter::writeCompilationEvent(void *anElement, void *userData)
+{
+	CompilationEntry *entry = (CompilationEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(CompilationID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write duration */
+	bufferWriter->writeLEB128(entry->duration);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write compile ID */
+	bufferWriter->writeLEB128(entry->compileID);
+
+	/* Write compiler type, there is no constant pool for it so write a null reference */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write method index */
+	bufferWriter->writeLEB128(entry->methodIndex);
+
+	/* Write compile level */
+	bufferWriter->writeLEB128(entry->compileLevel);
+
+	/* Write succeeded */
+	bufferWriter->writeBoolean(entry->succeeded);
+
+	/* Write isOSR */
+	bufferWriter->writeBoolean(entry->isOSR);
+
+	/* Write code size */
+	bufferWriter->writeLEB128((U_64)entry->codeSize);
+
+	/* Write inlined bytes */
+	bufferWriter->writeLEB128((U_64)entry->inlinedBytes);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeCompilationFailureEvent(void *anElement, void *userData)
+{
+	CompilationFailureEntry *entry = (CompilationFailureEntry *)anElement;
+	VM_JFRChunkWriter *writer = (VM_JFRChunkWriter *)userData;
+	VM_BufferWriter *bufferWriter = writer->_bufferWriter;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(CompilationFailureID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write failure message */
+	writer->writeUTF8String(entry->failureMessage, entry->failureMessageLength);
+
+	/* Write compile ID */
+	bufferWriter->writeLEB128(entry->compileID);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeCodeCacheFullEvent(void *anElement, void *userData)
+{
+	CodeCacheFullEntry *entry = (CodeCacheFullEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(CodeCacheFullID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write code blob type, there is no constant pool for it so write a null reference */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write start address */
+	bufferWriter->writeLEB128(entry->startAddress);
+
+	/* Write committed top address */
+	bufferWriter->writeLEB128(entry->commitedTopAddress);
+
+	/* Write reserved top address */
+	bufferWriter->writeLEB128(entry->reservedTopAddress);
+
+	/* Write entry count */
+	bufferWriter->writeLEB128(entry->entryCount);
+
+	/* Write method count */
+	bufferWriter->writeLEB128(entry->methodCount);
+
+	/* Write adaptor count, OpenJ9 does not generate adaptor blobs */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write unallocated capacity */
+	bufferWriter->writeLEB128(entry->unallocatedCapacity);
+
+	/* Write full count */
+	bufferWriter->writeLEB128(entry->fullCount);
+
+	/* Write code cache maximum capacity */
+	bufferWriter->writeLEB128(entry->codeCacheMaxCapacity);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeDeoptimizationEvent(void *anElement, void *userData)
+{
+	DeoptimizationEntry *entry = (DeoptimizationEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(DeoptimizationID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write stacktrace index, the stack is not walked during decompilation */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write compile ID */
+	bufferWriter->writeLEB128(entry->compileID);
+
+	/* Write compiler type, there is no constant pool for it so write a null reference */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write method index */
+	bufferWriter->writeLEB128(entry->methodIndex);
+
+	/* Write line number */
+	bufferWriter->writeLEB128(entry->lineNumber);
+
+	/* Write bytecode index */
+	bufferWriter->writeLEB128(entry->bytecodeIndex);
+
+	/* Write instruction, there is no constant pool for it so write a null reference */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write reason and action, only induced OSR records deoptimization events */
+	bufferWriter->writeLEB128((U_64)DeoptOnStackReplacement);
+	bufferWriter->writeLEB128((U_64)DeoptMaybeRecompile);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
 void
 VM_JFRChunkWriter::writeOldGarbageCollectionEvent(void *anElement, void *userData)
 {
@@ -79,6 +79,14 @@ static constexpr const char * const gcWhens[] = {
 	"After GC"
 };
 
+static constexpr const char * const deoptimizationReasons[] = {
+	"on_stack_replacement"
+};
+
+static constexpr const char * const deoptimizationActions[] = {
+	"maybe_recompile"
+};
+
 enum StringEnconding {
 	NullString = 0,
 	EmptyString,
@@ -100,6 +108,13 @@ enum MetadataTypeID {
 	SystemGCID = 36,
 	YoungGarbageCollectionID = 38,
 	OldGarbageCollectionID = 39,
+	CompilationID = 67,
+	CompilationFailureID = 69,
+	CodeCacheFullID = 71,
+	DeoptimizationID = 73,
+	ObjectAllocationInNewTLABID = 81,
+	ObjectAllocationOutsideTLABID = 82,
+	ObjectAllocationSampleID = 83,
 	JVMInformationID = 87,
 	OSInformationID = 88,
 	VirtualizationInformationID = 89,
@@ -142,6 +157,8 @@ enum MetadataTypeID {
 	StackTraceID = 188,
 	FrameTypeID = 189,
 	StackFrameID = 197,
+	DeoptimizationReasonID = 200,
+	DeoptimizationActionID = 201,
 };
 
 enum ReservedEvent {
@@ -200,6 +217,8 @@ private:
 	static constexpr int GC_NAMES_ENTRY_SIZE = CHECKPOINT_EVENT_HEADER_AND_FOOTER + sizeof(gcNames) + (GCNameTypeCount * STRING_HEADER_LENGTH);
 	static constexpr int GC_CAUSES_ENTRY_SIZE = CHECKPOINT_EVENT_HEADER_AND_FOOTER + sizeof(gcCauses) + (GCCauseTypeCount * STRING_HEADER_LENGTH);
 	static constexpr int GC_WHENS_ENTRY_SIZE = CHECKPOINT_EVENT_HEADER_AND_FOOTER + sizeof(gcWhens) + (GCWhenTypeCount * STRING_HEADER_LENGTH);
+	static constexpr int DEOPTIMIZATION_REASONS_ENTRY_SIZE = CHECKPOINT_EVENT_HEADER_AND_FOOTER + (DeoptimizationReasonTypeCount * STRING_CONSTANT_SIZE);
+	static constexpr int DEOPTIMIZATION_ACTIONS_ENTRY_SIZE = CHECKPOINT_EVENT_HEADER_AND_FOOTER + (DeoptimizationActionTypeCount * STRING_CONSTANT_SIZE);
 	static constexpr int CLASS_ENTRY_ENTRY_SIZE = (5 * sizeof(U_64)) + sizeof(U_8);
 	static constexpr int CLASSLOADER_ENTRY_SIZE = 3 * sizeof(U_64);
 	static constexpr int PACKAGE_ENTRY_SIZE = (3 * sizeof(U_64)) + sizeof(U_8);
@@ -242,6 +261,12 @@ private:
 	static constexpr int NETWORK_UTILIZATION_EVENT_SIZE = (4 * sizeof(U_64)) + sizeof(U_32);
 	static constexpr int DATA_LOSS_EVENT_SIZE = sizeof(U_8) + LEB128_32_SIZE + (3 * LEB128_64_SIZE);
 	static constexpr int THREAD_ALLOCATION_STATISTICS_EVENT_SIZE = sizeof(U_8) + LEB128_32_SIZE + (3 * LEB128_64_SIZE);
+	/* Each sample is written as an ObjectAllocationSample and an ObjectAllocation{InNew,Outside}TLAB event. */
+	static constexpr int OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE = 2 * (sizeof(U_32) + (4 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE));
+	static constexpr int COMPILATION_EVENT_SIZE = sizeof(U_32) + (2 * sizeof(U_8)) + (5 * LEB128_64_SIZE) + (5 * LEB128_32_SIZE);
+	static constexpr int COMPILATION_FAILURE_EVENT_SIZE = sizeof(U_32) + (2 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE) + 300 /* truncated failure message */;
+	static constexpr int CODE_CACHE_FULL_EVENT_SIZE = sizeof(U_32) + (7 * LEB128_64_SIZE) + (6 * LEB128_32_SIZE);
+	static constexpr int DEOPTIMIZATION_EVENT_SIZE = sizeof(U_32) + (2 * LEB128_64_SIZE) + (10 * LEB128_32_SIZE);
 
 	static constexpr int METADATA_ID = 1;
 
@@ -419,6 +444,10 @@ done:
 
 			writeGCWhenTypesEvent();
 
+			writeDeoptimizationReasonTypesEvent();
+
+			writeDeoptimizationActionTypesEvent();
+
 			writeThreadCheckpointEvent();
 
 			writeThreadGroupCheckpointEvent();
@@ -481,6 +510,16 @@ done:
 
 			pool_do(_constantPoolTypes.getPhysicalMemoryTable(), &writePhysicalMemoryEventFromTable, _bufferWriter);
 
+			pool_do(_constantPoolTypes.getObjectAllocationSampleTable(), &writeObjectAllocationSampleEvent, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getCompilationTable(), &writeCompilationEvent, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getCompilationFailureTable(), &writeCompilationFailureEvent, this);
+
+			pool_do(_constantPoolTypes.getCodeCacheFullTable(), &writeCodeCacheFullEvent, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getDeoptimizationTable(), &writeDeoptimizationEvent, _bufferWriter);
+
 			pool_do(_constantPoolTypes.getGCHeapSummaryTable(), &writeGCHeapSummaryEvent, _bufferWriter);
 
 			pool_do(_constantPoolTypes.getNetworkUtilizationTable(), &writeNetworkUtilizationEvent, this);
@@ -973,6 +1012,10 @@ done:
 
 	void writeGCWhenTypesEvent();
 
+	void writeDeoptimizationReasonTypesEvent();
+
+	void writeDeoptimizationActionTypesEvent();
+
 	void writeGCHeapConfigurationEvent();
 
 	void writeYoungGenerationConfigurationEvent();
@@ -997,6 +1040,16 @@ done:
 
 	static void writeSystemGCEvent(void *anElement, void *userData);
 
+	static void writeObjectAllocationSampleEvent(void *anElement, void *userData);
+
+	static void writeCompilationEvent(void *anElement, void *userData);
+
+	static void writeCompilationFailureEvent(void *anElement, void *userData);
+
+	static void writeCodeCacheFullEvent(void *anElement, void *userData);
+
+	static void writeDeoptimizationEvent(void *anElement, void *userData);
+
 	static void writeModuleRequire(void *anElement, void *userData);
 
 	static void writeModuleExport(void *anElement, void *userData);
@@ -1033,6 +1086,12 @@ done:
 
 		requiredBufferSize += GC_CAUSES_ENTRY_SIZE;
 
+		requiredBufferSize += GC_WHENS_ENTRY_SIZE;
+
+		requiredBufferSize += DEOPTIMIZATION_REASONS_ENTRY_SIZE;
+
+		requiredBufferSize += DEOPTIMIZATION_ACTIONS_ENTRY_SIZE;
+
 		requiredBufferSize += (CHECKPOINT_EVENT_HEADER_AND_FOOTER + (_constantPoolTypes.getClassCount() * CLASS_ENTRY_ENTRY_SIZE));
 
 		requiredBufferSize += (CHECKPOINT_EVENT_HEADER_AND_FOOTER + (_constantPoolTypes.getClassloaderCount() * CLASSLOADER_ENTRY_SIZE));
@@ -1125,6 +1184,16 @@ done:
 
 		requiredBufferSize += (_constantPoolTypes.getDataLossCount() * DATA_LOSS_EVENT_SIZE);
 
+		requiredBufferSize += (_constantPoolTypes.getObjectAllocationSampleCount() * OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getCompilationCount() * COMPILATION_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getCompilationFailureCount() * COMPILATION_FAILURE_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getCodeCacheFullCount() * CODE_CACHE_FULL_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getDeoptimizationCount() * DEOPTIMIZATION_EVENT_SIZE);
+
 		requiredBufferSize *= 2;
 
 		return requiredBufferSize;
@@ -1587,6 +1587,144 @@ done:
 	return;
 }
 
+void
+VM_JFRConstantPoolTypes::addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)pool_newElement(_objectAllocationSampleTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = objectAllocationSampleData->startTicks;
+	entry->allocationSize = objectAllocationSampleData->allocationSize;
+	entry->tlabSize = objectAllocationSampleData->tlabSize;
+	entry->weight = objectAllocationSampleData->weight;
+	entry->recordSample = objectAllocationSampleData->recordSample;
+	entry->recordTLABEvent = objectAllocationSampleData->recordTLABEvent;
+
+	/* Use the TID directly as the thread index */
+	entry->eventThreadIndex = objectAllocationSampleData->currentThreadTID;
+
+	entry->stackTraceIndex = consumeStackTrace(objectAllocationSampleData->currentThreadTID, J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(objectAllocationSampleData), objectAllocationSampleData->stackTraceSize, objectAllocationSampleData->stackTraceID);
+	if (isResultNotOKay()) goto done;
+
+	entry->objectClass = getClassEntry(objectAllocationSampleData->objectClass);
+	if (isResultNotOKay()) goto done;
+
+	_objectAllocationSampleCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addCompilationEntry(J9JFRCompilation *compilationData)
+{
+	CompilationEntry *entry = (CompilationEntry *)pool_newElement(_compilationTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = compilationData->startTicks;
+	entry->duration = compilationData->duration;
+	entry->eventThreadIndex = compilationData->currentThreadTID;
+	entry->compileID = compilationData->compileID;
+	entry->compileLevel = compilationData->compileLevel;
+	entry->codeSize = compilationData->codeSize;
+	entry->inlinedBytes = compilationData->inlinedBytes;
+	entry->succeeded = compilationData->succeeded;
+	entry->isOSR = compilationData->isOSR;
+
+	entry->methodIndex = getMethodEntry(J9_ROM_METHOD_FROM_RAM_METHOD(compilationData->method), J9_CLASS_FROM_METHOD(compilationData->method));
+	if (isResultNotOKay()) goto done;
+
+	_compilationCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addCompilationFailureEntry(J9JFRCompilationFailure *compilationFailureData)
+{
+	CompilationFailureEntry *entry = (CompilationFailureEntry *)pool_newElement(_compilationFailureTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = compilationFailureData->startTicks;
+	entry->eventThreadIndex = compilationFailureData->currentThreadTID;
+	entry->compileID = compilationFailureData->compileID;
+	entry->failureMessage = J9JFRCOMPILATIONFAILURE_MESSAGE(compilationFailureData);
+	entry->failureMessageLength = compilationFailureData->messageLength;
+
+	_compilationFailureCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addCodeCacheFullEntry(J9JFRCodeCacheFull *codeCacheFullData)
+{
+	CodeCacheFullEntry *entry = (CodeCacheFullEntry *)pool_newElement(_codeCacheFullTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = codeCacheFullData->startTicks;
+	entry->eventThreadIndex = codeCacheFullData->currentThreadTID;
+	entry->startAddress = codeCacheFullData->startAddress;
+	entry->commitedTopAddress = codeCacheFullData->commitedTopAddress;
+	entry->reservedTopAddress = codeCacheFullData->reservedTopAddress;
+	entry->unallocatedCapacity = codeCacheFullData->unallocatedCapacity;
+	entry->codeCacheMaxCapacity = codeCacheFullData->codeCacheMaxCapacity;
+	entry->entryCount = codeCacheFullData->entryCount;
+	entry->methodCount = codeCacheFullData->methodCount;
+	entry->fullCount = codeCacheFullData->fullCount;
+
+	_codeCacheFullCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addDeoptimizationEntry(J9JFRDeoptimization *deoptimizationData)
+{
+	DeoptimizationEntry *entry = (DeoptimizationEntry *)pool_newElement(_deoptimizationTable);
+	UDATA lineNumber = 0;
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = deoptimizationData->startTicks;
+	entry->eventThreadIndex = deoptimizationData->currentThreadTID;
+	entry->bytecodeIndex = deoptimizationData->bytecodeIndex;
+	entry->compileID = deoptimizationData->compileID;
+
+	lineNumber = getLineNumberForROMClass(_vm, deoptimizationData->method, deoptimizationData->bytecodeIndex);
+	entry->lineNumber = ((UDATA)-1 == lineNumber) ? 0 : (U_32)lineNumber;
+
+	entry->methodIndex = getMethodEntry(J9_ROM_METHOD_FROM_RAM_METHOD(deoptimizationData->method), J9_CLASS_FROM_METHOD(deoptimizationData->method));
+	if (isResultNotOKay()) goto done;
+
+	_deoptimizationCount += 1;
+
+done:
+	return;
+}
+
 void
 VM_JFRConstantPoolTypes::printTables()
 {
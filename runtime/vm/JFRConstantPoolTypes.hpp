@@ -94,6 +94,16 @@ enum GCWhenType {
 	GCWhenTypeCount
 };
 
+enum DeoptimizationReasonType {
+	DeoptOnStackReplacement = 0,
+	DeoptimizationReasonTypeCount,
+};
+
+enum DeoptimizationActionType {
+	DeoptMaybeRecompile = 0,
+	DeoptimizationActionTypeCount,
+};
+
 enum ThreadState {
 	NEW = 0,
 	TERMINATED,
@@ -259,6 +269,61 @@ struct MonitorEnterEntry {
 	U_32 stackTraceIndex;
 };
 
+struct ObjectAllocationSampleEntry {
+	I_64 ticks;
+	U_64 eventThreadIndex;
+	U_32 stackTraceIndex;
+	U_32 objectClass;
+	U_64 allocationSize;
+	U_64 tlabSize;
+	U_64 weight;
+	BOOLEAN recordSample;
+	BOOLEAN recordTLABEvent;
+};
+
+struct CompilationEntry {
+	I_64 ticks;
+	I_64 duration;
+	U_64 eventThreadIndex;
+	U_32 methodIndex;
+	U_32 compileID;
+	U_32 compileLevel;
+	U_32 codeSize;
+	U_32 inlinedBytes;
+	BOOLEAN succeeded;
+	BOOLEAN isOSR;
+};
+
+struct CompilationFailureEntry {
+	I_64 ticks;
+	U_64 eventThreadIndex;
+	U_32 compileID;
+	U_8 *failureMessage;
+	UDATA failureMessageLength;
+};
+
+struct CodeCacheFullEntry {
+	I_64 ticks;
+	U_64 eventThreadIndex;
+	U_64 startAddress;
+	U_64 commitedTopAddress;
+	U_64 reservedTopAddress;
+	U_64 unallocatedCapacity;
+	U_64 codeCacheMaxCapacity;
+	I_32 entryCount;
+	I_32 methodCount;
+	I_32 fullCount;
+};
+
+struct DeoptimizationEntry {
+	I_64 ticks;
+	U_64 eventThreadIndex;
+	U_32 methodIndex;
+	U_32 lineNumber;
+	U_32 bytecodeIndex;
+	U_32 compileID;
+};
+
 struct ThreadParkEntry {
 	I_64 ticks;
 	I_64 duration;
@@ -571,6 +636,16 @@ private:
 	UDATA _threadAllocationStatisticsCount;
 	J9Pool *_physicalMemoryTable;
 	UDATA _physicalMemoryCount;
+	J9Pool *_objectAllocationSampleTable;
+	UDATA _objectAllocationSampleCount;
+	J9Pool *_compilationTable;
+	UDATA _compilationCount;
+	J9Pool *_compilationFailureTable;
+	UDATA _compilationFailureCount;
+	J9Pool *_codeCacheFullTable;
+	UDATA _codeCacheFullCount;
+	J9Pool *_deoptimizationTable;
+	UDATA _deoptimizationCount;
 
 	/* Periodic events. */
 	bool _shouldWriteJVMInformation;
@@ -891,6 +966,16 @@ public:
 
 	void addPhysicalMemoryEntry(J9JFRPhysicalMemory *physicalMemoryData);
 
+	void addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData);
+
+	void addCompilationEntry(J9JFRCompilation *compilationData);
+
+	void addCompilationFailureEntry(J9JFRCompilationFailure *compilationFailureData);
+
+	void addCodeCacheFullEntry(J9JFRCodeCacheFull *codeCacheFullData);
+
+	void addDeoptimizationEntry(J9JFRDeoptimization *deoptimizationData);
+
 	void addDataLossEntry(J9JFRDataLoss *dataLossData);
 
 	void addThreadDumpEntry(J9JFRThreadDump *threadDumpData);
@@ -1294,6 +1379,56 @@ public:
 		return _physicalMemoryTable;
 	}
 
+	UDATA getObjectAllocationSampleCount()
+	{
+		return _objectAllocationSampleCount;
+	}
+
+	J9Pool *getObjectAllocationSampleTable()
+	{
+		return _objectAllocationSampleTable;
+	}
+
+	UDATA getCompilationCount()
+	{
+		return _compilationCount;
+	}
+
+	J9Pool *getCompilationTable()
+	{
+		return _compilationTable;
+	}
+
+	UDATA getCompilationFailureCount()
+	{
+		return _compilationFailureCount;
+	}
+
+	J9Pool *getCompilationFailureTable()
+	{
+		return _compilationFailureTable;
+	}
+
+	UDATA getCodeCacheFullCount()
+	{
+		return _codeCacheFullCount;
+	}
+
+	J9Pool *getCodeCacheFullTable()
+	{
+		return _codeCacheFullTable;
+	}
+
+	UDATA getDeoptimizationCount()
+	{
+		return _deoptimizationCount;
+	}
+
+	J9Pool *getDeoptimizationTable()
+	{
+		return _deoptimizationTable;
+	}
+
 	bool shouldWriteJVMInformation()
 	{
 		return _shouldWriteJVMInformation;
@@ -1489,6 +1624,21 @@ public:
 			case J9JFR_EVENT_TYPE_THREAD_ALLOCATION_STATISTICS:
 				addThreadAllocationStatistics((J9JFRThreadAllocationStatistics *)event);
 				break;
+			case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+				addObjectAllocationSampleEntry((J9JFRObjectAllocationSample *)event);
+				break;
+			case J9JFR_EVENT_TYPE_COMPILATION:
+				addCompilationEntry((J9JFRCompilation *)event);
+				break;
+			case J9JFR_EVENT_TYPE_COMPILATION_FAILURE:
+				addCompilationFailureEntry((J9JFRCompilationFailure *)event);
+				break;
+			case J9JFR_EVENT_TYPE_CODE_CACHE_FULL:
+				addCodeCacheFullEntry((J9JFRCodeCacheFull *)event);
+				break;
+			case J9JFR_EVENT_TYPE_DEOPTIMIZATION:
+				addDeoptimizationEntry((J9JFRDeoptimization *)event);
+				break;
 			case J9JFR_EVENT_TYPE_STACKTRACE:
 			{
 				J9JFREventWithStackTrace *stackTraceEvent = (J9JFREventWithStackTrace *)event;
@@ -2255,6 +2405,16 @@ done:
 		, _threadAllocationStatisticsCount(0)
 		, _physicalMemoryTable(NULL)
 		, _physicalMemoryCount(0)
+		, _objectAllocationSampleTable(NULL)
+		, _objectAllocationSampleCount(0)
+		, _compilationTable(NULL)
+		, _compilationCount(0)
+		, _compilationFailureTable(NULL)
+		, _compilationFailureCount(0)
+		, _codeCacheFullTable(NULL)
+		, _codeCacheFullCount(0)
+		, _deoptimizationTable(NULL)
+		, _deoptimizationCount(0)
 		, _shouldWriteJVMInformation(false)
 		, _shouldWriteCPUInformationEvent(false)
 		, _shouldWriteVirtualizationInformationEvent(false)
@@ -2434,6 +2594,36 @@ done:
 			goto done;
 		}
 
+		_objectAllocationSampleTable = pool_new(sizeof(ObjectAllocationSampleEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _objectAllocationSampleTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_compilationTable = pool_new(sizeof(CompilationEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _compilationTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_compilationFailureTable = pool_new(sizeof(CompilationFailureEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _compilationFailureTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_codeCacheFullTable = pool_new(sizeof(CodeCacheFullEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _codeCacheFullTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_deoptimizationTable = pool_new(sizeof(DeoptimizationEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _deoptimizationTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
 
 		_systemProcessTable = pool_new(sizeof(SystemProcessEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
 		if (NULL == _systemProcessTable) {
@@ -2615,6 +2805,11 @@ done:
 		pool_kill(_threadDumpTable);
 		pool_kill(_threadAllocationStatisticsTable);
 		pool_kill(_physicalMemoryTable);
+		pool_kill(_objectAllocationSampleTable);
+		pool_kill(_compilationTable);
+		pool_kill(_compilationFailureTable);
+		pool_kill(_codeCacheFullTable);
+		pool_kill(_deoptimizationTable);
 		freeNetworkInterfaceNames();
 		j9mem_free_memory(_globalStringTable);
 	}
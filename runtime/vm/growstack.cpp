@@ -104,6 +104,13 @@ UDATA   growJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 }
 
 
+UDATA   shrinkJavaStack(J9VMThread * vmThread, UDATA newStackSize)
+{
+	/* The frames are copied exactly as when growing; failing to shrink is harmless so no GC is attempted */
+	return internalGrowJavaStack(vmThread, newStackSize);
+}
+
+
 static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 {
 	PORT_ACCESS_FROM_VMC(vmThread);
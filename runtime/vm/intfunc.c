@@ -499,6 +499,10 @@ J9InternalVMFunctions J9InternalFunctions = {
 	setupChunkMonitor,
 	getThreadTID,
 	emitStackTrace,
+	jfrCompilation,
+	jfrCompilationFailure,
+	jfrCodeCacheFull,
+	jfrDeoptimization,
 #endif /* defined(J9VM_OPT_JFR) */
 #if defined(J9VM_OPT_SNAPSHOTS)
 	initializeSnapshotClassLoaderObject,
@@ -21,6 +21,7 @@
  *******************************************************************************/
 #include "JFRConstantPoolTypes.hpp"
 #include "j9protos.h"
+#include "mmhook.h"
 #include "omrlinkedlist.h"
 #include "objhelp.h"
 #include "pool_api.h"
@@ -59,6 +60,10 @@ J9_DECLARE_CONSTANT_UTF8(jfrEventClassUTF8, "jdk/jfr/Event");
 #define J9JFR_GLOBAL_BUFFER_SIZE (10 * J9JFR_THREAD_BUFFER_SIZE)
 #define J9JFR_SAMPLING_RATE 10
 #define J9JFR_CLASSNAME_BUFFER_SIZE 128
+#define J9JFR_ALLOCATION_SAMPLING_INTERVAL (512 * 1024)
+#define J9JFR_ALLOCATION_SAMPLES_PER_SECOND 150
+#define J9JFR_MAX_COMPILATION_FAILURE_MESSAGE_LENGTH 256
+#define J9JFR_NANOSECONDS_PER_SECOND ((U_64)1000000000)
 
 #define INVALID_TYPE_ID -1
 
@@ -204,6 +209,21 @@ jfrEventSize(J9JFREvent *jfrEvent)
 	case J9JFR_EVENT_TYPE_STACKTRACE:
 		size = sizeof(J9JFREventWithStackTrace) + (((J9JFREventWithStackTrace *)jfrEvent)->stackTraceSize * sizeof(UDATA));
 		break;
+	case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+		size = sizeof(J9JFRObjectAllocationSample) + (((J9JFRObjectAllocationSample *)jfrEvent)->stackTraceSize * sizeof(UDATA));
+		break;
+	case J9JFR_EVENT_TYPE_COMPILATION:
+		size = sizeof(J9JFRCompilation);
+		break;
+	case J9JFR_EVENT_TYPE_COMPILATION_FAILURE:
+		size = sizeof(J9JFRCompilationFailure) + (((J9JFRCompilationFailure *)jfrEvent)->messageLength * sizeof(U_8));
+		break;
+	case J9JFR_EVENT_TYPE_CODE_CACHE_FULL:
+		size = sizeof(J9JFRCodeCacheFull);
+		break;
+	case J9JFR_EVENT_TYPE_DEOPTIMIZATION:
+		size = sizeof(J9JFRDeoptimization);
+		break;
 	case J9JFR_EVENT_TYPE_JVM_INFORMATION:
 	case J9JFR_EVENT_TYPE_CPU_INFORMATION:
 	case J9JFR_EVENT_TYPE_VIRTUALIZATION_INFORMATION:
@@ -955,6 +975,94 @@ jfrSystemGC(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userD
 	}
 }
 
+/**
+ * Throttle allocation samples to J9JFR_ALLOCATION_SAMPLES_PER_SECOND across all threads.
+ * Samples dropped here are not lost from the allocation profile, their bytes are
+ * attributed to the next accepted sample on the same thread through the weight.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param now[in] the current time in nanoseconds
+ *
+ * @returns true if the sample should be recorded, false otherwise
+ */
+static bool
+acceptAllocationSample(J9JavaVM *vm, U_64 now)
+{
+	U_64 windowStart = vm->jfrState.allocationSampleWindowStart;
+
+	if ((now - windowStart) >= J9JFR_NANOSECONDS_PER_SECOND) {
+		/* Only the thread that moves the window resets the count. */
+		if (windowStart == VM_AtomicSupport::lockCompareExchangeU64(&vm->jfrState.allocationSampleWindowStart, windowStart, now)) {
+			vm->jfrState.allocationSampleWindowCount = 0;
+		}
+	}
+
+	return VM_AtomicSupport::addU32(&vm->jfrState.allocationSampleWindowCount, 1) <= J9JFR_ALLOCATION_SAMPLES_PER_SECOND;
+}
+
+/**
+ * Hook for sampled object allocations. Called with VM access from the out-of-line
+ * allocation path, which is also taken on TLAB refresh, whenever the GC allocation
+ * sampling interval is crossed.
+ *
+ * @param hook[in] the GC hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrObjectAllocationSample(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_ObjectAllocationSamplingEvent *event = (MM_ObjectAllocationSamplingEvent *)eventData;
+	J9VMThread *currentThread = event->currentThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	U_8 *objectStart = (U_8 *)event->object;
+	UDATA objectSize = event->objectSize;
+	UDATA tlabSize = 0;
+	BOOLEAN recordSample = TRUE;
+	BOOLEAN recordTLABEvent = TRUE;
+	PORT_ACCESS_FROM_VMC(currentThread);
+
+	/* An object bump allocated from the thread's TLAB ends exactly at the allocation pointer.
+	 * The TLAB size reported is the extent from the object to the current TLAB top.
+	 */
+	if (currentThread->heapAlloc == (objectStart + objectSize)) {
+		tlabSize = currentThread->heapTop - objectStart;
+	} else if (currentThread->nonZeroHeapAlloc == (objectStart + objectSize)) {
+		tlabSize = currentThread->nonZeroHeapTop - objectStart;
+	}
+
+#if JAVA_SPEC_VERSION >= 17
+	recordSample = isJFREventEnabled(vm, JfrObjectAllocationSampleEvent);
+	if (0 != tlabSize) {
+		recordTLABEvent = isJFREventEnabled(vm, JfrObjectAllocationInNewTLABEvent);
+	} else {
+		recordTLABEvent = isJFREventEnabled(vm, JfrObjectAllocationOutsideTLABEvent);
+	}
+#endif /* JAVA_SPEC_VERSION >= 17 */
+
+	if ((!recordSample && !recordTLABEvent) || !acceptAllocationSample(vm, (U_64)j9time_nano_time())) {
+		return;
+	}
+
+	UDATA bytesAllocated = vm->memoryManagerFunctions->j9gc_get_bytes_allocated_by_thread(currentThread);
+
+	/* Reserving buffer space may release VM access to flush, keep the object up to date for the GC hook. */
+	PUSH_OBJECT_IN_SPECIAL_FRAME(currentThread, event->object);
+	J9JFRObjectAllocationSample *jfrEvent = (J9JFRObjectAllocationSample *)reserveBufferWithStackTrace(currentThread, currentThread, J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE, sizeof(*jfrEvent), 0);
+	event->object = POP_OBJECT_IN_SPECIAL_FRAME(currentThread);
+
+	if (NULL != jfrEvent) {
+		jfrEvent->objectClass = event->clazz;
+		jfrEvent->allocationSize = objectSize;
+		jfrEvent->tlabSize = tlabSize;
+		jfrEvent->weight = bytesAllocated - currentThread->threadJfrState.lastAllocationSampleBytes;
+		jfrEvent->recordSample = recordSample;
+		jfrEvent->recordTLABEvent = recordTLABEvent;
+		currentThread->threadJfrState.lastAllocationSampleBytes = bytesAllocated;
+	}
+}
+
 /**
  * Hook for old garbage collection event. Called without VM access.
  *
@@ -1272,6 +1380,19 @@ startJFRRecording(J9JavaVM *vm)
 	if (0 != (vm->memoryManagerFunctions->j9gc_register_jfr_hooks(vm))) {
 		goto done;
 	}
+	/* Allocation sampling is only available if the hook was reserved before bootstrap, don't fail the recording without it. */
+	{
+		J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
+		/* If another listener (JVMTI) already samples allocations, keep its sampling interval. */
+		BOOLEAN alreadySampling = J9_EVENT_IS_HOOKED(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING);
+		if (0 == (*gcHooks)->J9HookRegisterWithCallSite(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSample, OMR_GET_CALLSITE(), NULL)) {
+			vm->jfrState.isAllocationSamplingHooked = TRUE;
+			if (!alreadySampling) {
+				vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9JFR_ALLOCATION_SAMPLING_INTERVAL);
+				vm->jfrState.setAllocationSamplingInterval = TRUE;
+			}
+		}
+	}
 
 	internalReleaseVMAccess(currentThread);
 	jfrStartSamplingThread(vm);
@@ -1325,6 +1446,17 @@ stopJFRRecording(J9JavaVM *vm)
 
 	/* Deregister GC-related hooks via gc_base */
 	vm->memoryManagerFunctions->j9gc_deregister_jfr_hooks(vm);
+
+	if (vm->jfrState.isAllocationSamplingHooked) {
+		J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
+		(*gcHooks)->J9HookUnregister(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSample, NULL);
+		/* Restore the default (disabled) interval unless another listener is still sampling. */
+		if (vm->jfrState.setAllocationSamplingInterval && !J9_EVENT_IS_HOOKED(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING)) {
+			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, UDATA_MAX);
+		}
+		vm->jfrState.isAllocationSamplingHooked = FALSE;
+		vm->jfrState.setAllocationSamplingInterval = FALSE;
+	}
 }
 
 void
@@ -2720,6 +2852,138 @@ jfrEmitDataLoss(J9VMThread *currentThread, U_64 bytes)
 	}
 }
 
+void
+jfrCompilation(J9VMThread *currentThread, J9Method *method, U_32 compileID, U_32 compileLevel, I_64 duration, BOOLEAN succeeded, BOOLEAN isOSR, U_32 codeSize, U_32 inlinedBytes, BOOLEAN isRemote, BOOLEAN isAOTLoad)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	if (!isJFRRecordingStarted(vm)) {
+		return;
+	}
+#if JAVA_SPEC_VERSION >= 17
+	if (!isJFREventEnabled(vm, JfrCompilationEvent)) {
+		return;
+	}
+#endif /* JAVA_SPEC_VERSION >= 17 */
+
+	bool needsVMAccess = J9_ARE_NO_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS);
+	if (needsVMAccess) {
+		internalAcquireVMAccess(currentThread);
+	}
+	J9JFRCompilation *jfrEvent = (J9JFRCompilation *)reserveBuffer(currentThread, currentThread, sizeof(J9JFRCompilation));
+	if (NULL != jfrEvent) {
+		initializeEventFields(currentThread, currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_COMPILATION);
+		/* The event is reported when the compilation ends, back-date the start time */
+		jfrEvent->startTicks -= duration;
+		jfrEvent->duration = duration;
+		jfrEvent->method = method;
+		jfrEvent->compileID = compileID;
+		jfrEvent->compileLevel = compileLevel;
+		jfrEvent->codeSize = codeSize;
+		jfrEvent->inlinedBytes = inlinedBytes;
+		jfrEvent->succeeded = succeeded;
+		jfrEvent->isOSR = isOSR;
+		jfrEvent->isRemote = isRemote;
+		jfrEvent->isAOTLoad = isAOTLoad;
+	}
+	if (needsVMAccess) {
+		internalReleaseVMAccess(currentThread);
+	}
+}
+
+void
+jfrCompilationFailure(J9VMThread *currentThread, U_32 compileID, const char *failureMessage)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	if (!isJFRRecordingStarted(vm)) {
+		return;
+	}
+#if JAVA_SPEC_VERSION >= 17
+	if (!isJFREventEnabled(vm, JfrCompilationFailureEvent)) {
+		return;
+	}
+#endif /* JAVA_SPEC_VERSION >= 17 */
+
+	UDATA messageLength = (NULL == failureMessage) ? 0 : strlen(failureMessage);
+	if (messageLength > J9JFR_MAX_COMPILATION_FAILURE_MESSAGE_LENGTH) {
+		messageLength = J9JFR_MAX_COMPILATION_FAILURE_MESSAGE_LENGTH;
+	}
+
+	bool needsVMAccess = J9_ARE_NO_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS);
+	if (needsVMAccess) {
+		internalAcquireVMAccess(currentThread);
+	}
+	J9JFRCompilationFailure *jfrEvent = (J9JFRCompilationFailure *)reserveBuffer(currentThread, currentThread, sizeof(J9JFRCompilationFailure) + messageLength);
+	if (NULL != jfrEvent) {
+		initializeEventFields(currentThread, currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_COMPILATION_FAILURE);
+		jfrEvent->compileID = compileID;
+		jfrEvent->messageLength = messageLength;
+		memcpy(J9JFRCOMPILATIONFAILURE_MESSAGE(jfrEvent), failureMessage, messageLength);
+	}
+	if (needsVMAccess) {
+		internalReleaseVMAccess(currentThread);
+	}
+}
+
+void
+jfrCodeCacheFull(J9VMThread *currentThread, U_64 startAddress, U_64 commitedTopAddress, U_64 reservedTopAddress, U_64 unallocatedCapacity, U_64 codeCacheMaxCapacity, I_32 entryCount, I_32 methodCount, I_32 fullCount)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	if (!isJFRRecordingStarted(vm)) {
+		return;
+	}
+#if JAVA_SPEC_VERSION >= 17
+	if (!isJFREventEnabled(vm, JfrCodeCacheFullEvent)) {
+		return;
+	}
+#endif /* JAVA_SPEC_VERSION >= 17 */
+
+	bool needsVMAccess = J9_ARE_NO_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS);
+	if (needsVMAccess) {
+		internalAcquireVMAccess(currentThread);
+	}
+	J9JFRCodeCacheFull *jfrEvent = (J9JFRCodeCacheFull *)reserveBuffer(currentThread, currentThread, sizeof(J9JFRCodeCacheFull));
+	if (NULL != jfrEvent) {
+		initializeEventFields(currentThread, currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_CODE_CACHE_FULL);
+		jfrEvent->startAddress = startAddress;
+		jfrEvent->commitedTopAddress = commitedTopAddress;
+		jfrEvent->reservedTopAddress = reservedTopAddress;
+		jfrEvent->unallocatedCapacity = unallocatedCapacity;
+		jfrEvent->codeCacheMaxCapacity = codeCacheMaxCapacity;
+		jfrEvent->entryCount = entryCount;
+		jfrEvent->methodCount = methodCount;
+		jfrEvent->fullCount = fullCount;
+	}
+	if (needsVMAccess) {
+		internalReleaseVMAccess(currentThread);
+	}
+}
+
+void
+jfrDeoptimization(J9VMThread *currentThread, J9Method *method, U_32 bytecodeIndex, U_32 compileID)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	if (!isJFRRecordingStarted(vm)) {
+		return;
+	}
+#if JAVA_SPEC_VERSION >= 17
+	if (!isJFREventEnabled(vm, JfrDeoptimizationEvent)) {
+		return;
+	}
+#endif /* JAVA_SPEC_VERSION >= 17 */
+
+	J9JFRDeoptimization *jfrEvent = (J9JFRDeoptimization *)reserveBuffer(currentThread, currentThread, sizeof(J9JFRDeoptimization));
+	if (NULL != jfrEvent) {
+		initializeEventFields(currentThread, currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_DEOPTIMIZATION);
+		jfrEvent->method = method;
+		jfrEvent->bytecodeIndex = bytecodeIndex;
+		jfrEvent->compileID = compileID;
+	}
+}
+
 jboolean
 requestJFREvent(J9VMThread *currentThread, jlong id)
 {
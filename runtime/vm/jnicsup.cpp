@@ -1699,6 +1699,173 @@ J9VM_initializeJNI31Table(JNIEnv *env)
 }
 #endif /* defined(J9VM_ZOS_3164_INTEROPERABILITY) */
 
+/**
+ * Get the JNI global ref slot cache of a thread, allocating it if necessary.
+ * @param vmThread the current J9VMThread
+ * @returns the cache, or NULL if it could not be allocated
+ */
+static J9JNIGlobalRefCache *
+getJNIGlobalRefCache(J9VMThread *vmThread)
+{
+	J9JNIGlobalRefCache *cache = vmThread->jniGlobalRefCache;
+	if (NULL == cache) {
+		PORT_ACCESS_FROM_VMC(vmThread);
+		cache = (J9JNIGlobalRefCache *)j9mem_allocate_memory(sizeof(J9JNIGlobalRefCache), J9MEM_CATEGORY_JNI);
+		if (NULL != cache) {
+			cache->count = 0;
+			cache->puddleStart = 0;
+			cache->puddleEnd = 0;
+			vmThread->jniGlobalRefCache = cache;
+		}
+	}
+	return cache;
+}
+
+/**
+ * Return cached JNI global ref slots to vm->jniGlobalReferences, starting at the given index.
+ * @param vm the J9JavaVM
+ * @param cache the cache
+ * @param index the number of slots to keep in the cache
+ */
+static void
+releaseCachedGlobalRefSlots(J9JavaVM *vm, J9JNIGlobalRefCache *cache, UDATA index)
+{
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+	for (UDATA i = index; i < cache->count; i++) {
+		pool_removeElement(vm->jniGlobalReferences, cache->slots[i]);
+	}
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+	cache->count = index;
+}
+
+/**
+ * Take a slot for a strong JNI global ref from the thread's cache, refilling
+ * the cache from vm->jniGlobalReferences in one batch if it is empty.
+ * @param vmThread the current J9VMThread
+ * @returns a slot holding NULL, or NULL if none could be allocated
+ */
+static j9object_t *
+takeCachedGlobalRefSlot(J9VMThread *vmThread)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9JNIGlobalRefCache *cache = getJNIGlobalRefCache(vmThread);
+	j9object_t *slot = NULL;
+
+	if (NULL != cache) {
+		if (0 == cache->count) {
+#ifdef J9VM_THR_PREEMPTIVE
+			omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+			while (cache->count < J9JNI_GLOBAL_REF_CACHE_REFILL) {
+				j9object_t *newSlot = (j9object_t *)pool_newElement(vm->jniGlobalReferences);
+				if (NULL == newSlot) {
+					break;
+				}
+				/* The pool does not zero elements, and the GC may iterate the pool as soon as the mutex is released */
+				*newSlot = NULL;
+				cache->slots[cache->count] = newSlot;
+				cache->count += 1;
+			}
+#ifdef J9VM_THR_PREEMPTIVE
+			omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+		}
+		if (0 != cache->count) {
+			cache->count -= 1;
+			slot = cache->slots[cache->count];
+		}
+	}
+	return slot;
+}
+
+/**
+ * Put the slot of a deleted strong JNI global ref into the thread's cache,
+ * returning half of the cache to vm->jniGlobalReferences if it is full.
+ * @param vmThread the current J9VMThread
+ * @param slot the slot, which must hold NULL
+ * @returns true if the slot was cached, false if it must be returned to the pool by the caller
+ */
+static bool
+cacheGlobalRefSlot(J9VMThread *vmThread, j9object_t *slot)
+{
+	J9JNIGlobalRefCache *cache = getJNIGlobalRefCache(vmThread);
+	bool cached = false;
+
+	if (NULL != cache) {
+		if (J9JNI_GLOBAL_REF_CACHE_SIZE == cache->count) {
+			releaseCachedGlobalRefSlots(vmThread->javaVM, cache, J9JNI_GLOBAL_REF_CACHE_SIZE / 2);
+		}
+		cache->slots[cache->count] = slot;
+		cache->count += 1;
+		cached = true;
+	}
+	return cached;
+}
+
+/**
+ * Check whether a slot is an element of vm->jniGlobalReferences.
+ * The pool links new puddles without a store barrier, so the puddle list is only walked while
+ * holding vm->jniFrameMutex. When the global ref cache is enabled the pool never frees its puddles,
+ * so the bounds of the last puddle found stay valid and are kept in the thread's cache, which
+ * lets most checks complete without acquiring the mutex.
+ * @param vmThread the current J9VMThread
+ * @param slot the slot
+ * @returns true if the slot is an element of the pool, false otherwise
+ */
+static bool
+isGlobalRefPoolElement(J9VMThread *vmThread, j9object_t *slot)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9Pool *pool = vm->jniGlobalReferences;
+	J9JNIGlobalRefCache *cache = getJNIGlobalRefCache(vmThread);
+	UDATA puddleSize = pool->elementSize * pool->elementsPerPuddle;
+	bool result = false;
+
+	if ((NULL != cache) && ((UDATA)slot >= cache->puddleStart) && ((UDATA)slot < cache->puddleEnd)) {
+		result = (0 == (((UDATA)slot - cache->puddleStart) % pool->elementSize));
+	} else {
+#ifdef J9VM_THR_PREEMPTIVE
+		omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+		J9PoolPuddle *puddle = J9POOLPUDDLELIST_NEXTPUDDLE(J9POOL_PUDDLELIST(pool));
+		while (NULL != puddle) {
+			UDATA firstElement = (UDATA)WSRP_GET(puddle->firstElementAddress, void *);
+			if (((UDATA)slot >= firstElement) && ((UDATA)slot < (firstElement + puddleSize))) {
+				result = (0 == (((UDATA)slot - firstElement) % pool->elementSize));
+				if (NULL != cache) {
+					cache->puddleStart = firstElement;
+					cache->puddleEnd = firstElement + puddleSize;
+				}
+				break;
+			}
+			puddle = J9POOLPUDDLE_NEXTPUDDLE(puddle);
+		}
+#ifdef J9VM_THR_PREEMPTIVE
+		omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+	}
+	return result;
+}
+
+void
+cleanupVMThreadJNIGlobalRefCache(J9VMThread *vmThread)
+{
+	J9JNIGlobalRefCache *cache = vmThread->jniGlobalRefCache;
+	if (NULL != cache) {
+		J9JavaVM *vm = vmThread->javaVM;
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		if (NULL != vm->jniGlobalReferences) {
+			releaseCachedGlobalRefSlots(vm, cache, 0);
+		}
+		j9mem_free_memory(cache);
+		vmThread->jniGlobalRefCache = NULL;
+	}
+}
+
 /*
  * 1) Private routine.  Used to delete a jni global reference from an actual object pointer.
  * 2) We don't acquire VM access - caller must already have it.
@@ -1712,7 +1879,31 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 
 	Assert_VM_mustHaveVMAccess(vmThread);
 
-	if (globalRef != NULL) {
+	if ((globalRef != NULL) && !isWeak && J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_JNI_GLOBAL_REF_CACHE)
+		&& isGlobalRefPoolElement(vmThread, (j9object_t *)globalRef)
+	) {
+		/* Strong global refs never hold NULL, so a NULL slot has already been deleted and is cached.
+		 * Clearing the slot atomically keeps racing deletes of the same ref from caching it twice.
+		 * Refs that are not elements of the pool (local refs, weak refs or bogus pointers) take the
+		 * locked path below, which ignores them, so they never end up in the cache.
+		 */
+		j9object_t *slot = (j9object_t *)globalRef;
+		j9object_t object = *slot;
+		if ((NULL != object) && ((UDATA)object == VM_AtomicSupport::lockCompareExchange((UDATA *)slot, (UDATA)object, (UDATA)NULL))) {
+#if defined(J9VM_GC_REALTIME)
+			vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, object);
+#endif /* defined(J9VM_GC_REALTIME) */
+			if (!cacheGlobalRefSlot(vmThread, slot)) {
+#ifdef J9VM_THR_PREEMPTIVE
+				omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+				pool_removeElement(vm->jniGlobalReferences, slot);
+#ifdef J9VM_THR_PREEMPTIVE
+				omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+			}
+		}
+	} else if (globalRef != NULL) {
 
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_enter(vm->jniFrameMutex);
@@ -1749,6 +1940,15 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_notNull(object);
 
+	if (!isWeak && J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_JNI_GLOBAL_REF_CACHE)) {
+		result = takeCachedGlobalRefSlot(vmThread);
+		if (result != NULL) {
+			/* The slot holds NULL until this single store publishes the object to a concurrent collector */
+			*result = object;
+			return (jobject) result;
+		}
+	}
+
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
@@ -2432,7 +2632,8 @@ getObjectRefType(JNIEnv *env, jobject obj)
 
 	/* Check for global ref */
 
-	if (pool_includesElement(vm->jniGlobalReferences, obj)) {
+	/* A NULL slot is a deleted global ref cached for reuse */
+	if (pool_includesElement(vm->jniGlobalReferences, obj) && (NULL != *(j9object_t*)obj)) {
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
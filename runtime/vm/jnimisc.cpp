@@ -194,19 +194,10 @@ getCurrentClassLoader(J9VMThread *currentThread)
 static bool
 checkString(const char *data, UDATA *lengthPtr)
 {
-	UDATA length = 0;
-	const char *source = data;
-	U_8 check = 0;
-	for(;;) {
-		char c = *source++;
-		if ('\0' == c) {
-			break;
-		}
-		check |= (U_8)c;
-		length += 1;
-	}
+	UDATA length = strlen(data);
 	*lengthPtr = length;
-	return J9_ARE_ANY_BITS_SET(check, 0x80);
+	/* The data contains no NUL, so it is all ASCII if the ASCII prefix covers it */
+	return asciiPrefixLengthLatin1((const U_8*)data, length) != length;
 }
 
 /**
@@ -230,6 +221,15 @@ compressUTF8(J9VMThread *currentThread, U_8 *data, UDATA length, UDATA *compress
 	} else {
 		U_8 *writeCursor = compressedData;
 		while (0 != length) {
+			/* ASCII characters are already in their canonical form */
+			UDATA asciiLength = asciiPrefixLengthLatin1(data, length);
+			if (0 != asciiLength) {
+				memcpy(writeCursor, data, asciiLength);
+				data += asciiLength;
+				length -= asciiLength;
+				writeCursor += asciiLength;
+				continue;
+			}
 			U_16 unicode = 0;
 			UDATA consumed = VM_VMHelpers::decodeUTF8CharN(data, &unicode, length);
 			if (0 == consumed) {
@@ -285,6 +285,15 @@ encodeUnverifiedUTF8(const char *source, UDATA sourceLength, U_8 *target)
 {
 	U_8 *targetStart = target;
 	while (0 != sourceLength) {
+		/* ASCII characters are already in their canonical form */
+		UDATA asciiLength = asciiPrefixLengthLatin1((const U_8*)source, sourceLength);
+		if (0 != asciiLength) {
+			memcpy(target, source, asciiLength);
+			source += asciiLength;
+			sourceLength -= asciiLength;
+			target += asciiLength;
+			continue;
+		}
 		U_8 b = *source;
 		U_16 unicode = b;
 		source += 1;
@@ -743,8 +752,16 @@ getStringCharsImpl(JNIEnv *env, jstring string, jboolean *isCopy, jboolean ensur
 			j9object_t charArray = J9VMJAVALANGSTRING_VALUE(currentThread, stringObject);
 
 			if (IS_STRING_COMPRESSED(currentThread, stringObject)) {
-				for (UDATA i = 0; i < length; ++i) {
-					((jchar*)chars)[i] = (jchar)(U_8)J9JAVAARRAYOFBYTE_LOAD(currentThread, charArray, i);
+				U_8 *latin1 = NULL;
+				if (0 != length) {
+					latin1 = (U_8*)VM_VMHelpers::contiguousStringDataRange(currentThread, charArray, 0, length, 0);
+				}
+				if (NULL != latin1) {
+					widenLatin1ToUTF16(latin1, (U_16*)chars, length);
+				} else {
+					for (UDATA i = 0; i < length; ++i) {
+						((jchar*)chars)[i] = (jchar)(U_8)J9JAVAARRAYOFBYTE_LOAD(currentThread, charArray, i);
+					}
 				}
 			} else {
 				VM_ArrayCopyHelpers::memcpyFromArray(currentThread, charArray, (UDATA)1, 0, length, (void*)chars);
@@ -1066,8 +1083,16 @@ outOfBounds:
 		UDATA byteCount = ulen * sizeof(U_16);
 		JAVA_OFFLOAD_SWITCH_ON_WITH_REASON_IF_LIMIT_EXCEEDED(currentThread, J9_JNI_OFFLOAD_SWITCH_GET_STRING_REGION, byteCount);
 		if (IS_STRING_COMPRESSED(currentThread, stringObject)) {
-			for (jsize i = 0; i < len; ++i) {
-				buf[i] = (jchar)(U_8)J9JAVAARRAYOFBYTE_LOAD(currentThread, charArray, i + start);
+			U_8 *latin1 = NULL;
+			if (0 != ulen) {
+				latin1 = (U_8*)VM_VMHelpers::contiguousStringDataRange(currentThread, charArray, ustart, ulen, 0);
+			}
+			if (NULL != latin1) {
+				widenLatin1ToUTF16(latin1, (U_16*)buf, ulen);
+			} else {
+				for (jsize i = 0; i < len; ++i) {
+					buf[i] = (jchar)(U_8)J9JAVAARRAYOFBYTE_LOAD(currentThread, charArray, i + start);
+				}
 			}
 		} else {
 			/* No guarantee of native memory alignment, so copy byte-wise */
@@ -312,6 +312,8 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 #if defined(J9VM_GC_JNI_ARRAY_CACHE)
 	cleanupVMThreadJniArrayCache(vmThread);
 #endif
+	/* Holding the vmThreadListMutex keeps the GC from iterating the global refs without the jniFrameMutex */
+	cleanupVMThreadJNIGlobalRefCache(vmThread);
 
 	if (vmThread->jniReferenceFrames) {
 		pool_kill(vmThread->jniReferenceFrames);
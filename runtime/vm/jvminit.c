@@ -898,7 +898,9 @@ freeJavaVM(J9JavaVM * vm)
 	if (NULL != vm->continuationT2Cache) {
 		for (U_32 i = 0; i < vm->continuationT2Size; i++) {
 			if (NULL != vm->continuationT2Cache[i]) {
-				freeJavaStack(vm, vm->continuationT2Cache[i]->stackObject);
+				if (NULL != vm->continuationT2Cache[i]->stackObject) {
+					freeJavaStack(vm, vm->continuationT2Cache[i]->stackObject);
+				}
 				j9mem_free_memory(vm->continuationT2Cache[i]);
 			}
 		}
@@ -2118,10 +2120,12 @@ processMemoryInterleaveOptions(J9JavaVM * vm)
 #if JAVA_SPEC_VERSION >= 19
 /**
  * -XX:ContinuationCache:t1=<U_32>,t2=<U_32>
+ * -XX:ContinuationCache:maxStackKB=<U_32>
  *
  * This helper searches for and consumes the Continuation cache option,
  * if option found, it is parsed based on the above syntax.
  * if option not found, default values are set for T1 and T2 cache size.
+ * maxStackKB is the stack size above which cached continuations release their stack.
  *
  * Returns 0 on success, -1 if option parsing failed.
  */
@@ -2146,6 +2150,9 @@ processContinuationCacheOptions(J9JavaVM *vm)
 					vm->continuationT2Size = cacheSize;
 					rc = 0;
 				}
+			} else if (try_scan(&cursor, "maxStackKB=") && (0 == omr_scan_u32(&cursor, &cacheSize))) {
+				vm->continuationCacheMaxStackSize = (UDATA)cacheSize * 1024;
+				rc = 0;
 			} else if (try_scan(&cursor, "printSummary")) {
 				/* Set VM flag. */
 				vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_ENABLE_CONTINUATION_CACHE_SUMMARY;
@@ -2168,6 +2175,9 @@ processContinuationCacheOptions(J9JavaVM *vm)
 		vm->continuationT2Size = (U_32)(j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET) * 2);
 		rc = 0;
 	}
+	if (0 == vm->continuationCacheMaxStackSize) {
+		vm->continuationCacheMaxStackSize = J9_CONTINUATION_CACHE_MAX_STACK_SIZE;
+	}
 
 	return rc;
 }
@@ -2832,8 +2842,15 @@ VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved)
 			initializeVMLocalStorage(vm);
 #endif
 
-			if (NULL == (vm->jniGlobalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary)))) {
-				goto _error;
+			{
+				/* The JNI global ref cache checks pool membership without the mutex, which requires puddles to never be freed */
+				UDATA poolFlags = POOL_NO_ZERO;
+				if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_JNI_GLOBAL_REF_CACHE)) {
+					poolFlags |= POOL_NEVER_FREE_PUDDLES;
+				}
+				if (NULL == (vm->jniGlobalReferences = pool_new(sizeof(UDATA), 0, 0, poolFlags, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary)))) {
+					goto _error;
+				}
 			}
 
 			if (0 != initializeNativeMethodBindTable(vm)) {
@@ -4524,6 +4541,40 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA enableMapZipFiles = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXENABLEMAPZIPFILES, NULL);
+		IDATA disableMapZipFiles = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXDISABLEMAPZIPFILES, NULL);
+		if (enableMapZipFiles > disableMapZipFiles) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_MAP_ZIP_FILES;
+		} else if (enableMapZipFiles < disableMapZipFiles) {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_MAP_ZIP_FILES;
+		}
+	}
+
+	{
+		/* Per-thread caching of JNI global ref slots is enabled by default */
+		IDATA enableJNIGlobalRefCache = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXENABLEJNIGLOBALREFCACHE, NULL);
+		IDATA disableJNIGlobalRefCache = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXDISABLEJNIGLOBALREFCACHE, NULL);
+		if (enableJNIGlobalRefCache >= disableJNIGlobalRefCache) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_JNI_GLOBAL_REF_CACHE;
+		} else {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_JNI_GLOBAL_REF_CACHE;
+		}
+	}
+
+#if JAVA_SPEC_VERSION >= 19
+	{
+		/* Shrinking the stacks of unmounted continuations is disabled by default */
+		IDATA enableCompactStacks = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXCOMPACTCONTINUATIONSTACKS, NULL);
+		IDATA disableCompactStacks = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOCOMPACTCONTINUATIONSTACKS, NULL);
+		if (enableCompactStacks > disableCompactStacks) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_COMPACT_CONTINUATION_STACKS;
+		} else {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_COMPACT_CONTINUATION_STACKS;
+		}
+	}
+#endif /* JAVA_SPEC_VERSION >= 19 */
+
 	/* -Xbootclasspath and -Xbootclasspath/p are not supported from Java 9 onwards */
 	if (J2SE_VERSION(vm) >= J2SE_V11) {
 		PORT_ACCESS_FROM_JAVAVM(vm);
@@ -7174,6 +7225,9 @@ runExitStages(J9JavaVM* vm, J9VMThread* vmThread)
 		j9tty_printf(PORTLIB, "\n     T2 Cache store:            %u", vm->t2store);
 		j9tty_printf(PORTLIB, "\nCache Freed:                %u\n", vm->cacheFree);
 		j9tty_printf(PORTLIB, "\nAvg Cache Stack Size:       %.2f KB\n", (double)vm->totalContinuationStackSize / (vm->t1CacheHit + vm->t2CacheHit + vm->cacheMiss) / 1024);
+		j9tty_printf(PORTLIB, "\nLarge Stacks Released:      %u (above %zu KB)", vm->continuationStacksReleased, vm->continuationCacheMaxStackSize / 1024);
+		j9tty_printf(PORTLIB, "\nStack Compactions:          %u", vm->continuationStackCompactions);
+		j9tty_printf(PORTLIB, "\n     Stack Released:            %.2f KB\n", (double)vm->continuationStackBytesCompacted / 1024);
 	}
 #endif /* JAVA_SPEC_VERSION >= 19 */
 
@@ -8001,6 +8055,11 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 		if (NULL == vm->zipCachePool) {
 			goto error;
 		}
+		/* Zip files are read through a read-only mapping only on request, as truncating a mapped file raises SIGBUS.
+		 * This covers the jars the VM opens through the pool, i.e. the bootstrap classpath including -Xbootclasspath/a.
+		 * Application classpath jars are read by java.util.zip and are not affected.
+		 */
+		zipCachePool_setMapZipFiles(vm->zipCachePool, J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_MAP_ZIP_FILES));
 	}
 #endif
 
@@ -46,11 +46,17 @@ static UDATA hits, misses;
 #endif
 
 #define J9_OBJECT_MONITOR_LOOKUP_SLOT(object,vm) ( (((UDATA)object) >> vm->omrVM->_objectAlignmentShift) & (J9VMTHREAD_OBJECT_MONITOR_CACHE_SIZE-1))
+#define J9_OBJECT_MONITOR_SHARED_LOOKUP_SLOT(object,vm) ( (((UDATA)object) >> vm->omrVM->_objectAlignmentShift) & (vm->monitorLookupCacheSize-1))
+
+/* Number of slots in the lookup cache shared by all threads, per monitor table */
+#define J9_MONITOR_LOOKUP_CACHE_SLOTS_PER_TABLE 256
 
 static UDATA hashMonitorCompare (void *leftKey, void *rightKey, void *userData);
 static UDATA hashMonitorDestroyDo (void *entry, void *opaque);
 static UDATA hashMonitorHash (void *key, void *userData);
 static J9HashTable* createMonitorTable(J9JavaVM *vm, char *tableName);
+static J9ObjectMonitor* sharedMonitorLookupCacheAt(J9JavaVM *vm, j9object_t object);
+static void cacheObjectMonitorForSharedLookup(J9JavaVM *vm, j9object_t object, J9ObjectMonitor *objectMonitor);
 
 
 static UDATA
@@ -101,6 +107,50 @@ cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor*
 	vmStruct->objectMonitorLookupCache[J9_OBJECT_MONITOR_LOOKUP_SLOT(object,vm)] = (j9objectmonitor_t) ((UDATA) objectMonitor);
 }
 
+/**
+ * Probes the lookup cache shared by all threads. This takes no locks.
+ *
+ * Entries of the shared cache are published and read by threads holding VM access, and the GC
+ * flushes the cache (along with the per-thread caches) before it destroys the monitors of dead
+ * objects while it holds exclusive VM access. Exclusive VM access therefore acts as the epoch
+ * boundary: a monitor read from the cache cannot be reclaimed until the reader releases VM access.
+ *
+ * @param vm		the vm
+ * @param object	the object to find the monitor for
+ *
+ * @return the monitor for the object, or NULL if it is not in the cache
+ */
+static J9ObjectMonitor*
+sharedMonitorLookupCacheAt(J9JavaVM *vm, j9object_t object)
+{
+	J9ObjectMonitor *objectMonitor = (J9ObjectMonitor *) ((UDATA) vm->monitorLookupCache[J9_OBJECT_MONITOR_SHARED_LOOKUP_SLOT(object, vm)]);
+
+	/* See monitorTableAt for why the weak read barrier is needed on userData */
+	if ((NULL != objectMonitor) && (J9WEAKROOT_OBJECT_LOAD_VM(vm, &((J9ThreadAbstractMonitor*)objectMonitor->monitor)->userData) != object)) {
+		objectMonitor = NULL;
+	}
+
+#if defined(OMR_THR_JLM)
+	if (J9_ARE_ANY_BITS_SET(omrthread_lib_get_flags(), J9THREAD_LIB_FLAG_JLM_ENABLED)) {
+		if (NULL != objectMonitor) {
+			addAtomic(&vm->monitorLookupCacheHits, 1);
+		} else {
+			addAtomic(&vm->monitorLookupCacheMisses, 1);
+		}
+	}
+#endif /* defined(OMR_THR_JLM) */
+
+	return objectMonitor;
+}
+
+static void
+cacheObjectMonitorForSharedLookup(J9JavaVM *vm, j9object_t object, J9ObjectMonitor *objectMonitor)
+{
+	/* The monitor was initialized under a monitor table mutex; make it visible before the cache entry */
+	issueWriteBarrier();
+	vm->monitorLookupCache[J9_OBJECT_MONITOR_SHARED_LOOKUP_SLOT(object, vm)] = (j9objectmonitor_t) ((UDATA) objectMonitor);
+}
+
 
 
 /**
@@ -154,6 +204,25 @@ initializeMonitorTable(J9JavaVM* vm)
 	}
 	memset(vm->monitorTables, 0, sizeof(J9HashTable *) * tableCount);
 
+	/* Each table is guarded by its own mutex so that threads inflating unrelated monitors do not serialize */
+	vm->monitorTableMutexes = (omrthread_monitor_t *)j9mem_allocate_memory(sizeof(omrthread_monitor_t) * tableCount, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableMutexes) {
+		return -1;
+	}
+	memset(vm->monitorTableMutexes, 0, sizeof(omrthread_monitor_t) * tableCount);
+
+	vm->monitorLookupCacheSize = 1;
+	while (vm->monitorLookupCacheSize < (tableCount * J9_MONITOR_LOOKUP_CACHE_SLOTS_PER_TABLE)) {
+		vm->monitorLookupCacheSize <<= 1;
+	}
+	vm->monitorLookupCache = (j9objectmonitor_t *)j9mem_allocate_memory(sizeof(j9objectmonitor_t) * vm->monitorLookupCacheSize, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorLookupCache) {
+		return -1;
+	}
+	memset(vm->monitorLookupCache, 0, sizeof(j9objectmonitor_t) * vm->monitorLookupCacheSize);
+	vm->monitorLookupCacheHits = 0;
+	vm->monitorLookupCacheMisses = 0;
+
 	vm->monitorTableList = NULL;
 
 	for (tableIndex = 0; tableIndex < tableCount; tableIndex++) {
@@ -161,6 +230,10 @@ initializeMonitorTable(J9JavaVM* vm)
 		if (NULL == table) {
 			return -1;
 		}
+		if (omrthread_monitor_init_with_name(&vm->monitorTableMutexes[tableIndex], 0, "VM monitor table shard")) {
+			hashTableFree(table);
+			return -1;
+		}
 		monitorTableListEntry = pool_newElement(vm->monitorTableListPool);
 		if (NULL == monitorTableListEntry) {
 			return -1;
@@ -203,6 +276,26 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTables = NULL;
 	}
 
+	if (NULL != vm->monitorTableMutexes) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		UDATA tableIndex = 0;
+		for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+			if (NULL != vm->monitorTableMutexes[tableIndex]) {
+				omrthread_monitor_destroy(vm->monitorTableMutexes[tableIndex]);
+				vm->monitorTableMutexes[tableIndex] = NULL;
+			}
+		}
+
+		j9mem_free_memory(vm->monitorTableMutexes);
+		vm->monitorTableMutexes = NULL;
+	}
+
+	if (NULL != vm->monitorLookupCache) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		j9mem_free_memory(vm->monitorLookupCache);
+		vm->monitorLookupCache = NULL;
+	}
+
 
 	/* free the monitorTableListPool */
 	if (NULL != vm->monitorTableListPool) {
@@ -231,7 +324,7 @@ J9ObjectMonitor *
 monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 {
 	J9JavaVM* vm = vmStruct->javaVM;
-	omrthread_monitor_t mutex = vm->monitorTableMutex;
+	omrthread_monitor_t mutex = NULL;
 	J9ObjectMonitor * objectMonitor = NULL;
 	J9ObjectMonitor key_objectMonitor;
 	J9ThreadAbstractMonitor key_monitor;
@@ -272,6 +365,15 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 		MISS();
 	}
 
+	/* Try the cache shared by all threads before hashing the object and locking its table */
+	objectMonitor = sharedMonitorLookupCacheAt(vm, object);
+	if (NULL != objectMonitor) {
+		TRACE("Shared cache hit");
+		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+		Trc_VM_monitorTableAt_CacheHit_Exit(vmStruct, objectMonitor);
+		return objectMonitor;
+	}
+
 	/* Create a "fake" monitor just to probe the hash-table */
 	key_monitor.userData = (UDATA) object;
 	key_objectMonitor.monitor = (omrthread_monitor_t) &key_monitor;
@@ -285,7 +387,7 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 #endif /* defined(J9VM_OPT_VALHALLA_VALUE_TYPES) */
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
-
+	mutex = vm->monitorTableMutexes[index];
 
 	omrthread_monitor_enter(mutex);
 
@@ -360,6 +462,7 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 
 	if (NULL != objectMonitor) {
 		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+		cacheObjectMonitorForSharedLookup(vm, object, objectMonitor);
 	}
 
 	omrthread_monitor_exit(mutex);
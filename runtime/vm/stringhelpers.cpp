@@ -46,6 +46,16 @@ compareUncompressedUnicode(J9VMThread *vmThread, j9object_t unicodeBytes1, j9obj
 	UDATA result = 1;
 	if (unicodeBytes1 != unicodeBytes2) {
 		UDATA i = 0;
+		if (0 != length) {
+			U_16 *data1 = (U_16 *)VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes1, 0, length, 1);
+			U_16 *data2 = (U_16 *)VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes2, 0, length, 1);
+			if ((NULL != data1) && (NULL != data2)) {
+				if (0 != memcmp(data1, data2, length * sizeof(U_16))) {
+					result = 0;
+				}
+				length = 0;
+			}
+		}
 		while (0 != length) {
 			U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
 			U_16 unicodeChar2 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes2, i);
@@ -74,6 +84,16 @@ compareCompressedUnicode(J9VMThread *vmThread, j9object_t unicodeBytes1, j9objec
 	UDATA result = 1;
 	if (unicodeBytes1 != unicodeBytes2) {
 		UDATA i = 0;
+		if (0 != length) {
+			U_8 *data1 = (U_8 *)VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes1, 0, length, 0);
+			U_8 *data2 = (U_8 *)VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes2, 0, length, 0);
+			if ((NULL != data1) && (NULL != data2)) {
+				if (0 != memcmp(data1, data2, length)) {
+					result = 0;
+				}
+				length = 0;
+			}
+		}
 		while (0 != length) {
 			U_16 unicodeChar1 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
 			U_16 unicodeChar2 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
@@ -101,6 +121,16 @@ compareCompressedUnicodeToUncompressedUnicode(J9VMThread *vmThread, j9object_t u
 {
 	UDATA result = 1;
 	UDATA i = 0;
+	if (0 != length) {
+		U_16 *data1 = (U_16 *)VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes1, 0, length, 1);
+		U_8 *data2 = (U_8 *)VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes2, 0, length, 0);
+		if ((NULL != data1) && (NULL != data2)) {
+			if (!equalsLatin1UTF16(data2, data1, length)) {
+				result = 0;
+			}
+			length = 0;
+		}
+	}
 	while (0 != length) {
 		U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
 		U_16 unicodeChar2 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
@@ -174,8 +204,30 @@ compareStringToUTF8(J9VMThread *vmThread, j9object_t string, UDATA translateDots
 	UDATA stringLength = J9VMJAVALANGSTRING_LENGTH(vmThread, string);
 	UDATA tmpStringLength = stringLength;
 	j9object_t unicodeBytes = J9VMJAVALANGSTRING_VALUE(vmThread, string);
+	bool isCompressed = IS_STRING_COMPRESSED(vmThread, string);
+
+	/* Compare the leading ASCII characters of the UTF8 data in bulk, they each encode one character */
+	if (!translateDots && (0 != tmpUtfLength) && (0 != tmpStringLength)) {
+		UDATA asciiLength = asciiPrefixLengthLatin1(tmpUtfData, OMR_MIN(tmpUtfLength, tmpStringLength));
+		if (0 != asciiLength) {
+			void *stringData = VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes, 0, asciiLength, isCompressed ? 0 : 1);
+			if (NULL != stringData) {
+				if (isCompressed) {
+					if (0 != memcmp(stringData, tmpUtfData, asciiLength)) {
+						return 0;
+					}
+				} else if (!equalsLatin1UTF16(tmpUtfData, (U_16 *)stringData, asciiLength)) {
+					return 0;
+				}
+				tmpStringLength -= asciiLength;
+				tmpUtfData += asciiLength;
+				tmpUtfLength -= asciiLength;
+				i = asciiLength;
+			}
+		}
+	}
 
-	if (IS_STRING_COMPRESSED(vmThread, string)) {
+	if (isCompressed) {
 		while ((tmpUtfLength != 0) && (tmpStringLength != 0)) {
 			U_16 unicodeChar = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i);
 			U_16 utfChar = 0;
@@ -216,6 +268,74 @@ compareStringToUTF8(J9VMThread *vmThread, j9object_t string, UDATA translateDots
 	return ((tmpUtfLength == 0) && (tmpStringLength == 0));
 }
 
+/**
+ * Encode contiguous Latin-1 characters as UTF8, copying runs of ASCII characters in bulk.
+ * Stops before the first character that does not fit.
+ * @param latin1 the characters
+ * @param length the number of characters
+ * @param data the UTF8 buffer
+ * @param capacity the number of bytes available in data
+ * @returns the end of the UTF8 data written
+ */
+static U_8 *
+copyLatin1ToUTF8(const U_8 *latin1, UDATA length, U_8 *data, UDATA capacity)
+{
+	UDATA i = 0;
+	while (i < length) {
+		UDATA asciiLength = asciiPrefixLengthLatin1(latin1 + i, OMR_MIN(length - i, capacity));
+		memcpy(data, latin1 + i, asciiLength);
+		data += asciiLength;
+		capacity -= asciiLength;
+		i += asciiLength;
+		if (i < length) {
+			I_8 unicode = (I_8)latin1[i];
+			UDATA encodedLength = VM_VMHelpers::encodedUTF8LengthI8(unicode);
+			if (encodedLength > capacity) {
+				break;
+			}
+			VM_VMHelpers::encodeUTF8CharI8(unicode, data);
+			data += encodedLength;
+			capacity -= encodedLength;
+			i += 1;
+		}
+	}
+	return data;
+}
+
+/**
+ * Encode contiguous UTF-16 characters as UTF8, copying runs of ASCII characters in bulk.
+ * Stops before the first character that does not fit.
+ * @param chars the characters
+ * @param length the number of characters
+ * @param data the UTF8 buffer
+ * @param capacity the number of bytes available in data
+ * @returns the end of the UTF8 data written
+ */
+static U_8 *
+copyUTF16ToUTF8(const U_16 *chars, UDATA length, U_8 *data, UDATA capacity)
+{
+	UDATA i = 0;
+	while (i < length) {
+		UDATA asciiLength = asciiPrefixLengthUTF16(chars + i, OMR_MIN(length - i, capacity));
+		narrowASCIIUTF16(chars + i, data, asciiLength);
+		data += asciiLength;
+		capacity -= asciiLength;
+		i += asciiLength;
+		if (i < length) {
+			U_16 unicode = chars[i];
+			UDATA encodedLength = VM_VMHelpers::encodedUTF8Length(unicode);
+			if (encodedLength > capacity) {
+				break;
+			}
+			VM_VMHelpers::encodeUTF8Char(unicode, data);
+			data += encodedLength;
+			capacity -= encodedLength;
+			i += 1;
+		}
+	}
+	return data;
+}
+
 UDATA
 copyStringToUTF8Helper(J9VMThread *vmThread, j9object_t string, UDATA stringFlags, UDATA stringOffset, UDATA stringLength, U_8 *utf8Data, UDATA utf8DataLength)
 {
@@ -223,8 +343,19 @@ copyStringToUTF8Helper(J9VMThread *vmThread, j9object_t string, UDATA stringFlag
 
 	j9object_t stringValue = J9VMJAVALANGSTRING_VALUE(vmThread, string);
 	U_8 *data = utf8Data;
+	void *contiguousData = NULL;
+
+	if (((stringFlags & J9_STR_XLAT) == 0) && (0 != stringLength)) {
+		contiguousData = VM_VMHelpers::contiguousStringDataRange(vmThread, stringValue, stringOffset, stringLength, IS_STRING_COMPRESSED(vmThread, string) ? 0 : 1);
+	}
 
-	if (IS_STRING_COMPRESSED(vmThread, string)) {
+	if (NULL != contiguousData) {
+		if (IS_STRING_COMPRESSED(vmThread, string)) {
+			data = copyLatin1ToUTF8((U_8 *)contiguousData, stringLength, data, utf8DataLength);
+		} else {
+			data = copyUTF16ToUTF8((U_16 *)contiguousData, stringLength, data, utf8DataLength);
+		}
+	} else if (IS_STRING_COMPRESSED(vmThread, string)) {
 		/* Manually version J9_STR_XLAT flag checking from the loop for performance as the compiler does not do it */
 		if ((stringFlags & J9_STR_XLAT) == 0) {
 			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
@@ -577,8 +708,29 @@ getStringUTF8Length(J9VMThread *vmThread, j9object_t string)
 	U_64 utf8Length = 0;
 	UDATA unicodeLength = J9VMJAVALANGSTRING_LENGTH(vmThread, string);
 	j9object_t unicodeBytes = J9VMJAVALANGSTRING_VALUE(vmThread, string);
+	bool isCompressed = IS_STRING_COMPRESSED(vmThread, string);
 
-	if (IS_STRING_COMPRESSED(vmThread, string)) {
+	if (0 != unicodeLength) {
+		void *contiguousData = VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes, 0, unicodeLength, isCompressed ? 0 : 1);
+		if (NULL != contiguousData) {
+			if (isCompressed) {
+				utf8Length = utf8LengthLatin1((U_8 *)contiguousData, unicodeLength);
+			} else {
+				utf8Length = utf8LengthUTF16((U_16 *)contiguousData, unicodeLength);
+			}
+#if UDATA_MAX < (3 * INT32_MAX)
+			/* Too long, compute the truncated length below */
+			if (utf8Length > UDATA_MAX) {
+				utf8Length = 0;
+			} else
+#endif /* UDATA_MAX < (3 * INT32_MAX) */
+			{
+				return (UDATA)utf8Length;
+			}
+		}
+	}
+
+	if (isCompressed) {
 		for (UDATA i = 0; i < unicodeLength; i++) {
 			UDATA nextLength = VM_VMHelpers::encodedUTF8LengthI8(J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i));
 #if UDATA_MAX < (3 * INT32_MAX)
@@ -617,8 +769,25 @@ getStringUTF8LengthTruncated(J9VMThread *vmThread, j9object_t string, U_64 maxLe
 	U_64 utf8Length = 0;
 	UDATA unicodeLength = J9VMJAVALANGSTRING_LENGTH(vmThread, string);
 	j9object_t unicodeBytes = J9VMJAVALANGSTRING_VALUE(vmThread, string);
+	bool isCompressed = IS_STRING_COMPRESSED(vmThread, string);
+
+	if (0 != unicodeLength) {
+		void *contiguousData = VM_VMHelpers::contiguousStringDataRange(vmThread, unicodeBytes, 0, unicodeLength, isCompressed ? 0 : 1);
+		if (NULL != contiguousData) {
+			if (isCompressed) {
+				utf8Length = utf8LengthLatin1((U_8 *)contiguousData, unicodeLength);
+			} else {
+				utf8Length = utf8LengthUTF16((U_16 *)contiguousData, unicodeLength);
+			}
+			if (utf8Length <= maxLength) {
+				return utf8Length;
+			}
+			/* Too long, compute the truncated length below */
+			utf8Length = 0;
+		}
+	}
 
-	if (IS_STRING_COMPRESSED(vmThread, string)) {
+	if (isCompressed) {
 		for (UDATA i = 0; i < unicodeLength; i++) {
 			UDATA nextLength = VM_VMHelpers::encodedUTF8LengthI8(J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i));
 			if (utf8Length > (maxLength - nextLength)) {
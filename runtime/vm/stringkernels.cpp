@@ -0,0 +1,603 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Kernels for converting and comparing string data in bulk.
+ *
+ * "ASCII" below means the characters 0x01 to 0x7F, which are the characters encoded
+ * as a single byte in modified UTF-8; 0 is encoded as two bytes. Each kernel has a
+ * portable implementation, and vector implementations for SSE2 and AVX2 on x86 and
+ * for ASIMD on AArch64. The implementation is picked on the first call.
+ */
+
+#include <string.h>
+
+#include "j9.h"
+#include "vm_internal.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#include <immintrin.h>
+#define J9STRING_SSE2
+#define J9STRING_AVX2
+#define J9STRING_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <emmintrin.h>
+#define J9STRING_SSE2
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <arm_neon.h>
+#define J9STRING_ASIMD
+#endif
+
+extern "C" {
+
+typedef struct J9StringKernels {
+	UDATA (*asciiPrefixLengthLatin1)(const U_8 *data, UDATA length);
+	UDATA (*asciiPrefixLengthUTF16)(const U_16 *data, UDATA length);
+	void (*narrowASCIIUTF16)(const U_16 *source, U_8 *target, UDATA length);
+	void (*widenLatin1ToUTF16)(const U_8 *source, U_16 *target, UDATA length);
+	U_64 (*utf8LengthLatin1)(const U_8 *data, UDATA length);
+	U_64 (*utf8LengthUTF16)(const U_16 *data, UDATA length);
+	BOOLEAN (*equalsLatin1UTF16)(const U_8 *latin1, const U_16 *utf16, UDATA length);
+} J9StringKernels;
+
+static const J9StringKernels *selectStringKernels(void);
+
+static const J9StringKernels *stringKernels = NULL;
+
+static VMINLINE const J9StringKernels *
+getStringKernels(void)
+{
+	const J9StringKernels *kernels = stringKernels;
+	if (NULL == kernels) {
+		kernels = selectStringKernels();
+	}
+	return kernels;
+}
+
+static VMINLINE bool
+isASCII(U_16 unicode)
+{
+	return (unicode >= 0x01) && (unicode <= 0x7F);
+}
+
+/* ---------------- portable ---------------- */
+
+static UDATA
+asciiPrefixLengthLatin1Portable(const U_8 *data, UDATA length)
+{
+	UDATA i = 0;
+	while ((i < length) && isASCII(data[i])) {
+		i += 1;
+	}
+	return i;
+}
+
+static UDATA
+asciiPrefixLengthUTF16Portable(const U_16 *data, UDATA length)
+{
+	UDATA i = 0;
+	while ((i < length) && isASCII(data[i])) {
+		i += 1;
+	}
+	return i;
+}
+
+static void
+narrowASCIIUTF16Portable(const U_16 *source, U_8 *target, UDATA length)
+{
+	for (UDATA i = 0; i < length; i++) {
+		target[i] = (U_8)source[i];
+	}
+}
+
+static void
+widenLatin1ToUTF16Portable(const U_8 *source, U_16 *target, UDATA length)
+{
+	for (UDATA i = 0; i < length; i++) {
+		target[i] = (U_16)source[i];
+	}
+}
+
+static U_64
+utf8LengthLatin1Portable(const U_8 *data, UDATA length)
+{
+	U_64 utf8Length = length;
+	for (UDATA i = 0; i < length; i++) {
+		if (!isASCII(data[i])) {
+			utf8Length += 1;
+		}
+	}
+	return utf8Length;
+}
+
+static U_64
+utf8LengthUTF16Portable(const U_16 *data, UDATA length)
+{
+	U_64 utf8Length = length;
+	for (UDATA i = 0; i < length; i++) {
+		U_16 unicode = data[i];
+		if (!isASCII(unicode)) {
+			utf8Length += (unicode >= 0x800) ? 2 : 1;
+		}
+	}
+	return utf8Length;
+}
+
+static BOOLEAN
+equalsLatin1UTF16Portable(const U_8 *latin1, const U_16 *utf16, UDATA length)
+{
+	for (UDATA i = 0; i < length; i++) {
+		if ((U_16)latin1[i] != utf16[i]) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+static const J9StringKernels portableStringKernels = {
+	asciiPrefixLengthLatin1Portable,
+	asciiPrefixLengthUTF16Portable,
+	narrowASCIIUTF16Portable,
+	widenLatin1ToUTF16Portable,
+	utf8LengthLatin1Portable,
+	utf8LengthUTF16Portable,
+	equalsLatin1UTF16Portable,
+};
+
+#if defined(J9STRING_SSE2) || defined(J9STRING_AVX2)
+static VMINLINE UDATA
+lowestSetBit(U_32 mask)
+{
+#if defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanForward(&index, mask);
+	return (UDATA)index;
+#else /* defined(_MSC_VER) */
+	return (UDATA)__builtin_ctz(mask);
+#endif /* defined(_MSC_VER) */
+}
+
+static VMINLINE UDATA
+countSetBits(U_32 mask)
+{
+	mask = mask - ((mask >> 1) & 0x55555555);
+	mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+	mask = (mask + (mask >> 4)) & 0x0F0F0F0F;
+	return (UDATA)((mask * 0x01010101) >> 24);
+}
+#endif /* defined(J9STRING_SSE2) || defined(J9STRING_AVX2) */
+
+#if defined(J9STRING_SSE2)
+/* ---------------- SSE2 ---------------- */
+
+/* Mark each byte that is not ASCII, i.e. 0 or >= 0x80, in the top bit */
+static VMINLINE __m128i
+nonASCIIBytesSSE2(__m128i bytes)
+{
+	return _mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, _mm_setzero_si128()));
+}
+
+/* Mark each 16-bit character that is not ASCII in the top bit of its high byte */
+static VMINLINE __m128i
+nonASCIICharsSSE2(__m128i chars)
+{
+	/* Adding 0x7F80 with unsigned saturation sets the top bit for every character >= 0x80 */
+	__m128i high = _mm_adds_epu16(chars, _mm_set1_epi16(0x7F80));
+	return _mm_or_si128(high, _mm_cmpeq_epi16(chars, _mm_setzero_si128()));
+}
+
+static UDATA
+asciiPrefixLengthLatin1SSE2(const U_8 *data, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		U_32 mask = (U_32)_mm_movemask_epi8(nonASCIIBytesSSE2(_mm_loadu_si128((const __m128i *)(data + i))));
+		if (0 != mask) {
+			return i + lowestSetBit(mask);
+		}
+	}
+	return i + asciiPrefixLengthLatin1Portable(data + i, length - i);
+}
+
+static UDATA
+asciiPrefixLengthUTF16SSE2(const U_16 *data, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 8) <= length; i += 8) {
+		U_32 mask = (U_32)_mm_movemask_epi8(nonASCIICharsSSE2(_mm_loadu_si128((const __m128i *)(data + i)))) & 0xAAAA;
+		if (0 != mask) {
+			return i + (lowestSetBit(mask) >> 1);
+		}
+	}
+	return i + asciiPrefixLengthUTF16Portable(data + i, length - i);
+}
+
+static void
+narrowASCIIUTF16SSE2(const U_16 *source, U_8 *target, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		__m128i low = _mm_loadu_si128((const __m128i *)(source + i));
+		__m128i high = _mm_loadu_si128((const __m128i *)(source + i + 8));
+		_mm_storeu_si128((__m128i *)(target + i), _mm_packus_epi16(low, high));
+	}
+	narrowASCIIUTF16Portable(source + i, target + i, length - i);
+}
+
+static void
+widenLatin1ToUTF16SSE2(const U_8 *source, U_16 *target, UDATA length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(source + i));
+		_mm_storeu_si128((__m128i *)(target + i), _mm_unpacklo_epi8(bytes, zero));
+		_mm_storeu_si128((__m128i *)(target + i + 8), _mm_unpackhi_epi8(bytes, zero));
+	}
+	widenLatin1ToUTF16Portable(source + i, target + i, length - i);
+}
+
+static U_64
+utf8LengthLatin1SSE2(const U_8 *data, UDATA length)
+{
+	U_64 utf8Length = length;
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		U_32 mask = (U_32)_mm_movemask_epi8(nonASCIIBytesSSE2(_mm_loadu_si128((const __m128i *)(data + i))));
+		utf8Length += countSetBits(mask);
+	}
+	return utf8Length + utf8LengthLatin1Portable(data + i, length - i) - (length - i);
+}
+
+static U_64
+utf8LengthUTF16SSE2(const U_16 *data, UDATA length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i above7F = _mm_set1_epi16((short)0xFF80);
+	const __m128i above7FF = _mm_set1_epi16((short)0xF800);
+	const __m128i ones = _mm_set1_epi16(1);
+	U_64 utf8Length = 0;
+	UDATA i = 0;
+	while ((i + 8) <= length) {
+		/* Each block adds at most 2 to a 16-bit lane, flush the lanes before they can overflow */
+		UDATA blockEnd = OMR_MIN(length & ~(UDATA)7, i + (8 * 4096));
+		__m128i sum = zero;
+		UDATA blockLength = blockEnd - i;
+		for (; i < blockEnd; i += 8) {
+			__m128i chars = _mm_loadu_si128((const __m128i *)(data + i));
+			/* Lanes are -1 where the condition holds; a character needs 3 + (below 0x80) + (below 0x800) - (is 0) bytes */
+			__m128i isZero = _mm_cmpeq_epi16(chars, zero);
+			__m128i below80 = _mm_cmpeq_epi16(_mm_and_si128(chars, above7F), zero);
+			__m128i below800 = _mm_cmpeq_epi16(_mm_and_si128(chars, above7FF), zero);
+			sum = _mm_add_epi16(sum, _mm_sub_epi16(_mm_add_epi16(below80, below800), isZero));
+		}
+		__m128i sum32 = _mm_madd_epi16(sum, ones);
+		sum32 = _mm_add_epi32(sum32, _mm_shuffle_epi32(sum32, _MM_SHUFFLE(1, 0, 3, 2)));
+		sum32 = _mm_add_epi32(sum32, _mm_shuffle_epi32(sum32, _MM_SHUFFLE(2, 3, 0, 1)));
+		utf8Length += (U_64)((I_64)(3 * blockLength) + (I_64)(I_32)_mm_cvtsi128_si32(sum32));
+	}
+	return utf8Length + utf8LengthUTF16Portable(data + i, length - i);
+}
+
+static BOOLEAN
+equalsLatin1UTF16SSE2(const U_8 *latin1, const U_16 *utf16, UDATA length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(latin1 + i));
+		__m128i low = _mm_cmpeq_epi16(_mm_unpacklo_epi8(bytes, zero), _mm_loadu_si128((const __m128i *)(utf16 + i)));
+		__m128i high = _mm_cmpeq_epi16(_mm_unpackhi_epi8(bytes, zero), _mm_loadu_si128((const __m128i *)(utf16 + i + 8)));
+		if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(low, high))) {
+			return FALSE;
+		}
+	}
+	return equalsLatin1UTF16Portable(latin1 + i, utf16 + i, length - i);
+}
+
+static const J9StringKernels sse2StringKernels = {
+	asciiPrefixLengthLatin1SSE2,
+	asciiPrefixLengthUTF16SSE2,
+	narrowASCIIUTF16SSE2,
+	widenLatin1ToUTF16SSE2,
+	utf8LengthLatin1SSE2,
+	utf8LengthUTF16SSE2,
+	equalsLatin1UTF16SSE2,
+};
+#endif /* defined(J9STRING_SSE2) */
+
+#if defined(J9STRING_AVX2)
+/* ---------------- AVX2 ---------------- */
+
+static J9STRING_AVX2_TARGET UDATA
+asciiPrefixLengthLatin1AVX2(const U_8 *data, UDATA length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	UDATA i = 0;
+	for (; (i + 32) <= length; i += 32) {
+		__m256i bytes = _mm256_loadu_si256((const __m256i *)(data + i));
+		U_32 mask = (U_32)_mm256_movemask_epi8(_mm256_or_si256(bytes, _mm256_cmpeq_epi8(bytes, zero)));
+		if (0 != mask) {
+			return i + lowestSetBit(mask);
+		}
+	}
+	return i + asciiPrefixLengthLatin1SSE2(data + i, length - i);
+}
+
+static J9STRING_AVX2_TARGET UDATA
+asciiPrefixLengthUTF16AVX2(const U_16 *data, UDATA length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i bias = _mm256_set1_epi16(0x7F80);
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		__m256i chars = _mm256_loadu_si256((const __m256i *)(data + i));
+		__m256i nonASCII = _mm256_or_si256(_mm256_adds_epu16(chars, bias), _mm256_cmpeq_epi16(chars, zero));
+		U_32 mask = (U_32)_mm256_movemask_epi8(nonASCII) & 0xAAAAAAAA;
+		if (0 != mask) {
+			return i + (lowestSetBit(mask) >> 1);
+		}
+	}
+	return i + asciiPrefixLengthUTF16SSE2(data + i, length - i);
+}
+
+static J9STRING_AVX2_TARGET void
+narrowASCIIUTF16AVX2(const U_16 *source, U_8 *target, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 32) <= length; i += 32) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)(source + i));
+		__m256i high = _mm256_loadu_si256((const __m256i *)(source + i + 16));
+		/* packus works within 128-bit lanes, put the quadwords back in order */
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256((__m256i *)(target + i), packed);
+	}
+	narrowASCIIUTF16SSE2(source + i, target + i, length - i);
+}
+
+static J9STRING_AVX2_TARGET void
+widenLatin1ToUTF16AVX2(const U_8 *source, U_16 *target, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(source + i));
+		_mm256_storeu_si256((__m256i *)(target + i), _mm256_cvtepu8_epi16(bytes));
+	}
+	widenLatin1ToUTF16Portable(source + i, target + i, length - i);
+}
+
+static J9STRING_AVX2_TARGET U_64
+utf8LengthLatin1AVX2(const U_8 *data, UDATA length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	U_64 utf8Length = length;
+	UDATA i = 0;
+	for (; (i + 32) <= length; i += 32) {
+		__m256i bytes = _mm256_loadu_si256((const __m256i *)(data + i));
+		U_32 mask = (U_32)_mm256_movemask_epi8(_mm256_or_si256(bytes, _mm256_cmpeq_epi8(bytes, zero)));
+		utf8Length += countSetBits(mask);
+	}
+	return utf8Length - (length - i) + utf8LengthLatin1SSE2(data + i, length - i);
+}
+
+static const J9StringKernels avx2StringKernels = {
+	asciiPrefixLengthLatin1AVX2,
+	asciiPrefixLengthUTF16AVX2,
+	narrowASCIIUTF16AVX2,
+	widenLatin1ToUTF16AVX2,
+	utf8LengthLatin1AVX2,
+	utf8LengthUTF16SSE2,
+	equalsLatin1UTF16SSE2,
+};
+
+static BOOLEAN
+isAVX2Supported(void)
+{
+	__builtin_cpu_init();
+	return 0 != __builtin_cpu_supports("avx2");
+}
+#endif /* defined(J9STRING_AVX2) */
+
+#if defined(J9STRING_ASIMD)
+/* ---------------- AArch64 ASIMD ---------------- */
+
+static VMINLINE uint8x16_t
+nonASCIIBytesASIMD(uint8x16_t bytes)
+{
+	return vorrq_u8(vcgeq_u8(bytes, vdupq_n_u8(0x80)), vceqq_u8(bytes, vdupq_n_u8(0)));
+}
+
+static VMINLINE uint16x8_t
+nonASCIICharsASIMD(uint16x8_t chars)
+{
+	return vorrq_u16(vcgeq_u16(chars, vdupq_n_u16(0x80)), vceqq_u16(chars, vdupq_n_u16(0)));
+}
+
+static UDATA
+asciiPrefixLengthLatin1ASIMD(const U_8 *data, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		if (0 != vmaxvq_u8(nonASCIIBytesASIMD(vld1q_u8(data + i)))) {
+			break;
+		}
+	}
+	return i + asciiPrefixLengthLatin1Portable(data + i, length - i);
+}
+
+static UDATA
+asciiPrefixLengthUTF16ASIMD(const U_16 *data, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 8) <= length; i += 8) {
+		if (0 != vmaxvq_u16(nonASCIICharsASIMD(vld1q_u16(data + i)))) {
+			break;
+		}
+	}
+	return i + asciiPrefixLengthUTF16Portable(data + i, length - i);
+}
+
+static void
+narrowASCIIUTF16ASIMD(const U_16 *source, U_8 *target, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		uint8x16_t bytes = vcombine_u8(vmovn_u16(vld1q_u16(source + i)), vmovn_u16(vld1q_u16(source + i + 8)));
+		vst1q_u8(target + i, bytes);
+	}
+	narrowASCIIUTF16Portable(source + i, target + i, length - i);
+}
+
+static void
+widenLatin1ToUTF16ASIMD(const U_8 *source, U_16 *target, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		uint8x16_t bytes = vld1q_u8(source + i);
+		vst1q_u16(target + i, vmovl_u8(vget_low_u8(bytes)));
+		vst1q_u16(target + i + 8, vmovl_high_u8(bytes));
+	}
+	widenLatin1ToUTF16Portable(source + i, target + i, length - i);
+}
+
+static U_64
+utf8LengthLatin1ASIMD(const U_8 *data, UDATA length)
+{
+	const uint8x16_t one = vdupq_n_u8(1);
+	U_64 utf8Length = length;
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		utf8Length += vaddvq_u8(vandq_u8(nonASCIIBytesASIMD(vld1q_u8(data + i)), one));
+	}
+	return utf8Length - (length - i) + utf8LengthLatin1Portable(data + i, length - i);
+}
+
+static U_64
+utf8LengthUTF16ASIMD(const U_16 *data, UDATA length)
+{
+	const uint16x8_t one = vdupq_n_u16(1);
+	U_64 utf8Length = length;
+	UDATA i = 0;
+	for (; (i + 8) <= length; i += 8) {
+		uint16x8_t chars = vld1q_u16(data + i);
+		/* One extra byte for characters that are not ASCII, another for characters >= 0x800 */
+		uint16x8_t extra = vandq_u16(nonASCIICharsASIMD(chars), one);
+		extra = vaddq_u16(extra, vandq_u16(vcgeq_u16(chars, vdupq_n_u16(0x800)), one));
+		utf8Length += vaddvq_u16(extra);
+	}
+	return utf8Length - (length - i) + utf8LengthUTF16Portable(data + i, length - i);
+}
+
+static BOOLEAN
+equalsLatin1UTF16ASIMD(const U_8 *latin1, const U_16 *utf16, UDATA length)
+{
+	UDATA i = 0;
+	for (; (i + 16) <= length; i += 16) {
+		uint8x16_t bytes = vld1q_u8(latin1 + i);
+		uint16x8_t low = vceqq_u16(vmovl_u8(vget_low_u8(bytes)), vld1q_u16(utf16 + i));
+		uint16x8_t high = vceqq_u16(vmovl_high_u8(bytes), vld1q_u16(utf16 + i + 8));
+		if (0xFFFF != vminvq_u16(vandq_u16(low, high))) {
+			return FALSE;
+		}
+	}
+	return equalsLatin1UTF16Portable(latin1 + i, utf16 + i, length - i);
+}
+
+static const J9StringKernels asimdStringKernels = {
+	asciiPrefixLengthLatin1ASIMD,
+	asciiPrefixLengthUTF16ASIMD,
+	narrowASCIIUTF16ASIMD,
+	widenLatin1ToUTF16ASIMD,
+	utf8LengthLatin1ASIMD,
+	utf8LengthUTF16ASIMD,
+	equalsLatin1UTF16ASIMD,
+};
+#endif /* defined(J9STRING_ASIMD) */
+
+/*
+ * Pick the kernels for this CPU on the first call. Racing threads all pick the same ones.
+ */
+static const J9StringKernels *
+selectStringKernels(void)
+{
+	const J9StringKernels *kernels = &portableStringKernels;
+
+#if defined(J9STRING_AVX2)
+	if (isAVX2Supported()) {
+		kernels = &avx2StringKernels;
+	} else {
+		kernels = &sse2StringKernels;
+	}
+#elif defined(J9STRING_SSE2) /* defined(J9STRING_AVX2) */
+	kernels = &sse2StringKernels;
+#elif defined(J9STRING_ASIMD) /* defined(J9STRING_AVX2) */
+	/* ASIMD is part of the AArch64 base architecture */
+	kernels = &asimdStringKernels;
+#endif /* defined(J9STRING_AVX2) */
+	stringKernels = kernels;
+	return kernels;
+}
+
+UDATA
+asciiPrefixLengthLatin1(const U_8 *data, UDATA length)
+{
+	return getStringKernels()->asciiPrefixLengthLatin1(data, length);
+}
+
+UDATA
+asciiPrefixLengthUTF16(const U_16 *data, UDATA length)
+{
+	return getStringKernels()->asciiPrefixLengthUTF16(data, length);
+}
+
+void
+narrowASCIIUTF16(const U_16 *source, U_8 *target, UDATA length)
+{
+	getStringKernels()->narrowASCIIUTF16(source, target, length);
+}
+
+void
+widenLatin1ToUTF16(const U_8 *source, U_16 *target, UDATA length)
+{
+	getStringKernels()->widenLatin1ToUTF16(source, target, length);
+}
+
+U_64
+utf8LengthLatin1(const U_8 *data, UDATA length)
+{
+	return getStringKernels()->utf8LengthLatin1(data, length);
+}
+
+U_64
+utf8LengthUTF16(const U_16 *data, UDATA length)
+{
+	return getStringKernels()->utf8LengthUTF16(data, length);
+}
+
+BOOLEAN
+equalsLatin1UTF16(const U_8 *latin1, const U_16 *utf16, UDATA length)
+{
+	return getStringKernels()->equalsLatin1UTF16(latin1, utf16, length);
+}
+
+} /* extern "C" */
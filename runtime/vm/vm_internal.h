@@ -377,6 +377,76 @@ isValidUtf8(const U_8 * utf8Data, size_t length);
 void
 fixBadUtf8(const U_8 * original, U_8 *corrected, size_t length);
 
+/* ------------------- stringkernels.cpp ----------------- */
+/*
+ * Bulk string kernels, vectorized where the CPU allows. ASCII characters are those
+ * in the range 0x01 to 0x7F, which modified UTF-8 encodes as a single byte.
+ */
+
+/**
+ * Count the leading ASCII characters of Latin-1 data.
+ * @param data the characters
+ * @param length the number of characters
+ * @return the number of characters before the first non-ASCII character
+ */
+UDATA
+asciiPrefixLengthLatin1(const U_8 *data, UDATA length);
+
+/**
+ * Count the leading ASCII characters of UTF-16 data.
+ * @param data the characters
+ * @param length the number of characters
+ * @return the number of characters before the first non-ASCII character
+ */
+UDATA
+asciiPrefixLengthUTF16(const U_16 *data, UDATA length);
+
+/**
+ * Copy UTF-16 characters, which must all be ASCII, to bytes.
+ * @param source the characters
+ * @param target the bytes
+ * @param length the number of characters
+ */
+void
+narrowASCIIUTF16(const U_16 *source, U_8 *target, UDATA length);
+
+/**
+ * Copy Latin-1 characters to UTF-16 characters.
+ * @param source the Latin-1 characters
+ * @param target the UTF-16 characters
+ * @param length the number of characters
+ */
+void
+widenLatin1ToUTF16(const U_8 *source, U_16 *target, UDATA length);
+
+/**
+ * Compute the length of Latin-1 data encoded as modified UTF-8.
+ * @param data the characters
+ * @param length the number of characters
+ * @return the number of bytes
+ */
+U_64
+utf8LengthLatin1(const U_8 *data, UDATA length);
+
+/**
+ * Compute the length of UTF-16 data encoded as modified UTF-8.
+ * @param data the characters
+ * @param length the number of characters
+ * @return the number of bytes
+ */
+U_64
+utf8LengthUTF16(const U_16 *data, UDATA length);
+
+/**
+ * Compare Latin-1 characters to UTF-16 characters for equality.
+ * @param latin1 the Latin-1 characters
+ * @param utf16 the UTF-16 characters
+ * @param length the number of characters
+ * @return TRUE if the characters are equal, FALSE otherwise
+ */
+BOOLEAN
+equalsLatin1UTF16(const U_8 *latin1, const U_16 *utf16, UDATA length);
+
 /* ------------------- NativeHelpers.cpp ----------------- */
 /**
  * Create an array of java.lang.Class representing the list of
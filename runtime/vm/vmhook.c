@@ -136,6 +136,15 @@ hookAboutToBootstrapEvent(J9HookInterface **hook, UDATA eventNum, void *voidEven
 		omrthread_monitor_exit(vm->runtimeFlagsMutex);
 	}
 
+#if defined(J9VM_OPT_JFR)
+	/* A recording requested on the command line records allocation samples, keep the hook available for it */
+	if ((NULL != vm->jfrState.jfrCMDLineOption)
+		|| J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_START_FLIGHT_RECORDING)
+	) {
+		(*gcHook)->J9HookReserve(gcHook, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING);
+	}
+#endif /* defined(J9VM_OPT_JFR) */
+
 	/* The sampled object allocate hook disables safepoint OSR */
 	if ((*gcHook)->J9HookDisable(gcHook, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING)) {
 		omrthread_monitor_enter(vm->runtimeFlagsMutex);
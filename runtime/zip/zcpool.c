@@ -215,6 +215,7 @@ J9ZipCachePool *zipCachePool_new(J9PortLibrary * portLib, void * userData)
 		p->userData = userData;
 		p->allocateWorkBuffer = TRUE;
 		p->workBuffer = NULL;
+		p->mapZipFiles = FALSE;
 		if (MUTEX_INIT(p->mutex)) {
 			p->pool = pool_new(sizeof(J9ZipCachePoolEntry),  0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_VM_JCL, POOL_FOR_PORT(portLib));
 			if (p->pool) {
@@ -239,6 +240,23 @@ J9ZipCachePool *zipCachePool_new(J9PortLibrary * portLib, void * userData)
 
 
 
+/**
+ * Sets whether zip files opened with a cache from this pool are mapped into memory.
+ * Only zip files opened after the call are affected. In the VM, these are the jars it
+ * opens itself, such as bootstrap classpath entries; jars on the application classpath
+ * are read by the class library and are never mapped.
+ *
+ * @param[in] zcp the zip cache pool
+ * @param[in] mapZipFiles TRUE to read zip files through a read-only mapping
+ *
+ * @return none
+ */
+void zipCachePool_setMapZipFiles(J9ZipCachePool *zcp, BOOLEAN mapZipFiles)
+{
+	zcp->mapZipFiles = mapZipFiles;
+}
+
+
 /**
  * Decrements the reference count of a cache in the pool.
  * If the reference count reaches 0, the cache is removed from the pool and @ref zipCache_kill is called on it. 
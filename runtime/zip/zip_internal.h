@@ -83,6 +83,7 @@ struct J9ZipCachePool  {
 	struct J9VMZipCachePoolHookInterface hookInterface;
 	BOOLEAN allocateWorkBuffer;
 	UDATA *workBuffer;
+	BOOLEAN mapZipFiles;
 };
 
 
@@ -123,6 +124,8 @@ typedef struct J9ZipCacheInternal {
 	J9ZipCacheEntry *entry;
 	IDATA zipFileFd;
 	U_8 zipFileType;
+	J9MmapHandle *zipFileMapHandle;
+	U_64 zipFileMapSize;
 } J9ZipCacheInternal;
 
 /**
@@ -160,6 +163,26 @@ U_64
 zipCache_getStartCentralDir(J9ZipCache *zipCache);
 
 
+/**
+* @brief
+* @param zipCache
+* @param zipFileSize
+* @return void
+*/
+void
+zipCache_mapFile(J9ZipCache *zipCache, I_64 zipFileSize);
+
+
+/**
+* @brief
+* @param zipCache
+* @param mappedSize
+* @return U_8 *
+*/
+U_8 *
+zipCache_getMappedFile(J9ZipCache *zipCache, U_64 *mappedSize);
+
+
 /**
 * @brief
 * @param zipCache
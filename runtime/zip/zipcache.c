@@ -119,6 +119,8 @@ zipCache_new(J9PortLibrary *portLib, char *zipName, IDATA zipNameLength, I_64 zi
 	zci->entry = zce;
 	zci->zipFileFd = -1;
 	zci->zipFileType = ZIP_Unknown;
+	zci->zipFileMapHandle = NULL;
+	zci->zipFileMapSize = 0;
 
 	zci->info.portLib = portLib;
 	ZIP_SRP_SET(zce->currentChunk, chunk);
@@ -465,6 +467,61 @@ zipCache_isSameZipFile(J9ZipCache *zipCache, IDATA zipTimeStamp, I_64 zipFileSiz
 }
 
 
+/**
+ * Maps the zip file of the cache read-only, so that entries can be read from memory
+ * rather than with file I/O. Failing to map the file is not an error; the file is then
+ * read using the file descriptor. The mapping is released by zipCache_kill().
+ *
+ * The file must not be truncated while it is mapped, as touching a page beyond the end
+ * of the file raises SIGBUS.
+ *
+ * @param[in] zipCache the zip cache, which must own an open file descriptor
+ * @param[in] zipFileSize the size of the zip file
+ */
+void
+zipCache_mapFile(J9ZipCache *zipCache, I_64 zipFileSize)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipCache;
+	PORT_ACCESS_FROM_PORT(zipCache->portLib);
+
+	if ((-1 != zci->zipFileFd)
+		&& (NULL == zci->zipFileMapHandle)
+		&& (0 < zipFileSize)
+		&& ((U_64)(UDATA)zipFileSize == (U_64)zipFileSize)
+		&& J9_ARE_ALL_BITS_SET(j9mmap_capabilities(), J9PORT_MMAP_CAPABILITY_READ)
+	) {
+		const char *zipFileName = ZIP_SRP_GET(zci->entry->zipFileName, const char *);
+
+		zci->zipFileMapHandle = j9mmap_map_file(zci->zipFileFd, 0, (UDATA)zipFileSize, zipFileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_VM_JCL);
+		if (NULL != zci->zipFileMapHandle) {
+			zci->zipFileMapSize = (U_64)zipFileSize;
+		}
+	}
+}
+
+
+/**
+ * Returns the mapped zip file of the cache.
+ *
+ * @param[in] zipCache the zip cache
+ * @param[out] mappedSize the number of bytes mapped
+ *
+ * @return the start of the mapped zip file, or NULL if the zip file is not mapped
+ */
+U_8 *
+zipCache_getMappedFile(J9ZipCache *zipCache, U_64 *mappedSize)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipCache;
+
+	if (NULL == zci->zipFileMapHandle) {
+		*mappedSize = 0;
+		return NULL;
+	}
+	*mappedSize = zci->zipFileMapSize;
+	return (U_8 *)zci->zipFileMapHandle->pointer;
+}
+
+
 /**
  * Return the startCentralDir of the cache.
  * 
@@ -760,7 +817,7 @@ void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
 
 
 /** 
- * Deletes a zip cache and frees its resources. Also closes the zip file descriptor.
+ * Deletes a zip cache and frees its resources. Also unmaps the zip file and closes the zip file descriptor.
  *
  * @param[in] zipCache the zip cache to be freed
  *
@@ -778,6 +835,9 @@ void zipCache_kill(J9ZipCache * zipCache)
 	PORT_ACCESS_FROM_PORT(portLib);
 
 	zipCache_freeChunks(portLib, zce);
+	if (NULL != zci->zipFileMapHandle) {
+		j9mmap_unmap_file(zci->zipFileMapHandle);
+	}
 	if (-1 != zci->zipFileFd) {
 		j9file_close(zci->zipFileFd);
 	}
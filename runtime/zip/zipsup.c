@@ -101,6 +101,7 @@ static I_32 getZipEntryUsingDirectory(J9PortLibrary *portLib, J9ZipFile *zipFile
 		const char *fileName, IDATA fileNameLength, BOOLEAN readDataPointer);
 static BOOLEAN isSeekFailure(I_64 seekResult, I_64 expectedValue);
 static BOOLEAN isUnsupported(I_64 value);
+static U_8 *getMappedData(J9ZipFile *zipFile, U_64 offset, U_64 length);
 
 #if defined(J9VM_THR_PREEMPTIVE)
 #include "omrthread.h"
@@ -218,6 +219,31 @@ isUnsupported(I_64 value)
 	return value < 0;
 }
 
+/**
+ * Returns the bytes of the zip file in [offset, offset + length) if the zip file is
+ * mapped into memory. Reading through the mapping does not move the file pointer
+ * of zipFile->fd, so callers falling back to file I/O afterwards must seek first.
+ *
+ * @param[in] zipFile the zip file
+ * @param[in] offset the offset of the bytes in the zip file
+ * @param[in] length the number of bytes
+ *
+ * @return the mapped bytes, or NULL if the zip file is not mapped or the range is not within the mapping
+ */
+static U_8 *
+getMappedData(J9ZipFile *zipFile, U_64 offset, U_64 length)
+{
+	if (NULL != zipFile->cache) {
+		U_64 mappedSize = 0;
+		U_8 *mappedFile = zipCache_getMappedFile(zipFile->cache, &mappedSize);
+
+		if ((NULL != mappedFile) && (offset <= mappedSize) && (length <= (mappedSize - offset))) {
+			return mappedFile + offset;
+		}
+	}
+	return NULL;
+}
+
 /*
 	Returns 0 on success or one of the following:
 			ZIP_ERR_UNSUPPORTED_FILE_TYPE
@@ -1131,6 +1157,7 @@ readZipEntry(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *zipEntry, c
 	U_64 currentEntryPointer = 0;
 	U_64 localEntryPointer = 0;
 	I_64 headerSize = 0;
+	U_8 *mappedData = NULL;
 
   retry:
 	if (NULL != entryStart) {
@@ -1150,18 +1177,29 @@ readZipEntry(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *zipEntry, c
 		readLength++;
 	}
 
-	/* Allocate some memory if necessary */
-	if (readLength <= sizeof(buffer)) {
-		current = buffer;
-	} else {
-		current = readBuffer = j9mem_allocate_memory((IDATA)readLength, J9MEM_CATEGORY_VM_JCL);
-		if (!readBuffer)
-			return ZIP_ERR_OUT_OF_MEMORY;
+	currentEntryPointer = localEntryPointer = zipFile->pointer;
+
+	/* When looking up a known entry in a mapped zip file, parse the header in place */
+	mappedData = NULL;
+	if (NULL != filename) {
+		mappedData = getMappedData(zipFile, zipFile->pointer, (U_64)readLength);
 	}
 
-	currentEntryPointer = localEntryPointer = zipFile->pointer;
+	if (NULL != mappedData) {
+		current = mappedData;
+		readResult = readLength;
+	} else {
+		/* Allocate some memory if necessary */
+		if (readLength <= sizeof(buffer)) {
+			current = buffer;
+		} else {
+			current = readBuffer = j9mem_allocate_memory((IDATA)readLength, J9MEM_CATEGORY_VM_JCL);
+			if (!readBuffer)
+				return ZIP_ERR_OUT_OF_MEMORY;
+		}
 
-	readResult = j9file_read(zipFile->fd, current, (IDATA)readLength);
+		readResult = j9file_read(zipFile->fd, current, (IDATA)readLength);
+	}
 	if ((readResult < 22) || (filename && !(readResult == readLength || (findDirectory && readResult == (readLength-1))))) {
 		/* We clearly didn't get enough bytes */
 		result = ZIP_ERR_FILE_READ_ERROR;
@@ -1262,6 +1300,15 @@ readZipEntry(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *zipEntry, c
 
 	/* Read the rest of the filename if necessary.  Allocate space in J9ZipEntry for it! */
 	if (readLength < zipEntry->filenameLength) {
+		if (NULL != mappedData) {
+			/* The header was not read from the file, so the file pointer must be set before reading */
+			seekResult = j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
+			if (isSeekFailure(seekResult, zipFile->pointer)) {
+				zipFile->pointer = -1;
+				result = ZIP_ERR_FILE_READ_ERROR;
+				goto finished;
+			}
+		}
 		readResult = j9file_read(zipFile->fd, zipEntry->filename + readLength,
 				(IDATA)(zipEntry->filenameLength - readLength));
 		if (readResult != (zipEntry->filenameLength - readLength)) {
@@ -1309,7 +1356,12 @@ readZipEntry(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *zipEntry, c
 		 * the extra field data in the corresponding local entry.
 		 */
 		if (readDataPointer) {
-			if ( j9file_seek( zipFile->fd, localEntryPointer + 28, EsSeekSet ) == localEntryPointer+28 ) {
+			mappedData = getMappedData(zipFile, localEntryPointer + 28, 2);
+			if (NULL != mappedData) {
+				ZIP_NEXT_U16( lost, mappedData );
+				zipEntry->dataPointer = zipEntry->extraFieldPointer + lost;
+				zipFile->pointer = localEntryPointer + 30;
+			} else if ( j9file_seek( zipFile->fd, localEntryPointer + 28, EsSeekSet ) == localEntryPointer+28 ) {
 				if ( j9file_read( zipFile->fd, buf, 2 ) == 2 ) {
 					ZIP_NEXT_U16( lost, buf2 );
 					zipEntry->dataPointer = zipEntry->extraFieldPointer + lost;
@@ -1518,6 +1570,9 @@ zip_setupCache(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipCache *cache, J9
 			J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipFile->cache;
 			zci->zipFileFd = zipFile->fd;
 			zci->zipFileType = zipFile->type;
+			if (cachePool->mapZipFiles) {
+				zipCache_mapFile(zipFile->cache, fileSize);
+			}
 		}
 	}
 
@@ -1783,13 +1838,17 @@ zip_getZipEntry(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry *entry,
 			goto finished;
 		}
 
-		/* Seek to the entry's position in the file. */
+		/* Seek to the entry's position in the file, unless the entry header is parsed in place from the mapping.
+		 * The length covers the largest header readZipEntry() reads for a known filename.
+		 */
 		zipFile->pointer = position;
-		seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
-		if (isSeekFailure(seekResult, zipFile->pointer)) {
-			zipFile->pointer = -1;
-			status = ZIP_ERR_FILE_READ_ERROR;
-			goto finished;
+		if (NULL == getMappedData(zipFile, position, 46 + fileNameLength + 1)) {
+			seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
+			if (isSeekFailure(seekResult, zipFile->pointer)) {
+				zipFile->pointer = -1;
+				status = ZIP_ERR_FILE_READ_ERROR;
+				goto finished;
+			}
 		}
 
 		/* Read the entry */
@@ -2015,6 +2074,14 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
 	if(entry->compressionMethod == ZIP_CM_Stored) {
 		IDATA readResult = 0;
+		U_8 *mappedData = getMappedData(zipFile, entry->dataPointer, entry->compressedSize);
+		if (NULL != mappedData) {
+			/* No compression - copy the data from the mapped file. */
+			memcpy(dataBuffer, mappedData, entry->compressedSize);
+			zipFile->pointer = entry->dataPointer + entry->compressedSize;
+			EXIT();
+			return 0;
+		}
 		/* No compression - just read the data in. */
 		zipFile->pointer = entry->dataPointer;
 		seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
@@ -2035,6 +2102,7 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
 	if(entry->compressionMethod == ZIP_CM_Deflated) {
 		U_8* readBuffer;
+		U_8 *mappedData = getMappedData(zipFile, entry->dataPointer, entry->compressedSize);
 
 		/* Read the file contents. */
 		if (entry->compressedSize < ZIP_WORK_BUFFER_SIZE) {
@@ -2049,6 +2117,14 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 				}
 			}
 		}
+		if (NULL != mappedData) {
+			/* Inflate straight from the mapped file into the data buffer, without staging the compressed data. */
+			zipFile->pointer = entry->dataPointer + entry->compressedSize;
+			result = inflateData(&wb, mappedData, entry->compressedSize, dataBuffer, entry->uncompressedSize);
+			if(result)  goto finished;
+			EXIT();
+			return 0;
+		}
 		readBuffer = zdataalloc(&wb, 1, entry->compressedSize);
 		if (!readBuffer) {
 			result = ZIP_ERR_OUT_OF_MEMORY;
@@ -2120,6 +2196,7 @@ zip_getZipEntryRawData(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *e
 	I_32 result = 0;
 	I_64 seekResult = 0;
 	I_64 readResult = 0;
+	U_8 *mappedData = NULL;
 
 	ENTER();
 
@@ -2131,6 +2208,13 @@ zip_getZipEntryRawData(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *e
 
 	/* Just read the data in.  Widen the data to check for overflow. */
 	zipFile->pointer = entry->dataPointer + offset;
+	mappedData = getMappedData(zipFile, zipFile->pointer, bufferSize);
+	if (NULL != mappedData) {
+		memcpy(buffer, mappedData, bufferSize);
+		zipFile->pointer += bufferSize;
+		EXIT();
+		return 0;
+	}
 	seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
 	if (isSeekFailure(seekResult, zipFile->pointer)) {
 		result = ZIP_ERR_FILE_READ_ERROR;
@@ -2183,6 +2267,7 @@ I_32 zip_getZipEntryExtraField(J9PortLibrary* portLib, J9ZipFile* zipFile, J9Zip
 	U_8* extraFieldBuffer;
 	I_64 seekResult;
 	IDATA readResult = 0;
+	U_8 *mappedData = NULL;
 
 	ENTER();
 
@@ -2207,6 +2292,13 @@ I_32 zip_getZipEntryExtraField(J9PortLibrary* portLib, J9ZipFile* zipFile, J9Zip
 	}
 
 	zipFile->pointer = entry->extraFieldPointer;
+	mappedData = getMappedData(zipFile, zipFile->pointer, entry->extraFieldLength);
+	if (NULL != mappedData) {
+		memcpy(extraFieldBuffer, mappedData, entry->extraFieldLength);
+		zipFile->pointer += entry->extraFieldLength;
+		EXIT();
+		return 0;
+	}
 	seekResult = j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
 	if (isSeekFailure(seekResult, zipFile->pointer)) {
 		zipFile->pointer = -1;
@@ -2265,6 +2357,7 @@ zip_getZipEntryComment(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *e
 	U_8 *fileCommentBuffer;
 	I_64 seekResult;
 	IDATA readResult = 0;
+	U_8 *mappedData = NULL;
 
 	ENTER();
 
@@ -2293,6 +2386,14 @@ zip_getZipEntryComment(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *e
 	}
 
 	zipFile->pointer = entry->fileCommentPointer;
+	mappedData = getMappedData(zipFile, zipFile->pointer, entry->fileCommentLength);
+	if (NULL != mappedData) {
+		memcpy(fileCommentBuffer, mappedData, entry->fileCommentLength);
+		fileCommentBuffer[entry->fileCommentLength] = '\0';
+		zipFile->pointer += entry->fileCommentLength;
+		EXIT();
+		return 0;
+	}
 	seekResult =  j9file_seek(zipFile->fd, zipFile->pointer, EsSeekSet);
 	if (isSeekFailure(seekResult, zipFile->pointer)) {
 		zipFile->pointer = -1;
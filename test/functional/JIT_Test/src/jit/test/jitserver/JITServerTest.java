@@ -602,6 +602,72 @@ public class JITServerTest {
 		destroyAndCheckProcess(client, clientBuilder);
 	}
 
+	public void testServerFailover() throws IOException, InterruptedException {
+		logger.info("running testServerFailover: INFO and above level logging enabled");
+
+		updateJITServerPort();
+
+		// A second server on another port, and a client that knows about both servers
+		final String firstPort = serverBuilder.command().get(1).substring(serverBuilder.command().get(1).indexOf('=') + 1);
+		final String secondPortOption = generatePortOption();
+		final String secondPort = secondPortOption.substring(secondPortOption.indexOf('=') + 1);
+
+		final ProcessBuilder secondServerBuilder = new ProcessBuilder(new ArrayList<String>(serverBuilder.command()));
+		secondServerBuilder.command().set(1, secondPortOption);
+		secondServerBuilder.redirectErrorStream(true);
+		secondServerBuilder.environment().put("TR_Options", serverBuilder.environment().get("TR_Options"));
+
+		final ProcessBuilder failoverClientBuilder = new ProcessBuilder(new ArrayList<String>(clientBuilder.command()));
+		failoverClientBuilder.command().add(2, "-XX:JITServerAddress=localhost:" + firstPort + ",localhost:" + secondPort);
+		failoverClientBuilder.redirectErrorStream(true);
+		failoverClientBuilder.environment().put("TR_Options", clientBuilder.environment().get("TR_Options").replace("heartbeat}", "heartbeat|JITServerConns}"));
+
+		final int logId = new Random().nextInt(Integer.MAX_VALUE);
+		final String clientLogName = "testServerFailover.client" + logId;
+		redirectProcessOutputs(failoverClientBuilder, clientLogName);
+		redirectProcessOutputs(serverBuilder, "testServerFailover.server");
+		redirectProcessOutputs(secondServerBuilder, "testServerFailover.secondServer");
+
+		final Process server = startProcess(serverBuilder, "server");
+		final Process secondServer = startProcess(secondServerBuilder, "second server");
+
+		Thread.sleep(SERVER_START_WAIT_TIME_MS);
+
+		final Process client = startProcess(failoverClientBuilder, "client");
+
+		logger.info("Waiting for " + CLIENT_TEST_TIME_MS + " millis.");
+		Thread.sleep(CLIENT_TEST_TIME_MS);
+
+		// The client starts with either server; stop the one it is using
+		final boolean startedOnFirstServer = checkLogFiles(clientLogName + ".jitverboselog.out.*", "Server #0: .* \\(initial\\)");
+		final String failedPort = startedOnFirstServer ? firstPort : secondPort;
+		final String remainingPort = startedOnFirstServer ? secondPort : firstPort;
+
+		logger.info("Stopping the server on port " + failedPort + "...");
+		if (startedOnFirstServer) {
+			destroyAndCheckProcess(server, serverBuilder);
+		} else {
+			destroyAndCheckProcess(secondServer, secondServerBuilder);
+		}
+
+		logger.info("Waiting for " + CLIENT_TEST_TIME_MS + " millis.");
+		Thread.sleep(CLIENT_TEST_TIME_MS);
+
+		logger.info("Stopping client...");
+		destroyAndCheckProcess(client, failoverClientBuilder);
+
+		logger.info("Stopping the server on port " + remainingPort + "...");
+		if (startedOnFirstServer) {
+			destroyAndCheckProcess(secondServer, secondServerBuilder);
+		} else {
+			destroyAndCheckProcess(server, serverBuilder);
+		}
+
+		if (!checkLogFiles(clientLogName + ".jitverboselog.out.*", "Switching from server .*:" + failedPort + " to server .*:" + remainingPort + " \\(connection failure\\)")) {
+			AssertJUnit.fail("The client did not fail over to the server on port " + remainingPort + ".");
+		}
+	}
+
 	public void testServerAOTCache() throws IOException, InterruptedException {
                 logger.info("running testServerSCC: INFO and above level logging enabled");
 
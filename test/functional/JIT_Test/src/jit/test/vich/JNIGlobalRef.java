@@ -0,0 +1,133 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times NewGlobalRef/DeleteGlobalRef from one thread and from several threads at once.
+ */
+public class JNIGlobalRef {
+
+	private static Logger logger = Logger.getLogger(JNIGlobalRef.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	public JNIGlobalRef() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 10000;
+	static final int batchSize = 100;
+	static final int threadCount = 8;
+
+	public native int globalReference(Object o, int batchSize, int loopCount);
+	public native int createGlobalRefs(Object[] objects);
+	public native int checkAndDeleteGlobalRefs();
+
+	void runThreads(int threads) throws InterruptedException
+	{
+		final Object o = new Object();
+		final int[] failures = new int[threads];
+		Thread[] workers = new Thread[threads];
+		for (int i = 0; i < threads; i++) {
+			final int index = i;
+			workers[i] = new Thread() {
+				public void run() {
+					failures[index] = globalReference(o, batchSize, loopCount);
+				}
+			};
+		}
+
+		timer.reset();
+		for (int i = 0; i < threads; i++) {
+			workers[i].start();
+		}
+		for (int i = 0; i < threads; i++) {
+			workers[i].join();
+		}
+		timer.mark();
+		logger.info(threads + " threads x " + (loopCount * batchSize) + " New/DeleteGlobalRef calls = " + timer.delta());
+
+		for (int i = 0; i < threads; i++) {
+			Assert.assertEquals(failures[i], 0, "global refs did not refer to the object");
+		}
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIGlobalRef() throws InterruptedException
+	{
+		try
+		{
+			Assert.assertEquals(globalReference(new Object(), batchSize, 1), 0);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		runThreads(1);
+		runThreads(threadCount);
+	}
+
+	/* Only the global refs keep these arrays alive. If the GC did not scan the
+	 * reused slots, the arrays would be collected and their memory overwritten.
+	 */
+	static Object[] makeArrays(int count)
+	{
+		Object[] arrays = new Object[count];
+		for (int i = 0; i < count; i++) {
+			byte[] array = new byte[i + 1];
+			java.util.Arrays.fill(array, (byte)i);
+			arrays[i] = array;
+		}
+		return arrays;
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIGlobalRefAcrossGC()
+	{
+		try
+		{
+			/* Populate the per-thread slot cache */
+			Assert.assertEquals(globalReference(new Object(), batchSize, 1), 0);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		for (int round = 0; round < 4; round++) {
+			Assert.assertEquals(createGlobalRefs(makeArrays(batchSize)), batchSize);
+			for (int i = 0; i < 3; i++) {
+				/* Allocate garbage to reuse the memory of anything the GC freed */
+				makeArrays(batchSize);
+				System.gc();
+			}
+			Assert.assertEquals(checkAndDeleteGlobalRefs(), 0, "global refs were not kept alive across GC");
+		}
+	}
+}
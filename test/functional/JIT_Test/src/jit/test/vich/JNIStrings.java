@@ -0,0 +1,129 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times the JNI string conversions on ASCII, Latin-1 and non-Latin-1 strings
+ * and checks that the converted data survives a round trip.
+ */
+public class JNIStrings {
+
+	private static Logger logger = Logger.getLogger(JNIStrings.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	public JNIStrings() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 1000;
+	static final int stringLength = 64 * 1024;
+
+	public native String newStringUTF(String string, int loopCount);
+	public native int getStringUTFChars(String string, int loopCount);
+	public native int getStringUTFRegion(String string, int loopCount);
+	public native String getStringChars(String string, int loopCount);
+
+	static String buildString(String pattern, String suffix)
+	{
+		StringBuilder builder = new StringBuilder(stringLength + suffix.length());
+		while (builder.length() < stringLength) {
+			builder.append(pattern);
+		}
+		builder.setLength(stringLength);
+		builder.append(suffix);
+		return builder.toString();
+	}
+
+	/* Length of the modified UTF-8 encoding, the string must not contain '\0' */
+	static int utfLength(String string)
+	{
+		int length = 0;
+		for (int i = 0; i < string.length(); i++) {
+			char c = string.charAt(i);
+			if (c < 0x80) {
+				length += 1;
+			} else if (c < 0x800) {
+				length += 2;
+			} else {
+				length += 3;
+			}
+		}
+		return length;
+	}
+
+	void runString(String kind, String string)
+	{
+		int utfLength = utfLength(string);
+
+		Assert.assertEquals(newStringUTF(string, 1), string, kind + " NewStringUTF");
+		Assert.assertEquals(getStringUTFChars(string, 1), utfLength, kind + " GetStringUTFChars");
+		Assert.assertEquals(getStringUTFRegion(string, 1), utfLength, kind + " GetStringUTFRegion");
+		Assert.assertEquals(getStringChars(string, 1), string, kind + " GetStringChars");
+
+		timer.reset();
+		newStringUTF(string, loopCount);
+		timer.mark();
+		logger.info(loopCount + " NewStringUTF calls (" + kind + ", length " + string.length() + ") = " + timer.delta());
+
+		timer.reset();
+		getStringUTFChars(string, loopCount);
+		timer.mark();
+		logger.info(loopCount + " GetStringUTFChars calls (" + kind + ", length " + string.length() + ") = " + timer.delta());
+
+		timer.reset();
+		getStringUTFRegion(string, loopCount);
+		timer.mark();
+		logger.info(loopCount + " GetStringUTFRegion calls (" + kind + ", length " + string.length() + ") = " + timer.delta());
+
+		timer.reset();
+		getStringChars(string, loopCount);
+		timer.mark();
+		logger.info(loopCount + " GetStringChars calls (" + kind + ", length " + string.length() + ") = " + timer.delta());
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIStrings()
+	{
+		try
+		{
+			getStringUTFChars("", 1);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		runString("ASCII", buildString("The quick brown fox jumps over the lazy dog. ", ""));
+		runString("Latin-1", buildString("Le coeur a ses raisons, fa\u00E7ade, na\u00EFve, \u00E9t\u00E9. ", ""));
+		runString("ASCII UTF-16", buildString("The quick brown fox jumps over the lazy dog. ", "\u20AC"));
+		runString("non-Latin-1", buildString("\u041F\u0440\u0438\u0432\u0435\u0442 \u4E16\u754C, caf\u00E9 \u20AC5. ", ""));
+	}
+}
@@ -28,7 +28,9 @@ import org.testng.annotations.Test;
 import java.lang.reflect.Field;
 import java.lang.reflect.Modifier;
 import java.time.Duration;
+import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.Executor;
+import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.locks.LockSupport;
@@ -277,6 +279,120 @@ public class VirtualThreadTests {
 		}
 	}
 
+	private static int parkAtDepth(int depth, CountDownLatch parked) {
+		if (depth > 0) {
+			return parkAtDepth(depth - 1, parked) + 1;
+		}
+		parked.countDown();
+		LockSupport.park();
+		return 0;
+	}
+
+	/* Create a builder for virtual threads that run on the given carrier threads. */
+	private static Thread.Builder.OfVirtual virtualThreadBuilder(Executor scheduler) throws Exception {
+		Class<?> builderCls = Class.forName("java.lang.ThreadBuilders$VirtualThreadBuilder");
+		var ctor = builderCls.getDeclaredConstructor(Executor.class);
+		ctor.setAccessible(true);
+		return (Thread.Builder.OfVirtual)ctor.newInstance(scheduler);
+	}
+
+	/* Virtual threads that park with deep stacks grow their continuation stacks past the
+	 * size the continuation caches keep. The carriers then exit while their T1 caches hold
+	 * continuations with released stacks, and the next virtual threads reuse cache entries.
+	 */
+	@Test
+	public void test_deepStackVirtualThreadsOnExitingCarriers() {
+		final int numThreads = 8;
+		final int depth = 5000;
+		try {
+			for (int round = 0; round < 3; round++) {
+				ExecutorService carriers = Executors.newFixedThreadPool(2);
+				Thread.Builder.OfVirtual builder = virtualThreadBuilder(carriers);
+				CountDownLatch parked = new CountDownLatch(numThreads);
+				int[] results = new int[numThreads];
+				Thread[] threads = new Thread[numThreads];
+				for (int i = 0; i < numThreads; i++) {
+					final int index = i;
+					threads[i] = builder.start(() -> {
+						results[index] = parkAtDepth(depth, parked);
+					});
+				}
+
+				AssertJUnit.assertTrue("Virtual threads did not park", parked.await(60, TimeUnit.SECONDS));
+				for (int i = 0; i < numThreads; i++) {
+					/* Unpark until the thread terminates in case it was woken up before parking */
+					while (!threads[i].join(Duration.ofMillis(100))) {
+						LockSupport.unpark(threads[i]);
+					}
+				}
+				for (int i = 0; i < numThreads; i++) {
+					AssertJUnit.assertEquals(depth, results[i]);
+				}
+
+				carriers.shutdown();
+				AssertJUnit.assertTrue("Carrier threads did not exit", carriers.awaitTermination(60, TimeUnit.SECONDS));
+			}
+		} catch (Exception e) {
+			Assert.fail("Unexpected exception occured : " + e.getMessage(), e);
+		}
+	}
+
+	private static long sumToDepth(int depth) {
+		long value = depth * 31L;
+		if (depth > 0) {
+			value += sumToDepth(depth - 1);
+		}
+		return value;
+	}
+
+	/* Park repeatedly below a few frames whose locals are checked once the parks are done. */
+	private static boolean parkBelowFrames(int frames, int parks, long value) {
+		long[] locals = { value, value * 7, value * 13 };
+		boolean intact;
+		if (frames > 0) {
+			intact = parkBelowFrames(frames - 1, parks, value + 1);
+		} else {
+			for (int i = 0; i < parks; i++) {
+				LockSupport.parkNanos(1_000_000);
+			}
+			intact = true;
+		}
+		return intact && (locals[0] == value) && (locals[1] == (value * 7)) && (locals[2] == (value * 13));
+	}
+
+	/* With -XX:+CompactContinuationStacks, a virtual thread that grew its stack, returned and then
+	 * parks repeatedly has its stack compacted while unmounted. The frames below the parks must be
+	 * intact when it resumes, the stack must grow again for another deep call, and a monitor held
+	 * across a park must still be owned afterwards.
+	 */
+	@Test
+	public void test_compactStackAfterDeepCall() {
+		final int depth = 5000;
+		final long expectedSum = 31L * depth * (depth + 1) / 2;
+		try {
+			Object lock = new Object();
+			long[] sums = new long[2];
+			boolean[] checks = new boolean[3];
+			Thread t = Thread.ofVirtual().start(() -> {
+				sums[0] = sumToDepth(depth);
+				checks[0] = parkBelowFrames(20, 32, 1000);
+				sums[1] = sumToDepth(depth);
+				synchronized (lock) {
+					checks[1] = parkBelowFrames(5, 8, 2000);
+					checks[2] = Thread.holdsLock(lock);
+				}
+			});
+			t.join();
+			AssertJUnit.assertEquals(expectedSum, sums[0]);
+			AssertJUnit.assertTrue("Frames below the parks were corrupted", checks[0]);
+			AssertJUnit.assertEquals(expectedSum, sums[1]);
+			AssertJUnit.assertTrue("Frames below the parks holding a monitor were corrupted", checks[1]);
+			AssertJUnit.assertTrue("Monitor was not held after parking", checks[2]);
+		} catch (Exception e) {
+			Assert.fail("Unexpected exception occured : " + e.getMessage(), e);
+		}
+	}
+
 	@Test
 	public void test_verifyJVMTIMacros() {
 		final int JVMTI_VTHREAD_STATE_NEW = 0;
@@ -0,0 +1,184 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.zip.GZIPInputStream;
+
+/**
+ * Sets up the heap for the -Xdump:heap:opts=PHD+STREAM tests.
+ * With "retain", keeps enough objects alive at VM shutdown that their heap dump does not fit in a small spool.
+ * With "oom", allocates until an OutOfMemoryError is thrown so that the dump is taken under memory pressure.
+ * With "verify &lt;file&gt;", checks that a dump written with "retain" is complete and its overflow file is gone.
+ */
+public class HeapDumpMain
+{
+	private static final int RETAINED_OBJECTS = 500000;
+
+	static class Node
+	{
+		Node _next;
+		int _value;
+	}
+
+	private static final String IDENTIFIER = "portable heap dump";
+	private static final int DUMP_END_TAG = 0x03;
+
+	public static Node _retained;
+
+	public static void main(String[] args)
+	{
+		if ((1 == args.length) && "retain".equals(args[0]))
+		{
+			for (int i = 0; i < RETAINED_OBJECTS; i++)
+			{
+				Node node = new Node();
+				node._next = _retained;
+				node._value = i;
+				_retained = node;
+			}
+			System.out.println("Objects retained");
+		}
+		else if ((1 == args.length) && "oom".equals(args[0]))
+		{
+			ArrayList<byte[]> holder = new ArrayList<byte[]>();
+			try
+			{
+				while (true)
+				{
+					holder.add(new byte[1024 * 1024]);
+				}
+			}
+			catch (OutOfMemoryError e)
+			{
+				holder = null;
+				System.out.println("OutOfMemoryError caught");
+			}
+		}
+		else if ((2 == args.length) && "verify".equals(args[0]))
+		{
+			String fileName = args[1];
+			boolean complete = false;
+			try
+			{
+				complete = verify(fileName);
+			}
+			catch (IOException e)
+			{
+				e.printStackTrace();
+			}
+			System.out.println("Heap dump " + fileName + (complete ? " is complete" : " is incomplete"));
+		}
+		else
+		{
+			System.err.println("Usage: HeapDumpMain retain|oom|verify <file>");
+			System.exit(1);
+		}
+	}
+
+	/**
+	 * The class records, including the one of Node, are written after all of the objects,
+	 * so they are only there if the part of the dump that overflowed the spool made it to the file.
+	 */
+	private static boolean verify(String fileName) throws IOException
+	{
+		if (new File(fileName + ".spool").exists())
+		{
+			System.out.println("Overflow file of " + fileName + " was not deleted");
+			return false;
+		}
+
+		byte[] dump = readDump(fileName);
+		byte[] identifier = IDENTIFIER.getBytes(StandardCharsets.US_ASCII);
+		if ((dump.length < (identifier.length + 2)) || (identifier.length != (((dump[0] & 0xFF) << 8) | (dump[1] & 0xFF))))
+		{
+			System.out.println("Missing file identifier");
+			return false;
+		}
+		for (int i = 0; i < identifier.length; i++)
+		{
+			if (identifier[i] != dump[i + 2])
+			{
+				System.out.println("Missing file identifier");
+				return false;
+			}
+		}
+		if (DUMP_END_TAG != dump[dump.length - 1])
+		{
+			System.out.println("Missing dump end tag");
+			return false;
+		}
+		if (!contains(dump, Node.class.getName().replace('.', '/').getBytes(StandardCharsets.US_ASCII)))
+		{
+			System.out.println("Missing class record of " + Node.class.getName());
+			return false;
+		}
+		return true;
+	}
+
+	private static byte[] readDump(String fileName) throws IOException
+	{
+		InputStream in = new FileInputStream(fileName);
+		try
+		{
+			if (fileName.endsWith(".gz"))
+			{
+				in = new GZIPInputStream(in);
+			}
+			ByteArrayOutputStream out = new ByteArrayOutputStream();
+			byte[] buffer = new byte[64 * 1024];
+			int length;
+			while ((length = in.read(buffer)) > 0)
+			{
+				out.write(buffer, 0, length);
+			}
+			return out.toByteArray();
+		}
+		finally
+		{
+			in.close();
+		}
+	}
+
+	private static boolean contains(byte[] data, byte[] pattern)
+	{
+		for (int i = 0; i <= (data.length - pattern.length); i++)
+		{
+			int j = 0;
+			while ((j < pattern.length) && (data[i + j] == pattern[j]))
+			{
+				j++;
+			}
+			if (j == pattern.length)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Keeps many equal but distinct Strings alive while allocating garbage for the specified number of seconds,
+ * so that -XX:+StringDeduplication has candidates to deduplicate, then checks that every String still has
+ * its original contents.
+ */
+public class StringDeduplicationMain
+{
+	private static final int STRING_COUNT = 20000;
+	private static final int DISTINCT_VALUES = 100;
+	private static final String PREFIX = "string deduplication test value ";
+
+	public static Object[] _garbageHolder = new Object[256];
+
+	private static String expectedValue(int index)
+	{
+		return PREFIX + (index % DISTINCT_VALUES);
+	}
+
+	/**
+	 * @param args Takes one argument:  number of seconds to allocate garbage for before checking the Strings.
+	 * This argument is required.  It must be in the range [1-60]
+	 */
+	public static void main(String[] args)
+	{
+		if (1 != args.length)
+		{
+			System.err.println("Missing argument for test run time.  Please specify the number of seconds desired for the test run (in the range [1-60]).");
+			System.exit(1);
+		}
+		int secondsToSpin = Integer.parseInt(args[0]);
+		if ((secondsToSpin < 1) || (secondsToSpin > 60))
+		{
+			System.err.println("Invalid option given for seconds (" + secondsToSpin + ").  Value given must be in the range [1-60].");
+			System.exit(2);
+		}
+
+		/* each String gets its own value array */
+		String[] strings = new String[STRING_COUNT];
+		for (int i = 0; i < STRING_COUNT; i++)
+		{
+			strings[i] = new String(expectedValue(i).toCharArray());
+		}
+
+		long finishTime = System.currentTimeMillis() + (secondsToSpin * 1000);
+		int next = 0;
+		while (System.currentTimeMillis() < finishTime)
+		{
+			_garbageHolder[next] = new byte[1024];
+			next = (next + 1) % _garbageHolder.length;
+		}
+
+		for (int i = 0; i < STRING_COUNT; i++)
+		{
+			String expected = expectedValue(i);
+			if (!expected.equals(strings[i]) || (expected.hashCode() != strings[i].hashCode()))
+			{
+				System.out.println("Test failed: String " + i + " is \"" + strings[i] + "\", expected \"" + expected + "\"");
+				System.exit(3);
+			}
+		}
+		System.out.println("Test passed");
+	}
+}
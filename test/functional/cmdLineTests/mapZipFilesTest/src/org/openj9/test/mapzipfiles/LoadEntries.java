@@ -0,0 +1,76 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test.mapzipfiles;
+
+import java.io.File;
+import java.io.RandomAccessFile;
+import java.nio.file.Files;
+import java.nio.file.StandardCopyOption;
+
+/**
+ * The main class of the generated jars, run with the jar on -Xbootclasspath/a.
+ * Loads EntryA, optionally modifies the jar it was loaded from, then loads EntryB.
+ *
+ * Usage: LoadEntries [rewrite|replace <jar> <replacement jar>]
+ *   rewrite: writes the replacement over the jar in place. The replacement is never
+ *            smaller than the jar, as truncating a mapped jar raises SIGBUS.
+ *   replace: renames a copy of the replacement over the jar.
+ */
+public class LoadEntries {
+	public static void main(String[] args) throws Exception {
+		loadEntry("org.openj9.test.mapzipfiles.EntryA");
+
+		if (args.length == 3) {
+			File jar = new File(args[1]);
+			File replacement = new File(args[2]);
+			if (replacement.length() < jar.length()) {
+				throw new IllegalArgumentException(replacement + " is smaller than " + jar);
+			}
+			if ("rewrite".equals(args[0])) {
+				byte[] bytes = Files.readAllBytes(replacement.toPath());
+				try (RandomAccessFile file = new RandomAccessFile(jar, "rw")) {
+					file.write(bytes);
+				}
+			} else if ("replace".equals(args[0])) {
+				File copy = new File(jar.getPath() + ".tmp");
+				Files.copy(replacement.toPath(), copy.toPath(), StandardCopyOption.REPLACE_EXISTING);
+				Files.move(copy.toPath(), jar.toPath(), StandardCopyOption.REPLACE_EXISTING);
+			} else {
+				throw new IllegalArgumentException(args[0]);
+			}
+			System.out.println("Modified " + jar);
+		}
+
+		loadEntry("org.openj9.test.mapzipfiles.EntryB");
+	}
+
+	private static void loadEntry(String className) throws Exception {
+		Class<?> clazz;
+		try {
+			clazz = Class.forName(className);
+		} catch (Throwable t) {
+			System.out.println(className + " not loaded: " + t.getClass().getName());
+			return;
+		}
+		System.out.println(clazz.getMethod("getMessage").invoke(null));
+	}
+}
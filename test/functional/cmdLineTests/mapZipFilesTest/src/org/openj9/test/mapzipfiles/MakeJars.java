@@ -0,0 +1,162 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test.mapzipfiles;
+
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.Arrays;
+import java.util.zip.CRC32;
+import java.util.zip.ZipEntry;
+import java.util.zip.ZipOutputStream;
+
+/**
+ * Generates the jars read with -XX:+MapZipFiles in the current directory, or deletes them.
+ *
+ * Usage: MakeJars [clean]
+ */
+public class MakeJars {
+	private static final String PACKAGE = "org/openj9/test/mapzipfiles/";
+	private static final String[] CLASSES = { "LoadEntries", "EntryA", "EntryB" };
+	private static final String[] JARS = {
+		"stored.jar", "deflated.jar", "truncated.jar", "corrupt.jar",
+		"rewritten.jar", "rewrite.jar", "replace.jar", "replace.jar.tmp"
+	};
+
+	public static void main(String[] args) throws IOException {
+		for (String jar : JARS) {
+			Files.deleteIfExists(new File(jar).toPath());
+		}
+		if ((args.length > 0) && "clean".equals(args[0])) {
+			return;
+		}
+
+		byte[] stored = makeJar(ZipEntry.STORED, 0);
+		byte[] deflated = makeJar(ZipEntry.DEFLATED, 0);
+		writeFile("stored.jar", stored);
+		writeFile("deflated.jar", deflated);
+
+		/* Cut off the central directory */
+		writeFile("truncated.jar", Arrays.copyOf(deflated, deflated.length / 2));
+
+		/* Replace the compressed data of EntryA with an invalid deflate block type */
+		byte[] corrupt = deflated.clone();
+		int dataStart = findLocalData(corrupt, PACKAGE + "EntryA.class");
+		int dataEnd = findLocalHeader(corrupt, dataStart);
+		Arrays.fill(corrupt, dataStart, dataEnd, (byte)0xFF);
+		writeFile("corrupt.jar", corrupt);
+
+		/* The same classes preceded by a padding entry, so that every entry moves and the jar grows */
+		writeFile("rewritten.jar", makeJar(ZipEntry.DEFLATED, 8192));
+		writeFile("rewrite.jar", deflated);
+		writeFile("replace.jar", deflated);
+	}
+
+	private static byte[] makeJar(int method, int paddingSize) throws IOException {
+		ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+		try (ZipOutputStream out = new ZipOutputStream(bytes)) {
+			if (paddingSize > 0) {
+				byte[] padding = new byte[paddingSize];
+				Arrays.fill(padding, (byte)'.');
+				putEntry(out, "padding.txt", padding, ZipEntry.STORED);
+			}
+			for (String name : CLASSES) {
+				putEntry(out, PACKAGE + name + ".class", readClass(name), method);
+			}
+		}
+		return bytes.toByteArray();
+	}
+
+	private static void putEntry(ZipOutputStream out, String name, byte[] data, int method) throws IOException {
+		ZipEntry entry = new ZipEntry(name);
+		entry.setMethod(method);
+		if (ZipEntry.STORED == method) {
+			CRC32 crc = new CRC32();
+			crc.update(data);
+			entry.setSize(data.length);
+			entry.setCompressedSize(data.length);
+			entry.setCrc(crc.getValue());
+		}
+		out.putNextEntry(entry);
+		out.write(data);
+		out.closeEntry();
+	}
+
+	private static byte[] readClass(String name) throws IOException {
+		try (InputStream in = MakeJars.class.getResourceAsStream("/" + PACKAGE + name + ".class")) {
+			ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+			byte[] buffer = new byte[4096];
+			int count = 0;
+			while ((count = in.read(buffer)) > 0) {
+				bytes.write(buffer, 0, count);
+			}
+			return bytes.toByteArray();
+		}
+	}
+
+	/**
+	 * Returns the offset of the data of the named entry, from its local header.
+	 */
+	private static int findLocalData(byte[] jar, String name) {
+		byte[] nameBytes = name.getBytes(StandardCharsets.UTF_8);
+		for (int header = findLocalHeader(jar, 0); header < jar.length; header = findLocalHeader(jar, header + 4)) {
+			int nameLength = readU16(jar, header + 26);
+			int extraLength = readU16(jar, header + 28);
+			if ((nameLength == nameBytes.length)
+				&& Arrays.equals(nameBytes, Arrays.copyOfRange(jar, header + 30, header + 30 + nameLength))
+			) {
+				return header + 30 + nameLength + extraLength;
+			}
+		}
+		throw new IllegalStateException(name + " not found");
+	}
+
+	/**
+	 * Returns the offset of the next local header or data descriptor signature at or after start,
+	 * or of the central directory if there is none.
+	 */
+	private static int findLocalHeader(byte[] jar, int start) {
+		for (int i = start; i + 4 <= jar.length; i++) {
+			if ((jar[i] == 'P') && (jar[i + 1] == 'K')) {
+				int kind = (jar[i + 2] << 8) | jar[i + 3];
+				if ((kind == 0x0304) || (kind == 0x0708) || (kind == 0x0102)) {
+					return i;
+				}
+			}
+		}
+		return jar.length;
+	}
+
+	private static int readU16(byte[] bytes, int offset) {
+		return (bytes[offset] & 0xFF) | ((bytes[offset + 1] & 0xFF) << 8);
+	}
+
+	private static void writeFile(String name, byte[] bytes) throws IOException {
+		try (FileOutputStream out = new FileOutputStream(name)) {
+			out.write(bytes);
+		}
+	}
+}